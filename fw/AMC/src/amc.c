@@ -85,6 +85,8 @@
 #define AMC_TASK_SLEEP_MS             ( 100 )
 #define AMC_GET_PROJECT_INFO_SLEEP_MS ( 1000 )
 
+#define AMC_STATUS_WORDS_OFFSET       ( HAL_PARTITION_TABLE_SIZE + HAL_RPU_RING_BUFFER_LEN )
+
 
 /******************************************************************************/
 /* Enums                                                                      */
@@ -193,6 +195,16 @@ static void vTaskFuncMain( void );
  */
 static void vConfigurePartitionTable( void );
 
+/**
+ * @brief   Write one of the AMC status words stored in shared memory
+ *
+ * @param   ulWord      Index of the status word (HAL_STATUS_WORD_xxx)
+ * @param   ulValue     Value to write
+ *
+ * @return  N/A
+ */
+static void vSetStatusWord( uint32_t ulWord, uint32_t ulValue );
+
 
 /******************************************************************************/
 /* Local variables                                                            */
@@ -259,6 +271,9 @@ AXC_PROXY_DRIVER_EXTERNAL_DEVICE_CONFIG xDimmDevice =
 
 uint64_t ullAmcInitStatus = 0;
 
+/* Incremented on every main task tick so the AMI can check we are alive without a GCQ request */
+static uint32_t ulHeartbeatCount = 0;
+
 
 /******************************************************************************/
 /* Function implementations                                                   */
@@ -335,6 +350,7 @@ static void vTaskFuncMain( void )
          * of the shared memory with the information needed by the AMI.
          */
         PLL_ERR( AMC_NAME, "Error Main Task has initialisation failures\r\n" );
+        vSetStatusWord( HAL_STATUS_WORD_HEALTH, HAL_AMC_HEALTH_INIT_ERROR );
     }
 
     PLL_INF( AMC_NAME, "ullAmcInitStatus:\n\r" );
@@ -413,6 +429,9 @@ static void vTaskFuncMain( void )
 
     FOREVER
     {
+        /* Drains the log if deferred logging has been enabled (iPLL_SetDeferredMode) */
+        iPLL_FlushDeferredLog();
+        vSetStatusWord( HAL_STATUS_WORD_HEARTBEAT, ++ulHeartbeatCount );
         iOSAL_Task_SleepMs( AMC_TASK_SLEEP_MS );
     }
 }
@@ -1048,8 +1067,8 @@ static void vConfigurePartitionTable( void )
     xPartTable.ulMagicNum                  = HAL_PARTITION_TABLE_MAGIC_NO;
     xPartTable.xRingBuffer.ulRingBufferOff = HAL_PARTITION_TABLE_SIZE;
     xPartTable.xRingBuffer.ulRingBufferLen = HAL_RPU_RING_BUFFER_LEN;
-    xPartTable.xStatus.ulStatusOff         = HAL_PARTITION_TABLE_SIZE + HAL_RPU_RING_BUFFER_LEN;
-    xPartTable.xStatus.ulStatusLen         = sizeof( uint32_t );
+    xPartTable.xStatus.ulStatusOff         = AMC_STATUS_WORDS_OFFSET;
+    xPartTable.xStatus.ulStatusLen         = HAL_STATUS_NUM_WORDS * sizeof( uint32_t );
     xPartTable.xLogMsg.ulLogMsgIndex       = 0;
     xPartTable.xLogMsg.ulLogMsgBufferOff   = xPartTable.xStatus.ulStatusOff + xPartTable.xStatus.ulStatusLen;
     xPartTable.xLogMsg.ulLogMsgBufferLen   = PLL_LOG_BUF_LEN;
@@ -1072,12 +1091,32 @@ static void vConfigurePartitionTable( void )
                               xPartTable.xLogMsg.ulLogMsgBufferLen );
     }
 
+    /*
+     * The heartbeat and health words follow the enable word; AMI versions which
+     * only know about the enable word will ignore them.
+     */
+    vSetStatusWord( HAL_STATUS_WORD_HEARTBEAT, ulHeartbeatCount );
+    vSetStatusWord( HAL_STATUS_WORD_HEALTH, HAL_AMC_HEALTH_OK );
+
     /*
      * AMI is waiting for the status to be set to a value of 0x1, currently we have no
      * concept of stopping/starting the AMC so once initialised this will always be valid
      */
-    pucDestAdd = ( uint8_t* )( HAL_RPU_SHARED_MEMORY_BASE_ADDR + xPartTable.xStatus.ulStatusOff );
-    pvOSAL_MemSet( pucDestAdd, HAL_ENABLE_AMI_COMMS, xPartTable.xStatus.ulStatusLen );
-    HAL_FLUSH_CACHE_DATA( ( HAL_RPU_SHARED_MEMORY_BASE_ADDR + xPartTable.xStatus.ulStatusOff ),
-                          xPartTable.xStatus.ulStatusLen );
+    vSetStatusWord( HAL_STATUS_WORD_ENABLE, HAL_ENABLE_AMI_COMMS );
+}
+
+/**
+ * @brief   Write one of the AMC status words stored in shared memory
+ */
+static void vSetStatusWord( uint32_t ulWord, uint32_t ulValue )
+{
+    uintptr_t ulWordAddr = ( uintptr_t )( HAL_RPU_SHARED_MEMORY_BASE_ADDR +
+                                          AMC_STATUS_WORDS_OFFSET +
+                                          ( ulWord * sizeof( uint32_t ) ) );
+
+    if( HAL_STATUS_NUM_WORDS > ulWord )
+    {
+        *( volatile uint32_t* )ulWordAddr = ulValue;
+        HAL_FLUSH_CACHE_DATA( ulWordAddr, sizeof( uint32_t ) );
+    }
 }
@@ -75,6 +75,9 @@
 /* Value, Max & Average */
 #define SENSOR_RESPONSE_VALUES                  ( 0x3 )
 
+/* Sample count & read latency histogram that follow the min value in a single sensor response */
+#define SENSOR_RESPONSE_STATS_BYTES             ( sizeof( uint64_t ) + ( ASC_STATS_LATENCY_BUCKETS * sizeof( uint32_t ) ) )
+
 #define SENSOR_RESP_BUFFER_SIZE                 ( 512 )
 
 #define TOTAL_POWER_NUM_RECORDS                 ( 1 )
@@ -115,6 +118,7 @@
     DO( ASDM_ERRORS_INIT_OVERALL_FAILED )            \
     DO( ASDM_ERRORS_ASC_GET_SENSORS_FAILED )         \
     DO( ASDM_ERRORS_ASC_GET_SINGLE_SENSOR_FAILED )   \
+    DO( ASDM_ERRORS_ASC_GET_SENSOR_STATS_FAILED )    \
     DO( ASDM_ERRORS_AMI_SENSOR_REQUEST_EMPTY_SDR )   \
     DO( ASDM_ERRORS_AMI_SENSOR_REQUEST_UNKNOWN_API ) \
     DO( ASDM_ERRORS_AMI_SENSOR_REQUEST_FAILED )      \
@@ -1530,6 +1534,7 @@ static int iAscCallback( EVL_SIGNAL *pxSignal )
                 INC_STAT_COUNTER( ASDM_STATS_ASC_SENSOR_OTHER_EVENT )
                 iStatus = OK;
                 break;
+            case ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED:
             case ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING:
                 iStatus = iASC_GetSingleSensorDataById( pxSignal->ucInstance, pxThis->pxAscData );
                 if( OK != iStatus )
@@ -2071,17 +2076,17 @@ static int iPopulateSdr( uint8_t ucIndex,
         ( NULL != pusByteCount ) &&
         ( NULL != pxSdr) )
     {
-        uint8_t ucInBandRepo = 0;
+        AMC_ASDM_SUPPORTED_REPO xInBandRepo = AMC_ASDM_SUPPORTED_REPO_TEMP;
 
         /* We use ASC_PROXY_DRIVER_SENSOR_TYPE_POWER for both single / total power */
         if( ASDM_REPOSITORY_TYPE_TOTAL_POWER == ucRepoType )
         {
-            ucInBandRepo = AMC_ASDM_SUPPORTED_REPO_POWER;
-            iStatus      = OK;
+            xInBandRepo = AMC_ASDM_SUPPORTED_REPO_POWER;
+            iStatus     = OK;
         }
         else
         {
-            iStatus = iMapAsdmRepo( ucRepoType, ( AMC_ASDM_SUPPORTED_REPO* )&ucInBandRepo );
+            iStatus = iMapAsdmRepo( ucRepoType, &xInBandRepo );
         }
 
         if( OK == iStatus )
@@ -2120,7 +2125,7 @@ static int iPopulateSdr( uint8_t ucIndex,
                 uint8_t                ucSnsrUnitsLen = strlen( pcConvertRepoBaseUnitStr[ ucRepoType ] ) + 1;
 
                 pxSdr->xSensorValue.ucLength = ( ucSnsrValueLen & ASDM_RECORD_FIELD_LENGTH_MASK );
-                pxSdr->xSensorValue.ulValue  = pxData->pxReadings[ ucInBandRepo ].ulSensorValue;
+                pxSdr->xSensorValue.ulValue  = pxData->pxReadings[ xInBandRepo ].ulSensorValue;
                 usByteCount                 += ucSnsrValueLen;
 
                 pxSdr->xSensorBaseUnit.ucType   = ASDM_RECORD_FIELD_TYPE_CODE_8_BIT_ASCII;
@@ -2131,7 +2136,7 @@ static int iPopulateSdr( uint8_t ucIndex,
                 pxSdr->xSensorBaseUnit.pucBytesValue[ ucSnsrUnitsLen ] = '\0';
                 usByteCount += ucSnsrUnitsLen;
 
-                iStatus = iMapUnitModifier( pxData->pxReadings[ ucInBandRepo ].xSensorUnitModifier,
+                iStatus = iMapUnitModifier( pxData->pxReadings[ xInBandRepo ].xSensorUnitModifier,
                                             &xSdrUnitMod );
                 if( OK == iStatus )
                 {
@@ -2151,7 +2156,7 @@ static int iPopulateSdr( uint8_t ucIndex,
                 iStatus = iPopulateSdrThresholds( pxData,
                                                   pxSdr,
                                                   ucSnsrValueLen,
-                                                  ucInBandRepo,
+                                                  xInBandRepo,
                                                   &usThresByteCount );
                 if( OK == iStatus )
                 {
@@ -2166,15 +2171,15 @@ static int iPopulateSdr( uint8_t ucIndex,
             {
                 pxSdr->ucSensorStatus = ASDM_SDR_SENSOR_STATUS_PRESENT_VALID;
                 usByteCount          += sizeof( pxSdr->ucSensorStatus );
-                if( ASC_SENSOR_INVALID_VAL != pxData->pxReadings[ ucInBandRepo ].ulMaxSensorValue )
+                if( ASC_SENSOR_INVALID_VAL != pxData->pxReadings[ xInBandRepo ].ulMaxSensorValue )
                 {
-                    pxSdr->ulMaxValue                   = pxData->pxReadings[ ucInBandRepo ].ulMaxSensorValue;
+                    pxSdr->ulMaxValue                   = pxData->pxReadings[ xInBandRepo ].ulMaxSensorValue;
                     pxSdr->ucThresholdSupportedBitMask |= ASDM_SDR_THRESHOLD_SENSOR_AVG_MASK;
                     usByteCount += sizeof( ucSnsrValueLen );
                 }
-                if( ASC_SENSOR_INVALID_VAL != pxData->pxReadings[ ucInBandRepo ].ulAverageSensorValue )
+                if( ASC_SENSOR_INVALID_VAL != pxData->pxReadings[ xInBandRepo ].ulAverageSensorValue )
                 {
-                    pxSdr->ulAverageValue               = pxData->pxReadings[ ucInBandRepo ].ulAverageSensorValue;
+                    pxSdr->ulAverageValue               = pxData->pxReadings[ xInBandRepo ].ulAverageSensorValue;
                     pxSdr->ucThresholdSupportedBitMask |= ASDM_SDR_THRESHOLD_SENSOR_MAX_MASK;
                     usByteCount += sizeof( ucSnsrValueLen );
                 }
@@ -2206,15 +2211,15 @@ static int iPopulateSds( uint8_t ucIndex,
         ( NULL != pusByteCount ) &&
         ( NULL != pxSds ) )
     {
-        uint8_t ucAsdmRepo = 0;
+        AMC_ASDM_SUPPORTED_REPO xAsdmRepo = AMC_ASDM_SUPPORTED_REPO_TEMP;
 
-        iStatus = iMapAsdmRepo( ucRepoType, ( AMC_ASDM_SUPPORTED_REPO* )&ucAsdmRepo );
+        iStatus = iMapAsdmRepo( ucRepoType, &xAsdmRepo );
 
         if( OK == iStatus )
         {
-            uint16_t usByteCount    = 0;
-            uint8_t  ucSnsrValueLen = AMC_ASDM_SENSOR_SIZE_4B;
-            uint8_t  ucSensorTag    = 0;
+            uint16_t            usByteCount    = 0;
+            uint8_t             ucSnsrValueLen = AMC_ASDM_SENSOR_SIZE_4B;
+            ASDM_SDS_SENSOR_TAG xSensorTag     = ASDM_SDS_SENSOR_TAG_BOARD_INFO;
 
             /* 1. Sensor ID */
             pxSds->ucId  = ucIndex + 1;
@@ -2222,19 +2227,19 @@ static int iPopulateSds( uint8_t ucIndex,
 
             /* 2. Sensor Size / Value */
             pxSds->xSensorValue.ucLength = ( ucSnsrValueLen & ASDM_RECORD_FIELD_LENGTH_MASK );
-            pxSds->xSensorValue.ulValue  = pxData->pxReadings[ ucAsdmRepo ].ulSensorValue;
+            pxSds->xSensorValue.ulValue  = pxData->pxReadings[ xAsdmRepo ].ulSensorValue;
             usByteCount                 += ucSnsrValueLen;
 
             /* 4. Sensor Status */
-            pxSds->ucSensorStatus = pxData->pxReadings[ ucAsdmRepo ].xSensorStatus;
+            pxSds->ucSensorStatus = pxData->pxReadings[ xAsdmRepo ].xSensorStatus;
             usByteCount          += sizeof( pxSds->ucSensorStatus );
 
             /* 5. Sensor Tag */
-            iStatus = iMapSensorTag( ( AMC_ASDM_SUPPORTED_REPO )ucAsdmRepo, ( ASDM_SDS_SENSOR_TAG* )&ucSensorTag );
+            iStatus = iMapSensorTag( xAsdmRepo, &xSensorTag );
 
             if( OK == iStatus )
             {
-                pxSds->ucSensorTag = ucSensorTag;
+                pxSds->ucSensorTag = ( uint8_t )xSensorTag;
                 usByteCount       += sizeof( pxSds->ucSensorTag );
             }
             else
@@ -2942,8 +2947,31 @@ static int iPopulateAsdmGetSingleSensorResponse( ASDM_REPOSITORY_TYPE xRepo,
         /* Map the internal repo type from the AMI request */
         iStatus = iMapAsdmRepo( xRepo, &xAsdmRepo );
 
+        if( ( OK == iStatus ) &&
+            ( ucSensorId >= pxThis->pxAsdmSdrInfo[ xAsdmRepo ].xHdr.ucTotalNumRecords ) )
+        {
+            iStatus = ERROR;
+        }
+
         if( OK == iStatus )
         {
+            ASC_PROXY_DRIVER_SENSOR_STATS xStats =
+            {
+                0
+            };
+
+            /*
+             * Taken before the ASDM mutex, the ASC holds its own.
+             * Total power is calculated here rather than read by the ASC so has no statistics.
+             */
+            if( ( AMC_ASDM_SUPPORTED_REPO_TOTAL_POWER > xAsdmRepo ) &&
+                ( OK != iASC_GetSensorStats( pxThis->pxSensorList[ xAsdmRepo ].pucSensorId[ ucSensorId ],
+                                             ( uint8_t )xAsdmRepo,
+                                             &xStats ) ) )
+            {
+                INC_ERROR_COUNTER( ASDM_ERRORS_ASC_GET_SENSOR_STATS_FAILED )
+            }
+
             if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
                                                       OSAL_TIMEOUT_WAIT_FOREVER ) )
             {
@@ -2966,15 +2994,20 @@ static int iPopulateAsdmGetSingleSensorResponse( ASDM_REPOSITORY_TYPE xRepo,
                 usByteCount++;
 
                 /* Sensor Value */
-                ucSensorValueLen = ( pxThis->pxAsdmSdrInfo[ xAsdmRepo ].pxSensorRecord[ ucSensorId ].xSensorName.ucLength
+                ucSensorValueLen = ( pxThis->pxAsdmSdrInfo[ xAsdmRepo ].pxSensorRecord[ ucSensorId ].xSensorValue.ucLength
                                     & ASDM_RECORD_FIELD_LENGTH_MASK );
 
                 ucSensorStatusLen = sizeof( pxThis->pxAsdmSdrInfo[ xAsdmRepo ].pxSensorRecord[ ucSensorId ].ucSensorStatus );
 
-                /* Size of sensor Value + ( Snsr Val + Max Snsr Val + Snsr Avg) + sensor status */
+                /*
+                 * Size of sensor Value + ( Snsr Val + Max Snsr Val + Snsr Avg) + sensor status
+                 * + ( Min Snsr Val + sample count + read latency histogram )
+                 */
                 ucPayloadSize += ( ( sizeof( ucSensorValueLen ) +
                                      ( SENSOR_RESPONSE_VALUES * ucSensorValueLen ) ) +
-                                   ucSensorStatusLen );
+                                   ucSensorStatusLen +
+                                   ucSensorValueLen +
+                                   SENSOR_RESPONSE_STATS_BYTES );
 
                 pucRespBuff[ usByteCount++ ] = ucSensorStatusLen;
                 pvOSAL_MemCpy( &pucRespBuff[ usByteCount ],
@@ -2989,8 +3022,18 @@ static int iPopulateAsdmGetSingleSensorResponse( ASDM_REPOSITORY_TYPE xRepo,
                                &pxThis->pxAsdmSdrInfo[ xAsdmRepo ].pxSensorRecord[ ucSensorId ].ulAverageValue,
                                ucSensorValueLen );
                 usByteCount               += ucSensorValueLen;
-                pucRespBuff[ usByteCount ] = pxThis->pxAsdmSdrInfo[ xAsdmRepo ].pxSensorRecord[ ucSensorId ].ucSensorStatus,
-                usByteCount += ucSensorStatusLen;
+                pucRespBuff[ usByteCount ] = pxThis->pxAsdmSdrInfo[ xAsdmRepo ].pxSensorRecord[ ucSensorId ].ucSensorStatus;
+                usByteCount               += ucSensorStatusLen;
+
+                /* Statistics follow the original response so existing parsers are unaffected */
+                pvOSAL_MemCpy( &pucRespBuff[ usByteCount ], &xStats.ulMinValue, ucSensorValueLen );
+                usByteCount += ucSensorValueLen;
+                pvOSAL_MemCpy( &pucRespBuff[ usByteCount ], &xStats.ullSampleCount, sizeof( xStats.ullSampleCount ) );
+                usByteCount += sizeof( xStats.ullSampleCount );
+                pvOSAL_MemCpy( &pucRespBuff[ usByteCount ],
+                               xStats.pulLatencyHistogram,
+                               sizeof( xStats.pulLatencyHistogram ) );
+                usByteCount += sizeof( xStats.pulLatencyHistogram );
 
                 /* Payload size */
                 pucRespBuff[ ASDM_SDR_RESP_BYTE_SIZE ] = ucPayloadSize;
@@ -758,6 +758,7 @@ static int iAscCallback( EVL_SIGNAL *pxSignal )
             case ASC_PROXY_DRIVER_E_SENSOR_LOWER_WARNING:
             case ASC_PROXY_DRIVER_E_SENSOR_LOWER_CRITICAL:
             case ASC_PROXY_DRIVER_E_SENSOR_LOWER_FATAL:
+            case ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED:
             {
                 break;
             }
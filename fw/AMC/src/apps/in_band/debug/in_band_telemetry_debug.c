@@ -541,6 +541,45 @@ static int iAmiCallbackTestMode( EVL_SIGNAL *pxSignal )
             break;
         }
 
+        case AMI_PROXY_DRIVER_E_MODULE_READ_SG:
+        {
+            AMI_PROXY_MODULE_SG_REQUEST xModuleSgRequest =
+            {
+                0
+            };
+
+            if( OK == iAMI_GetModuleScatterGatherRequest( pxSignal, &xModuleSgRequest ) )
+            {
+                AMI_PROXY_RESULT xResult = AMI_PROXY_RESULT_SUCCESS;
+                PLL_DBG( AMC_IN_BAND_DBG_NAME,
+                         "Module Scatter-Gather Read/Entries : %d Length: 0x%X\r\n",
+                         xModuleSgRequest.usNumEntries,
+                         xModuleSgRequest.ulLength );
+                iStatus = iAMI_SetModuleScatterGatherCompleteResponse( pxSignal, xResult );
+            }
+            break;
+        }
+
+        case AMI_PROXY_DRIVER_E_TASK_PROFILE:
+        {
+            AMI_PROXY_TASK_PROFILE_REQUEST xTaskProfileRequest =
+            {
+                0
+            };
+
+            if( OK == iAMI_GetTaskProfileRequest( pxSignal, &xTaskProfileRequest ) )
+            {
+                AMI_PROXY_TASK_PROFILE_RESPONSE xResponse = { 0 };
+                AMI_PROXY_RESULT xResult = AMI_PROXY_RESULT_SUCCESS;
+                PLL_DBG( AMC_IN_BAND_DBG_NAME,
+                         "Task Profile/Address : 0x%llx Length: 0x%X\r\n",
+                         xTaskProfileRequest.ullAddress,
+                         xTaskProfileRequest.ulLength );
+                iStatus = iAMI_SetTaskProfileCompleteResponse( pxSignal, xResult, &xResponse );
+            }
+            break;
+        }
+
         case AMI_PROXY_DRIVER_E_PDI_DOWNLOAD_START:
         {
             AMI_PROXY_PDI_DOWNLOAD_REQUEST xDownloadRequest =
@@ -58,6 +58,8 @@
         DO( IN_BAND_STATS_AMI_SENSOR_REQUEST_SUCCESS )  \
         DO( IN_BAND_STATS_AMI_EEPROM_RW_REQUEST )       \
         DO( IN_BAND_STATS_AMI_MODULE_RW_REQUEST )       \
+        DO( IN_BAND_STATS_AMI_MODULE_SG_REQUEST )       \
+        DO( IN_BAND_STATS_AMI_TASK_PROFILE_REQUEST )    \
         DO( IN_BAND_STATS_AMI_DEBUG_VERBOSITY_REQUEST ) \
         DO( IN_BAND_STATS_INIT_MUTEX )                  \
         DO( IN_BAND_STATS_TAKE_MUTEX )                  \
@@ -75,6 +77,9 @@
         DO( IN_BAND_ERRORS_AMI_UNSUPPORTED_REPO )           \
         DO( IN_BAND_ERRORS_AMI_EEPROM_RW_UNKNOWN_REQ )      \
         DO( IN_BAND_ERRORS_AMI_MODULE_RW_UNKNOWN_REQ )      \
+        DO( IN_BAND_ERRORS_AMI_MODULE_SG_INVALID_LIST )     \
+        DO( IN_BAND_ERRORS_AMI_MODULE_SG_ENTRY_FAILED )     \
+        DO( IN_BAND_ERRORS_AMI_TASK_PROFILE_FAILED )        \
         DO( IN_BAND_ERRORS_MUTEX_RELEASE_FAILED )           \
         DO( IN_BAND_ERRORS_MUTEX_TAKE_FAILED )              \
         DO( IN_BAND_ERRORS_MALLOC_FAILED )                  \
@@ -124,6 +129,7 @@ typedef struct IN_BAND_PRIVATE_DATA
     uint32_t ulUpperFirewall;
     void     *pvOsalMutexHdl;
     uint64_t ullSharedMemBaseAddr;
+    OSAL_TASK_PROFILE xTaskProfiles[ OSAL_TASK_PROFILE_MAX ];
     uint32_t pulStatCounters[ IN_BAND_STATS_MAX ];
     uint32_t pulErrorCounters[ IN_BAND_ERRORS_MAX ];
     int      iInitialised;
@@ -142,6 +148,11 @@ static IN_BAND_PRIVATE_DATA xLocalData =
     UPPER_FIREWALL, /* ulUpperFirewall */
     NULL,           /* pvOsalMutexHdl */
     0,              /* ullSharedMemBaseAddr*/
+    {
+        {
+            { 0 }
+        }
+    },              /* xTaskProfiles */
     {
         0
     },              /* pulStatCounters */
@@ -453,9 +464,9 @@ static int iAmiCallback( EVL_SIGNAL *pxSignal )
                 switch( xEepromReadWriteRequest.xRequest )
                 {
                     case AMI_PROXY_CMD_RW_REQUEST_READ:
-                        iStatus = iEEPROM_ReadRawValue( pucDestAddr,
-                                                        xEepromReadWriteRequest.ulLength,
-                                                        xEepromReadWriteRequest.ulOffset );
+                        iStatus = iEEPROM_ReadBulk( pucDestAddr,
+                                                    xEepromReadWriteRequest.ulLength,
+                                                    ( uint16_t )xEepromReadWriteRequest.ulOffset );
 
                         /* Flush shared memory so the latest data is available in cache. */
                         HAL_FLUSH_CACHE_DATA(
@@ -470,9 +481,9 @@ static int iAmiCallback( EVL_SIGNAL *pxSignal )
                             xEepromReadWriteRequest.ulLength
                         );
 
-                        iStatus = iEEPROM_WriteRawValue( pucDestAddr,
-                                                         xEepromReadWriteRequest.ulLength,
-                                                         xEepromReadWriteRequest.ulOffset );
+                        iStatus = iEEPROM_WriteBulk( pucDestAddr,
+                                                     xEepromReadWriteRequest.ulLength,
+                                                     ( uint16_t )xEepromReadWriteRequest.ulOffset );
                         break;
                     default:
                         INC_ERROR_COUNTER( IN_BAND_ERRORS_AMI_EEPROM_RW_UNKNOWN_REQ )
@@ -519,8 +530,14 @@ static int iAmiCallback( EVL_SIGNAL *pxSignal )
                         case AMI_PROXY_CMD_RW_REQUEST_READ:
                             if( 1 < xModuleReadWriteRequest.ucLength )
                             {
-                                /* TODO: Implement block read. */
-                                iStatus = ERROR;
+                                /* Block read. */
+                                iStatus = iAXC_GetBytes(
+                                    xModuleReadWriteRequest.ucExDeviceId,
+                                    xModuleReadWriteRequest.ucPage,
+                                    xModuleReadWriteRequest.ucByteOffset,
+                                    xModuleReadWriteRequest.ucLength,
+                                    pucDestAddr
+                                );
                             }
                             else
                             {
@@ -579,6 +596,147 @@ static int iAmiCallback( EVL_SIGNAL *pxSignal )
             break;
         }
 
+        case AMI_PROXY_DRIVER_E_MODULE_READ_SG:
+        {
+            AMI_PROXY_MODULE_SG_REQUEST xModuleSgRequest =
+            {
+                0
+            };
+            INC_STAT_COUNTER( IN_BAND_STATS_AMI_MODULE_SG_REQUEST )
+
+            iStatus = iAMI_GetModuleScatterGatherRequest( pxSignal, &xModuleSgRequest );
+            if( OK == iStatus )
+            {
+                uintptr_t                 ullBaseAddr   = ( pxThis->ullSharedMemBaseAddr + xModuleSgRequest.ullAddress );
+                AMI_PROXY_MODULE_SG_ENTRY *pxEntries    = ( AMI_PROXY_MODULE_SG_ENTRY* )( ullBaseAddr );
+                uint32_t                  ulListSize    = xModuleSgRequest.usNumEntries * sizeof( AMI_PROXY_MODULE_SG_ENTRY );
+                uint32_t                  ulDataOffset  = ulListSize;
+                AMI_PROXY_RESULT          xResult       = AMI_PROXY_RESULT_SUCCESS;
+                int                       i             = 0;
+
+                /* Flush shared memory so the descriptor list written by the host is visible. */
+                HAL_FLUSH_CACHE_DATA( ullBaseAddr, ulListSize );
+
+                if( ( 0 == xModuleSgRequest.usNumEntries ) ||
+                    ( AMI_PROXY_MODULE_SG_MAX_ENTRIES < xModuleSgRequest.usNumEntries ) ||
+                    ( ulListSize > xModuleSgRequest.ulLength ) )
+                {
+                    INC_ERROR_COUNTER( IN_BAND_ERRORS_AMI_MODULE_SG_INVALID_LIST )
+                    xResult = AMI_PROXY_RESULT_INVALID_CONFIGURATION;
+                }
+                else
+                {
+                    /* Check the packed data fits before touching any device */
+                    for( i = 0; i < xModuleSgRequest.usNumEntries; i++ )
+                    {
+                        ulDataOffset += pxEntries[ i ].usLength;
+                    }
+
+                    if( ulDataOffset > xModuleSgRequest.ulLength )
+                    {
+                        INC_ERROR_COUNTER( IN_BAND_ERRORS_AMI_MODULE_SG_INVALID_LIST )
+                        xResult = AMI_PROXY_RESULT_INVALID_CONFIGURATION;
+                    }
+                }
+
+                if( AMI_PROXY_RESULT_SUCCESS == xResult )
+                {
+                    ulDataOffset = ulListSize;
+
+                    for( i = 0; i < xModuleSgRequest.usNumEntries; i++ )
+                    {
+                        AMI_PROXY_MODULE_SG_ENTRY *pxEntry = &pxEntries[ i ];
+
+                        pxEntry->ucResult = AMI_PROXY_RESULT_INVALID_CONFIGURATION;
+
+                        if( OK == iAXC_ValidateRequest( pxEntry->ucExDeviceId,
+                                                        pxEntry->ucPage,
+                                                        pxEntry->ucByteOffset ) )
+                        {
+                            pxEntry->ucResult = AMI_PROXY_RESULT_FAILURE;
+
+                            if( OK == iAXC_GetBytes( pxEntry->ucExDeviceId,
+                                                     pxEntry->ucPage,
+                                                     pxEntry->ucByteOffset,
+                                                     pxEntry->usLength,
+                                                     ( uint8_t* )( ullBaseAddr + ulDataOffset ) ) )
+                            {
+                                pxEntry->ucResult = AMI_PROXY_RESULT_SUCCESS;
+                            }
+                        }
+
+                        if( AMI_PROXY_RESULT_SUCCESS != pxEntry->ucResult )
+                        {
+                            INC_ERROR_COUNTER( IN_BAND_ERRORS_AMI_MODULE_SG_ENTRY_FAILED )
+                        }
+
+                        ulDataOffset += pxEntry->usLength;
+                    }
+
+                    /* Flush shared memory so the results and data are visible to the host. */
+                    HAL_FLUSH_CACHE_DATA( ullBaseAddr, ulDataOffset );
+                }
+
+                iStatus = iAMI_SetModuleScatterGatherCompleteResponse( pxSignal, xResult );
+            }
+            break;
+        }
+
+        case AMI_PROXY_DRIVER_E_TASK_PROFILE:
+        {
+            AMI_PROXY_TASK_PROFILE_REQUEST xTaskProfileRequest =
+            {
+                0
+            };
+            INC_STAT_COUNTER( IN_BAND_STATS_AMI_TASK_PROFILE_REQUEST )
+
+            iStatus = iAMI_GetTaskProfileRequest( pxSignal, &xTaskProfileRequest );
+            if( OK == iStatus )
+            {
+                uintptr_t                       ullBaseAddr     = ( pxThis->ullSharedMemBaseAddr + xTaskProfileRequest.ullAddress );
+                AMI_PROXY_TASK_PROFILE_ENTRY    *pxEntries      = ( AMI_PROXY_TASK_PROFILE_ENTRY* )( ullBaseAddr );
+                AMI_PROXY_TASK_PROFILE_RESPONSE xResponse       = { 0 };
+                AMI_PROXY_RESULT                xResult         = AMI_PROXY_RESULT_FAILURE;
+                uint32_t                        ulNumTasks      = xTaskProfileRequest.ulLength / sizeof( AMI_PROXY_TASK_PROFILE_ENTRY );
+                uint32_t                        i               = 0;
+
+                if( OSAL_TASK_PROFILE_MAX < ulNumTasks )
+                {
+                    ulNumTasks = OSAL_TASK_PROFILE_MAX;
+                }
+
+                if( OSAL_ERRORS_NONE == iOSAL_Task_GetProfile( pxThis->xTaskProfiles, &ulNumTasks ) )
+                {
+                    for( i = 0; i < ulNumTasks; i++ )
+                    {
+                        OSAL_TASK_PROFILE            *pxProfile = &pxThis->xTaskProfiles[ i ];
+                        AMI_PROXY_TASK_PROFILE_ENTRY *pxEntry   = &pxEntries[ i ];
+
+                        pvOSAL_MemSet( pxEntry->cName, 0, sizeof( pxEntry->cName ) );
+                        pvOSAL_MemCpy( pxEntry->cName, pxProfile->pcName, sizeof( pxEntry->cName ) - 1 );
+                        pxEntry->ullRunTimeUs         = pxProfile->ullRunTimeUs;
+                        pxEntry->ulWakeups            = pxProfile->ulWakeups;
+                        pxEntry->ulMaxLoopUs          = pxProfile->ulMaxLoopUs;
+                        pxEntry->ulStackSize          = pxProfile->ulStackSize;
+                        pxEntry->ulStackHighWaterMark = pxProfile->ulStackHighWaterMark;
+                    }
+
+                    /* Flush shared memory so the profiles are visible to the host. */
+                    HAL_FLUSH_CACHE_DATA( ullBaseAddr, ulNumTasks * sizeof( AMI_PROXY_TASK_PROFILE_ENTRY ) );
+
+                    xResponse.ulNumTasks = ulNumTasks;
+                    xResult = AMI_PROXY_RESULT_SUCCESS;
+                }
+                else
+                {
+                    INC_ERROR_COUNTER( IN_BAND_ERRORS_AMI_TASK_PROFILE_FAILED )
+                }
+
+                iStatus = iAMI_SetTaskProfileCompleteResponse( pxSignal, xResult, &xResponse );
+            }
+            break;
+        }
+
         case AMI_PROXY_DRIVER_E_PDI_DOWNLOAD_START:
         {
             AMI_PROXY_PDI_DOWNLOAD_REQUEST xDownloadRequest =
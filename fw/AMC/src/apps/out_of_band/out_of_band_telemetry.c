@@ -53,11 +53,13 @@
         DO( OUT_OF_BAND_STATS_BMC_PDR_REQUEST )           \
         DO( OUT_OF_BAND_STATS_BMC_PDR_INFO_REQUEST )      \
         DO( OUT_OF_BAND_STATS_BMC_UNSUPPORTED_REQUEST )   \
+        DO( OUT_OF_BAND_STATS_ASC_SENSOR_UPDATE_EVENT )   \
         DO( OUT_OF_BAND_STATS_MAX )
 
 #define OUT_OF_BAND_ERRORS( DO )                                         \
         DO( OUT_OF_BAND_ERRORS_INIT_MUTEX_FAILED )                       \
         DO( OUT_OF_BAND_ERRORS_INIT_BIND_BMC_CB_FAILED )                 \
+        DO( OUT_OF_BAND_ERRORS_INIT_BIND_ASC_CB_FAILED )                 \
         DO( OUT_OF_BAND_ERRORS_INIT_OVERALL_FAILED )                     \
         DO( OUT_OF_BAND_ERRORS_MUTEX_RELEASE_FAILED )                    \
         DO( OUT_OF_BAND_ERRORS_MUTEX_TAKE_FAILED )                       \
@@ -65,6 +67,7 @@
         DO( OUT_OF_BAND_ERRORS_BMC_GET_SENSOR_REQUEST_FAILED )           \
         DO( OUT_OF_BAND_ERRORS_ASC_GET_SENSOR_DATA_FAILED )              \
         DO( OUT_OF_BAND_ERRORS_ASC_SET_SENSOR_OPERATIONAL_STATE_FAILED ) \
+        DO( OUT_OF_BAND_ERRORS_BMC_SNAPSHOT_REFRESH_FAILED )             \
         DO( OUT_OF_BAND_ERRORS_MAX )
 
 #define PRINT_STAT_COUNTER( x )  PLL_INF( OUT_OF_BAND_NAME,           \
@@ -150,6 +153,29 @@ static OUT_OF_BAND_PRIVATE_DATA *pxThis = &xLocalData;
  *          ERROR if an error was raised in the callback
  */
 static int iBmcProxyCallback( EVL_SIGNAL *pxSignal );
+static int iAscProxyCallback( EVL_SIGNAL *pxSignal );
+
+
+/******************************************************************************/
+/* Local Function Declarations                                                */
+/******************************************************************************/
+
+/**
+ * @brief   Read a sensor from the ASC for the BMC
+ *
+ * @param   usSensorId      PLDM sensor Id (AMC sensor Id + ( sensor type << 8 ))
+ * @param   pssReading      Pointer to the sensor reading
+ * @param   pucSensorState  Pointer to the sensor operational state
+ * @param   pxResponse      Pointer to the response to return to the BMC
+ *
+ * @return  OK if the sensor was read, ERROR otherwise
+ *
+ * @note    Used both to answer a single request and to refresh the BMC snapshot
+ */
+static int iReadSensorForBmc( uint16_t usSensorId,
+                              int16_t *pssReading,
+                              uint8_t *pucSensorState,
+                              BMC_GET_SENSOR_RESPONSE *pxResponse );
 
 
 /******************************************************************************/
@@ -186,6 +212,20 @@ int iOUT_OF_BAND_TELEMETRY_Initialise( void )
                 iStatus = ERROR;
             }
 
+            if( OK == iStatus )
+            {
+                /* Refresh the BMC sensor snapshot after every ASC sweep */
+                if( OK == iASC_BindCallback( &iAscProxyCallback ) )
+                {
+                    PLL_DBG( OUT_OF_BAND_NAME, "ASC proxy bound\r\n" );
+                }
+                else
+                {
+                    INC_ERROR_COUNTER( OUT_OF_BAND_ERRORS_INIT_BIND_ASC_CB_FAILED )
+                    iStatus = ERROR;
+                }
+            }
+
             if( OK == iStatus )
             {
                 pxThis->iInitialised = TRUE;
@@ -288,65 +328,27 @@ static int iBmcProxyCallback( EVL_SIGNAL *pxSignal )
             {
                 INC_STAT_COUNTER( OUT_OF_BAND_STATS_BMC_SENSOR_INFO_REQUEST )
 
-                int16_t ssSensorDataResponse = 0;
-                int16_t ssSensorId = 0;
-                ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS ucSensorOperationalState = 0;
-                uint32_t ulSensorType = 0;
+                int16_t                 ssSensorDataResponse     = 0;
+                int16_t                 ssSensorId               = 0;
+                uint8_t                 ucSensorOperationalState = 0;
+                BMC_GET_SENSOR_RESPONSE xSensorResponse          = BMC_GET_SENSOR_RESP_INVALID_SENSOR_ID;
 
                 /* call into BMC Proxy to get required sensor id */
-                if( OK != iBMC_GetSensorIdRequest( pxSignal, &ssSensorId, ( uint8_t * )&ucSensorOperationalState ) )
+                if( OK != iBMC_GetSensorIdRequest( pxSignal, &ssSensorId, &ucSensorOperationalState ) )
                 {
                     INC_ERROR_COUNTER( OUT_OF_BAND_ERRORS_BMC_GET_SENSOR_REQUEST_FAILED )
                 }
                 else
                 {
-                    uint32_t ulSensorId = 0;
-
-                    ASC_PROXY_DRIVER_SENSOR_DATA xSensorData =
-                    {
-                        0
-                    };
-
-                    /* decode PLDM sensor ID to AMC ID */
-                    ulSensorId = ssSensorId & 0xFF;
-
-                    BMC_GET_SENSOR_RESPONSE xSensorResponse = BMC_GET_SENSOR_RESP_INVALID_SENSOR_ID;
-                    if( OK != iASC_GetSingleSensorDataById( ulSensorId, &xSensorData ) )
-                    {
-                        INC_ERROR_COUNTER( OUT_OF_BAND_ERRORS_ASC_GET_SENSOR_DATA_FAILED );
-                        iBMC_SendResponseForGetSensor( pxSignal,
-                                                       ssSensorId,
-                                                       ssSensorDataResponse,
-                                                       ucSensorOperationalState,
-                                                       xSensorResponse );
-                    }
-                    else
-                    {
-                        ulSensorType = ssSensorId >> 8;
-
-                        if( OK != iASC_GetSingleSensorOperationalStateById( ulSensorId,
-                                                                            ulSensorType,
-                                                                            &ucSensorOperationalState ) )
-                        {
-                            INC_ERROR_COUNTER( OUT_OF_BAND_ERRORS_ASC_GET_SENSOR_DATA_FAILED );
-                            iBMC_SendResponseForGetSensor( pxSignal,
-                                                           ssSensorId,
-                                                           ssSensorDataResponse,
-                                                           ucSensorOperationalState,
-                                                           xSensorResponse );
-                        }
-                        else
-                        {
-                            ssSensorDataResponse =
-                                ( int16_t )xSensorData.pxReadings[ ulSensorType ].ulSensorValue;
-                            xSensorResponse = BMC_GET_SENSOR_RESP_OK;
-                            iBMC_SendResponseForGetSensor( pxSignal,
-                                                           ssSensorId,
-                                                           ssSensorDataResponse,
-                                                           ucSensorOperationalState,
-                                                           xSensorResponse );
-                        }
-                    }
+                    ( void )iReadSensorForBmc( ( uint16_t )ssSensorId,
+                                               &ssSensorDataResponse,
+                                               &ucSensorOperationalState,
+                                               &xSensorResponse );
+                    iBMC_SendResponseForGetSensor( pxSignal,
+                                                   ssSensorId,
+                                                   ssSensorDataResponse,
+                                                   ucSensorOperationalState,
+                                                   xSensorResponse );
                 }
                 break;
 
@@ -410,3 +412,82 @@ static int iBmcProxyCallback( EVL_SIGNAL *pxSignal )
 
     return iStatus;
 }
+
+/**
+ * @brief   ASC Proxy Driver EVL callback
+ */
+static int iAscProxyCallback( EVL_SIGNAL *pxSignal )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pxSignal ) && ( AMC_CFG_UNIQUE_ID_ASC == pxSignal->ucModule ) )
+    {
+        iStatus = OK;
+
+        if( ASC_PROXY_DRIVER_E_SENSOR_UPDATE_COMPLETE == pxSignal->ucEventType )
+        {
+            INC_STAT_COUNTER( OUT_OF_BAND_STATS_ASC_SENSOR_UPDATE_EVENT )
+
+            if( OK != iBMC_RefreshSensorSnapshot( &iReadSensorForBmc ) )
+            {
+                INC_ERROR_COUNTER( OUT_OF_BAND_ERRORS_BMC_SNAPSHOT_REFRESH_FAILED )
+                iStatus = ERROR;
+            }
+        }
+    }
+
+    return iStatus;
+}
+
+
+/******************************************************************************/
+/* Local Function Implementations                                             */
+/******************************************************************************/
+
+/**
+ * @brief   Read a sensor from the ASC for the BMC
+ */
+static int iReadSensorForBmc( uint16_t usSensorId,
+                              int16_t *pssReading,
+                              uint8_t *pucSensorState,
+                              BMC_GET_SENSOR_RESPONSE *pxResponse )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pssReading ) &&
+        ( NULL != pucSensorState ) &&
+        ( NULL != pxResponse ) )
+    {
+        ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS xOperationalState = 0;
+        ASC_PROXY_DRIVER_SENSOR_DATA xSensorData =
+        {
+            0
+        };
+
+        /* decode PLDM sensor ID to AMC ID */
+        uint32_t ulSensorId   = usSensorId & 0xFF;
+        uint32_t ulSensorType = usSensorId >> 8;
+
+        *pxResponse = BMC_GET_SENSOR_RESP_INVALID_SENSOR_ID;
+
+        if( OK != iASC_GetSingleSensorDataById( ulSensorId, &xSensorData ) )
+        {
+            INC_ERROR_COUNTER( OUT_OF_BAND_ERRORS_ASC_GET_SENSOR_DATA_FAILED );
+        }
+        else if( OK != iASC_GetSingleSensorOperationalStateById( ulSensorId,
+                                                                 ulSensorType,
+                                                                 &xOperationalState ) )
+        {
+            INC_ERROR_COUNTER( OUT_OF_BAND_ERRORS_ASC_GET_SENSOR_DATA_FAILED );
+        }
+        else
+        {
+            *pssReading     = ( int16_t )xSensorData.pxReadings[ ulSensorType ].ulSensorValue;
+            *pucSensorState = ( uint8_t )xOperationalState;
+            *pxResponse     = BMC_GET_SENSOR_RESP_OK;
+            iStatus         = OK;
+        }
+    }
+
+    return iStatus;
+}
@@ -0,0 +1,563 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains microbenchmarks of the core AMC primitives (EVL, PLL,
+ * OSAL and the ASDM response builder) running on the Linux profile.
+ *
+ * Results are printed as one whitespace separated row per benchmark under a
+ * fixed header, so runs from different commits can be compared directly.
+ *
+ * @file amc_bench.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "standard.h"
+#include "osal.h"
+#include "pll.h"
+#include "evl.h"
+#include "asdm.h"
+#include "eeprom.h"
+#include "asc_proxy_driver.h"
+#include "apc_proxy_driver.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define BENCH_NAME                  "BENCH"
+
+#define BENCH_TASK_STACK            ( 0x4000 )
+#define BENCH_TASK_PRIO             ( 6 )
+
+#define BENCH_ITERATIONS            ( 200000 )
+#define BENCH_ASDM_ITERATIONS       ( 20000 )
+#define BENCH_WARMUP_DIVISOR        ( 10 )
+
+#define BENCH_NAME_LEN              ( 32 )
+#define BENCH_MEMCPY_MAX_SIZE       ( 4096 )
+#define BENCH_ASDM_RESP_SIZE        ( 4096 )
+
+#define BENCH_NUM_TEMP_SENSORS      ( 8 )
+#define BENCH_NUM_RAIL_SENSORS      ( 8 )
+#define BENCH_NUM_SENSORS           ( BENCH_NUM_TEMP_SENSORS + BENCH_NUM_RAIL_SENSORS )
+
+#define BENCH_NS_PER_S              ( 1000000000ULL )
+
+/* A present, valid reading with limits that are never crossed */
+#define BENCH_READING( val )                                                \
+    {                                                                       \
+        .ulSensorValue            = ( val ),                                \
+        .ulUpperWarningLimit      = 0xFFFFFFF0,                             \
+        .ulUpperCriticalLimit     = 0xFFFFFFF8,                             \
+        .ulUpperFatalLimit        = 0xFFFFFFFF,                             \
+        .ulAverageSensorValue     = ( val ),                                \
+        .ulMaxSensorValue         = ( val ),                                \
+        .xSensorStatus            = ASC_PROXY_DRIVER_SENSOR_STATUS_PRESENT_AND_VALID, \
+        .xSensorOperationalStatus = ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED, \
+        .xSensorUnitModifier      = ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_NONE   \
+    }
+
+#define BENCH_TEMP_SENSOR( name, id )                                       \
+    {                                                                       \
+        .pcSensorName = name,                                               \
+        .ucSensorId   = ( id ),                                             \
+        .ucSensorType = ASC_PROXY_DRIVER_SENSOR_BITFIELD_TEMPERATURE,       \
+        .pxSensorEnabled = &iSensorEnabled,                                 \
+        .pxReadings   =                                                     \
+        {                                                                   \
+            [ ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE ] = BENCH_READING( 40 + ( id ) ) \
+        }                                                                   \
+    }
+
+#define BENCH_RAIL_SENSOR( name, id )                                       \
+    {                                                                       \
+        .pcSensorName = name,                                               \
+        .ucSensorId   = ( id ),                                             \
+        .ucSensorType = ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE |          \
+                        ASC_PROXY_DRIVER_SENSOR_BITFIELD_CURRENT |          \
+                        ASC_PROXY_DRIVER_SENSOR_BITFIELD_POWER,             \
+        .pxSensorEnabled = &iSensorEnabled,                                 \
+        .pxReadings   =                                                     \
+        {                                                                   \
+            [ ASC_PROXY_DRIVER_SENSOR_TYPE_VOLTAGE ] = BENCH_READING( 12000 ), \
+            [ ASC_PROXY_DRIVER_SENSOR_TYPE_CURRENT ] = BENCH_READING( 2000 + ( id ) ), \
+            [ ASC_PROXY_DRIVER_SENSOR_TYPE_POWER ]   = BENCH_READING( 24 + ( id ) ) \
+        }                                                                   \
+    }
+
+
+/*****************************************************************************/
+/* Typedefs                                                                  */
+/*****************************************************************************/
+
+/* A single timed operation - returns OK or ERROR */
+typedef int ( BENCH_FUNC )( void *pvArg );
+
+
+/*****************************************************************************/
+/* Function declarations                                                     */
+/*****************************************************************************/
+
+static int iSensorEnabled( void );
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static ASC_PROXY_DRIVER_SENSOR_DATA pxSensors[ BENCH_NUM_SENSORS ] =
+{
+    BENCH_TEMP_SENSOR( "PCB_TOP_FRONT",  0 ),
+    BENCH_TEMP_SENSOR( "PCB_TOP_REAR",   1 ),
+    BENCH_TEMP_SENSOR( "PCB_BTM_FRONT",  2 ),
+    BENCH_TEMP_SENSOR( "DEVICE",         3 ),
+    BENCH_TEMP_SENSOR( "VCCINT_TEMP",    4 ),
+    BENCH_TEMP_SENSOR( "QSFP_0",         5 ),
+    BENCH_TEMP_SENSOR( "QSFP_1",         6 ),
+    BENCH_TEMP_SENSOR( "DIMM",           7 ),
+    BENCH_RAIL_SENSOR( "12V_PEX",        8 ),
+    BENCH_RAIL_SENSOR( "3V3_PEX",        9 ),
+    BENCH_RAIL_SENSOR( "12V_AUX_0",     10 ),
+    BENCH_RAIL_SENSOR( "12V_AUX_1",     11 ),
+    BENCH_RAIL_SENSOR( "VCCINT",        12 ),
+    BENCH_RAIL_SENSOR( "VCC_HBM",       13 ),
+    BENCH_RAIL_SENSOR( "VCC_1V2",       14 ),
+    BENCH_RAIL_SENSOR( "VCC_SOC",       15 )
+};
+
+static uint8_t  pucSrc[ BENCH_MEMCPY_MAX_SIZE ]      = { 0 };
+static uint8_t  pucDst[ BENCH_MEMCPY_MAX_SIZE ]      = { 0 };
+static uint8_t  pucAsdmResp[ BENCH_ASDM_RESP_SIZE ] = { 0 };
+
+static void *pvBenchMutex = NULL;
+static void *pvBenchMBox  = NULL;
+
+/* Stops the compiler discarding the results */
+static volatile uint32_t ulSink = 0;
+
+
+/*****************************************************************************/
+/* Stubs                                                                     */
+/*****************************************************************************/
+
+/*
+ * ASDM is linked on its own, so the proxy drivers and EEPROM it reads at
+ * initialisation are replaced with a fixed sensor table and board info.
+ */
+
+static int iSensorEnabled( void )
+{
+    return TRUE;
+}
+
+int iASC_BindCallback( EVL_CALLBACK *pxCallback )
+{
+    return OK;
+}
+
+int iASC_GetAllSensorData( ASC_PROXY_DRIVER_SENSOR_DATA *pxData, uint8_t *pucNumSensors )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pxData ) && ( NULL != pucNumSensors ) && ( BENCH_NUM_SENSORS <= *pucNumSensors ) )
+    {
+        memcpy( pxData, pxSensors, sizeof( pxSensors ) );
+        *pucNumSensors = BENCH_NUM_SENSORS;
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+int iASC_GetSingleSensorDataById( uint8_t ucId, ASC_PROXY_DRIVER_SENSOR_DATA *pxData )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pxData ) && ( BENCH_NUM_SENSORS > ucId ) )
+    {
+        memcpy( pxData, &pxSensors[ ucId ], sizeof( pxSensors[ ucId ] ) );
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+int iASC_GetSensorStats( uint8_t ucId, uint8_t ucSensorType, ASC_PROXY_DRIVER_SENSOR_STATS *pxStats )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pxStats ) && ( BENCH_NUM_SENSORS > ucId ) )
+    {
+        memset( pxStats, 0, sizeof( *pxStats ) );
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+int iAPC_BindCallback( EVL_CALLBACK *pxCallback )
+{
+    return OK;
+}
+
+int iAPC_GetFptHeader( APC_BOOT_DEVICES xBootDevice, APC_PROXY_DRIVER_FPT_HEADER *pxFptHeader )
+{
+    int iStatus = ERROR;
+
+    if( NULL != pxFptHeader )
+    {
+        memset( pxFptHeader, 0, sizeof( *pxFptHeader ) );
+        pxFptHeader->ucNumEntries = 1;
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+int iAPC_GetFptPartition( APC_BOOT_DEVICES xBootDevice, int iPartition, APC_PROXY_DRIVER_FPT_PARTITION *pxFptPartition )
+{
+    int iStatus = ERROR;
+
+    if( NULL != pxFptPartition )
+    {
+        memset( pxFptPartition, 0, sizeof( *pxFptPartition ) );
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+static int iEepromField( uint8_t *pucField, uint8_t *pucSizeBytes )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pucField ) && ( NULL != pucSizeBytes ) )
+    {
+        memcpy( pucField, "BENCH", sizeof( "BENCH" ) );
+        *pucSizeBytes = sizeof( "BENCH" ) - 1;
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+int iEEPROM_GetEepromVersion( uint8_t *pucField, uint8_t *pucSizeBytes )    { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetProductName( uint8_t *pucField, uint8_t *pucSizeBytes )      { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetProductRevision( uint8_t *pucField, uint8_t *pucSizeBytes )  { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetSerialNumber( uint8_t *pucField, uint8_t *pucSizeBytes )     { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetMacAddressCount( uint8_t *pucField, uint8_t *pucSizeBytes )  { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetFirstMacAddress( uint8_t *pucField, uint8_t *pucSizeBytes )  { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetActiveState( uint8_t *pucField, uint8_t *pucSizeBytes )      { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetConfigMode( uint8_t *pucField, uint8_t *pucSizeBytes )       { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetManufacturingDate( uint8_t *pucField, uint8_t *pucSizeBytes ) { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetPartNumber( uint8_t *pucField, uint8_t *pucSizeBytes )       { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetMfgPartNumber( uint8_t *pucField, uint8_t *pucSizeBytes )    { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetUuid( uint8_t *pucField, uint8_t *pucSizeBytes )             { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetPcieId( uint8_t *pucField, uint8_t *pucSizeBytes )           { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetMaxPowerMode( uint8_t *pucField, uint8_t *pucSizeBytes )     { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetMemorySize( uint8_t *pucField, uint8_t *pucSizeBytes )       { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetOemId( uint8_t *pucField, uint8_t *pucSizeBytes )            { return iEepromField( pucField, pucSizeBytes ); }
+int iEEPROM_GetCapability( uint8_t *pucField, uint8_t *pucSizeBytes )       { return iEepromField( pucField, pucSizeBytes ); }
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static uint64_t ullNowNs( void )
+{
+    struct timespec xTs = { 0 };
+
+    clock_gettime( CLOCK_MONOTONIC, &xTs );
+
+    return ( ( uint64_t )xTs.tv_sec * BENCH_NS_PER_S ) + xTs.tv_nsec;
+}
+
+/**
+ * @brief   Time an operation and print its row
+ *
+ * @param   pcName          Benchmark name - the first column
+ * @param   pxFunc          Operation to time
+ * @param   pvArg           Argument passed to every call
+ * @param   ulIterations    Number of timed calls
+ *
+ * @return  OK if every call succeeded, else ERROR
+ */
+static int iRunBench( const char *pcName, BENCH_FUNC *pxFunc, void *pvArg, uint32_t ulIterations )
+{
+    int      iStatus  = OK;
+    uint64_t ullStart = 0;
+    uint64_t ullNs    = 0;
+    uint32_t i        = 0;
+
+    for( i = 0; i < ( ulIterations / BENCH_WARMUP_DIVISOR ); i++ )
+    {
+        iStatus |= pxFunc( pvArg );
+    }
+
+    ullStart = ullNowNs();
+    for( i = 0; i < ulIterations; i++ )
+    {
+        iStatus |= pxFunc( pvArg );
+    }
+    ullNs = ullNowNs() - ullStart;
+
+    if( OK == iStatus )
+    {
+        printf( "%-32s %12u %12.1f\n", pcName, ulIterations, ( double )ullNs / ulIterations );
+    }
+    else
+    {
+        printf( "%-32s %12u %12s\n", pcName, ulIterations, "FAILED" );
+        iStatus = ERROR;
+    }
+
+    return iStatus;
+}
+
+
+/*****************************************************************************/
+/* Operations                                                                */
+/*****************************************************************************/
+
+static int iEvlCallback( EVL_SIGNAL *pxSignal )
+{
+    ulSink += pxSignal->ucEventType;
+
+    return OK;
+}
+
+static int iEvlRaise( void *pvArg )
+{
+    EVL_SIGNAL xSignal = { 0 };
+
+    xSignal.ucModule    = 0xFF;
+    xSignal.ucEventType = 1;
+
+    return iEVL_RaiseEvent( ( EVL_RECORD * )pvArg, &xSignal );
+}
+
+static int iPllDebug( void *pvArg )
+{
+    PLL_DBG( BENCH_NAME, "sensor %d reading %u\r\n", ( int )ulSink, ( uint32_t )( uintptr_t )pvArg );
+
+    return OK;
+}
+
+static int iOsalMemCpy( void *pvArg )
+{
+    uint16_t usSize = ( uint16_t )( uintptr_t )pvArg;
+
+    pvOSAL_MemCpy( pucDst, pucSrc, usSize );
+    ulSink += pucDst[ usSize - 1 ];
+
+    return OK;
+}
+
+static int iOsalMBox( void *pvArg )
+{
+    int      iStatus = ERROR;
+    uint32_t ulItem  = ulSink;
+
+    if( ( OSAL_ERRORS_NONE == iOSAL_MBox_Post( pvBenchMBox, &ulItem, OSAL_TIMEOUT_NO_WAIT ) ) &&
+        ( OSAL_ERRORS_NONE == iOSAL_MBox_Pend( pvBenchMBox, &ulItem, OSAL_TIMEOUT_NO_WAIT ) ) )
+    {
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+static int iOsalMutex( void *pvArg )
+{
+    int iStatus = ERROR;
+
+    if( ( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pvBenchMutex, OSAL_TIMEOUT_WAIT_FOREVER ) ) &&
+        ( OSAL_ERRORS_NONE == iOSAL_Mutex_Release( pvBenchMutex ) ) )
+    {
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+static int iAsdmGetAll( void *pvArg )
+{
+    int      iStatus = ERROR;
+    uint16_t usSize  = sizeof( pucAsdmResp );
+
+    iStatus = iASDM_PopulateResponse( ASDM_API_ID_TYPE_GET_ALL_SENSOR_DATA,
+                                      ( ASDM_REPOSITORY_TYPE )( uintptr_t )pvArg,
+                                      0,
+                                      pucAsdmResp,
+                                      &usSize );
+    ulSink += usSize;
+
+    return iStatus;
+}
+
+
+/*****************************************************************************/
+/* Benchmarks                                                                */
+/*****************************************************************************/
+
+/**
+ * @brief   Raise an event on records with 1, 4 and 16 bound callbacks
+ *
+ * @note    A record holds at most EVL_MAX_BINDINGS callbacks, so larger
+ *          counts are clamped and the row is named after the real count.
+ */
+static int iBenchEvl( void )
+{
+    int      iStatus      = OK;
+    uint32_t pulCounts[ ] = { 1, 4, 16 };
+    uint32_t i            = 0;
+    uint32_t j            = 0;
+
+    for( i = 0; i < ( sizeof( pulCounts ) / sizeof( pulCounts[ 0 ] ) ); i++ )
+    {
+        EVL_RECORD *pxRecord            = NULL;
+        char       pcName[ BENCH_NAME_LEN ] = { 0 };
+        uint32_t   ulCount              = MIN( pulCounts[ i ], EVL_MAX_BINDINGS );
+
+        if( OK != iEVL_CreateRecord( &pxRecord ) )
+        {
+            iStatus = ERROR;
+            continue;
+        }
+
+        for( j = 0; j < ulCount; j++ )
+        {
+            iStatus |= iEVL_BindCallback( pxRecord, &iEvlCallback );
+        }
+
+        snprintf( pcName, sizeof( pcName ), "evl_raise_%u_callbacks", ulCount );
+        iStatus |= iRunBench( pcName, iEvlRaise, pxRecord, BENCH_ITERATIONS );
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Time a debug message that is filtered out and one that is
+ *          formatted into the log (but not printed)
+ */
+static int iBenchPll( void )
+{
+    int iStatus = OK;
+
+    iStatus |= iPLL_SetOutputLevel( PLL_OUTPUT_LEVEL_LOGGING );
+    iStatus |= iPLL_SetLoggingLevel( PLL_OUTPUT_LEVEL_LOGGING );
+    iStatus |= iRunBench( "pll_output_disabled", iPllDebug, NULL, BENCH_ITERATIONS );
+
+    iStatus |= iPLL_SetLoggingLevel( PLL_OUTPUT_LEVEL_DEBUG );
+    iStatus |= iRunBench( "pll_output_enabled", iPllDebug, NULL, BENCH_ITERATIONS );
+
+    iStatus |= iPLL_SetLoggingLevel( PLL_OUTPUT_LEVEL_LOGGING );
+
+    return iStatus;
+}
+
+static int iBenchOsal( void )
+{
+    int      iStatus     = OK;
+    uint32_t pulSizes[ ] = { 16, 256, BENCH_MEMCPY_MAX_SIZE };
+    uint32_t i           = 0;
+
+    for( i = 0; i < ( sizeof( pulSizes ) / sizeof( pulSizes[ 0 ] ) ); i++ )
+    {
+        char pcName[ BENCH_NAME_LEN ] = { 0 };
+
+        snprintf( pcName, sizeof( pcName ), "osal_memcpy_%u", pulSizes[ i ] );
+        iStatus |= iRunBench( pcName, iOsalMemCpy, ( void * )( uintptr_t )pulSizes[ i ], BENCH_ITERATIONS );
+    }
+
+    iStatus |= iRunBench( "osal_mbox_post_pend", iOsalMBox, NULL, BENCH_ITERATIONS );
+    iStatus |= iRunBench( "osal_mutex_take_release", iOsalMutex, NULL, BENCH_ITERATIONS );
+
+    return iStatus;
+}
+
+static int iBenchAsdm( void )
+{
+    int iStatus = OK;
+
+    iStatus |= iRunBench( "asdm_get_all_temp", iAsdmGetAll,
+                          ( void * )ASDM_REPOSITORY_TYPE_TEMP, BENCH_ASDM_ITERATIONS );
+    iStatus |= iRunBench( "asdm_get_all_voltage", iAsdmGetAll,
+                          ( void * )ASDM_REPOSITORY_TYPE_VOLTAGE, BENCH_ASDM_ITERATIONS );
+    iStatus |= iRunBench( "asdm_get_all_current", iAsdmGetAll,
+                          ( void * )ASDM_REPOSITORY_TYPE_CURRENT, BENCH_ASDM_ITERATIONS );
+    iStatus |= iRunBench( "asdm_get_all_power", iAsdmGetAll,
+                          ( void * )ASDM_REPOSITORY_TYPE_POWER, BENCH_ASDM_ITERATIONS );
+
+    return iStatus;
+}
+
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+/**
+ * @brief   Start task - the OSAL calls are only valid once the OS is running
+ */
+static void vBenchTask( void )
+{
+    int      iStatus = OK;
+    uint32_t i       = 0;
+
+    /* The start task can run before the OSAL has marked the OS as started */
+    while( OSAL_ERRORS_OS_NOT_STARTED == iOSAL_Mutex_Create( &pvBenchMutex, "bench mutex" ) )
+    {
+        iOSAL_Task_SleepMs( 1 );
+    }
+
+    for( i = 0; i < BENCH_MEMCPY_MAX_SIZE; i++ )
+    {
+        pucSrc[ i ] = ( uint8_t )i;
+    }
+
+    if( ( NULL == pvBenchMutex ) ||
+        ( OSAL_ERRORS_NONE != iOSAL_MBox_Create( &pvBenchMBox, 1, sizeof( uint32_t ), "bench mbox" ) ) ||
+        ( OK != iPLL_Initialise( PLL_OUTPUT_LEVEL_LOGGING, PLL_OUTPUT_LEVEL_LOGGING ) ) ||
+        ( OK != iEVL_Initialise() ) ||
+        ( OK != iASDM_Initialise( BENCH_NUM_SENSORS ) ) )
+    {
+        printf( "initialisation failed\n" );
+        exit( 1 );
+    }
+
+    printf( "%-32s %12s %12s\n", "benchmark", "iterations", "ns_per_op" );
+
+    iStatus |= iBenchEvl();
+    iStatus |= iBenchPll();
+    iStatus |= iBenchOsal();
+    iStatus |= iBenchAsdm();
+
+    fflush( stdout );
+    exit( ( OK == iStatus ) ? 0 : 1 );
+}
+
+int main( void )
+{
+    void *pvTaskHandle = NULL;
+
+    iOSAL_StartOS( TRUE, &pvTaskHandle, &vBenchTask, BENCH_TASK_STACK, BENCH_TASK_PRIO );
+
+    printf( "failed to start the OS\n" );
+
+    return 1;
+}
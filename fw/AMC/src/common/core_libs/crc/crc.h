@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains the public API for the CRC Library
+ *
+ * CRC32 is the IEEE 802.3 CRC (reflected polynomial 0xEDB88320, initial
+ * value and final XOR 0xFFFFFFFF), as used by PLDM.
+ * CRC8 is the SMBus CRC (polynomial 0x07, initial value 0, no final XOR),
+ * as used by PLDM PDRs and SMBus PEC.
+ *
+ * @file crc.h
+ *
+ */
+
+#ifndef _CRC_H_
+#define _CRC_H_
+
+/******************************************************************************/
+/* Includes                                                                   */
+/******************************************************************************/
+
+#include "standard.h"
+
+
+/******************************************************************************/
+/* Public function declarations                                               */
+/******************************************************************************/
+
+/**
+ * @brief   Start a CRC32 calculation
+ *
+ * @return  The initial CRC32 state, to pass to ulCRC_Crc32Update
+ */
+uint32_t ulCRC_Crc32Init( void );
+
+/**
+ * @brief   Add data to a CRC32 calculation
+ *
+ * @param   ulCrc       Current CRC32 state
+ * @param   pucData     Pointer to the data
+ * @param   ulLength    Number of bytes of data
+ *
+ * @return  The updated CRC32 state
+ *
+ * @note    Data may be supplied in any number of calls of any length
+ */
+uint32_t ulCRC_Crc32Update( uint32_t ulCrc, const uint8_t *pucData, uint32_t ulLength );
+
+/**
+ * @brief   Finish a CRC32 calculation
+ *
+ * @param   ulCrc       Current CRC32 state
+ *
+ * @return  The CRC32 of all the data added
+ */
+uint32_t ulCRC_Crc32Final( uint32_t ulCrc );
+
+/**
+ * @brief   Get a CRC32 for supplied data
+ *
+ * @param   pucData     Pointer to the data
+ * @param   ulLength    Number of bytes of data
+ *
+ * @return  The CRC32 of the data
+ */
+uint32_t ulCRC_Crc32( const uint8_t *pucData, uint32_t ulLength );
+
+/**
+ * @brief   Start a CRC8 calculation
+ *
+ * @return  The initial CRC8 state, to pass to ucCRC_Crc8Update
+ */
+uint8_t ucCRC_Crc8Init( void );
+
+/**
+ * @brief   Add data to a CRC8 calculation
+ *
+ * @param   ucCrc       Current CRC8 state
+ * @param   pucData     Pointer to the data
+ * @param   ulLength    Number of bytes of data
+ *
+ * @return  The updated CRC8 state
+ *
+ * @note    Data may be supplied in any number of calls of any length
+ */
+uint8_t ucCRC_Crc8Update( uint8_t ucCrc, const uint8_t *pucData, uint32_t ulLength );
+
+/**
+ * @brief   Finish a CRC8 calculation
+ *
+ * @param   ucCrc       Current CRC8 state
+ *
+ * @return  The CRC8 of all the data added
+ */
+uint8_t ucCRC_Crc8Final( uint8_t ucCrc );
+
+/**
+ * @brief   Get a CRC8 for supplied data
+ *
+ * @param   pucData     Pointer to the data
+ * @param   ulLength    Number of bytes of data
+ *
+ * @return  The CRC8 of the data
+ */
+uint8_t ucCRC_Crc8( const uint8_t *pucData, uint32_t ulLength );
+
+#endif
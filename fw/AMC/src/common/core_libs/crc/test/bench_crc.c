@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains a microbenchmark comparing the slice-by-8 CRC32 with
+ * the byte-at-a-time table method it replaced, and the CRC8 throughput.
+ *
+ * @file bench_crc.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "crc.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define BENCH_CRC_MAX_SIZE          ( 64 * 1024 )
+#define BENCH_CRC_TARGET_BYTES      ( 256 * 1024 * 1024 )
+
+#define BENCH_NS_PER_S              ( 1000000000ULL )
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static uint8_t  pucData[ BENCH_CRC_MAX_SIZE ] = { 0 };
+static uint32_t pulBytewiseTable[ 256 ]       = { 0 };
+
+/* Stops the compiler discarding the results */
+static volatile uint32_t ulSink = 0;
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static uint64_t ullNowNs( void )
+{
+    struct timespec xTs = { 0 };
+
+    clock_gettime( CLOCK_MONOTONIC, &xTs );
+
+    return ( ( uint64_t )xTs.tv_sec * BENCH_NS_PER_S ) + xTs.tv_nsec;
+}
+
+/**
+ * @brief   The byte-at-a-time CRC32 previously used by PLDM
+ */
+static uint32_t ulBytewiseCrc32( const uint8_t *pucBuf, uint32_t ulLength )
+{
+    uint32_t ulCrc = 0xFFFFFFFF;
+    uint32_t i     = 0;
+
+    for( i = 0; i < ulLength; i++ )
+    {
+        ulCrc = pulBytewiseTable[ ( ulCrc ^ pucBuf[ i ] ) & 0xFF ] ^ ( ulCrc >> 8 );
+    }
+
+    return ulCrc ^ 0xFFFFFFFF;
+}
+
+static uint32_t ulCrc8Wrapper( const uint8_t *pucBuf, uint32_t ulLength )
+{
+    return ucCRC_Crc8( pucBuf, ulLength );
+}
+
+/**
+ * @brief   Time a CRC function over buffers of the given size
+ *
+ * @return  Throughput in MB/s
+ */
+static double dRunBench( uint32_t ( *pxCrc )( const uint8_t *, uint32_t ), uint32_t ulSize )
+{
+    uint32_t ulIterations = BENCH_CRC_TARGET_BYTES / ulSize;
+    uint64_t ullStart     = 0;
+    uint64_t ullNs        = 0;
+    uint32_t i            = 0;
+
+    ullStart = ullNowNs();
+    for( i = 0; i < ulIterations; i++ )
+    {
+        ulSink ^= pxCrc( pucData, ulSize );
+    }
+    ullNs = ullNowNs() - ullStart;
+
+    return ( ( double )ulIterations * ulSize * 1000 ) / ( ullNs ? ullNs : 1 );
+}
+
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+int main( void )
+{
+    int      iStatus        = 0;
+    uint32_t pulSizes[ ]    = { 16, 128, 1024, BENCH_CRC_MAX_SIZE };
+    uint32_t i              = 0;
+    uint32_t j              = 0;
+
+    for( i = 0; i < 256; i++ )
+    {
+        uint32_t ulCrc = i;
+
+        for( j = 0; j < 8; j++ )
+        {
+            ulCrc = ( ulCrc >> 1 ) ^ ( ( ulCrc & 1 ) ? 0xEDB88320 : 0 );
+        }
+        pulBytewiseTable[ i ] = ulCrc;
+    }
+
+    srand( 1 );
+    for( i = 0; i < BENCH_CRC_MAX_SIZE; i++ )
+    {
+        pucData[ i ] = ( uint8_t )rand();
+    }
+
+    printf( "%8s %14s %14s %8s %14s\n", "size", "crc32_byte_MBs", "crc32_s8_MBs", "speedup", "crc8_MBs" );
+
+    for( i = 0; i < ( sizeof( pulSizes ) / sizeof( pulSizes[ 0 ] ) ); i++ )
+    {
+        double dBytewise = 0;
+        double dSlice8   = 0;
+        double dCrc8     = 0;
+
+        if( ulBytewiseCrc32( pucData, pulSizes[ i ] ) != ulCRC_Crc32( pucData, pulSizes[ i ] ) )
+        {
+            printf( "%8u MISMATCH\n", pulSizes[ i ] );
+            iStatus = -1;
+            continue;
+        }
+
+        dBytewise = dRunBench( ulBytewiseCrc32, pulSizes[ i ] );
+        dSlice8   = dRunBench( ulCRC_Crc32, pulSizes[ i ] );
+        dCrc8     = dRunBench( ulCrc8Wrapper, pulSizes[ i ] );
+
+        printf( "%8u %14.1f %14.1f %7.2fx %14.1f\n",
+                pulSizes[ i ], dBytewise, dSlice8, dSlice8 / dBytewise, dCrc8 );
+    }
+
+    return ( 0 == iStatus ) ? 0 : 1;
+}
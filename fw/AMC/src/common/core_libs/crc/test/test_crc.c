@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains tests for the CRC library. Results are checked against
+ * known vectors and a bit-wise reference, for every split of the data across
+ * update calls and every alignment of the slice-by-8 path.
+ *
+ * @file test_crc.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "crc.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_BUFFER_SIZE    ( 256 )
+
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+typedef struct TEST_VECTOR
+{
+    const uint8_t *pucData;
+    uint32_t      ulLength;
+    uint32_t      ulCrc32;
+    uint8_t       ucCrc8;
+
+} TEST_VECTOR;
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static const uint8_t pucCheck[ ]    = "123456789";
+static const uint8_t pucFox[ ]      = "The quick brown fox jumps over the lazy dog";
+static const uint8_t pucZeros[ 32 ] = { 0 };
+static const uint8_t pucOnes[ 32 ]  =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+static const TEST_VECTOR pxVectors[ ] =
+{
+    { pucCheck, 0,                      0x00000000, 0x00 },
+    { pucCheck, sizeof( pucCheck ) - 1, 0xCBF43926, 0xF4 },
+    { pucFox,   sizeof( pucFox ) - 1,   0x414FA339, 0xC1 },
+    { pucZeros, sizeof( pucZeros ),     0x190A55AD, 0x00 },
+    { pucOnes,  sizeof( pucOnes ),      0xFF6CAB0B, 0x09 },
+};
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static uint32_t ulReferenceCrc32( const uint8_t *pucData, uint32_t ulLength )
+{
+    uint32_t ulCrc = 0xFFFFFFFF;
+    uint32_t i     = 0;
+    int      iBit  = 0;
+
+    for( i = 0; i < ulLength; i++ )
+    {
+        ulCrc ^= pucData[ i ];
+        for( iBit = 0; iBit < 8; iBit++ )
+        {
+            ulCrc = ( ulCrc >> 1 ) ^ ( ( ulCrc & 1 ) ? 0xEDB88320 : 0 );
+        }
+    }
+
+    return ulCrc ^ 0xFFFFFFFF;
+}
+
+static uint8_t ucReferenceCrc8( const uint8_t *pucData, uint32_t ulLength )
+{
+    uint8_t  ucCrc = 0;
+    uint32_t i     = 0;
+    int      iBit  = 0;
+
+    for( i = 0; i < ulLength; i++ )
+    {
+        ucCrc ^= pucData[ i ];
+        for( iBit = 0; iBit < 8; iBit++ )
+        {
+            ucCrc = ( ucCrc & 0x80 ) ? ( uint8_t )( ( ucCrc << 1 ) ^ 0x07 ) : ( uint8_t )( ucCrc << 1 );
+        }
+    }
+
+    return ucCrc;
+}
+
+static void vFillRandom( uint8_t *pucData, uint32_t ulLength )
+{
+    uint32_t i = 0;
+
+    for( i = 0; i < ulLength; i++ )
+    {
+        pucData[ i ] = ( uint8_t )rand();
+    }
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_known_vectors( void **state )
+{
+    uint32_t i = 0;
+
+    for( i = 0; i < ( sizeof( pxVectors ) / sizeof( pxVectors[ 0 ] ) ); i++ )
+    {
+        assert_int_equal( pxVectors[ i ].ulCrc32, ulCRC_Crc32( pxVectors[ i ].pucData, pxVectors[ i ].ulLength ) );
+        assert_int_equal( pxVectors[ i ].ucCrc8, ucCRC_Crc8( pxVectors[ i ].pucData, pxVectors[ i ].ulLength ) );
+    }
+}
+
+static void test_matches_reference( void **state )
+{
+    uint8_t  pucData[ TEST_BUFFER_SIZE + 8 ] = { 0 };
+    uint32_t ulOffset                        = 0;
+    uint32_t ulLength                        = 0;
+
+    srand( 1 );
+    vFillRandom( pucData, sizeof( pucData ) );
+
+    /* Every length through the tail and slice paths, at every alignment */
+    for( ulOffset = 0; ulOffset < 8; ulOffset++ )
+    {
+        for( ulLength = 0; ulLength <= TEST_BUFFER_SIZE; ulLength++ )
+        {
+            assert_int_equal( ulReferenceCrc32( pucData + ulOffset, ulLength ),
+                              ulCRC_Crc32( pucData + ulOffset, ulLength ) );
+            assert_int_equal( ucReferenceCrc8( pucData + ulOffset, ulLength ),
+                              ucCRC_Crc8( pucData + ulOffset, ulLength ) );
+        }
+    }
+}
+
+static void test_incremental_split( void **state )
+{
+    uint8_t  pucData[ TEST_BUFFER_SIZE ] = { 0 };
+    uint32_t ulExpected32                = 0;
+    uint8_t  ucExpected8                 = 0;
+    uint32_t ulSplit                     = 0;
+
+    srand( 2 );
+    vFillRandom( pucData, sizeof( pucData ) );
+    ulExpected32 = ulCRC_Crc32( pucData, sizeof( pucData ) );
+    ucExpected8  = ucCRC_Crc8( pucData, sizeof( pucData ) );
+
+    for( ulSplit = 0; ulSplit <= sizeof( pucData ); ulSplit++ )
+    {
+        uint32_t ulCrc = ulCRC_Crc32Init();
+        uint8_t  ucCrc = ucCRC_Crc8Init();
+
+        ulCrc = ulCRC_Crc32Update( ulCrc, pucData, ulSplit );
+        ulCrc = ulCRC_Crc32Update( ulCrc, pucData + ulSplit, sizeof( pucData ) - ulSplit );
+        assert_int_equal( ulExpected32, ulCRC_Crc32Final( ulCrc ) );
+
+        ucCrc = ucCRC_Crc8Update( ucCrc, pucData, ulSplit );
+        ucCrc = ucCRC_Crc8Update( ucCrc, pucData + ulSplit, sizeof( pucData ) - ulSplit );
+        assert_int_equal( ucExpected8, ucCRC_Crc8Final( ucCrc ) );
+    }
+}
+
+static void test_incremental_parts( void **state )
+{
+    uint32_t ulCrc    = ulCRC_Crc32Init();
+    uint8_t  ucCrc    = ucCRC_Crc8Init();
+    uint32_t ulOffset = 0;
+    uint32_t ulPart   = 1;
+
+    /* Stream the fox in growing parts, as a multipart transfer would */
+    while( ulOffset < ( sizeof( pucFox ) - 1 ) )
+    {
+        uint32_t ulLength = sizeof( pucFox ) - 1 - ulOffset;
+
+        if( ulLength > ulPart )
+        {
+            ulLength = ulPart;
+        }
+
+        ulCrc     = ulCRC_Crc32Update( ulCrc, pucFox + ulOffset, ulLength );
+        ucCrc     = ucCRC_Crc8Update( ucCrc, pucFox + ulOffset, ulLength );
+        ulOffset += ulLength;
+        ulPart++;
+    }
+
+    assert_int_equal( 0x414FA339, ulCRC_Crc32Final( ulCrc ) );
+    assert_int_equal( 0xC1, ucCRC_Crc8Final( ucCrc ) );
+}
+
+static void test_null_data( void **state )
+{
+    assert_int_equal( 0x12345678, ulCRC_Crc32Update( 0x12345678, NULL, 16 ) );
+    assert_int_equal( 0x5A, ucCRC_Crc8Update( 0x5A, NULL, 16 ) );
+    assert_int_equal( 0, ulCRC_Crc32( NULL, 16 ) );
+    assert_int_equal( 0, ucCRC_Crc8( NULL, 16 ) );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test( test_known_vectors ),
+        cmocka_unit_test( test_matches_reference ),
+        cmocka_unit_test( test_incremental_split ),
+        cmocka_unit_test( test_incremental_parts ),
+        cmocka_unit_test( test_null_data ),
+    };
+
+    return cmocka_run_group_tests( tests, NULL, NULL );
+}
@@ -69,6 +69,16 @@ static void vPLL_SetOutputLevel( void );
  */
 static void vPLL_SetLoggingLevel( void );
 
+/**
+ * @brief   Function to get the deferred logging mode
+ */
+static void vPLL_GetDeferredMode( void );
+
+/**
+ * @brief   Function to set the deferred logging mode
+ */
+static void vPLL_SetDeferredMode( void );
+
 /**
  * @brief   Function to test the PPL print macros 
  */
@@ -125,6 +135,7 @@ void vPLL_DebugInit( DAL_HDL pxParentHandle )
                 pxDAL_NewDebugFunction( "set_output_level", pxSetDir, vPLL_SetOutputLevel );
                 pxDAL_NewDebugFunction( "set_logging_level", pxSetDir, vPLL_SetLoggingLevel );
                 pxDAL_NewDebugFunction( "clear_log", pxSetDir, vPLL_ClearLog );
+                pxDAL_NewDebugFunction( "set_deferred_mode", pxSetDir, vPLL_SetDeferredMode );
             }
             if( NULL != pxGetDir )
             {
@@ -132,6 +143,7 @@ void vPLL_DebugInit( DAL_HDL pxParentHandle )
                 pxDAL_NewDebugFunction( "get_logging_level", pxGetDir, vPLL_GetLoggingLevel );
                 pxDAL_NewDebugFunction( "dump_log", pxGetDir, vPLL_DumpLog );
                 pxDAL_NewDebugFunction( "dump_fsbl_log", pxGetDir, vPLL_DumpFsblLog );
+                pxDAL_NewDebugFunction( "get_deferred_mode", pxGetDir, vPLL_GetDeferredMode );
             }
         }
 
@@ -261,6 +273,44 @@ static void vPLL_SetLoggingLevel( void )
     }
 }
 
+/**
+ * @brief   Debug function to get the deferred logging mode
+ */
+static void vPLL_GetDeferredMode( void )
+{
+    int iEnabled = FALSE;
+
+    if( OK != iPLL_GetDeferredMode( &iEnabled ) )
+    {
+        PLL_DAL( PLL_BDG_NAME, "Error getting deferred logging mode\r\n" );
+    }
+    else
+    {
+        PLL_DAL( PLL_BDG_NAME, "Deferred logging: %s\r\n", ( TRUE == iEnabled ) ? "enabled" : "disabled" );
+    }
+}
+
+/**
+ * @brief   Debug function to set the deferred logging mode
+ */
+static void vPLL_SetDeferredMode( void )
+{
+    int iEnable = FALSE;
+
+    if( OK != iDAL_GetIntInRange( "\r\nEnable deferred logging (0: disable, 1: enable): ", &iEnable, FALSE, TRUE ) )
+    {
+        PLL_DAL( PLL_BDG_NAME, "Error retrieving deferred logging mode\r\n" );
+    }
+    else if( OK != iPLL_SetDeferredMode( iEnable ) )
+    {
+        PLL_DAL( PLL_BDG_NAME, "Error setting deferred logging mode\r\n" );
+    }
+    else
+    {
+        PLL_DAL( PLL_BDG_NAME, "Successfully set deferred logging mode\r\n" );
+    }
+}
+
 /**
  * @brief   Debug function to test PLL macros
  */
@@ -36,6 +36,11 @@
 
 #define PLL_SLEEP_INTERVAL_MS  ( 1000 )
 
+#define PLL_DEFERRED_SPEC_LEN  ( 16 )
+#define PLL_DEFERRED_FLAGS     "-+ #0"
+#define PLL_DEFERRED_INTEGERS  "diuxXoc"
+#define PLL_DEFERRED_FLOATS    "fFeEgGaA"
+
 
 /* Stat & Error definitions */
 #define PLL_STATS( DO )                           \
@@ -53,6 +58,10 @@
     DO( PLL_STATS_LOG_COLLECT_SUCCESS )           \
     DO( PLL_STATS_MALLOC )                        \
     DO( PLL_STATS_FREE )                          \
+    DO( PLL_STATS_FILTERED_OUT )                  \
+    DO( PLL_STATS_DEFERRED_RECORD )               \
+    DO( PLL_STATS_DEFERRED_FLUSH )                \
+    DO( PLL_STATS_DEFERRED_UNSUPPORTED_FORMAT )   \
     DO( PLL_STATS_MAX )
 
 #define PLL_ERRORS( DO )                          \
@@ -68,6 +77,7 @@
     DO( PLL_ERRORS_STORE_PT_FAILED )              \
     DO( PLL_ERRORS_LOG_COLLECT_FAILED )           \
     DO( PLL_ERRORS_MALLOC_FAILED )                \
+    DO( PLL_ERRORS_DEFERRED_RING_FULL )           \
     DO( PLL_ERRORS_MAX )
 
 
@@ -98,11 +108,44 @@ UTIL_MAKE_ENUM_AND_STRINGS( PLL_STATS, PLL_STATS, PLL_STATS_STR )
  */
 UTIL_MAKE_ENUM_AND_STRINGS( PLL_ERRORS, PLL_ERRORS, PLL_ERRORS_STR )
 
+/**
+ * @enum    PLL_DEFERRED_ARG_TYPE
+ * @brief   Type of a captured deferred log argument
+ */
+typedef enum PLL_DEFERRED_ARG_TYPE
+{
+    PLL_DEFERRED_ARG_TYPE_NONE = 0,    /* "%%" - no argument consumed */
+    PLL_DEFERRED_ARG_TYPE_INT,
+    PLL_DEFERRED_ARG_TYPE_LONG,
+    PLL_DEFERRED_ARG_TYPE_LONG_LONG,
+    PLL_DEFERRED_ARG_TYPE_POINTER,
+    PLL_DEFERRED_ARG_TYPE_DOUBLE,
+
+    MAX_PLL_DEFERRED_ARG_TYPE
+
+} PLL_DEFERRED_ARG_TYPE;
+
 
 /******************************************************************************/
 /* Structs/Unions                                                             */
 /******************************************************************************/
 
+/**
+ * @struct  PLL_DEFERRED_RECORD
+ * @brief   Binary log record - formatted later by iPLL_FlushDeferredLog
+ */
+typedef struct PLL_DEFERRED_RECORD
+{
+    const char  *pcFormat;
+    uint32_t    ulTimestampMs;
+    uint8_t     ucLevel;
+    uint8_t     ucIsLineStart;
+    uint8_t     ucNumArgs;
+    uint8_t     ucArgTypes[ PLL_DEFERRED_MAX_ARGS ];
+    uint64_t    ullArgs[ PLL_DEFERRED_MAX_ARGS ];
+
+} PLL_DEFERRED_RECORD;
+
 /**
  * @struct  PLL_PRIVATE_DATA
  * @brief   Locally held private data
@@ -123,6 +166,13 @@ typedef struct PLL_PRIVATE_DATA
     void                *pvMtxHdl;
     void                *pvSemHdl;
 
+    int                 iDeferredEnabled;
+    PLL_DEFERRED_RECORD xDeferredLog[ PLL_DEFERRED_LOG_RECS ];
+    uint32_t            ulDeferredHead;
+    uint32_t            ulDeferredTail;
+    uint32_t            ulDeferredDropped;
+    int                 iDeferredLineStart;
+
     uint32_t            ulStats[ PLL_STATS_MAX ];
     uint32_t            ulErrors[ PLL_ERRORS_MAX ];
 
@@ -152,6 +202,13 @@ static PLL_PRIVATE_DATA xLocalData =
     NULL,           /* pvMtxHdl          */
     NULL,           /* pvSemHdl          */
 
+    FALSE,          /* iDeferredEnabled  */
+    { { 0 } },      /* xDeferredLog      */
+    0,              /* ulDeferredHead    */
+    0,              /* ulDeferredTail    */
+    0,              /* ulDeferredDropped */
+    TRUE,           /* iDeferredLineStart */
+
     { 0 },          /* ulStats           */
     { 0 },          /* ulErrors          */
 
@@ -175,6 +232,55 @@ static PLL_PRIVATE_DATA *pxThis = &xLocalData;
  */
 static int iLogCollect( char *pcBuf );
 
+/**
+ * @brief   Prints and/or logs a formatted message, depending on the current levels
+ *
+ * @param   xOutputLevel    Verbosity level of the message
+ * @param   pcBuffer        Formatted message
+ *
+ * @return  N/A
+ */
+static void vEmitMessage( PLL_OUTPUT_LEVEL xOutputLevel, char *pcBuffer );
+
+/**
+ * @brief   Parses a single conversion specification
+ *
+ * @param   pcSpec      Pointer to the '%' starting the specification
+ * @param   piSpecLen   Length of the specification, including the conversion character
+ * @param   pxType      Type of argument consumed by the specification
+ *
+ * @return  OK      if the specification can be deferred
+ *          ERROR   if the specification is unsupported (e.g. %s)
+ */
+static int iParseSpec( const char *pcSpec, int *piSpecLen, PLL_DEFERRED_ARG_TYPE *pxType );
+
+/**
+ * @brief   Captures a message as a binary record
+ *
+ * @param   xOutputLevel    Verbosity level of the message
+ * @param   pcFormat        Format string
+ * @param   xArgs           Format arguments
+ * @param   pxRecord        Record to populate
+ *
+ * @return  OK      if all arguments were captured
+ *          ERROR   if the format cannot be deferred
+ */
+static int iCaptureRecord( PLL_OUTPUT_LEVEL xOutputLevel,
+                           const char *pcFormat,
+                           va_list xArgs,
+                           PLL_DEFERRED_RECORD *pxRecord );
+
+/**
+ * @brief   Formats a binary record
+ *
+ * @param   pxRecord        Record to format
+ * @param   pcBuffer        Output buffer
+ * @param   iBufferSize     Size of output buffer
+ *
+ * @return  N/A
+ */
+static void vFormatRecord( const PLL_DEFERRED_RECORD *pxRecord, char *pcBuffer, int iBufferSize );
+
 
 /******************************************************************************/
 /* Public function implementations                                            */
@@ -399,64 +505,211 @@ int iPLL_GetLoggingLevel( PLL_OUTPUT_LEVEL *pxLoggingLevel )
 }
 
 /**
- * @brief   Function for task/thread safe prints with verbosity
+ * @brief   Enables or disables deferred (binary) logging
  */
-void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+int iPLL_SetDeferredMode( int iEnable )
 {
+    int iStatus = ERROR;
+
     if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
         ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
         ( TRUE == pxThis->iIsInitialised ) &&
-        ( NULL != pcFormat ) &&
-        ( PRINT_BUFFER_SIZE >= strlen( pcFormat ) ) )
+        ( ( TRUE == iEnable ) || ( FALSE == iEnable ) ) )
     {
-        char pcBuffer[ PRINT_BUFFER_SIZE ] = { 0 };
-        va_list xArgs = { 0 };
+        pxThis->iDeferredEnabled = iEnable;
+        INC_STAT_COUNTER( PLL_STATS_LEVEL_CHANGE )
 
-        va_start( xArgs, pcFormat );
-        vsnprintf( pcBuffer, PRINT_BUFFER_SIZE, pcFormat, xArgs );
+        if( FALSE == iEnable )
+        {
+            iStatus = iPLL_FlushDeferredLog();
+        }
+        else
+        {
+            iStatus = OK;
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( PLL_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Gets the current deferred logging mode
+ */
+int iPLL_GetDeferredMode( int *piEnabled )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iIsInitialised ) &&
+        ( NULL != piEnabled ) )
+    {
+        *piEnabled = pxThis->iDeferredEnabled;
+        INC_STAT_COUNTER( PLL_STATS_LEVEL_RETRIEVAL )
 
-        if( OSAL_ERRORS_NONE == iOSAL_Semaphore_Pend( pxThis->pvSemHdl, OSAL_TIMEOUT_TASK_WAIT_MS ) )
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( PLL_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Formats and outputs all pending deferred log records
+ */
+int iPLL_FlushDeferredLog( void )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iIsInitialised ) )
+    {
+        int iIsEmpty = FALSE;
+        uint32_t ulDropped = 0;
+
+        while( FALSE == iIsEmpty )
         {
-            INC_STAT_COUNTER( PLL_STATS_PEND_SEMAPHORE );
+            PLL_DEFERRED_RECORD xRecord = { 0 };
 
-            /* Check output level */
-            if( pxThis->xOutputLevel >= xOutputLevel )
+            vOSAL_EnterCritical();
+            if( pxThis->ulDeferredTail == pxThis->ulDeferredHead )
             {
-                PRINT( "%s", pcBuffer );
-                INC_STAT_COUNTER( PLL_STATS_THREAD_SAFE_PRINT_COUNT );
+                iIsEmpty = TRUE;
             }
+            else
+            {
+                xRecord = pxThis->xDeferredLog[ pxThis->ulDeferredTail % PLL_DEFERRED_LOG_RECS ];
+                pxThis->ulDeferredTail++;
+            }
+            vOSAL_ExitCritical();
 
-            /* Check logging level */
-            if( pxThis->xLoggingLevel >= xOutputLevel )
+            if( FALSE == iIsEmpty )
             {
-                if( OK == iLogCollect( pcBuffer ) )
+                char pcBuffer[ PRINT_BUFFER_SIZE ] = { 0 };
+
+                vFormatRecord( &xRecord, pcBuffer, sizeof( pcBuffer ) );
+                vEmitMessage( ( PLL_OUTPUT_LEVEL )xRecord.ucLevel, pcBuffer );
+                INC_STAT_COUNTER( PLL_STATS_DEFERRED_FLUSH )
+            }
+        }
+
+        vOSAL_EnterCritical();
+        ulDropped = pxThis->ulDeferredDropped;
+        pxThis->ulDeferredDropped = 0;
+        vOSAL_ExitCritical();
+
+        if( 0 != ulDropped )
+        {
+            char pcBuffer[ PRINT_BUFFER_SIZE ] = { 0 };
+
+            snprintf( pcBuffer, sizeof( pcBuffer ), "\r\n[" PLL_NAME "] %lu deferred records dropped\r\n",
+                      ( unsigned long )ulDropped );
+            vEmitMessage( PLL_OUTPUT_LEVEL_WARNING, pcBuffer );
+        }
+
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( PLL_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Function for task/thread safe prints with verbosity
+ */
+void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+{
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iIsInitialised ) &&
+        ( NULL != pcFormat ) )
+    {
+        /* Discard filtered messages before paying for any formatting or locking */
+        if( ( pxThis->xOutputLevel < xOutputLevel ) &&
+            ( pxThis->xLoggingLevel < xOutputLevel ) )
+        {
+            INC_STAT_COUNTER( PLL_STATS_FILTERED_OUT )
+        }
+        else if( PRINT_BUFFER_SIZE >= strlen( pcFormat ) )
+        {
+            int iIsDeferred = FALSE;
+            int iIsDropped = FALSE;
+            va_list xArgs = { 0 };
+
+            va_start( xArgs, pcFormat );
+
+            if( TRUE == pxThis->iDeferredEnabled )
+            {
+                PLL_DEFERRED_RECORD xRecord = { 0 };
+                va_list xCaptureArgs = { 0 };
+
+                va_copy( xCaptureArgs, xArgs );
+                if( OK == iCaptureRecord( xOutputLevel, pcFormat, xCaptureArgs, &xRecord ) )
                 {
-                    INC_STAT_COUNTER( PLL_STATS_LOG_COLLECT_SUCCESS )
+                    size_t xFormatLen = strlen( pcFormat );
+                    int iEndsLine = ( 0 < xFormatLen ) &&
+                                    ( ( '\n' == pcFormat[ xFormatLen - 1 ] ) ||
+                                      ( '\r' == pcFormat[ xFormatLen - 1 ] ) );
+
+                    vOSAL_EnterCritical();
+                    if( PLL_DEFERRED_LOG_RECS > ( pxThis->ulDeferredHead - pxThis->ulDeferredTail ) )
+                    {
+                        /* Only the first fragment of a line gets a timestamp */
+                        xRecord.ucIsLineStart = ( uint8_t )pxThis->iDeferredLineStart;
+                        pxThis->xDeferredLog[ pxThis->ulDeferredHead % PLL_DEFERRED_LOG_RECS ] = xRecord;
+                        pxThis->ulDeferredHead++;
+                        iIsDeferred = TRUE;
+                    }
+                    else
+                    {
+                        pxThis->ulDeferredDropped++;
+                        iIsDropped = TRUE;
+                    }
+                    pxThis->iDeferredLineStart = iEndsLine;
+                    vOSAL_ExitCritical();
+
+                    if( TRUE == iIsDeferred )
+                    {
+                        INC_STAT_COUNTER( PLL_STATS_DEFERRED_RECORD )
+                    }
+                    else
+                    {
+                        /* Ring full - drop the record, the flush reports how many were lost */
+                        INC_ERROR_COUNTER( PLL_ERRORS_DEFERRED_RING_FULL )
+                    }
                 }
                 else
                 {
-                    INC_ERROR_COUNTER( PLL_ERRORS_LOG_COLLECT_FAILED )
+                    INC_STAT_COUNTER( PLL_STATS_DEFERRED_UNSUPPORTED_FORMAT )
                 }
+                va_end( xCaptureArgs );
             }
 
-            if( OSAL_ERRORS_NONE == iOSAL_Semaphore_Post( pxThis->pvSemHdl ) )
-            {
-                INC_STAT_COUNTER( PLL_STATS_POST_SEMAPHORE );
-            }
-            else
+            if( ( FALSE == iIsDeferred ) && ( FALSE == iIsDropped ) )
             {
-                INC_ERROR_COUNTER( PLL_ERRORS_POST_SEMAPHORE );
+                char pcBuffer[ PRINT_BUFFER_SIZE ] = { 0 };
+
+                vsnprintf( pcBuffer, PRINT_BUFFER_SIZE, pcFormat, xArgs );
+                vEmitMessage( xOutputLevel, pcBuffer );
             }
+
+            va_end( xArgs );
         }
         else
         {
-            /* not thread safe - semaphore timeout */
-            PRINT( "%s", pcBuffer );
-
-            INC_STAT_COUNTER( PLL_STATS_NON_THREAD_SAFE_PRINT_COUNT );
+            INC_ERROR_COUNTER( PLL_ERRORS_VALIDATION_FAILED );
         }
-
-        va_end( xArgs );
     }
     else
     {
@@ -537,6 +790,9 @@ int iPLL_DumpLog( void )
         HAL_PARTITION_TABLE_LOG_MSG xLogMsg = { 0 };
         uintptr_t ulLogMsgSrcAddr = HAL_RPU_SHARED_MEMORY_BASE_ADDR + offsetof( HAL_PARTITION_TABLE, xLogMsg );
 
+        /* Make sure deferred records have reached shared memory */
+        iPLL_FlushDeferredLog();
+
         if( NULL != pvOSAL_MemCpy( &xLogMsg, ( void * )ulLogMsgSrcAddr, sizeof( xLogMsg ) ) )
         {
             vPLL_Printf( "\r\n======================================================================\r\n" );
@@ -871,3 +1127,280 @@ static int iLogCollect( char *pcBuf )
 
     return iStatus;
 }
+
+/**
+ * @brief   Prints and/or logs a formatted message, depending on the current levels
+ */
+static void vEmitMessage( PLL_OUTPUT_LEVEL xOutputLevel, char *pcBuffer )
+{
+    if( OSAL_ERRORS_NONE == iOSAL_Semaphore_Pend( pxThis->pvSemHdl, OSAL_TIMEOUT_TASK_WAIT_MS ) )
+    {
+        INC_STAT_COUNTER( PLL_STATS_PEND_SEMAPHORE );
+
+        /* Check output level */
+        if( pxThis->xOutputLevel >= xOutputLevel )
+        {
+            PRINT( "%s", pcBuffer );
+            INC_STAT_COUNTER( PLL_STATS_THREAD_SAFE_PRINT_COUNT );
+        }
+
+        /* Check logging level */
+        if( pxThis->xLoggingLevel >= xOutputLevel )
+        {
+            if( OK == iLogCollect( pcBuffer ) )
+            {
+                INC_STAT_COUNTER( PLL_STATS_LOG_COLLECT_SUCCESS )
+            }
+            else
+            {
+                INC_ERROR_COUNTER( PLL_ERRORS_LOG_COLLECT_FAILED )
+            }
+        }
+
+        if( OSAL_ERRORS_NONE == iOSAL_Semaphore_Post( pxThis->pvSemHdl ) )
+        {
+            INC_STAT_COUNTER( PLL_STATS_POST_SEMAPHORE );
+        }
+        else
+        {
+            INC_ERROR_COUNTER( PLL_ERRORS_POST_SEMAPHORE );
+        }
+    }
+    else
+    {
+        /* not thread safe - semaphore timeout */
+        PRINT( "%s", pcBuffer );
+
+        INC_STAT_COUNTER( PLL_STATS_NON_THREAD_SAFE_PRINT_COUNT );
+    }
+}
+
+/**
+ * @brief   Parses a single conversion specification
+ */
+static int iParseSpec( const char *pcSpec, int *piSpecLen, PLL_DEFERRED_ARG_TYPE *pxType )
+{
+    int iStatus = ERROR;
+    int i = 1;
+    int iNumLong = 0;
+
+    if( '%' == pcSpec[ i ] )
+    {
+        *piSpecLen = 2;
+        *pxType = PLL_DEFERRED_ARG_TYPE_NONE;
+        iStatus = OK;
+    }
+    else
+    {
+        /* Flags, width and precision - '*' would consume an extra argument */
+        while( ( '\0' != pcSpec[ i ] ) && ( NULL != strchr( PLL_DEFERRED_FLAGS, pcSpec[ i ] ) ) )
+        {
+            i++;
+        }
+        while( ( '0' <= pcSpec[ i ] ) && ( '9' >= pcSpec[ i ] ) )
+        {
+            i++;
+        }
+        if( '.' == pcSpec[ i ] )
+        {
+            i++;
+            while( ( '0' <= pcSpec[ i ] ) && ( '9' >= pcSpec[ i ] ) )
+            {
+                i++;
+            }
+        }
+
+        /* Length modifiers - 'h' promotes to int */
+        while( 'h' == pcSpec[ i ] )
+        {
+            i++;
+        }
+        while( ( 'l' == pcSpec[ i ] ) && ( 2 > iNumLong ) )
+        {
+            iNumLong++;
+            i++;
+        }
+
+        if( ( '\0' != pcSpec[ i ] ) && ( PLL_DEFERRED_SPEC_LEN > ( i + 1 ) ) )
+        {
+            if( NULL != strchr( PLL_DEFERRED_INTEGERS, pcSpec[ i ] ) )
+            {
+                *pxType = ( 0 == iNumLong ) ? PLL_DEFERRED_ARG_TYPE_INT :
+                          ( 1 == iNumLong ) ? PLL_DEFERRED_ARG_TYPE_LONG :
+                                              PLL_DEFERRED_ARG_TYPE_LONG_LONG;
+                iStatus = OK;
+            }
+            else if( ( 0 == iNumLong ) && ( 'p' == pcSpec[ i ] ) )
+            {
+                *pxType = PLL_DEFERRED_ARG_TYPE_POINTER;
+                iStatus = OK;
+            }
+            else if( ( 0 == iNumLong ) && ( NULL != strchr( PLL_DEFERRED_FLOATS, pcSpec[ i ] ) ) )
+            {
+                *pxType = PLL_DEFERRED_ARG_TYPE_DOUBLE;
+                iStatus = OK;
+            }
+
+            *piSpecLen = i + 1;
+        }
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Captures a message as a binary record
+ */
+static int iCaptureRecord( PLL_OUTPUT_LEVEL xOutputLevel,
+                           const char *pcFormat,
+                           va_list xArgs,
+                           PLL_DEFERRED_RECORD *pxRecord )
+{
+    int iStatus = OK;
+    const char *pcNext = strchr( pcFormat, '%' );
+
+    pxRecord->pcFormat      = pcFormat;
+    pxRecord->ulTimestampMs = ulOSAL_GetUptimeMs();
+    pxRecord->ucLevel       = ( uint8_t )xOutputLevel;
+    pxRecord->ucNumArgs     = 0;
+
+    while( ( OK == iStatus ) && ( NULL != pcNext ) )
+    {
+        PLL_DEFERRED_ARG_TYPE xType = PLL_DEFERRED_ARG_TYPE_NONE;
+        int iSpecLen = 0;
+
+        iStatus = iParseSpec( pcNext, &iSpecLen, &xType );
+
+        if( ( OK == iStatus ) && ( PLL_DEFERRED_ARG_TYPE_NONE != xType ) )
+        {
+            if( PLL_DEFERRED_MAX_ARGS > pxRecord->ucNumArgs )
+            {
+                uint64_t *pullArg = &pxRecord->ullArgs[ pxRecord->ucNumArgs ];
+
+                switch( xType )
+                {
+                case PLL_DEFERRED_ARG_TYPE_INT:
+                    *pullArg = ( uint64_t )( unsigned int )va_arg( xArgs, int );
+                    break;
+
+                case PLL_DEFERRED_ARG_TYPE_LONG:
+                    *pullArg = ( uint64_t )( unsigned long )va_arg( xArgs, long );
+                    break;
+
+                case PLL_DEFERRED_ARG_TYPE_LONG_LONG:
+                    *pullArg = ( uint64_t )va_arg( xArgs, long long );
+                    break;
+
+                case PLL_DEFERRED_ARG_TYPE_POINTER:
+                    *pullArg = ( uint64_t )( uintptr_t )va_arg( xArgs, void * );
+                    break;
+
+                case PLL_DEFERRED_ARG_TYPE_DOUBLE:
+                {
+                    double dArg = va_arg( xArgs, double );
+                    memcpy( pullArg, &dArg, sizeof( dArg ) );
+                    break;
+                }
+
+                default:
+                    iStatus = ERROR;
+                    break;
+                }
+
+                pxRecord->ucArgTypes[ pxRecord->ucNumArgs++ ] = ( uint8_t )xType;
+            }
+            else
+            {
+                iStatus = ERROR;
+            }
+        }
+
+        if( OK == iStatus )
+        {
+            pcNext = strchr( pcNext + iSpecLen, '%' );
+        }
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Formats a binary record
+ */
+static void vFormatRecord( const PLL_DEFERRED_RECORD *pxRecord, char *pcBuffer, int iBufferSize )
+{
+    const char *pcFormat = pxRecord->pcFormat;
+    int iLen = 0;
+    int iArg = 0;
+
+    if( TRUE == pxRecord->ucIsLineStart )
+    {
+        iLen = snprintf( pcBuffer, iBufferSize, "[%lu] ", ( unsigned long )pxRecord->ulTimestampMs );
+    }
+
+    while( ( '\0' != *pcFormat ) && ( ( iBufferSize - 1 ) > iLen ) )
+    {
+        PLL_DEFERRED_ARG_TYPE xType = PLL_DEFERRED_ARG_TYPE_NONE;
+        char pcSpec[ PLL_DEFERRED_SPEC_LEN ] = { 0 };
+        int iSpecLen = 0;
+        int iWritten = 0;
+
+        if( '%' != *pcFormat )
+        {
+            pcBuffer[ iLen++ ] = *pcFormat++;
+            continue;
+        }
+
+        /* Format was validated at capture time */
+        iParseSpec( pcFormat, &iSpecLen, &xType );
+        memcpy( pcSpec, pcFormat, iSpecLen );
+        pcFormat += iSpecLen;
+
+        switch( xType )
+        {
+        case PLL_DEFERRED_ARG_TYPE_INT:
+            iWritten = snprintf( &pcBuffer[ iLen ], iBufferSize - iLen, pcSpec,
+                                 ( unsigned int )pxRecord->ullArgs[ iArg++ ] );
+            break;
+
+        case PLL_DEFERRED_ARG_TYPE_LONG:
+            iWritten = snprintf( &pcBuffer[ iLen ], iBufferSize - iLen, pcSpec,
+                                 ( unsigned long )pxRecord->ullArgs[ iArg++ ] );
+            break;
+
+        case PLL_DEFERRED_ARG_TYPE_LONG_LONG:
+            iWritten = snprintf( &pcBuffer[ iLen ], iBufferSize - iLen, pcSpec,
+                                 ( unsigned long long )pxRecord->ullArgs[ iArg++ ] );
+            break;
+
+        case PLL_DEFERRED_ARG_TYPE_POINTER:
+            iWritten = snprintf( &pcBuffer[ iLen ], iBufferSize - iLen, pcSpec,
+                                 ( void * )( uintptr_t )pxRecord->ullArgs[ iArg++ ] );
+            break;
+
+        case PLL_DEFERRED_ARG_TYPE_DOUBLE:
+        {
+            double dArg = 0;
+            memcpy( &dArg, &pxRecord->ullArgs[ iArg++ ], sizeof( dArg ) );
+            iWritten = snprintf( &pcBuffer[ iLen ], iBufferSize - iLen, pcSpec, dArg );
+            break;
+        }
+
+        default:
+            pcBuffer[ iLen ] = '%';
+            iWritten = 1;
+            break;
+        }
+
+        if( 0 < iWritten )
+        {
+            iLen += iWritten;
+        }
+    }
+
+    if( iLen >= iBufferSize )
+    {
+        iLen = iBufferSize - 1;
+    }
+    pcBuffer[ iLen ] = '\0';
+}
@@ -29,6 +29,12 @@
 #define PLL_LOG_ENTRY_SIZE   ( 96 )
 #define PLL_LOG_MAX_RECS     ( 50 )
 
+#ifndef PLL_DEFERRED_LOG_RECS
+#define PLL_DEFERRED_LOG_RECS ( 32 )
+#endif
+
+#define PLL_DEFERRED_MAX_ARGS ( 6 )
+
 #ifdef DEBUG_PRINT
 #define PLL_PRINTF( l, t, m, ...) vPLL_Output( l, "[" t "] " m, ##__VA_ARGS__)
 #else
@@ -136,12 +142,57 @@ int iPLL_SetLoggingLevel( PLL_OUTPUT_LEVEL xLoggingLevel );
  */
 int iPLL_GetLoggingLevel( PLL_OUTPUT_LEVEL *pxLoggingLevel );
 
+/**
+ * @brief   Enables or disables deferred (binary) logging
+ *
+ * @param   iEnable     TRUE to record messages and format them later, FALSE to
+ *                      format and output them immediately
+ *
+ * @return  OK     if mode set correctly
+ *          ERROR  if mode not set
+ *
+ * @note    In deferred mode vPLL_Output only stores the format string pointer,
+ *          its arguments and a timestamp - formatting and output happen in
+ *          iPLL_FlushDeferredLog. Format strings must therefore have static
+ *          storage (as all PLL_xxx macros do). Messages using %s, '*' widths or
+ *          more than PLL_DEFERRED_MAX_ARGS arguments are output immediately,
+ *          ahead of any records still pending. The first fragment of each
+ *          deferred line is prefixed with its capture time in ms.
+ *          When the ring is full new records are dropped and counted; the
+ *          next flush reports how many were lost.
+ *          Disabled by default. Disabling the mode flushes any pending records.
+ */
+int iPLL_SetDeferredMode( int iEnable );
+
+/**
+ * @brief   Gets the current deferred logging mode
+ *
+ * @param   piEnabled   Pointer to deferred mode (TRUE/FALSE)
+ *
+ * @return  OK     if mode retrieved successful
+ *          ERROR  if mode not retrieved successful
+ */
+int iPLL_GetDeferredMode( int *piEnabled );
+
+/**
+ * @brief   Formats and outputs all pending deferred log records
+ *
+ * @return  OK     if the deferred log was flushed
+ *          ERROR  if the deferred log was not flushed
+ *
+ * @note    Intended to be called periodically from a low priority context.
+ */
+int iPLL_FlushDeferredLog( void );
+
 /**
  * @brief   Function for task/thread safe prints.
  *
  * @param   xOutputLevel  Verbosity level of the message.
  * 
  * @param   pcFormat      C string that contains the text to be written.
+ *
+ * @note    Messages above both the output and logging levels are discarded
+ *          before any formatting or locking takes place.
  */
 void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... );
 
@@ -157,6 +208,8 @@ void vPLL_Printf( const char *pcFormat, ... );
 
 /**
  * @brief    Dumps logs from shared memory.
+ *
+ * @note     Pending deferred records are flushed first.
  * 
  * @return   OK if successful
  *           ERROR if not successful. 
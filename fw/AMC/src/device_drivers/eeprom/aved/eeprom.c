@@ -49,6 +49,11 @@
 #define EEPROM_ADDRESS_SIZE_MAX             ( 255 )
 #define EEPROM_WRITE_MULTI_BYTE_SIZE_MAX    ( 255 )
 #define EEPROM_WRITE_BYTE_SIZE_MAX          ( 255 )
+#define EEPROM_ACK_POLL_RETRY_MAX           ( 20 )
+#define EEPROM_ACK_POLL_INTERVAL_MS         ( 1 )
+#define EEPROM_BYTE_SHIFT                   ( 8 )
+#define EEPROM_BYTE_MASK                    ( 0xFF )
+#define EEPROM_ONE_BYTE_ADDRESS_SPACE       ( 256 )
 
 /* Default register content in EEPROM if a particular register has not been programmed */
 #define EEPROM_DEFAULT_VAL                  ( 0xFF )
@@ -227,6 +232,10 @@ STATIC_ASSERT( EEPROM_V3_1_CAPABILITY_SIZE < EEPROM_MAX_FIELD_SIZE);
     DO( EEPROM_STAT_SINGLE_BYTE_WRITE ) \
     DO( EEPROM_STAT_MULTI_BYTE_WRITE )  \
     DO( EEPROM_STATS_VERIFY_DEVICE_ID ) \
+    DO( EEPROM_STAT_BULK_READ )         \
+    DO( EEPROM_STAT_BULK_WRITE )        \
+    DO( EEPROM_STAT_PAGE_WRITE )        \
+    DO( EEPROM_STAT_ACK_POLL_RETRY )    \
     DO( EEPROM_STATS_MAX )
 
 #define EEPROM_ERROR( DO )               \
@@ -242,6 +251,10 @@ STATIC_ASSERT( EEPROM_V3_1_CAPABILITY_SIZE < EEPROM_MAX_FIELD_SIZE);
     DO( EEPROM_ERROR_VALIDATION )        \
     DO( EEPROM_ERRORS_DEVICE_ID_READ )   \
     DO( EEPROM_ERRORS_VERIFY_DEVICE_ID ) \
+    DO( EEPROM_ERROR_BULK_READ )         \
+    DO( EEPROM_ERROR_BULK_WRITE )        \
+    DO( EEPROM_ERROR_PAGE_WRITE )        \
+    DO( EEPROM_ERROR_ACK_POLL_TIMEOUT )  \
     DO( EEPROM_ERROR_MAX )
 
 #define PRINT_STAT( x )    PLL_INF( EEPROM_NAME,           \
@@ -565,6 +578,38 @@ static int ucEepromWriteMultiBytes( uint8_t ucAddressOffset, uint8_t *pucData, u
  */
 static int ucEepromReadMultiBytes( uint8_t ucAddressOffset, uint8_t *pucRegisterValue, uint8_t ucReadSize );
 
+/**
+ * @brief   Load the EEPROM register address into an I2C buffer
+ *
+ * @param   usAddressOffset     Address offset of register
+ * @param   pucBuffer           Buffer to load, must hold ucEepromAddressSize bytes
+ *
+ * @return  N/A
+ */
+static void vEepromLoadAddress( uint16_t usAddressOffset, uint8_t *pucBuffer );
+
+/**
+ * @brief   Write one or more bytes within a single EEPROM page using a 16-bit address
+ *
+ * @param   usAddressOffset     Address offset of register to write
+ * @param   pucData             Data to write
+ * @param   ucWriteSize         Number of bytes to write, must not cross a page boundary
+ *
+ * @return  OK                  Page successfully written and write cycle completed
+ *          ERROR               Page write failed
+ */
+static int iEepromWritePage( uint16_t usAddressOffset, uint8_t *pucData, uint8_t ucWriteSize );
+
+/**
+ * @brief   Poll the EEPROM for an ACK to detect the end of the internal write cycle
+ *
+ * @param   usAddressOffset     Address offset of the last write, resent as the poll
+ *
+ * @return  OK                  EEPROM acknowledged, write cycle complete
+ *          ERROR               EEPROM did not acknowledge within the retry limit
+ */
+static int iEepromAckPoll( uint16_t usAddressOffset );
+
 /**
  * @brief   Read a single byte from the EEPROM
  *
@@ -1411,6 +1456,124 @@ int iEEPROM_WriteRawValue( uint8_t *pucData, uint8_t ucSizeBytes, uint8_t ucEepr
     return iStatus;
 }
 
+/**
+ * @brief   Read raw data using a 16-bit address and arbitrary length
+ */
+int iEEPROM_ReadBulk( uint8_t *pucData, uint32_t ulSizeBytes, uint16_t usEepromAddr )
+{
+    int iStatus = ERROR;
+    uint32_t ulCapacity = ( ( uint32_t )pxThis->xEepromCfg.ucEepromPageSize *
+                            ( uint32_t )pxThis->xEepromCfg.ucEepromNumPages );
+
+    if( EEPROM_ONE_BYTE == pxThis->xEepromCfg.ucEepromAddressSize )
+    {
+        ulCapacity = ( ulCapacity > EEPROM_ONE_BYTE_ADDRESS_SPACE ) ?
+                     EEPROM_ONE_BYTE_ADDRESS_SPACE : ulCapacity;
+    }
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( NULL != pucData ) &&
+        ( EEPROM_ONE_BYTE <= pxThis->xEepromCfg.ucEepromAddressSize ) &&
+        ( EEPROM_TWO_BYTES >= pxThis->xEepromCfg.ucEepromAddressSize ) &&
+        ( 0 < ulSizeBytes ) &&
+        ( ulCapacity >= ulSizeBytes ) &&
+        ( ( ulCapacity - ulSizeBytes ) >= usEepromAddr ) )
+    {
+        uint8_t pucAddressOffset[ EEPROM_TWO_BYTES ] =
+        {
+            0
+        };
+
+        /*
+         * A sequential read auto-increments across page boundaries, so the whole
+         * range is fetched with a single addressed transaction.
+         */
+        vEepromLoadAddress( usEepromAddr, pucAddressOffset );
+        iStatus = iI2C_SendRecv( pxThis->xEepromCfg.ucEepromI2cBus,
+                                 pxThis->xEepromCfg.ucEepromSlaveAddress,
+                                 pucAddressOffset,
+                                 pxThis->xEepromCfg.ucEepromAddressSize,
+                                 pucData,
+                                 ulSizeBytes );
+        if( ERROR == iStatus )
+        {
+            INC_ERROR_COUNTER( EEPROM_ERROR_BULK_READ );
+        }
+        else
+        {
+            INC_STAT_COUNTER( EEPROM_STAT_BULK_READ );
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EEPROM_ERROR_VALIDATION );
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Write raw data using a 16-bit address and arbitrary length
+ */
+int iEEPROM_WriteBulk( uint8_t *pucData, uint32_t ulSizeBytes, uint16_t usEepromAddr )
+{
+    int iStatus = ERROR;
+    uint32_t ulCapacity = ( ( uint32_t )pxThis->xEepromCfg.ucEepromPageSize *
+                            ( uint32_t )pxThis->xEepromCfg.ucEepromNumPages );
+
+    if( EEPROM_ONE_BYTE == pxThis->xEepromCfg.ucEepromAddressSize )
+    {
+        ulCapacity = ( ulCapacity > EEPROM_ONE_BYTE_ADDRESS_SPACE ) ?
+                     EEPROM_ONE_BYTE_ADDRESS_SPACE : ulCapacity;
+    }
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( NULL != pucData ) &&
+        ( EEPROM_ONE_BYTE <= pxThis->xEepromCfg.ucEepromAddressSize ) &&
+        ( EEPROM_TWO_BYTES >= pxThis->xEepromCfg.ucEepromAddressSize ) &&
+        ( 0 < pxThis->xEepromCfg.ucEepromPageSize ) &&
+        ( 0 < ulSizeBytes ) &&
+        ( ulCapacity >= ulSizeBytes ) &&
+        ( ( ulCapacity - ulSizeBytes ) >= usEepromAddr ) )
+    {
+        uint32_t ulOffset    = usEepromAddr;
+        uint32_t ulRemaining = ulSizeBytes;
+
+        iStatus = OK;
+
+        /* Coalesce into as few page writes as possible, splitting only on page boundaries */
+        while( ( OK == iStatus ) && ( 0 < ulRemaining ) )
+        {
+            uint32_t ulPageSpace = pxThis->xEepromCfg.ucEepromPageSize -
+                                   ( ulOffset % pxThis->xEepromCfg.ucEepromPageSize );
+            uint8_t  ucChunk     = ( uint8_t )( ( ulRemaining < ulPageSpace ) ? ulRemaining : ulPageSpace );
+
+            iStatus = iEepromWritePage( ( uint16_t )ulOffset,
+                                        &pucData[ ulOffset - usEepromAddr ],
+                                        ucChunk );
+            ulOffset    += ucChunk;
+            ulRemaining -= ucChunk;
+        }
+
+        if( OK == iStatus )
+        {
+            INC_STAT_COUNTER( EEPROM_STAT_BULK_WRITE );
+        }
+        else
+        {
+            INC_ERROR_COUNTER( EEPROM_ERROR_BULK_WRITE );
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EEPROM_ERROR_VALIDATION );
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Print all the stats gathered by the eeprom driver
  */
@@ -1691,6 +1854,113 @@ static int ucEepromWriteMultiBytes( uint8_t ucAddressOffset, uint8_t *pucData, u
     return iStatus;
 }
 
+/**
+ * @brief   Load the EEPROM register address into an I2C buffer
+ */
+static void vEepromLoadAddress( uint16_t usAddressOffset, uint8_t *pucBuffer )
+{
+    if( NULL != pucBuffer )
+    {
+        if( EEPROM_2_BYTE_ADDRESS == pxThis->xEepromCfg.ucEepromAddressSize )
+        {
+            pucBuffer[ EEPROM_ADDRESS_BYTE_ZERO ] = ( uint8_t )( ( usAddressOffset >> EEPROM_BYTE_SHIFT ) &
+                                                                 EEPROM_BYTE_MASK );
+            pucBuffer[ EEPROM_ADDRESS_BYTE_ONE ]  = ( uint8_t )( usAddressOffset & EEPROM_BYTE_MASK );
+        }
+        else
+        {
+            pucBuffer[ EEPROM_ADDRESS_BYTE_ZERO ] = ( uint8_t )( usAddressOffset & EEPROM_BYTE_MASK );
+        }
+    }
+}
+
+/**
+ * @brief   Write one or more bytes within a single EEPROM page using a 16-bit address
+ */
+static int iEepromWritePage( uint16_t usAddressOffset, uint8_t *pucData, uint8_t ucWriteSize )
+{
+    int iStatus = ERROR;
+    uint8_t pucBuffer[ EEPROM_WRITE_MULTI_BYTE_SIZE_MAX ] =
+    {
+        0
+    };
+
+    if( ( NULL != pucData ) &&
+        ( 0 < ucWriteSize ) &&
+        ( pxThis->xEepromCfg.ucEepromPageSize >= ucWriteSize ) &&
+        ( EEPROM_WRITE_MULTI_BYTE_SIZE_MAX >= ( pxThis->xEepromCfg.ucEepromAddressSize + ucWriteSize ) ) )
+    {
+        uint32_t ulDataLen = pxThis->xEepromCfg.ucEepromAddressSize + ucWriteSize;
+
+        vEepromLoadAddress( usAddressOffset, pucBuffer );
+        pvOSAL_MemCpy( &pucBuffer[ pxThis->xEepromCfg.ucEepromAddressSize ], pucData, ucWriteSize );
+
+        iStatus = iI2C_Send( pxThis->xEepromCfg.ucEepromI2cBus,
+                             pxThis->xEepromCfg.ucEepromSlaveAddress,
+                             pucBuffer,
+                             ulDataLen );
+        if( ERROR == iStatus )
+        {
+            INC_ERROR_COUNTER( EEPROM_ERROR_PAGE_WRITE );
+        }
+        else
+        {
+            INC_STAT_COUNTER( EEPROM_STAT_PAGE_WRITE );
+
+            /* Wait only as long as the part actually needs to commit the page */
+            iStatus = iEepromAckPoll( usAddressOffset );
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EEPROM_ERROR_VALIDATION );
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Poll the EEPROM for an ACK to detect the end of the internal write cycle
+ */
+static int iEepromAckPoll( uint16_t usAddressOffset )
+{
+    int iStatus = ERROR;
+    int i       = 0;
+    uint8_t pucAddressOffset[ EEPROM_TWO_BYTES ] =
+    {
+        0
+    };
+
+    /*
+     * The EEPROM NACKs its slave address while the write cycle is in progress,
+     * so an address-only write doubles as a harmless "are you done" probe.
+     * iI2C_Probe treats the NACK as an answer rather than a bus fault, so
+     * polling does not reset the controller or count I2C errors.
+     */
+    vEepromLoadAddress( usAddressOffset, pucAddressOffset );
+    for( i = 0; i < EEPROM_ACK_POLL_RETRY_MAX; i++ )
+    {
+        if( OK == iI2C_Probe( pxThis->xEepromCfg.ucEepromI2cBus,
+                              pxThis->xEepromCfg.ucEepromSlaveAddress,
+                              pucAddressOffset,
+                              pxThis->xEepromCfg.ucEepromAddressSize ) )
+        {
+            iStatus = OK;
+            break;
+        }
+
+        INC_STAT_COUNTER( EEPROM_STAT_ACK_POLL_RETRY );
+        iOSAL_Task_SleepMs( EEPROM_ACK_POLL_INTERVAL_MS );
+    }
+
+    if( OK != iStatus )
+    {
+        INC_ERROR_COUNTER( EEPROM_ERROR_ACK_POLL_TIMEOUT );
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Read a single byte from the EEPROM
  */
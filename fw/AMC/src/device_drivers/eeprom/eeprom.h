@@ -323,6 +323,35 @@ int iEEPROM_ReadRawValue( uint8_t *pucData, uint8_t ucSizeBytes, uint8_t ucEepro
  */
 int iEEPROM_WriteRawValue( uint8_t *pucData, uint8_t ucSizeBytes, uint8_t ucEepromAddr );
 
+/**
+ * @brief   Read raw data using a 16-bit address and arbitrary length
+ *
+ * @param   pucData        Buffer to store the raw data in
+ * @param   ulSizeBytes    The number of bytes to read
+ * @param   usEepromAddr   Address in EEPROM to read data from
+ *
+ * @return  OK             Data read successfully
+ *          ERROR          Data not read successfully
+ *
+ * @note    The range is read with a single sequential transaction.
+ */
+int iEEPROM_ReadBulk( uint8_t *pucData, uint32_t ulSizeBytes, uint16_t usEepromAddr );
+
+/**
+ * @brief   Write raw data using a 16-bit address and arbitrary length
+ *
+ * @param   pucData        Buffer of raw data to write
+ * @param   ulSizeBytes    The number of bytes to write from the buffer
+ * @param   usEepromAddr   Address in EEPROM to write data to
+ *
+ * @return  OK             Data written successfully
+ *          ERROR          Data not written successfully
+ *
+ * @note    Data is split only on page boundaries and each page write
+ *          completes via ACK polling rather than a fixed delay.
+ */
+int iEEPROM_WriteBulk( uint8_t *pucData, uint32_t ulSizeBytes, uint16_t usEepromAddr );
+
 /**
  * @brief   Print all the stats gathered by the eeprom driver
  *
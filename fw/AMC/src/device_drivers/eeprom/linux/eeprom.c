@@ -1006,6 +1006,52 @@ int iEEPROM_WriteRawValue( uint8_t *pucData, uint8_t ucSizeBytes, uint8_t ucEepr
     return iStatus;
 }
 
+/**
+ * @brief   Read raw data using a 16-bit address and arbitrary length
+ */
+int iEEPROM_ReadBulk( uint8_t *pucData, uint32_t ulSizeBytes, uint16_t usEepromAddr )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( NULL != pucData ) &&
+        ( EEPROM_ADDRESS_SIZE_UNINITIALISED != pxThis->xEepromCfg.ucEepromAddressSize ) &&
+        ( 0 < ulSizeBytes ) )
+    {
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EEPROM_ERROR_VALIDATION );
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Write raw data using a 16-bit address and arbitrary length
+ */
+int iEEPROM_WriteBulk( uint8_t *pucData, uint32_t ulSizeBytes, uint16_t usEepromAddr )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( NULL != pucData ) &&
+        ( EEPROM_ADDRESS_SIZE_UNINITIALISED != pxThis->xEepromCfg.ucEepromAddressSize ) &&
+        ( 0 < ulSizeBytes ) )
+    {
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EEPROM_ERROR_VALIDATION );
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Print all the stats gathered by the eeprom driver
  */
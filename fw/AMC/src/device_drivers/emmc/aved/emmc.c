@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: MIT
  *
  * This file contains the user API definitions for the EMMC driver.
+ * Requests are queued and run by emmc_queue.c, which calls back in here per chunk.
  *
  * @file emmc.c
  *
@@ -19,6 +20,7 @@
 #include "pll.h"
 #include "osal.h"
 #include "emmc.h"
+#include "emmc_queue.h"
 #include "profile_hal.h"
 
 
@@ -31,11 +33,16 @@
 
 #define EMMC_NAME                               "EMMC"
 #define EMMC_WAIT_TIMEOUT_MS                    ( 100 )
-#define EMMC_BLOCK_BITSHIFT                     ( 9 )
+#define EMMC_BLOCK_BITSHIFT                     ( EMMC_QUEUE_BLOCK_BITSHIFT )
 #define EMMC_ERASE_BLOCK_INCREMENT              ( 0x800000 )
 #define EMMC_ERASE_BLOCK_INCREMENT_MINUS_ONE    ( EMMC_ERASE_BLOCK_INCREMENT - 1 )
 #define EMMC_FINAL_BLOCK                        ( HAL_EMMC_MAX_BLOCKS - 1 )
 
+/* XSdPs describes a transfer with 32 ADMA2 descriptors of up to 64KB each */
+#define EMMC_ADMA2_DESC_COUNT                   ( 32 )
+#define EMMC_ADMA2_DESC_MAX_BYTES               ( 0x10000 )
+#define EMMC_ADMA2_MAX_BLOCKS                   ( ( EMMC_ADMA2_DESC_COUNT * EMMC_ADMA2_DESC_MAX_BYTES ) >> EMMC_BLOCK_BITSHIFT )
+
 /* Stat & Error definitions */
 #define EMMC_STATS( DO )                                     \
     DO( EMMC_STATS_INIT_COMPLETED )                          \
@@ -138,15 +145,20 @@ static EMMC_PRIVATE_DATA *pxThis = &xLocalData;
 /******************************************************************************/
 
 /**
- * @brief   Check the parameters are valid
+ * @brief   Transfer one chunk with the SD controller
  *
- * @param   ullBlockAddress    The address of the initial block
- * @param   ulBlockCount       The total number of blocks
+ * @param   xType              Read or write
+ * @param   ulBlockAddress     The first block to transfer
+ * @param   ulBlockCount       The number of blocks, at most EMMC_ADMA2_MAX_BLOCKS
+ * @param   pucBuff            The buffer to read into or write from
  *
- * @return  OK                 The parameters are valid
- *          ERROR              The parameters are not valid
+ * @return  OK                 Transfer was successful
+ *          ERROR              Transfer failed
  */
-static int iValidateBlockCount( uint64_t ullBlockAddress, uint32_t ulBlockCount );
+static int iTransferChunk( EMMC_REQUEST_TYPE xType,
+                           uint32_t ulBlockAddress,
+                           uint32_t ulBlockCount,
+                           uint8_t *pucBuff );
 
 
 /******************************************************************************/
@@ -201,6 +213,15 @@ int iEMMC_Initialise( uint32_t ulBaseAddr )
             INC_STAT_COUNTER( EMMC_STATS_CREATE_MUTEX )
         }
 
+        /* Each XSdPs transfer is described by one ADMA2 descriptor table */
+        if( ( OK == iStatus ) &&
+            ( OK != iEMMC_QueueInitialise( iTransferChunk,
+                                           EMMC_ADMA2_MAX_BLOCKS,
+                                           pxThis->xSdInstance.SectorCount ) ) )
+        {
+            iStatus = ERROR;
+        }
+
         if( OK == iStatus )
         {
             pxThis->iInitialised = TRUE;
@@ -216,99 +237,6 @@ int iEMMC_Initialise( uint32_t ulBaseAddr )
     return iStatus;
 }
 
-/**
- * @brief   Read from the EMMC.
- */
-int iEMMC_Read( uint64_t ullAddress, uint32_t ulBlockCount , uint8_t *pucReadBuff )
-{
-    int iStatus = ERROR;
-
-    if( ( TRUE == pxThis->iInitialised ) &&
-        ( NULL != pucReadBuff ) &&
-        ( OK == iValidateBlockCount( ullAddress, ulBlockCount ) ) )
-    {
-        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
-                                                  EMMC_WAIT_TIMEOUT_MS ) )
-        {
-            INC_STAT_COUNTER( EMMC_STATS_TAKE_MUTEX )
-
-            uint32_t ulBlockAddress = ullAddress >> EMMC_BLOCK_BITSHIFT;
-
-            iStatus = XSdPs_ReadPolled( &( pxThis->xSdInstance ), ulBlockAddress, ulBlockCount, pucReadBuff );
-            if( OK == iStatus )
-            {
-                INC_STAT_COUNTER( EMMC_STATS_EMMC_READ )
-            }
-            else
-            {
-                INC_ERROR_COUNTER( EMMC_ERRORS_EMMC_READ_FAILED )
-            }
-
-            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
-            {
-                INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_RELEASE_FAILED )
-                iStatus = ERROR;
-            }
-            else
-            {
-                INC_STAT_COUNTER( EMMC_STATS_RELEASE_MUTEX )
-            }
-        }
-        else
-        {
-            INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_TAKE_FAILED )
-        }
-    }
-    return iStatus;
-}
-
-/**
- * @brief   Write to the EMMC.
- */
-int iEMMC_Write( uint64_t ullAddress, uint32_t ulBlockCount , const uint8_t *pucWriteBuff )
-{
-    int iStatus = ERROR;
-
-    if( ( TRUE == pxThis->iInitialised ) &&
-        ( NULL != pucWriteBuff ) &&
-        ( OK == iValidateBlockCount( ullAddress, ulBlockCount ) ) )
-    {
-        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
-                                                  EMMC_WAIT_TIMEOUT_MS ) )
-        {
-            INC_STAT_COUNTER( EMMC_STATS_TAKE_MUTEX )
-
-            uint32_t ulBlockAddress = ullAddress >> EMMC_BLOCK_BITSHIFT;
-
-            iStatus = XSdPs_WritePolled( &( pxThis->xSdInstance ), ulBlockAddress, ulBlockCount, pucWriteBuff );
-            if( OK == iStatus )
-            {
-                INC_STAT_COUNTER( EMMC_STATS_EMMC_WRITE )
-            }
-            else
-            {
-                INC_ERROR_COUNTER( EMMC_ERRORS_EMMC_WRITE_FAILED )
-            }
-
-            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
-            {
-                INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_RELEASE_FAILED )
-                iStatus = ERROR;
-            }
-            else
-            {
-                INC_STAT_COUNTER( EMMC_STATS_RELEASE_MUTEX )
-            }
-        }
-        else
-        {
-            INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_TAKE_FAILED )
-        }
-    }
-    return iStatus;
-}
-
-
 /**
  * @brief   Erase blocks in the EMMC.
  */
@@ -511,7 +439,7 @@ int iEMMC_PrintStatistics( void )
             PRINT_ERROR_COUNTER( i );
         }
         PLL_INF( EMMC_NAME, "============================================================\n\r" );
-        iStatus = OK;
+        iStatus = iEMMC_QueuePrintStatistics();
     }
     else
     {
@@ -534,7 +462,7 @@ int iEMMC_ClearStatistics( void )
     {
         pvOSAL_MemSet( pxThis->pulStatCounters, 0, sizeof( pxThis->pulStatCounters ) );
         pvOSAL_MemSet( pxThis->pulErrorCounters, 0, sizeof( pxThis->pulErrorCounters ) );
-        iStatus = OK;
+        iStatus = iEMMC_QueueClearStatistics();
     }
     else
     {
@@ -545,23 +473,58 @@ int iEMMC_ClearStatistics( void )
 }
 
 /**
- * @brief   Check the parameters are valid
+ * @brief   Transfer one chunk with the SD controller
  */
-static int iValidateBlockCount( uint64_t ullAddress, uint32_t ulBlockCount )
+static int iTransferChunk( EMMC_REQUEST_TYPE xType,
+                           uint32_t ulBlockAddress,
+                           uint32_t ulBlockCount,
+                           uint8_t *pucBuff )
 {
-    int         iStatus = ERROR;
-    uint32_t    ulBlockAddress = 0;
+    int iStatus = ERROR;
 
-    if( TRUE == pxThis->iInitialised )
+    if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                              EMMC_WAIT_TIMEOUT_MS ) )
     {
-        if( 0 == ( ullAddress % pxThis->xSdInstance.BlkSize ) )
+        INC_STAT_COUNTER( EMMC_STATS_TAKE_MUTEX )
+
+        if( EMMC_REQUEST_TYPE_READ == xType )
         {
-            ulBlockAddress = ullAddress >> EMMC_BLOCK_BITSHIFT;
-            if( ( ulBlockAddress + ulBlockCount ) <= pxThis->xSdInstance.SectorCount )
+            iStatus = XSdPs_ReadPolled( &( pxThis->xSdInstance ), ulBlockAddress, ulBlockCount, pucBuff );
+            if( OK == iStatus )
+            {
+                INC_STAT_COUNTER( EMMC_STATS_EMMC_READ )
+            }
+            else
             {
-                iStatus = OK;
+                INC_ERROR_COUNTER( EMMC_ERRORS_EMMC_READ_FAILED )
             }
         }
+        else
+        {
+            iStatus = XSdPs_WritePolled( &( pxThis->xSdInstance ), ulBlockAddress, ulBlockCount, pucBuff );
+            if( OK == iStatus )
+            {
+                INC_STAT_COUNTER( EMMC_STATS_EMMC_WRITE )
+            }
+            else
+            {
+                INC_ERROR_COUNTER( EMMC_ERRORS_EMMC_WRITE_FAILED )
+            }
+        }
+
+        if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+        {
+            INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_RELEASE_FAILED )
+            iStatus = ERROR;
+        }
+        else
+        {
+            INC_STAT_COUNTER( EMMC_STATS_RELEASE_MUTEX )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_TAKE_FAILED )
     }
 
     return iStatus;
@@ -19,11 +19,83 @@
 /* Defines                                                                    */
 /******************************************************************************/
 
+#define EMMC_QUEUE_DEPTH                ( 4 )
+
+
+/******************************************************************************/
+/* Enums                                                                      */
+/******************************************************************************/
+
+/**
+ * @enum    EMMC_REQUEST_TYPE
+ * @brief   The transfer an EMMC request performs
+ */
+typedef enum EMMC_REQUEST_TYPE
+{
+    EMMC_REQUEST_TYPE_READ = 0,
+    EMMC_REQUEST_TYPE_WRITE,
+
+    MAX_EMMC_REQUEST_TYPE
+
+} EMMC_REQUEST_TYPE;
+
+/**
+ * @enum    EMMC_REQUEST_STATE
+ * @brief   Progress of an EMMC request
+ */
+typedef enum EMMC_REQUEST_STATE
+{
+    EMMC_REQUEST_STATE_IDLE = 0,
+    EMMC_REQUEST_STATE_QUEUED,
+    EMMC_REQUEST_STATE_ACTIVE,
+    EMMC_REQUEST_STATE_DONE,
+
+    MAX_EMMC_REQUEST_STATE
+
+} EMMC_REQUEST_STATE;
+
 
 /******************************************************************************/
 /* Typedefs                                                                   */
 /******************************************************************************/
 
+struct EMMC_REQUEST;
+
+/**
+ * @brief   Called from the EMMC task when a request completes
+ *
+ * @param   pxRequest       The completed request, iStatus holds the result
+ */
+typedef void ( EMMC_REQUEST_CALLBACK )( struct EMMC_REQUEST *pxRequest );
+
+
+/******************************************************************************/
+/* Structs                                                                    */
+/******************************************************************************/
+
+/**
+ * @struct  EMMC_REQUEST
+ * @brief   An asynchronous EMMC transfer
+ *
+ * @note    The request and its buffer belong to the driver from iEMMC_Submit
+ *          until the request is complete
+ */
+typedef struct EMMC_REQUEST
+{
+    EMMC_REQUEST_TYPE               xType;
+    uint64_t                        ullAddress;         /* EMMC byte address, block aligned */
+    uint32_t                        ulBlockCount;
+    uint8_t                         *pucBuff;
+
+    void                            *pvOsalSemHdl;      /* optional, posted on completion */
+    EMMC_REQUEST_CALLBACK           *pxCallback;        /* optional, called on completion */
+    void                            *pvContext;         /* for the caller's use */
+
+    volatile EMMC_REQUEST_STATE     xState;
+    int                             iStatus;            /* OK or ERROR, valid once complete */
+
+} EMMC_REQUEST;
+
 
 /******************************************************************************/
 /* Driver External APIs                                                       */
@@ -40,7 +112,7 @@
 int iEMMC_Initialise( uint32_t ulBaseAddr );
 
 /**
- * @brief   Read from the EMMC.
+ * @brief   Read from the EMMC, waiting for the transfer to complete.
  *
  * @param   ullAddress          The EMMC address to read from
  * @param   ulBlockCount        The number of blocks to read
@@ -52,7 +124,7 @@ int iEMMC_Initialise( uint32_t ulBaseAddr );
 int iEMMC_Read( uint64_t ullAddress, uint32_t ulBlockCount, uint8_t *pucReadBuff );
 
 /**
- * @brief   Write to the EMMC.
+ * @brief   Write to the EMMC, waiting for the transfer to complete.
  *
  * @param   ullAddress          The EMMC address to write to
  * @param   ulBlockCount        The number of blocks to write
@@ -63,6 +135,31 @@ int iEMMC_Read( uint64_t ullAddress, uint32_t ulBlockCount, uint8_t *pucReadBuff
  */
 int iEMMC_Write( uint64_t ullAddress, uint32_t ulBlockCount, const uint8_t *pucWriteBuff );
 
+/**
+ * @brief   Queue a transfer to or from the EMMC.
+ *
+ * @param   pxRequest           The request to queue
+ *
+ * @return  OK                  Request queued, completion is signalled through
+ *                              the request semaphore and/or callback
+ *          ERROR               Request invalid or the queue is full
+ *
+ * @note    Transfers run in order on the EMMC task, large transfers are split
+ *          into the largest chunk one ADMA2 descriptor table can describe.
+ */
+int iEMMC_Submit( EMMC_REQUEST *pxRequest );
+
+/**
+ * @brief   Get the number of requests queued or in progress.
+ *
+ * @param   pulQueued           Requests currently queued or in progress
+ * @param   pulPeakQueued       The most requests queued at once
+ *
+ * @return  OK                  Depth retrieved successfully
+ *          ERROR               Depth not retrieved
+ */
+int iEMMC_GetQueueDepth( uint32_t *pulQueued, uint32_t *pulPeakQueued );
+
 /**
  * @brief   Erase blocks in the EMMC.
  * @param   ulStartBlockAddress Address of the first write block to be erased.
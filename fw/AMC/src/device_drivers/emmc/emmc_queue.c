@@ -0,0 +1,617 @@
+/**
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains the request queue shared by the EMMC driver backends.
+ *
+ * @file emmc_queue.c
+ *
+ */
+
+/******************************************************************************/
+/* Includes                                                                   */
+/******************************************************************************/
+
+#include "util.h"
+#include "pll.h"
+#include "osal.h"
+#include "emmc_queue.h"
+
+
+/******************************************************************************/
+/* Defines                                                                    */
+/******************************************************************************/
+
+#define UPPER_FIREWALL                          ( 0xBABECAFE )
+#define LOWER_FIREWALL                          ( 0xDEADFACE )
+
+#define EMMC_QUEUE_NAME                         "EMMC_QUEUE"
+#define EMMC_QUEUE_WAIT_TIMEOUT_MS              ( 100 )
+
+#define EMMC_TASK_PRIO                          ( 6 )
+#define EMMC_TASK_STACK                         ( 0x1000 )
+
+/* Stat & Error definitions */
+#define EMMC_QUEUE_STATS( DO )                               \
+    DO( EMMC_QUEUE_STATS_INIT_COMPLETED )                    \
+    DO( EMMC_QUEUE_STATS_CREATE_MUTEX )                      \
+    DO( EMMC_QUEUE_STATS_TAKE_MUTEX )                        \
+    DO( EMMC_QUEUE_STATS_RELEASE_MUTEX )                     \
+    DO( EMMC_QUEUE_STATS_CREATE_MBOX )                       \
+    DO( EMMC_QUEUE_STATS_CREATE_SEMAPHORE )                  \
+    DO( EMMC_QUEUE_STATS_CREATE_TASK )                       \
+    DO( EMMC_QUEUE_STATS_REQUEST_SUBMITTED )                 \
+    DO( EMMC_QUEUE_STATS_REQUEST_COMPLETED )                 \
+    DO( EMMC_QUEUE_STATS_CHUNK_TRANSFERRED )                 \
+    DO( EMMC_QUEUE_STATS_MAX )
+
+#define EMMC_QUEUE_ERRORS( DO )                              \
+    DO( EMMC_QUEUE_ERRORS_VALIDATION_FAILED )                \
+    DO( EMMC_QUEUE_ERRORS_MUTEX_CREATE_FAILED )              \
+    DO( EMMC_QUEUE_ERRORS_MUTEX_RELEASE_FAILED )             \
+    DO( EMMC_QUEUE_ERRORS_MUTEX_TAKE_FAILED )                \
+    DO( EMMC_QUEUE_ERRORS_MBOX_CREATE_FAILED )               \
+    DO( EMMC_QUEUE_ERRORS_MBOX_POST_FAILED )                 \
+    DO( EMMC_QUEUE_ERRORS_SEMAPHORE_CREATE_FAILED )          \
+    DO( EMMC_QUEUE_ERRORS_SEMAPHORE_PEND_FAILED )            \
+    DO( EMMC_QUEUE_ERRORS_SEMAPHORE_POST_FAILED )            \
+    DO( EMMC_QUEUE_ERRORS_TASK_CREATE_FAILED )               \
+    DO( EMMC_QUEUE_ERRORS_QUEUE_FULL )                       \
+    DO( EMMC_QUEUE_ERRORS_CHUNK_FAILED )                     \
+    DO( EMMC_QUEUE_ERRORS_MAX )
+
+#define PRINT_STAT_COUNTER( x )         PLL_INF( EMMC_QUEUE_NAME, "%50s . . . . %d\r\n",    \
+                                                 EMMC_QUEUE_STATS_STR[ x ],                 \
+                                                 pxThis->pulStatCounters[ x ] )
+#define PRINT_ERROR_COUNTER( x )        PLL_INF( EMMC_QUEUE_NAME, "%50s . . . . %d\r\n",    \
+                                                 EMMC_QUEUE_ERRORS_STR[ x ],                \
+                                                 pxThis->pulErrorCounters[ x ] )
+
+#define INC_STAT_COUNTER( x )           { if( x < EMMC_QUEUE_STATS_MAX )pxThis->pulStatCounters[ x ]++; }
+#define INC_ERROR_COUNTER( x )          { if( x < EMMC_QUEUE_ERRORS_MAX )pxThis->pulErrorCounters[ x ]++; }
+
+
+/******************************************************************************/
+/* Enums                                                                      */
+/******************************************************************************/
+
+/**
+ * @enum    EMMC_QUEUE_STATS
+ * @brief   Enumeration of stats counters for the request queue
+ */
+UTIL_MAKE_ENUM_AND_STRINGS( EMMC_QUEUE_STATS, EMMC_QUEUE_STATS, EMMC_QUEUE_STATS_STR )
+
+/**
+ * @enum    EMMC_QUEUE_ERRORS
+ * @brief   Enumeration of stats errors for the request queue
+ */
+UTIL_MAKE_ENUM_AND_STRINGS( EMMC_QUEUE_ERRORS, EMMC_QUEUE_ERRORS, EMMC_QUEUE_ERRORS_STR )
+
+
+/******************************************************************************/
+/* Structs                                                                    */
+/******************************************************************************/
+
+/**
+ * @struct  EMMC_QUEUE_PRIVATE_DATA
+ * @brief   Structure to hold the request queue's private data
+ */
+typedef struct EMMC_QUEUE_PRIVATE_DATA
+{
+    uint32_t                    ulUpperFirewall;
+
+    EMMC_QUEUE_TRANSFER_FUNC    *pxTransferFunc;
+    uint32_t                    ulMaxChunkBlocks;
+    uint32_t                    ulDeviceBlocks;
+    int                         iInitialised;
+
+    void                        *pvOsalMBoxHdl;
+    void                        *pvOsalTaskHdl;
+    void                        *pvOsalSyncMutexHdl;
+    void                        *pvOsalSyncSemHdl;
+
+    uint32_t                    ulQueued;
+    uint32_t                    ulPeakQueued;
+
+    uint32_t                    pulStatCounters[ EMMC_QUEUE_STATS_MAX ];
+    uint32_t                    pulErrorCounters[ EMMC_QUEUE_ERRORS_MAX ];
+
+    uint32_t                    ulLowerFirewall;
+
+} EMMC_QUEUE_PRIVATE_DATA;
+
+
+/******************************************************************************/
+/* Local Variables                                                            */
+/******************************************************************************/
+
+static EMMC_QUEUE_PRIVATE_DATA xLocalData =
+{
+    UPPER_FIREWALL,                         /* ulUpperFirewall */
+    NULL,                                   /* pxTransferFunc */
+    0,                                      /* ulMaxChunkBlocks */
+    0,                                      /* ulDeviceBlocks */
+    FALSE,                                  /* iInitialised */
+    NULL,                                   /* pvOsalMBoxHdl */
+    NULL,                                   /* pvOsalTaskHdl */
+    NULL,                                   /* pvOsalSyncMutexHdl */
+    NULL,                                   /* pvOsalSyncSemHdl */
+    0,                                      /* ulQueued */
+    0,                                      /* ulPeakQueued */
+    { 0 },                                  /* pulStatCounters */
+    { 0 },                                  /* pulErrorCounters */
+    LOWER_FIREWALL                          /* ulLowerFirewall */
+};
+static EMMC_QUEUE_PRIVATE_DATA *pxThis = &xLocalData;
+
+
+/******************************************************************************/
+/* Private Function declarations                                              */
+/******************************************************************************/
+
+/**
+ * @brief   Check the parameters are valid
+ *
+ * @param   ullAddress         The byte address of the initial block
+ * @param   ulBlockCount       The total number of blocks
+ *
+ * @return  OK                 The parameters are valid
+ *          ERROR              The parameters are not valid
+ */
+static int iValidateBlockCount( uint64_t ullAddress, uint32_t ulBlockCount );
+
+/**
+ * @brief   Task to run queued requests in order
+ *
+ * @param   pvArgs             Pointer to task args (unused)
+ */
+static void vEmmcTask( void *pvArgs );
+
+/**
+ * @brief   Run the transfer for a request, one backend chunk at a time
+ *
+ * @param   pxRequest          The request to run
+ *
+ * @return  OK                 Transfer was successful
+ *          ERROR              Transfer failed
+ */
+static int iRunRequest( EMMC_REQUEST *pxRequest );
+
+/**
+ * @brief   Mark a request complete and signal its owner
+ *
+ * @param   pxRequest          The completed request
+ */
+static void vCompleteRequest( EMMC_REQUEST *pxRequest );
+
+/**
+ * @brief   Submit a request and wait for it to complete
+ *
+ * @param   pxRequest          The request to run
+ *
+ * @return  OK                 Transfer was successful
+ *          ERROR              Transfer failed
+ */
+static int iRunSyncRequest( EMMC_REQUEST *pxRequest );
+
+
+/******************************************************************************/
+/* Public Function implementations                                            */
+/******************************************************************************/
+
+/**
+ * @brief   Create the request queue and the task that services it
+ */
+int iEMMC_QueueInitialise( EMMC_QUEUE_TRANSFER_FUNC *pxTransferFunc,
+                           uint32_t ulMaxChunkBlocks,
+                           uint32_t ulDeviceBlocks )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( FALSE == pxThis->iInitialised ) &&
+        ( NULL != pxTransferFunc ) &&
+        ( 0 < ulMaxChunkBlocks ) )
+    {
+        pxThis->pxTransferFunc   = pxTransferFunc;
+        pxThis->ulMaxChunkBlocks = ulMaxChunkBlocks;
+        pxThis->ulDeviceBlocks   = ulDeviceBlocks;
+
+        if( OSAL_ERRORS_NONE != iOSAL_MBox_Create( &( pxThis->pvOsalMBoxHdl ),
+                                                   EMMC_QUEUE_DEPTH,
+                                                   sizeof( EMMC_REQUEST * ),
+                                                   "EMMC request mbox" ) )
+        {
+            PLL_ERR( EMMC_QUEUE_NAME, "Error initialising mbox\r\n" );
+            INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_MBOX_CREATE_FAILED )
+        }
+        else if( OSAL_ERRORS_NONE != iOSAL_Mutex_Create( &( pxThis->pvOsalSyncMutexHdl ),
+                                                         "EMMC sync mutex" ) )
+        {
+            INC_STAT_COUNTER( EMMC_QUEUE_STATS_CREATE_MBOX )
+            PLL_ERR( EMMC_QUEUE_NAME, "Error initialising sync mutex\r\n" );
+            INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_MUTEX_CREATE_FAILED )
+        }
+        else if( OSAL_ERRORS_NONE != iOSAL_Semaphore_Create( &( pxThis->pvOsalSyncSemHdl ),
+                                                             0, 1, "EMMC sync sem" ) )
+        {
+            INC_STAT_COUNTER( EMMC_QUEUE_STATS_CREATE_MBOX )
+            INC_STAT_COUNTER( EMMC_QUEUE_STATS_CREATE_MUTEX )
+            PLL_ERR( EMMC_QUEUE_NAME, "Error initialising sync semaphore\r\n" );
+            INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_SEMAPHORE_CREATE_FAILED )
+        }
+        else
+        {
+            INC_STAT_COUNTER( EMMC_QUEUE_STATS_CREATE_MBOX )
+            INC_STAT_COUNTER( EMMC_QUEUE_STATS_CREATE_MUTEX )
+            INC_STAT_COUNTER( EMMC_QUEUE_STATS_CREATE_SEMAPHORE )
+
+            /* The task may run straight away, so the queue must be usable first */
+            pxThis->iInitialised = TRUE;
+
+            if( OSAL_ERRORS_NONE != iOSAL_Task_Create( &( pxThis->pvOsalTaskHdl ),
+                                                       vEmmcTask,
+                                                       EMMC_TASK_STACK,
+                                                       NULL,
+                                                       EMMC_TASK_PRIO,
+                                                       "EMMC_Task" ) )
+            {
+                pxThis->iInitialised = FALSE;
+                PLL_ERR( EMMC_QUEUE_NAME, "Error creating task\r\n" );
+                INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_TASK_CREATE_FAILED )
+            }
+            else
+            {
+                INC_STAT_COUNTER( EMMC_QUEUE_STATS_CREATE_TASK )
+                INC_STAT_COUNTER( EMMC_QUEUE_STATS_INIT_COMPLETED )
+                iStatus = OK;
+            }
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Read from the EMMC, waiting for the transfer to complete.
+ */
+int iEMMC_Read( uint64_t ullAddress, uint32_t ulBlockCount , uint8_t *pucReadBuff )
+{
+    EMMC_REQUEST xRequest = { 0 };
+
+    xRequest.xType        = EMMC_REQUEST_TYPE_READ;
+    xRequest.ullAddress   = ullAddress;
+    xRequest.ulBlockCount = ulBlockCount;
+    xRequest.pucBuff      = pucReadBuff;
+
+    return iRunSyncRequest( &xRequest );
+}
+
+/**
+ * @brief   Write to the EMMC, waiting for the transfer to complete.
+ */
+int iEMMC_Write( uint64_t ullAddress, uint32_t ulBlockCount , const uint8_t *pucWriteBuff )
+{
+    EMMC_REQUEST xRequest = { 0 };
+
+    xRequest.xType        = EMMC_REQUEST_TYPE_WRITE;
+    xRequest.ullAddress   = ullAddress;
+    xRequest.ulBlockCount = ulBlockCount;
+    xRequest.pucBuff      = ( uint8_t * )pucWriteBuff;
+
+    return iRunSyncRequest( &xRequest );
+}
+
+/**
+ * @brief   Queue a transfer to or from the EMMC.
+ */
+int iEMMC_Submit( EMMC_REQUEST *pxRequest )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pxRequest ) &&
+        ( NULL != pxRequest->pucBuff ) &&
+        ( MAX_EMMC_REQUEST_TYPE > pxRequest->xType ) &&
+        ( OK == iValidateBlockCount( pxRequest->ullAddress, pxRequest->ulBlockCount ) ) )
+    {
+        vOSAL_EnterCritical();
+        if( EMMC_QUEUE_DEPTH > pxThis->ulQueued )
+        {
+            pxThis->ulQueued++;
+            pxThis->ulPeakQueued = MAX( pxThis->ulPeakQueued, pxThis->ulQueued );
+            iStatus = OK;
+        }
+        vOSAL_ExitCritical();
+
+        if( OK != iStatus )
+        {
+            INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_QUEUE_FULL )
+        }
+        else
+        {
+            pxRequest->xState  = EMMC_REQUEST_STATE_QUEUED;
+            pxRequest->iStatus = ERROR;
+
+            if( OSAL_ERRORS_NONE != iOSAL_MBox_Post( pxThis->pvOsalMBoxHdl,
+                                                     ( void * )&pxRequest,
+                                                     OSAL_TIMEOUT_NO_WAIT ) )
+            {
+                vOSAL_EnterCritical();
+                pxThis->ulQueued--;
+                vOSAL_ExitCritical();
+
+                pxRequest->xState = EMMC_REQUEST_STATE_IDLE;
+                INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_MBOX_POST_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( EMMC_QUEUE_STATS_REQUEST_SUBMITTED )
+            }
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Get the number of requests queued or in progress.
+ */
+int iEMMC_GetQueueDepth( uint32_t *pulQueued, uint32_t *pulPeakQueued )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pulQueued ) &&
+        ( NULL != pulPeakQueued ) )
+    {
+        *pulQueued     = pxThis->ulQueued;
+        *pulPeakQueued = pxThis->ulPeakQueued;
+        iStatus        = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Print the queue stats and depth
+ */
+int iEMMC_QueuePrintStatistics( void )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) )
+    {
+        int i = 0;
+        PLL_INF( EMMC_QUEUE_NAME, "============================================================\n\r" );
+        PLL_INF( EMMC_QUEUE_NAME, "EMMC Queue Statistics:\n\r" );
+        for( i = 0; i < EMMC_QUEUE_STATS_MAX; i++ )
+        {
+            PRINT_STAT_COUNTER( i );
+        }
+        PLL_INF( EMMC_QUEUE_NAME, "%50s . . . . %d\r\n", "EMMC_QUEUE_DEPTH", pxThis->ulQueued );
+        PLL_INF( EMMC_QUEUE_NAME, "%50s . . . . %d\r\n", "EMMC_QUEUE_PEAK_DEPTH", pxThis->ulPeakQueued );
+        PLL_INF( EMMC_QUEUE_NAME, "------------------------------------------------------------\n\r" );
+        PLL_INF( EMMC_QUEUE_NAME, "EMMC Queue Errors:\n\r" );
+        for( i = 0; i < EMMC_QUEUE_ERRORS_MAX; i++ )
+        {
+            PRINT_ERROR_COUNTER( i );
+        }
+        PLL_INF( EMMC_QUEUE_NAME, "============================================================\n\r" );
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Clear the queue stats and reset the peak depth
+ */
+int iEMMC_QueueClearStatistics( void )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) )
+    {
+        pvOSAL_MemSet( pxThis->pulStatCounters, 0, sizeof( pxThis->pulStatCounters ) );
+        pvOSAL_MemSet( pxThis->pulErrorCounters, 0, sizeof( pxThis->pulErrorCounters ) );
+        pxThis->ulPeakQueued = pxThis->ulQueued;
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+
+/******************************************************************************/
+/* Private Function implementations                                           */
+/******************************************************************************/
+
+/**
+ * @brief   Check the parameters are valid
+ */
+static int iValidateBlockCount( uint64_t ullAddress, uint32_t ulBlockCount )
+{
+    int iStatus = ERROR;
+
+    if( 0 == ( ullAddress % EMMC_QUEUE_BLOCK_SIZE ) )
+    {
+        uint64_t ullBlockAddress = ullAddress >> EMMC_QUEUE_BLOCK_BITSHIFT;
+
+        if( ( ullBlockAddress + ulBlockCount ) <= pxThis->ulDeviceBlocks )
+        {
+            iStatus = OK;
+        }
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Task to run queued requests in order
+ */
+static void vEmmcTask( void *pvArgs )
+{
+    EMMC_REQUEST *pxRequest = NULL;
+
+    FOREVER
+    {
+        if( OSAL_ERRORS_NONE == iOSAL_MBox_Pend( pxThis->pvOsalMBoxHdl,
+                                                 ( void * )&pxRequest,
+                                                 OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            if( NULL != pxRequest )
+            {
+                pxRequest->xState  = EMMC_REQUEST_STATE_ACTIVE;
+                pxRequest->iStatus = iRunRequest( pxRequest );
+                vCompleteRequest( pxRequest );
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Run the transfer for a request, one backend chunk at a time
+ */
+static int iRunRequest( EMMC_REQUEST *pxRequest )
+{
+    int      iStatus        = OK;
+    uint32_t ulBlockAddress = ( uint32_t )( pxRequest->ullAddress >> EMMC_QUEUE_BLOCK_BITSHIFT );
+    uint32_t ulRemaining    = pxRequest->ulBlockCount;
+    uint8_t  *pucBuff       = pxRequest->pucBuff;
+
+    /*
+     * The backend may limit how much it moves in one go (e.g. one ADMA2
+     * descriptor table), and takes its device lock per chunk so erases are
+     * not held off for the whole request.
+     */
+    while( ( OK == iStatus ) && ( 0 < ulRemaining ) )
+    {
+        uint32_t ulChunk = MIN( ulRemaining, pxThis->ulMaxChunkBlocks );
+
+        iStatus = pxThis->pxTransferFunc( pxRequest->xType, ulBlockAddress, ulChunk, pucBuff );
+        if( OK == iStatus )
+        {
+            INC_STAT_COUNTER( EMMC_QUEUE_STATS_CHUNK_TRANSFERRED )
+        }
+        else
+        {
+            INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_CHUNK_FAILED )
+        }
+
+        ulBlockAddress += ulChunk;
+        ulRemaining    -= ulChunk;
+        pucBuff        += ( ( size_t )ulChunk << EMMC_QUEUE_BLOCK_BITSHIFT );
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Mark a request complete and signal its owner
+ */
+static void vCompleteRequest( EMMC_REQUEST *pxRequest )
+{
+    /* The owner may reuse the request as soon as it is marked done */
+    EMMC_REQUEST_CALLBACK *pxCallback = pxRequest->pxCallback;
+    void                  *pvSemHdl   = pxRequest->pvOsalSemHdl;
+
+    vOSAL_EnterCritical();
+    pxThis->ulQueued--;
+    vOSAL_ExitCritical();
+
+    INC_STAT_COUNTER( EMMC_QUEUE_STATS_REQUEST_COMPLETED )
+
+    if( NULL != pxCallback )
+    {
+        pxCallback( pxRequest );
+    }
+
+    pxRequest->xState = EMMC_REQUEST_STATE_DONE;
+
+    if( NULL != pvSemHdl )
+    {
+        if( OSAL_ERRORS_NONE != iOSAL_Semaphore_Post( pvSemHdl ) )
+        {
+            INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_SEMAPHORE_POST_FAILED )
+        }
+    }
+}
+
+/**
+ * @brief   Submit a request and wait for it to complete
+ */
+static int iRunSyncRequest( EMMC_REQUEST *pxRequest )
+{
+    int iStatus = ERROR;
+
+    if( TRUE == pxThis->iInitialised )
+    {
+        /* Only one synchronous caller may own the sync semaphore at a time */
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalSyncMutexHdl,
+                                                  EMMC_QUEUE_WAIT_TIMEOUT_MS ) )
+        {
+            INC_STAT_COUNTER( EMMC_QUEUE_STATS_TAKE_MUTEX )
+
+            pxRequest->pvOsalSemHdl = pxThis->pvOsalSyncSemHdl;
+
+            if( OK == iEMMC_Submit( pxRequest ) )
+            {
+                if( OSAL_ERRORS_NONE == iOSAL_Semaphore_Pend( pxThis->pvOsalSyncSemHdl,
+                                                              OSAL_TIMEOUT_WAIT_FOREVER ) )
+                {
+                    iStatus = pxRequest->iStatus;
+                }
+                else
+                {
+                    INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_SEMAPHORE_PEND_FAILED )
+                }
+            }
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalSyncMutexHdl ) )
+            {
+                INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_MUTEX_RELEASE_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( EMMC_QUEUE_STATS_RELEASE_MUTEX )
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER( EMMC_QUEUE_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+
+    return iStatus;
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains the request queue shared by the EMMC driver backends.
+ * The queue owns the EMMC task, completion signalling and the splitting of
+ * requests into chunks; each backend only provides a transfer hook.
+ *
+ * @file emmc_queue.h
+ *
+ */
+
+#ifndef _EMMC_QUEUE_H_
+#define _EMMC_QUEUE_H_
+
+/******************************************************************************/
+/* Includes                                                                   */
+/******************************************************************************/
+
+#include "standard.h"
+#include "emmc.h"
+
+
+/******************************************************************************/
+/* Defines                                                                    */
+/******************************************************************************/
+
+#define EMMC_QUEUE_BLOCK_BITSHIFT       ( 9 )
+#define EMMC_QUEUE_BLOCK_SIZE           ( 1 << EMMC_QUEUE_BLOCK_BITSHIFT )
+
+
+/******************************************************************************/
+/* Typedefs                                                                   */
+/******************************************************************************/
+
+/**
+ * @brief   Backend transfer of a single chunk, called from the EMMC task
+ *
+ * @param   xType               Read or write
+ * @param   ulBlockAddress      The first block to transfer
+ * @param   ulBlockCount        The number of blocks, at most the configured chunk size
+ * @param   pucBuff             The buffer to read into or write from
+ *
+ * @return  OK                  Transfer was successful
+ *          ERROR               Transfer failed
+ */
+typedef int ( EMMC_QUEUE_TRANSFER_FUNC )( EMMC_REQUEST_TYPE xType,
+                                          uint32_t ulBlockAddress,
+                                          uint32_t ulBlockCount,
+                                          uint8_t *pucBuff );
+
+
+/******************************************************************************/
+/* Function declarations                                                      */
+/******************************************************************************/
+
+/**
+ * @brief   Create the request queue and the task that services it
+ *
+ * @param   pxTransferFunc      Backend transfer hook
+ * @param   ulMaxChunkBlocks    Largest number of blocks passed to the hook at once
+ * @param   ulDeviceBlocks      Size of the device in blocks
+ *
+ * @return  OK                  Queue and task created
+ *          ERROR               Queue or task not created
+ *
+ * @note    Once this succeeds, iEMMC_Submit, iEMMC_Read, iEMMC_Write and
+ *          iEMMC_GetQueueDepth are available.
+ */
+int iEMMC_QueueInitialise( EMMC_QUEUE_TRANSFER_FUNC *pxTransferFunc,
+                           uint32_t ulMaxChunkBlocks,
+                           uint32_t ulDeviceBlocks );
+
+/**
+ * @brief   Print the queue stats and depth
+ *
+ * @return  OK                  Stats printed
+ *          ERROR               Stats not printed
+ */
+int iEMMC_QueuePrintStatistics( void );
+
+/**
+ * @brief   Clear the queue stats and reset the peak depth
+ *
+ * @return  OK                  Stats cleared
+ *          ERROR               Stats not cleared
+ */
+int iEMMC_QueueClearStatistics( void );
+
+#endif /* _EMMC_QUEUE_H_ */
@@ -0,0 +1,422 @@
+/**
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains the user API definitions for the EMMC driver (stubbed out Linux version).
+ * The card is a RAM image, so transfers complete as soon as the EMMC task runs them.
+ * Requests are queued and run by emmc_queue.c, which calls back in here per chunk.
+ *
+ * @file emmc.c
+ *
+ */
+
+/******************************************************************************/
+/* Includes                                                                   */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "util.h"
+#include "pll.h"
+#include "osal.h"
+#include "emmc.h"
+#include "emmc_queue.h"
+
+
+/******************************************************************************/
+/* Defines                                                                    */
+/******************************************************************************/
+
+#define UPPER_FIREWALL                          ( 0xBABECAFE )
+#define LOWER_FIREWALL                          ( 0xDEADFACE )
+
+#define EMMC_NAME                               "EMMC"
+#define EMMC_WAIT_TIMEOUT_MS                    ( 100 )
+#define EMMC_BLOCK_BITSHIFT                     ( EMMC_QUEUE_BLOCK_BITSHIFT )
+#define EMMC_BLOCK_SIZE                         ( EMMC_QUEUE_BLOCK_SIZE )
+#define EMMC_STUB_BLOCK_COUNT                   ( 256 )
+
+/* Stat & Error definitions */
+#define EMMC_STATS( DO )                                     \
+    DO( EMMC_STATS_INIT_COMPLETED )                          \
+    DO( EMMC_STATS_CREATE_MUTEX )                            \
+    DO( EMMC_STATS_TAKE_MUTEX )                              \
+    DO( EMMC_STATS_RELEASE_MUTEX )                           \
+    DO( EMMC_STATS_EMMC_READ )                               \
+    DO( EMMC_STATS_EMMC_WRITE )                              \
+    DO( EMMC_STATS_EMMC_ERASE )                              \
+    DO( EMMC_STATS_MAX )
+
+#define EMMC_ERRORS( DO )                                    \
+    DO( EMMC_ERRORS_VALIDATION_FAILED )                      \
+    DO( EMMC_ERRORS_IMAGE_ALLOC_FAILED )                     \
+    DO( EMMC_ERRORS_MUTEX_CREATE_FAILED )                    \
+    DO( EMMC_ERRORS_MUTEX_RELEASE_FAILED )                   \
+    DO( EMMC_ERRORS_MUTEX_TAKE_FAILED )                      \
+    DO( EMMC_ERRORS_EMMC_ERASE_FAILED )                      \
+    DO( EMMC_ERRORS_MAX )
+
+#define PRINT_STAT_COUNTER( x )         PLL_INF( EMMC_NAME, "%50s . . . . %d\r\n",          \
+                                                 EMMC_STATS_STR[ x ],                       \
+                                                 pxThis->pulStatCounters[ x ] )
+#define PRINT_ERROR_COUNTER( x )        PLL_INF( EMMC_NAME, "%50s . . . . %d\r\n",          \
+                                                 EMMC_ERRORS_STR[ x ],                      \
+                                                 pxThis->pulErrorCounters[ x ] )
+
+#define INC_STAT_COUNTER( x )           { if( x < EMMC_STATS_MAX )pxThis->pulStatCounters[ x ]++; }
+#define INC_ERROR_COUNTER( x )          { if( x < EMMC_ERRORS_MAX )pxThis->pulErrorCounters[ x ]++; }
+
+
+/******************************************************************************/
+/* Enums                                                                      */
+/******************************************************************************/
+
+/**
+ * @enum    EMMC_STATS
+ * @brief   Enumeration of stats counters for this driver
+ */
+UTIL_MAKE_ENUM_AND_STRINGS( EMMC_STATS, EMMC_STATS, EMMC_STATS_STR )
+
+/**
+ * @enum    EMMC_ERRORS
+ * @brief   Enumeration of stats errors for this driver
+ */
+UTIL_MAKE_ENUM_AND_STRINGS( EMMC_ERRORS, EMMC_ERRORS, EMMC_ERRORS_STR )
+
+
+/******************************************************************************/
+/* Structs                                                                    */
+/******************************************************************************/
+
+/**
+ * @struct  EMMC_PRIVATE_DATA
+ * @brief   Structure to hold ths driver's private data
+ */
+typedef struct EMMC_PRIVATE_DATA
+{
+    uint32_t        ulUpperFirewall;
+
+    uint32_t        ulBaseAddr;
+    uint8_t         *pucImage;
+    uint32_t        ulBlockCount;
+    int             iInitialised;
+
+    void            *pvOsalMutexHdl;
+
+    uint32_t        pulStatCounters[ EMMC_STATS_MAX ];
+    uint32_t        pulErrorCounters[ EMMC_ERRORS_MAX ];
+
+    uint32_t        ulLowerFirewall;
+
+} EMMC_PRIVATE_DATA;
+
+
+/******************************************************************************/
+/* Local Variables                                                            */
+/******************************************************************************/
+
+static EMMC_PRIVATE_DATA xLocalData =
+{
+    UPPER_FIREWALL,                         /* ulUpperFirewall */
+    0,                                      /* ulBaseAddr */
+    NULL,                                   /* pucImage */
+    0,                                      /* ulBlockCount */
+    FALSE,                                  /* iInitialised */
+    NULL,                                   /* pvOsalMutexHdl */
+    { 0 },                                  /* pulStatCounters */
+    { 0 },                                  /* pulErrorCounters */
+    LOWER_FIREWALL                          /* ulLowerFirewall */
+};
+static EMMC_PRIVATE_DATA *pxThis = &xLocalData;
+
+
+/******************************************************************************/
+/* Private Function declarations                                              */
+/******************************************************************************/
+
+/**
+ * @brief   Copy one chunk to or from the RAM image
+ *
+ * @param   xType              Read or write
+ * @param   ulBlockAddress     The first block to transfer
+ * @param   ulBlockCount       The number of blocks
+ * @param   pucBuff            The buffer to read into or write from
+ *
+ * @return  OK                 Transfer was successful
+ *          ERROR              Transfer failed
+ */
+static int iTransferChunk( EMMC_REQUEST_TYPE xType,
+                           uint32_t ulBlockAddress,
+                           uint32_t ulBlockCount,
+                           uint8_t *pucBuff );
+
+
+/******************************************************************************/
+/* Public Function implementations                                            */
+/******************************************************************************/
+
+/**
+ * @brief   Initializes the EMMC driver.
+ */
+int iEMMC_Initialise( uint32_t ulBaseAddr )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( FALSE == pxThis->iInitialised ) )
+    {
+        pxThis->ulBaseAddr   = ulBaseAddr;
+        pxThis->ulBlockCount = EMMC_STUB_BLOCK_COUNT;
+        pxThis->pucImage     = calloc( pxThis->ulBlockCount, EMMC_BLOCK_SIZE );
+
+        if( NULL != pxThis->pucImage )
+        {
+            iStatus = OK;
+        }
+        else
+        {
+            PLL_ERR( EMMC_NAME, "Error allocating EMMC image\r\n" );
+            INC_ERROR_COUNTER( EMMC_ERRORS_IMAGE_ALLOC_FAILED )
+        }
+
+        if( OSAL_ERRORS_NONE != iOSAL_Mutex_Create( &( pxThis->pvOsalMutexHdl ),
+                                                    "EMMC mutex" ) )
+        {
+            PLL_ERR( EMMC_NAME, "Error initialising mutex\r\n" );
+            INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_CREATE_FAILED )
+            iStatus = ERROR;
+        }
+        else
+        {
+            INC_STAT_COUNTER( EMMC_STATS_CREATE_MUTEX )
+        }
+
+        if( ( OK == iStatus ) &&
+            ( OK != iEMMC_QueueInitialise( iTransferChunk, pxThis->ulBlockCount, pxThis->ulBlockCount ) ) )
+        {
+            iStatus = ERROR;
+        }
+
+        if( OK == iStatus )
+        {
+            pxThis->iInitialised = TRUE;
+            INC_STAT_COUNTER( EMMC_STATS_INIT_COMPLETED )
+        }
+
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Erase blocks in the EMMC.
+ */
+int iEMMC_Erase( uint64_t ullStartBlockAddress, uint64_t ullEndBlockAddress )
+{
+    int iStatus = ERROR;
+
+    if( ( TRUE == pxThis->iInitialised ) &&
+        ( 0 == ( ullStartBlockAddress % EMMC_BLOCK_SIZE ) ) &&
+        ( 0 == ( ullEndBlockAddress % EMMC_BLOCK_SIZE ) ) &&
+        ( pxThis->ulBlockCount > ( ullStartBlockAddress >> EMMC_BLOCK_BITSHIFT ) ) &&
+        ( pxThis->ulBlockCount > ( ullEndBlockAddress >> EMMC_BLOCK_BITSHIFT ) ) &&
+        ( ullEndBlockAddress >= ullStartBlockAddress ) )
+    {
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                  EMMC_WAIT_TIMEOUT_MS ) )
+        {
+            INC_STAT_COUNTER( EMMC_STATS_TAKE_MUTEX )
+
+            memset( pxThis->pucImage + ullStartBlockAddress, 0,
+                    ( size_t )( ullEndBlockAddress - ullStartBlockAddress ) + EMMC_BLOCK_SIZE );
+            INC_STAT_COUNTER( EMMC_STATS_EMMC_ERASE )
+            iStatus = OK;
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_RELEASE_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( EMMC_STATS_RELEASE_MUTEX )
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+    return iStatus;
+}
+
+/**
+ * @brief   Erase all blocks in the EMMC.
+ */
+int iEMMC_EraseAll( void )
+{
+    int iStatus = ERROR;
+
+    if( TRUE == pxThis->iInitialised )
+    {
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                  EMMC_WAIT_TIMEOUT_MS ) )
+        {
+            INC_STAT_COUNTER( EMMC_STATS_TAKE_MUTEX )
+
+            memset( pxThis->pucImage, 0, ( size_t )pxThis->ulBlockCount * EMMC_BLOCK_SIZE );
+            INC_STAT_COUNTER( EMMC_STATS_EMMC_ERASE )
+            iStatus = OK;
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_RELEASE_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( EMMC_STATS_RELEASE_MUTEX )
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+    return iStatus;
+}
+
+/**
+ * @brief   Print the EMMC detected device details.
+ */
+int iEMMC_PrintInstanceDetails( void )
+{
+    int iStatus = ERROR;
+
+    if( TRUE == pxThis->iInitialised )
+    {
+        PLL_LOG( EMMC_NAME, "INSTANCE (Linux stub):\n\r" );
+        PLL_LOG( EMMC_NAME, "BaseAddress:           0x%x\n\r", pxThis->ulBaseAddr );
+        PLL_LOG( EMMC_NAME, "SectorCount:           0x%x\n\r", pxThis->ulBlockCount );
+        PLL_LOG( EMMC_NAME, "BlkSize:               0x%x\n\r", EMMC_BLOCK_SIZE );
+
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Print all the stats gathered by the driver
+ */
+int iEMMC_PrintStatistics( void )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) )
+    {
+        int i = 0;
+        PLL_INF( EMMC_NAME, "============================================================\n\r" );
+        PLL_INF( EMMC_NAME, "EMMC Statistics:\n\r" );
+        for( i = 0; i < EMMC_STATS_MAX; i++ )
+        {
+            PRINT_STAT_COUNTER( i );
+        }
+        PLL_INF( EMMC_NAME, "------------------------------------------------------------\n\r" );
+        PLL_INF( EMMC_NAME, "EMMC Errors:\n\r" );
+        for( i = 0; i < EMMC_ERRORS_MAX; i++ )
+        {
+            PRINT_ERROR_COUNTER( i );
+        }
+        PLL_INF( EMMC_NAME, "============================================================\n\r" );
+        iStatus = iEMMC_QueuePrintStatistics();
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Clear all the stats in the driver
+ */
+int iEMMC_ClearStatistics( void )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) )
+    {
+        pvOSAL_MemSet( pxThis->pulStatCounters, 0, sizeof( pxThis->pulStatCounters ) );
+        pvOSAL_MemSet( pxThis->pulErrorCounters, 0, sizeof( pxThis->pulErrorCounters ) );
+        iStatus = iEMMC_QueueClearStatistics();
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Copy one chunk to or from the RAM image
+ */
+static int iTransferChunk( EMMC_REQUEST_TYPE xType,
+                           uint32_t ulBlockAddress,
+                           uint32_t ulBlockCount,
+                           uint8_t *pucBuff )
+{
+    int    iStatus  = ERROR;
+    size_t xOffset  = ( size_t )ulBlockAddress << EMMC_BLOCK_BITSHIFT;
+    size_t xLength  = ( size_t )ulBlockCount << EMMC_BLOCK_BITSHIFT;
+
+    if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                              EMMC_WAIT_TIMEOUT_MS ) )
+    {
+        INC_STAT_COUNTER( EMMC_STATS_TAKE_MUTEX )
+
+        if( EMMC_REQUEST_TYPE_READ == xType )
+        {
+            memcpy( pucBuff, pxThis->pucImage + xOffset, xLength );
+            INC_STAT_COUNTER( EMMC_STATS_EMMC_READ )
+        }
+        else
+        {
+            memcpy( pxThis->pucImage + xOffset, pucBuff, xLength );
+            INC_STAT_COUNTER( EMMC_STATS_EMMC_WRITE )
+        }
+        iStatus = OK;
+
+        if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+        {
+            INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_RELEASE_FAILED )
+            iStatus = ERROR;
+        }
+        else
+        {
+            INC_STAT_COUNTER( EMMC_STATS_RELEASE_MUTEX )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( EMMC_ERRORS_MUTEX_TAKE_FAILED )
+    }
+
+    return iStatus;
+}
@@ -0,0 +1,583 @@
+/**
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains tests for the EMMC request queue shared by the driver
+ * backends. The backend is a RAM image behind a transfer hook that records
+ * each chunk. The EMMC task only runs when a test lets it, so the depth of
+ * the queue and the work done while requests are in flight can be checked
+ * at each step.
+ *
+ * @file test_emmc_queue.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "standard.h"
+#include "osal.h"
+#include "pll.h"
+#include "emmc.h"
+#include "emmc_queue.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_BLOCK_SIZE         ( 512 )
+#define TEST_BLOCKS_PER_REQUEST ( 4 )
+#define TEST_REQUEST_SIZE       ( TEST_BLOCK_SIZE * TEST_BLOCKS_PER_REQUEST )
+#define TEST_PING_PONG_CHUNKS   ( 8 )
+#define TEST_MAX_SEMAPHORES     ( 4 )
+#define TEST_DEVICE_BLOCKS      ( 256 )
+#define TEST_MAX_CHUNK_BLOCKS   ( 3 )
+#define TEST_MAX_CHUNKS         ( 16 )
+#define TEST_CHUNKED_BLOCKS     ( 10 )
+#define TEST_CHUNKED_SIZE       ( TEST_CHUNKED_BLOCKS * TEST_BLOCK_SIZE )
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static void         ( *pxTaskFunc )( void *pvTaskParam ) = NULL;
+static jmp_buf      xTaskExit;
+static uint32_t     ulTaskBudget                        = 0;
+
+/* Mailbox of request pointers */
+static EMMC_REQUEST *pxMBox[ EMMC_QUEUE_DEPTH ] = { 0 };
+static uint32_t     ulMBoxSize                  = 0;
+static uint32_t     ulMBoxHead                  = 0;
+static uint32_t     ulMBoxCount                 = 0;
+
+/* Each semaphore handle points at its count */
+static int          piSemCounts[ TEST_MAX_SEMAPHORES ] = { 0 };
+static int          iSemCreated                        = 0;
+
+static int          iCriticalNesting = 0;
+
+static EMMC_REQUEST *pxCompleted[ EMMC_QUEUE_DEPTH * 2 ] = { 0 };
+static int          iCompletedCount                     = 0;
+
+static uint8_t      pucPattern[ TEST_PING_PONG_CHUNKS ][ TEST_REQUEST_SIZE ] = { { 0 } };
+
+/* Backend - a RAM image and a record of the chunks passed to the hook */
+static uint8_t      pucImage[ TEST_DEVICE_BLOCKS * TEST_BLOCK_SIZE ] = { 0 };
+static uint32_t     pulChunkAddress[ TEST_MAX_CHUNKS ]              = { 0 };
+static uint32_t     pulChunkBlocks[ TEST_MAX_CHUNKS ]               = { 0 };
+static uint8_t      *ppucChunkBuff[ TEST_MAX_CHUNKS ]               = { 0 };
+static int          iChunkCount                                     = 0;
+static int          iFailChunk                                      = -1;
+
+
+/*****************************************************************************/
+/* Stubs                                                                     */
+/*****************************************************************************/
+
+void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+{
+}
+
+void *pvOSAL_MemSet( void *pvDestination, int iValue, uint16_t usSize )
+{
+    return memset( pvDestination, iValue, usSize );
+}
+
+void vOSAL_EnterCritical( void )
+{
+    iCriticalNesting++;
+}
+
+void vOSAL_ExitCritical( void )
+{
+    iCriticalNesting--;
+    assert_true( 0 <= iCriticalNesting );
+}
+
+int iOSAL_Mutex_Create( void **ppvMutexHandle, const char *pcMutexName )
+{
+    *ppvMutexHandle = ( void * )1;
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Take( void *pvMutexHandle, uint32_t ulTimeoutMs )
+{
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Release( void *pvMutexHandle )
+{
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_MBox_Create( void **ppvMBoxHandle, uint32_t ulMBoxLength, uint32_t ulItemSize, const char *pcMBoxName )
+{
+    assert_int_equal( sizeof( EMMC_REQUEST * ), ulItemSize );
+    assert_true( EMMC_QUEUE_DEPTH >= ulMBoxLength );
+
+    ulMBoxSize     = ulMBoxLength;
+    *ppvMBoxHandle = ( void * )pxMBox;
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_MBox_Post( void *pvMBoxHandle, void *pvMBoxItem, uint32_t ulTimeoutMs )
+{
+    int iStatus = OSAL_ERRORS_OS_IMPLEMENTATION;
+
+    if( ulMBoxCount < ulMBoxSize )
+    {
+        pxMBox[ ( ulMBoxHead + ulMBoxCount ) % ulMBoxSize ] = *( EMMC_REQUEST ** )pvMBoxItem;
+        ulMBoxCount++;
+        iStatus = OSAL_ERRORS_NONE;
+    }
+
+    return iStatus;
+}
+
+/* An empty mailbox would block the EMMC task, so leave it instead */
+int iOSAL_MBox_Pend( void *pvMBoxHandle, void *pvMBoxBuffer, uint32_t ulTimeoutMs )
+{
+    if( ( 0 == ulMBoxCount ) || ( 0 == ulTaskBudget ) )
+    {
+        longjmp( xTaskExit, 1 );
+    }
+    ulTaskBudget--;
+
+    *( EMMC_REQUEST ** )pvMBoxBuffer = pxMBox[ ulMBoxHead ];
+    ulMBoxHead = ( ulMBoxHead + 1 ) % ulMBoxSize;
+    ulMBoxCount--;
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Semaphore_Create( void **ppvSemHandle, uint32_t ullCount, uint32_t ullBucket, const char *pcSemName )
+{
+    assert_true( TEST_MAX_SEMAPHORES > iSemCreated );
+
+    piSemCounts[ iSemCreated ] = ( int )ullCount;
+    *ppvSemHandle              = &piSemCounts[ iSemCreated++ ];
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Semaphore_Post( void *pvSemHandle )
+{
+    ( *( int * )pvSemHandle )++;
+
+    return OSAL_ERRORS_NONE;
+}
+
+static void vRunEmmcTask( uint32_t ulRequests );
+
+/* Waiting on a semaphore lets the EMMC task run */
+int iOSAL_Semaphore_Pend( void *pvSemHandle, uint32_t ulTimeoutMs )
+{
+    int iStatus = OSAL_ERRORS_OS_IMPLEMENTATION;
+
+    if( 0 == *( int * )pvSemHandle )
+    {
+        vRunEmmcTask( UINT32_MAX );
+    }
+
+    if( 0 < *( int * )pvSemHandle )
+    {
+        ( *( int * )pvSemHandle )--;
+        iStatus = OSAL_ERRORS_NONE;
+    }
+
+    return iStatus;
+}
+
+int iOSAL_Task_Create( void **ppvTaskHandle,
+                       void ( *pvTaskFunction )( void *pvTaskParam ),
+                       uint16_t usTaskStackSize,
+                       void *pvTaskParam,
+                       uint32_t ulTaskPriority,
+                       const char *pcTaskName )
+{
+    pxTaskFunc     = pvTaskFunction;
+    *ppvTaskHandle = ( void * )1;
+
+    return OSAL_ERRORS_NONE;
+}
+
+
+/* Backend transfer hook - fails the chunk numbered iFailChunk */
+static int iTestTransfer( EMMC_REQUEST_TYPE xType,
+                          uint32_t ulBlockAddress,
+                          uint32_t ulBlockCount,
+                          uint8_t *pucBuff )
+{
+    int    iStatus = OK;
+    size_t xOffset = ( size_t )ulBlockAddress * TEST_BLOCK_SIZE;
+    size_t xLength = ( size_t )ulBlockCount * TEST_BLOCK_SIZE;
+
+    assert_true( TEST_MAX_CHUNK_BLOCKS >= ulBlockCount );
+    assert_true( 0 < ulBlockCount );
+    assert_true( TEST_DEVICE_BLOCKS >= ( ulBlockAddress + ulBlockCount ) );
+
+    if( TEST_MAX_CHUNKS > iChunkCount )
+    {
+        pulChunkAddress[ iChunkCount ] = ulBlockAddress;
+        pulChunkBlocks[ iChunkCount ]  = ulBlockCount;
+        ppucChunkBuff[ iChunkCount ]   = pucBuff;
+    }
+
+    if( iFailChunk == iChunkCount )
+    {
+        iStatus = ERROR;
+    }
+    else if( EMMC_REQUEST_TYPE_READ == xType )
+    {
+        memcpy( pucBuff, &pucImage[ xOffset ], xLength );
+    }
+    else
+    {
+        memcpy( &pucImage[ xOffset ], pucBuff, xLength );
+    }
+    iChunkCount++;
+
+    return iStatus;
+}
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+/* Run the EMMC task for up to ulRequests requests, or until its mailbox is empty */
+static void vRunEmmcTask( uint32_t ulRequests )
+{
+    assert_non_null( pxTaskFunc );
+
+    ulTaskBudget = ulRequests;
+
+    if( 0 == setjmp( xTaskExit ) )
+    {
+        pxTaskFunc( NULL );
+    }
+}
+
+static void vRecordCompletion( struct EMMC_REQUEST *pxRequest )
+{
+    assert_true( ( sizeof( pxCompleted ) / sizeof( pxCompleted[ 0 ] ) ) > iCompletedCount );
+    assert_int_equal( EMMC_REQUEST_STATE_ACTIVE, pxRequest->xState );
+
+    pxCompleted[ iCompletedCount++ ] = pxRequest;
+}
+
+static void vFillPattern( uint8_t *pucBuff, uint8_t ucSeed )
+{
+    int i = 0;
+
+    for( i = 0; i < TEST_REQUEST_SIZE; i++ )
+    {
+        pucBuff[ i ] = ( uint8_t )( ucSeed + ( i * 7 ) );
+    }
+}
+
+static void vInitRequest( EMMC_REQUEST *pxRequest, EMMC_REQUEST_TYPE xType, uint32_t ulChunk, uint8_t *pucBuff )
+{
+    memset( pxRequest, 0, sizeof( *pxRequest ) );
+    pxRequest->xType        = xType;
+    pxRequest->ullAddress   = ( uint64_t )ulChunk * TEST_REQUEST_SIZE;
+    pxRequest->ulBlockCount = TEST_BLOCKS_PER_REQUEST;
+    pxRequest->pucBuff      = pucBuff;
+    pxRequest->pxCallback   = vRecordCompletion;
+}
+
+static void vAssertQueueDepth( uint32_t ulExpected, uint32_t ulExpectedPeak )
+{
+    uint32_t ulQueued     = 0;
+    uint32_t ulPeakQueued = 0;
+
+    assert_int_equal( OK, iEMMC_GetQueueDepth( &ulQueued, &ulPeakQueued ) );
+    assert_int_equal( ulExpected, ulQueued );
+    assert_int_equal( ulExpectedPeak, ulPeakQueued );
+}
+
+static int iTestSetup( void **state )
+{
+    return iEMMC_QueueInitialise( iTestTransfer, TEST_MAX_CHUNK_BLOCKS, TEST_DEVICE_BLOCKS );
+}
+
+static int iTestReset( void **state )
+{
+    iCompletedCount = 0;
+    iChunkCount     = 0;
+    iFailChunk      = -1;
+
+    return iEMMC_QueueClearStatistics();
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_queue_depth( void **state )
+{
+    EMMC_REQUEST pxRequests[ EMMC_QUEUE_DEPTH + 1 ] = { { 0 } };
+    uint8_t      pucBuff[ EMMC_QUEUE_DEPTH + 1 ][ TEST_REQUEST_SIZE ];
+    int          i = 0;
+
+    vAssertQueueDepth( 0, 0 );
+
+    for( i = 0; i < EMMC_QUEUE_DEPTH; i++ )
+    {
+        vFillPattern( pucBuff[ i ], ( uint8_t )i );
+        vInitRequest( &pxRequests[ i ], EMMC_REQUEST_TYPE_WRITE, i, pucBuff[ i ] );
+        assert_int_equal( OK, iEMMC_Submit( &pxRequests[ i ] ) );
+        assert_int_equal( EMMC_REQUEST_STATE_QUEUED, pxRequests[ i ].xState );
+        vAssertQueueDepth( i + 1, i + 1 );
+    }
+
+    /* Full - rejected without touching the request */
+    vInitRequest( &pxRequests[ i ], EMMC_REQUEST_TYPE_WRITE, i, pucBuff[ i ] );
+    assert_int_equal( ERROR, iEMMC_Submit( &pxRequests[ i ] ) );
+    assert_int_equal( EMMC_REQUEST_STATE_IDLE, pxRequests[ i ].xState );
+    vAssertQueueDepth( EMMC_QUEUE_DEPTH, EMMC_QUEUE_DEPTH );
+    assert_int_equal( 0, iCompletedCount );
+
+    vRunEmmcTask( UINT32_MAX );
+
+    /* Completed in submission order */
+    assert_int_equal( EMMC_QUEUE_DEPTH, iCompletedCount );
+    for( i = 0; i < EMMC_QUEUE_DEPTH; i++ )
+    {
+        assert_true( &pxRequests[ i ] == pxCompleted[ i ] );
+        assert_int_equal( EMMC_REQUEST_STATE_DONE, pxRequests[ i ].xState );
+        assert_int_equal( OK, pxRequests[ i ].iStatus );
+    }
+    vAssertQueueDepth( 0, EMMC_QUEUE_DEPTH );
+    assert_int_equal( 0, iCriticalNesting );
+
+    /* Space again once drained */
+    assert_int_equal( OK, iEMMC_Submit( &pxRequests[ EMMC_QUEUE_DEPTH ] ) );
+    vRunEmmcTask( UINT32_MAX );
+    assert_int_equal( EMMC_REQUEST_STATE_DONE, pxRequests[ EMMC_QUEUE_DEPTH ].xState );
+}
+
+static void test_overlap( void **state )
+{
+    EMMC_REQUEST pxRequests[ 2 ] = { { 0 } };
+    uint8_t      pucBuff[ 2 ][ TEST_REQUEST_SIZE ];
+    uint8_t      pucReadBack[ TEST_REQUEST_SIZE ];
+    int          iPrepared   = 0;
+    uint32_t     ulChunk     = 0;
+
+    /*
+     * Ping-pong: the next buffer is filled while the previous write is still
+     * queued, and the EMMC task only completes a request when its buffer must
+     * be reused.
+     */
+    for( ulChunk = 0; ulChunk < TEST_PING_PONG_CHUNKS; ulChunk++ )
+    {
+        int iSlot = ulChunk % 2;
+
+        if( EMMC_REQUEST_STATE_QUEUED == pxRequests[ iSlot ].xState )
+        {
+            vRunEmmcTask( 1 );
+        }
+        assert_true( EMMC_REQUEST_STATE_QUEUED != pxRequests[ iSlot ].xState );
+
+        vFillPattern( pucBuff[ iSlot ], ( uint8_t )( 0x40 + ulChunk ) );
+        vFillPattern( pucPattern[ ulChunk ], ( uint8_t )( 0x40 + ulChunk ) );
+        if( ( 0 < ulChunk ) && ( EMMC_REQUEST_STATE_QUEUED == pxRequests[ 1 - iSlot ].xState ) )
+        {
+            iPrepared++;
+        }
+
+        vInitRequest( &pxRequests[ iSlot ], EMMC_REQUEST_TYPE_WRITE, ulChunk, pucBuff[ iSlot ] );
+        assert_int_equal( OK, iEMMC_Submit( &pxRequests[ iSlot ] ) );
+    }
+    vRunEmmcTask( UINT32_MAX );
+
+    /* Every buffer after the first was prepared with a write in flight */
+    assert_int_equal( TEST_PING_PONG_CHUNKS - 1, iPrepared );
+    assert_int_equal( TEST_PING_PONG_CHUNKS, iCompletedCount );
+    vAssertQueueDepth( 0, 2 );
+
+    for( ulChunk = 0; ulChunk < TEST_PING_PONG_CHUNKS; ulChunk++ )
+    {
+        assert_int_equal( OK, iEMMC_Read( ( uint64_t )ulChunk * TEST_REQUEST_SIZE,
+                                          TEST_BLOCKS_PER_REQUEST,
+                                          pucReadBack ) );
+        assert_memory_equal( pucPattern[ ulChunk ], pucReadBack, TEST_REQUEST_SIZE );
+    }
+}
+
+static void test_semaphore_completion( void **state )
+{
+    EMMC_REQUEST xRequest = { 0 };
+    uint8_t      pucBuff[ TEST_REQUEST_SIZE ];
+    void         *pvSemHdl = NULL;
+
+    assert_int_equal( OSAL_ERRORS_NONE, iOSAL_Semaphore_Create( &pvSemHdl, 0, 1, "test sem" ) );
+
+    vInitRequest( &xRequest, EMMC_REQUEST_TYPE_READ, 1, pucBuff );
+    xRequest.pxCallback   = NULL;
+    xRequest.pvOsalSemHdl = pvSemHdl;
+
+    assert_int_equal( OK, iEMMC_Submit( &xRequest ) );
+    assert_int_equal( 0, *( int * )pvSemHdl );
+
+    assert_int_equal( OSAL_ERRORS_NONE, iOSAL_Semaphore_Pend( pvSemHdl, OSAL_TIMEOUT_WAIT_FOREVER ) );
+    assert_int_equal( EMMC_REQUEST_STATE_DONE, xRequest.xState );
+    assert_int_equal( OK, xRequest.iStatus );
+    /* Chunk 1 was written by test_overlap */
+    assert_memory_equal( pucPattern[ 1 ], pucBuff, TEST_REQUEST_SIZE );
+}
+
+static void test_sync_read_write( void **state )
+{
+    uint8_t pucWrite[ TEST_REQUEST_SIZE ];
+    uint8_t pucRead[ TEST_REQUEST_SIZE ];
+
+    vFillPattern( pucWrite, 0xA5 );
+    memset( pucRead, 0, sizeof( pucRead ) );
+
+    assert_int_equal( OK, iEMMC_Write( TEST_REQUEST_SIZE * 2, TEST_BLOCKS_PER_REQUEST, pucWrite ) );
+    assert_int_equal( OK, iEMMC_Read( TEST_REQUEST_SIZE * 2, TEST_BLOCKS_PER_REQUEST, pucRead ) );
+    assert_memory_equal( pucWrite, pucRead, TEST_REQUEST_SIZE );
+    vAssertQueueDepth( 0, 1 );
+}
+
+static void test_invalid_requests( void **state )
+{
+    EMMC_REQUEST xRequest = { 0 };
+    uint8_t      pucBuff[ TEST_REQUEST_SIZE ];
+
+    assert_int_equal( ERROR, iEMMC_Submit( NULL ) );
+
+    vInitRequest( &xRequest, EMMC_REQUEST_TYPE_READ, 0, NULL );
+    assert_int_equal( ERROR, iEMMC_Submit( &xRequest ) );
+
+    vInitRequest( &xRequest, MAX_EMMC_REQUEST_TYPE, 0, pucBuff );
+    assert_int_equal( ERROR, iEMMC_Submit( &xRequest ) );
+
+    vInitRequest( &xRequest, EMMC_REQUEST_TYPE_READ, 0, pucBuff );
+    xRequest.ullAddress = 1;
+    assert_int_equal( ERROR, iEMMC_Submit( &xRequest ) );
+
+    vInitRequest( &xRequest, EMMC_REQUEST_TYPE_READ, 0, pucBuff );
+    xRequest.ulBlockCount = UINT32_MAX;
+    assert_int_equal( ERROR, iEMMC_Submit( &xRequest ) );
+
+    /* Past the end of the device, and wrapping a 32-bit block address */
+    vInitRequest( &xRequest, EMMC_REQUEST_TYPE_READ, 0, pucBuff );
+    xRequest.ullAddress = ( uint64_t )( TEST_DEVICE_BLOCKS - 1 ) * TEST_BLOCK_SIZE;
+    assert_int_equal( ERROR, iEMMC_Submit( &xRequest ) );
+
+    vInitRequest( &xRequest, EMMC_REQUEST_TYPE_READ, 0, pucBuff );
+    xRequest.ullAddress   = TEST_BLOCK_SIZE;
+    xRequest.ulBlockCount = UINT32_MAX;
+    assert_int_equal( ERROR, iEMMC_Submit( &xRequest ) );
+
+    assert_int_equal( ERROR, iEMMC_GetQueueDepth( NULL, NULL ) );
+    vAssertQueueDepth( 0, 0 );
+    assert_int_equal( 0, iCompletedCount );
+    assert_int_equal( 0, iChunkCount );
+}
+
+static void test_chunking( void **state )
+{
+    EMMC_REQUEST xRequest = { 0 };
+    uint8_t      pucBuff[ TEST_CHUNKED_SIZE ];
+    uint8_t      pucRead[ TEST_CHUNKED_SIZE ];
+    uint32_t     ulFirstBlock   = 40;
+    uint32_t     pulExpected[]  = { 3, 3, 3, 1 };
+    int          i              = 0;
+
+    for( i = 0; i < TEST_CHUNKED_SIZE; i++ )
+    {
+        pucBuff[ i ] = ( uint8_t )( 0x11 + ( i * 13 ) + ( i / TEST_BLOCK_SIZE ) );
+    }
+
+    /* A request larger than the backend chunk is split in order */
+    vInitRequest( &xRequest, EMMC_REQUEST_TYPE_WRITE, 0, pucBuff );
+    xRequest.ullAddress   = ( uint64_t )ulFirstBlock * TEST_BLOCK_SIZE;
+    xRequest.ulBlockCount = TEST_CHUNKED_BLOCKS;
+    assert_int_equal( OK, iEMMC_Submit( &xRequest ) );
+    vRunEmmcTask( UINT32_MAX );
+
+    assert_int_equal( OK, xRequest.iStatus );
+    assert_int_equal( 4, iChunkCount );
+    for( i = 0; i < iChunkCount; i++ )
+    {
+        assert_int_equal( ulFirstBlock + ( i * TEST_MAX_CHUNK_BLOCKS ), pulChunkAddress[ i ] );
+        assert_int_equal( pulExpected[ i ], pulChunkBlocks[ i ] );
+        assert_true( &pucBuff[ i * TEST_MAX_CHUNK_BLOCKS * TEST_BLOCK_SIZE ] == ppucChunkBuff[ i ] );
+    }
+    assert_memory_equal( pucBuff, &pucImage[ ulFirstBlock * TEST_BLOCK_SIZE ], TEST_CHUNKED_SIZE );
+
+    /* Reads are split the same way */
+    memset( pucRead, 0, sizeof( pucRead ) );
+    iChunkCount = 0;
+    assert_int_equal( OK, iEMMC_Read( ( uint64_t )ulFirstBlock * TEST_BLOCK_SIZE, TEST_CHUNKED_BLOCKS, pucRead ) );
+    assert_int_equal( 4, iChunkCount );
+    assert_memory_equal( pucBuff, pucRead, TEST_CHUNKED_SIZE );
+
+    /* A request that fits in one chunk is passed straight through */
+    iChunkCount = 0;
+    assert_int_equal( OK, iEMMC_Read( ( uint64_t )ulFirstBlock * TEST_BLOCK_SIZE, 1, pucRead ) );
+    assert_int_equal( 1, iChunkCount );
+    assert_int_equal( ulFirstBlock, pulChunkAddress[ 0 ] );
+    assert_int_equal( 1, pulChunkBlocks[ 0 ] );
+}
+
+static void test_chunk_failure( void **state )
+{
+    EMMC_REQUEST xRequest = { 0 };
+    uint8_t      pucBuff[ TEST_CHUNKED_SIZE ];
+
+    memset( pucBuff, 0x33, sizeof( pucBuff ) );
+
+    /* The request stops at the first failed chunk and still completes */
+    iFailChunk = 1;
+    vInitRequest( &xRequest, EMMC_REQUEST_TYPE_WRITE, 0, pucBuff );
+    xRequest.ulBlockCount = TEST_CHUNKED_BLOCKS;
+    assert_int_equal( OK, iEMMC_Submit( &xRequest ) );
+    vRunEmmcTask( UINT32_MAX );
+
+    assert_int_equal( 2, iChunkCount );
+    assert_int_equal( ERROR, xRequest.iStatus );
+    assert_int_equal( EMMC_REQUEST_STATE_DONE, xRequest.xState );
+    assert_int_equal( 1, iCompletedCount );
+    vAssertQueueDepth( 0, 1 );
+
+    /* Synchronous callers see the failure */
+    iChunkCount = 0;
+    iFailChunk  = 0;
+    assert_int_equal( ERROR, iEMMC_Write( 0, 1, pucBuff ) );
+    assert_int_equal( 1, iChunkCount );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup( test_queue_depth, iTestReset ),
+        cmocka_unit_test_setup( test_overlap, iTestReset ),
+        cmocka_unit_test_setup( test_semaphore_completion, iTestReset ),
+        cmocka_unit_test_setup( test_sync_read_write, iTestReset ),
+        cmocka_unit_test_setup( test_invalid_requests, iTestReset ),
+        cmocka_unit_test_setup( test_chunking, iTestReset ),
+        cmocka_unit_test_setup( test_chunk_failure, iTestReset ),
+    };
+
+    return cmocka_run_group_tests( tests, iTestSetup, NULL );
+}
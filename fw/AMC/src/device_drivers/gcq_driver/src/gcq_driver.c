@@ -313,6 +313,146 @@ static inline GCQ_ERRORS_TYPE prvxGCQConsume( GCQ_INSTANCE_TYPE *pxGCQInstance,
     return xStatus;
 }
 
+/**
+ *
+ * @brief   Get the number of slots that can be produced, up to a limit
+ *
+ * @param   pxGCQInstance the gcq driver instance
+ * @param   pxRing the sq or cq ring buffer
+ * @param   ulMaxSlots the maximum number of slots wanted
+ *
+ * @return  the number of free slots, capped at ulMaxSlots
+ *
+ * @note    The consumed pointer is only re-read if the cached value does not
+ *          show enough free slots.
+ *
+ */
+static inline uint32_t prvulGCQProducibleSlots( const GCQ_INSTANCE_TYPE *pxGCQInstance,
+                                                struct GCQ_RING_TYPE *pxRing,
+                                                uint32_t ulMaxSlots )
+{
+    uint32_t ulSlots = 0;
+
+    gcq_assert( pxGCQInstance );
+    gcq_assert( pxRing );
+
+    ulSlots = pxRing->ulRingSlotNum - ( pxRing->ulRingProduced - pxRing->ulRingConsumed );
+    if( ulSlots < ulMaxSlots )
+    {
+        prvvGCQRingReadConsumed( pxGCQInstance->pxGCQIOAccess, pxGCQInstance->xGCQFlags, pxRing );
+        ulSlots = pxRing->ulRingSlotNum - ( pxRing->ulRingProduced - pxRing->ulRingConsumed );
+    }
+
+    return ( ( ulSlots < ulMaxSlots ) ? ulSlots : ulMaxSlots );
+}
+
+/**
+ *
+ * @brief   Get the number of slots that can be consumed, up to a limit
+ *
+ * @param   pxGCQInstance the gcq driver instance
+ * @param   pxRing the sq or cq ring buffer
+ * @param   ulMaxSlots the maximum number of slots wanted
+ *
+ * @return  the number of slots holding data, capped at ulMaxSlots
+ *
+ * @note    The produced pointer is only re-read if the cached value does not
+ *          show enough slots.
+ *
+ */
+static inline uint32_t prvulGCQConsumableSlots( const GCQ_INSTANCE_TYPE *pxGCQInstance,
+                                                struct GCQ_RING_TYPE *pxRing,
+                                                uint32_t ulMaxSlots )
+{
+    uint32_t ulSlots = 0;
+
+    if( GCQ_TRUE == likely( prvucGCQCanConsume( pxGCQInstance, pxRing ) ) )
+    {
+        ulSlots = pxRing->ulRingProduced - pxRing->ulRingConsumed;
+        if( ulSlots < ulMaxSlots )
+        {
+            prvvGCQRingReadProduced( pxGCQInstance->pxGCQIOAccess, pxGCQInstance->xGCQFlags, pxRing );
+            ulSlots = pxRing->ulRingProduced - pxRing->ulRingConsumed;
+        }
+    }
+
+    return ( ( ulSlots < ulMaxSlots ) ? ulSlots : ulMaxSlots );
+}
+
+/**
+ *
+ * @brief   Copy a slot from the ring into a local buffer
+ *
+ * @param   pxGCQInstance the gcq driver instance
+ * @param   ullSlotAddr is the slot address
+ * @param   pucData is the buffer to populate
+ * @param   ulDataLen is the length to copy, 32-bit aligned
+ *
+ * @return  N/A
+ *
+ * @note    Uses the bound in block copy if provided, otherwise 32-bit accesses
+ *
+ */
+static inline void prvvGCQReadSlot( const GCQ_INSTANCE_TYPE *pxGCQInstance,
+                                    uint64_t ullSlotAddr,
+                                    uint8_t *pucData,
+                                    uint32_t ulDataLen )
+{
+    GCQ_DEBUG( "Read data from slot addr:0x%llx len:%ld\r\n", ullSlotAddr, ulDataLen );
+
+    if( CHECK_NOT_NULL( pxGCQInstance->pxGCQIOAccess->xGCQReadMemBlock ) )
+    {
+        pxGCQInstance->pxGCQIOAccess->xGCQReadMemBlock( ullSlotAddr, pucData, ulDataLen );
+    }
+    else
+    {
+        int offset = 0;
+
+        for( offset = 0; offset < ulDataLen; offset += 4 )
+        {
+            *( uint32_t *)( pucData + offset ) = pxGCQInstance->pxGCQIOAccess->xGCQReadMem32( ullSlotAddr + offset );
+            GCQ_DEBUG( "Read addr:0x%llx val:0x%lx\r\n", ullSlotAddr + offset, *( uint32_t* )( pucData + offset ) );
+        }
+    }
+}
+
+/**
+ *
+ * @brief   Copy a local buffer into a slot in the ring
+ *
+ * @param   pxGCQInstance the gcq driver instance
+ * @param   ullSlotAddr is the slot address
+ * @param   pucData is the buffer to copy from
+ * @param   ulDataLen is the length to copy, 32-bit aligned
+ *
+ * @return  N/A
+ *
+ * @note    Uses the bound in block copy if provided, otherwise 32-bit accesses
+ *
+ */
+static inline void prvvGCQWriteSlot( const GCQ_INSTANCE_TYPE *pxGCQInstance,
+                                     uint64_t ullSlotAddr,
+                                     uint8_t *pucData,
+                                     uint32_t ulDataLen )
+{
+    GCQ_DEBUG( "Write data to slot addr:0x%llx len:%ld\r\n", ullSlotAddr, ulDataLen );
+
+    if( CHECK_NOT_NULL( pxGCQInstance->pxGCQIOAccess->xGCQWriteMemBlock ) )
+    {
+        pxGCQInstance->pxGCQIOAccess->xGCQWriteMemBlock( ullSlotAddr, pucData, ulDataLen );
+    }
+    else
+    {
+        int offset = 0;
+
+        for( offset = 0; offset < ulDataLen; offset += 4 )
+        {
+            pxGCQInstance->pxGCQIOAccess->xGCQWriteMem32( ullSlotAddr + offset, *( uint32_t * )( pucData + offset ) );
+            GCQ_DEBUG( "Write addr:0x%llx val:0x%lx\r\n", ullSlotAddr + offset, *( uint32_t * )( pucData + offset ) );
+        }
+    }
+}
+
 /**
  *
  * @brief   Attempt to find an uninitialized GCQ instance
@@ -689,15 +829,8 @@ GCQ_ERRORS_TYPE xGCQConsumeData( struct GCQ_INSTANCE_TYPE *pxGCQInstance, uint8_
 
         if( GCQ_ERRORS_NONE == xStatus )
         {
-            int offset;
-            GCQ_DEBUG( "Read data from slot addr:0x%llx len:%ld\r\n", ullSlotAddr, ulDataLen );
-
             /* Process the data & populate the return buffer */
-            for( offset = 0; offset < ulDataLen; offset += 4 )
-            {
-                *( uint32_t *)( pucData + offset ) = pxGCQInstance->pxGCQIOAccess->xGCQReadMem32( ullSlotAddr + offset );
-                GCQ_DEBUG( "Read addr:0x%llx val:0x%lx\r\n", ullSlotAddr + offset, *( uint32_t* )( pucData + offset ) );
-            }
+            prvvGCQReadSlot( pxGCQInstance, ullSlotAddr, pucData, ulDataLen );
 
             /* Notify the peer the data has been consumed */
             prvvGCQRingWriteConsumed( pxGCQInstance->pxGCQIOAccess, pxGCQInstance->xGCQFlags, pxGCQInstance->pxGCQConsumer );
@@ -762,14 +895,7 @@ GCQ_ERRORS_TYPE xGCQProduceData( struct GCQ_INSTANCE_TYPE *pxGCQInstance, uint8_
 
         if( GCQ_ERRORS_NONE == xStatus )
         {
-            int offset = 0;
-            GCQ_DEBUG( "Write data to slot addr:0x%llx len:%ld\r\n", ullSlotAddr, ulDataLen );
-
-            for( offset = 0; offset < ulDataLen; offset += 4 )
-            {
-                pxGCQInstance->pxGCQIOAccess->xGCQWriteMem32( ullSlotAddr + offset, *( uint32_t * )( pucData + offset ) );
-                GCQ_DEBUG( "Write addr:0x%llx val:0x%lx\r\n", ullSlotAddr + offset, *( uint32_t * )( pucData + offset ) );
-            }
+            prvvGCQWriteSlot( pxGCQInstance, ullSlotAddr, pucData, ulDataLen );
 
             prvvGCQRingWriteProduced( pxGCQInstance->pxGCQIOAccess, pxGCQInstance->xGCQFlags, pxGCQInstance->pxGCQProducer );
 
@@ -794,6 +920,181 @@ GCQ_ERRORS_TYPE xGCQProduceData( struct GCQ_INSTANCE_TYPE *pxGCQInstance, uint8_
     return xStatus;
 }
 
+/**
+ *
+ * @brief    Function to consume a batch of slots from the ring buffer
+ *
+ */
+GCQ_ERRORS_TYPE xGCQConsumeDataBatch( struct GCQ_INSTANCE_TYPE *pxGCQInstance,
+                                      uint8_t *pucData,
+                                      uint32_t ulDataLen,
+                                      uint32_t ulMaxSlots,
+                                      uint32_t *pulNumSlots )
+{
+    GCQ_ERRORS_TYPE xStatus = GCQ_ERRORS_INVALID_ARG;
+
+    uint32_t ulSlots = 0;
+
+    if( ( GCQ_INSTANCE_UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( GCQ_INSTANCE_LOWER_FIREWALL == pxThis->ulLowerFirewall ) )
+    {
+        xStatus = GCQ_ERRORS_NONE;
+
+        if( ( CHECK_INSTANCE( pxGCQInstance ) ) || ( GCQ_FALSE == pxGCQInstance->iInitialised ) )
+        {
+            xStatus = GCQ_ERRORS_INVALID_INSTANCE;
+        }
+        else if( CHECK_ATTACHED( pxGCQInstance ) )
+        {
+            xStatus = GCQ_ERRORS_CONSUMER_NOT_ATTACHED;
+        }
+        else if( ulDataLen > pxGCQInstance->ulConsumerSlotSize )
+        {
+            GCQ_DEBUG( " Error: length 0x%lx specified is larger than slot configured\r\n", ulDataLen );
+            xStatus = GCQ_ERRORS_INVALID_ARG;
+        }
+
+        if( ( CHECK_NULL( pucData ) ) || ( CHECK_NULL( pulNumSlots ) ) || ( 0 == ulMaxSlots ) )
+        {
+            xStatus = GCQ_ERRORS_INVALID_ARG;
+        }
+
+        if( !CHECK_32BIT_ALIGNMENT( ulDataLen ) )
+        {
+            GCQ_DEBUG( " Error: length 0x%lx is not 32bit aligned\r\n", ulDataLen );
+            xStatus = GCQ_ERRORS_INVALID_ARG;
+        }
+
+        if( GCQ_ERRORS_NONE == xStatus )
+        {
+            *pulNumSlots = 0;
+            ulSlots = prvulGCQConsumableSlots( pxGCQInstance, pxGCQInstance->pxGCQConsumer, ulMaxSlots );
+            if( 0 == ulSlots )
+            {
+                xStatus = GCQ_ERRORS_CONSUMER_NO_DATA_RECEIVED;
+            }
+        }
+
+        if( GCQ_ERRORS_NONE == xStatus )
+        {
+            struct GCQ_RING_TYPE *pxRing = pxGCQInstance->pxGCQConsumer;
+            uint32_t ulSlot = 0;
+
+            for( ulSlot = 0; ulSlot < ulSlots; ulSlot++ )
+            {
+                prvvGCQReadSlot( pxGCQInstance,
+                                 prvullGCQRingGetSlotPtrConsumed( pxRing ),
+                                 pucData + ( ulSlot * ulDataLen ),
+                                 ulDataLen );
+                pxRing->ulRingConsumed++;
+            }
+
+            /* Notify the peer once for the whole batch */
+            prvvGCQRingWriteConsumed( pxGCQInstance->pxGCQIOAccess, pxGCQInstance->xGCQFlags, pxRing );
+            *pulNumSlots = ulSlots;
+
+            if( ( GCQ_INTERRUPT_MODE_INTERRUPT_REG == pxGCQInstance->xIntMode ) )
+            {
+                xStatus = xGCQHWClearInterrupt( pxGCQInstance->xMode,
+                                                pxGCQInstance->ullBaseAddr,
+                                                pxGCQInstance->pxGCQIOAccess );
+            }
+        }
+    }
+
+    return xStatus;
+}
+
+/**
+ *
+ * @brief    Function to provide a batch of slots and populate the ring buffer
+ *
+ */
+GCQ_ERRORS_TYPE xGCQProduceDataBatch( struct GCQ_INSTANCE_TYPE *pxGCQInstance,
+                                      uint8_t *pucData,
+                                      uint32_t ulDataLen,
+                                      uint32_t ulNumSlots,
+                                      uint32_t *pulNumProduced )
+{
+    GCQ_ERRORS_TYPE xStatus = GCQ_ERRORS_INVALID_ARG;
+
+    uint32_t ulSlots = 0;
+
+    if( ( GCQ_INSTANCE_UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( GCQ_INSTANCE_LOWER_FIREWALL == pxThis->ulLowerFirewall ) )
+    {
+        xStatus = GCQ_ERRORS_NONE;
+
+        if( ( CHECK_INSTANCE( pxGCQInstance ) ) || ( GCQ_FALSE == pxGCQInstance->iInitialised ) )
+        {
+            xStatus = GCQ_ERRORS_INVALID_INSTANCE;
+        }
+        else if( ulDataLen > pxGCQInstance->ulProducerSlotSize )
+        {
+            GCQ_DEBUG( " Error: length 0x%lx specified is larger than slot configured\r\n", ulDataLen );
+            xStatus = GCQ_ERRORS_INVALID_ARG;
+        }
+
+        if( ( CHECK_NULL( pucData ) ) || ( CHECK_NULL( pulNumProduced ) ) || ( 0 == ulNumSlots ) )
+        {
+            xStatus = GCQ_ERRORS_INVALID_ARG;
+        }
+
+        if( !CHECK_32BIT_ALIGNMENT( ulDataLen ) )
+        {
+            GCQ_DEBUG( " Error: length 0x%lx is not 32bit aligned\r\n", ulDataLen );
+            xStatus = GCQ_ERRORS_INVALID_ARG;
+        }
+
+        if( GCQ_ERRORS_NONE == xStatus )
+        {
+            *pulNumProduced = 0;
+            ulSlots = prvulGCQProducibleSlots( pxGCQInstance, pxGCQInstance->pxGCQProducer, ulNumSlots );
+            if( 0 == ulSlots )
+            {
+                xStatus = GCQ_ERRORS_PRODUCER_NO_FREE_SLOTS;
+            }
+        }
+
+        if( GCQ_ERRORS_NONE == xStatus )
+        {
+            struct GCQ_RING_TYPE *pxRing = pxGCQInstance->pxGCQProducer;
+            uint32_t ulSlot = 0;
+
+            for( ulSlot = 0; ulSlot < ulSlots; ulSlot++ )
+            {
+                prvvGCQWriteSlot( pxGCQInstance,
+                                  prvullGCQRingGetSlotPtrProduced( pxRing ),
+                                  pucData + ( ulSlot * ulDataLen ),
+                                  ulDataLen );
+                pxRing->ulRingProduced++;
+            }
+
+            /* Publish the whole batch to the peer at once */
+            prvvGCQRingWriteProduced( pxGCQInstance->pxGCQIOAccess, pxGCQInstance->xGCQFlags, pxRing );
+            *pulNumProduced = ulSlots;
+
+            if( GCQ_INTERRUPT_MODE_INTERRUPT_REG == pxGCQInstance->xIntMode )
+            {
+                xStatus = xGCQHWTriggerInterrupt( pxGCQInstance->xMode,
+                                                  pxGCQInstance->ullBaseAddr,
+                                                  pxGCQInstance->pxGCQIOAccess );
+
+                if( GCQ_ERRORS_NONE != xStatus )
+                {
+                    GCQ_DEBUG( "Error: Interrupt trigger failed with status: %d\r\n", xStatus );
+                }
+            }
+        }
+        else
+        {
+            GCQ_DEBUG( "Error: Failed to add batch into slots: %d\r\n", xStatus );
+        }
+    }
+
+    return xStatus;
+}
+
 /**
  *
  * @brief    Sets this modules version information
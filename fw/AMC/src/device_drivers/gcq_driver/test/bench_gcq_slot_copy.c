@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains a microbenchmark comparing the GCQ slot copy cost
+ * through the 32-bit memory functions and the optional block functions.
+ *
+ * @file bench_gcq_slot_copy.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "gcq_internal.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define BENCH_GCQ_REG_SIZE          ( 0x200 )
+#define BENCH_GCQ_RING_SIZE         ( 0x10000 )
+#define BENCH_GCQ_MAX_SLOT_SIZE     ( 4096 )
+#define BENCH_GCQ_TARGET_BYTES      ( 64 * 1024 * 1024 )
+
+#define BENCH_NS_PER_S              ( 1000000000ULL )
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static uint32_t pulRegs[ BENCH_GCQ_REG_SIZE / sizeof( uint32_t ) ] = { 0 };
+static uint32_t pulRing[ BENCH_GCQ_RING_SIZE / sizeof( uint32_t ) ] = { 0 };
+static uint32_t pulSlot[ BENCH_GCQ_MAX_SLOT_SIZE / sizeof( uint32_t ) ] = { 0 };
+
+
+/*****************************************************************************/
+/* IO functions - addresses are host pointers                                */
+/*****************************************************************************/
+
+static uint32_t ulReadMemReg32( uint64_t ullAddr )
+{
+    return *( volatile uint32_t * )( uintptr_t )ullAddr;
+}
+
+static void vWriteMemReg32( uint64_t ullAddr, uint32_t ulValue )
+{
+    *( volatile uint32_t * )( uintptr_t )ullAddr = ulValue;
+}
+
+static void vReadMemBlock( uint64_t ullAddr, uint8_t *pucData, uint32_t ulLen )
+{
+    memcpy( pucData, ( const void * )( uintptr_t )ullAddr, ulLen );
+}
+
+static void vWriteMemBlock( uint64_t ullAddr, const uint8_t *pucData, uint32_t ulLen )
+{
+    memcpy( ( void * )( uintptr_t )ullAddr, pucData, ulLen );
+}
+
+static const GCQ_IO_ACCESS_TYPE xWordIO =
+{
+    ulReadMemReg32,
+    vWriteMemReg32,
+    ulReadMemReg32,
+    vWriteMemReg32,
+    NULL,
+    NULL
+};
+
+static const GCQ_IO_ACCESS_TYPE xBlockIO =
+{
+    ulReadMemReg32,
+    vWriteMemReg32,
+    ulReadMemReg32,
+    vWriteMemReg32,
+    vReadMemBlock,
+    vWriteMemBlock
+};
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static uint64_t ullNowNs( void )
+{
+    struct timespec xTs = { 0 };
+
+    clock_gettime( CLOCK_MONOTONIC, &xTs );
+
+    return ( ( uint64_t )xTs.tv_sec * BENCH_NS_PER_S ) + xTs.tv_nsec;
+}
+
+/**
+ * @brief   Time producing and consuming slots of the given size
+ *
+ * @return  0 on success, -1 on error
+ */
+static int iRunBench( const char *pcPath, const GCQ_IO_ACCESS_TYPE *pxIO, uint32_t ulSlotSize )
+{
+    int iStatus = -1;
+    struct GCQ_INSTANCE_TYPE *pxInstance = NULL;
+    uint64_t ullBase = ( uintptr_t )pulRegs;
+    uint64_t ullRing = ( uintptr_t )pulRing;
+    uint32_t *pulPeerProduced = &pulRegs[ GCQ_PRODUCER_CQ_TAIL_POINTER / sizeof( uint32_t ) ];
+    uint32_t *pulProduced = &pulRegs[ GCQ_PRODUCER_SQ_TAIL_POINTER / sizeof( uint32_t ) ];
+    uint32_t *pulPeerConsumed = &pulRing[ offsetof( struct GCQ_HEADER_TYPE, ulHdrCQConsumed ) / sizeof( uint32_t ) ];
+    uint32_t ulIterations = BENCH_GCQ_TARGET_BYTES / ulSlotSize;
+    uint64_t ullProduceNs = 0;
+    uint64_t ullConsumeNs = 0;
+    uint64_t ullStart = 0;
+    uint32_t i = 0;
+
+    memset( pulRegs, 0, sizeof( pulRegs ) );
+    memset( pulRing, 0, sizeof( pulRing ) );
+
+    if( GCQ_ERRORS_NONE == xGCQInit( &pxInstance, pxIO, GCQ_MODE_TYPE_PRODUCER_MODE, GCQ_INTERRUPT_MODE_POLLING,
+                                     0, ullBase, ullRing, sizeof( pulRing ), ulSlotSize, ulSlotSize ) )
+    {
+        iStatus = 0;
+
+        /* Produce onto the CQ, the peer consumes as it goes */
+        ullStart = ullNowNs();
+        for( i = 0; ( 0 == iStatus ) && ( i < ulIterations ); i++ )
+        {
+            pulSlot[ 0 ] = i;
+            if( GCQ_ERRORS_NONE != xGCQProduceData( pxInstance, ( uint8_t * )pulSlot, ulSlotSize ) )
+            {
+                iStatus = -1;
+            }
+            *pulPeerConsumed = *pulProduced;
+        }
+        ullProduceNs = ullNowNs() - ullStart;
+
+        /* Consume from the SQ, the peer produces as it goes */
+        ullStart = ullNowNs();
+        for( i = 0; ( 0 == iStatus ) && ( i < ulIterations ); i++ )
+        {
+            ( *pulPeerProduced )++;
+            if( GCQ_ERRORS_NONE != xGCQConsumeData( pxInstance, ( uint8_t * )pulSlot, ulSlotSize ) )
+            {
+                iStatus = -1;
+            }
+        }
+        ullConsumeNs = ullNowNs() - ullStart;
+
+        xGCQDeinit( pxInstance );
+    }
+
+    if( 0 == iStatus )
+    {
+        printf( "%-6s %6u %10u %12.1f %12.1f %10.1f %10.1f\n",
+                pcPath, ulSlotSize, ulIterations,
+                ( double )ullProduceNs / ulIterations,
+                ( double )ullConsumeNs / ulIterations,
+                ( ( double )ulIterations * ulSlotSize * 1000 ) / ullProduceNs,
+                ( ( double )ulIterations * ulSlotSize * 1000 ) / ullConsumeNs );
+    }
+    else
+    {
+        printf( "%-6s %6u FAILED\n", pcPath, ulSlotSize );
+    }
+
+    return iStatus;
+}
+
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+int main( void )
+{
+    int iStatus = 0;
+    uint32_t pulSlotSizes[ ] = { 64, 4096 };
+    int i = 0;
+
+    printf( "%-6s %6s %10s %12s %12s %10s %10s\n",
+            "path", "slot", "slots", "produce_ns", "consume_ns", "prod_MB/s", "cons_MB/s" );
+
+    for( i = 0; i < ( sizeof( pulSlotSizes ) / sizeof( pulSlotSizes[ 0 ] ) ); i++ )
+    {
+        iStatus |= iRunBench( "word", &xWordIO, pulSlotSizes[ i ] );
+        iStatus |= iRunBench( "block", &xBlockIO, pulSlotSizes[ i ] );
+    }
+
+    return ( 0 == iStatus ) ? 0 : 1;
+}
@@ -0,0 +1,436 @@
+/**
+ * Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains throughput tests for the GCQ driver batch APIs.
+ * The peer side of the queue is simulated directly in fake memory and
+ * registers, and every tail pointer write and interrupt is counted.
+ *
+ * @file test_gcq_batch.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "cmocka.h"
+
+#include "gcq_internal.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_GCQ_BASE_ADDR          ( 0x0000 )
+#define TEST_GCQ_REG_SIZE           ( 0x200 )
+#define TEST_GCQ_RING_ADDR          ( 0x10000 )
+#define TEST_GCQ_RING_SIZE          ( 0x1000 )
+#define TEST_GCQ_SLOT_SIZE          ( 64 )
+
+#define TEST_GCQ_NUM_MESSAGES       ( 1000 )
+#define TEST_GCQ_BATCH_SIZE         ( 8 )
+
+/* Producer mode: the CQ is produced through the SQ tail register and the SQ is consumed in memory */
+#define TEST_GCQ_PRODUCED_REG       ( TEST_GCQ_BASE_ADDR + GCQ_PRODUCER_SQ_TAIL_POINTER )
+#define TEST_GCQ_PEER_PRODUCED_REG  ( TEST_GCQ_BASE_ADDR + GCQ_PRODUCER_CQ_TAIL_POINTER )
+#define TEST_GCQ_INTERRUPT_REG      ( TEST_GCQ_BASE_ADDR + GCQ_PRODUCER_SQ_INTERRUPT_REG )
+#define TEST_GCQ_CONSUMED_ADDR      ( TEST_GCQ_RING_ADDR + offsetof( struct GCQ_HEADER_TYPE, ulHdrSQConsumed ) )
+#define TEST_GCQ_PEER_CONSUMED_ADDR ( TEST_GCQ_RING_ADDR + offsetof( struct GCQ_HEADER_TYPE, ulHdrCQConsumed ) )
+
+#define REG( a )                    ( *pulFakeAddr( a ) )
+#define MEM( a )                    ( *pulFakeAddr( a ) )
+
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * @struct  TEST_GCQ_COUNTERS
+ * @brief   Accesses of interest to throughput
+ */
+typedef struct TEST_GCQ_COUNTERS
+{
+    uint32_t ulProducedWrites;
+    uint32_t ulConsumedWrites;
+    uint32_t ulInterruptsTriggered;
+    uint32_t ulInterruptsCleared;
+
+} TEST_GCQ_COUNTERS;
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static uint32_t pulFakeRegs[ TEST_GCQ_REG_SIZE / sizeof( uint32_t ) ] = { 0 };
+static uint32_t pulFakeRing[ TEST_GCQ_RING_SIZE / sizeof( uint32_t ) ] = { 0 };
+static TEST_GCQ_COUNTERS xCounters = { 0 };
+
+
+/*****************************************************************************/
+/* Fake IO                                                                   */
+/*****************************************************************************/
+
+/**
+ * @brief   Map an address onto the fake registers or ring
+ *
+ * @note    Without GCQ_FLAGS_TYPE_IN_MEM_PTR_ENABLE the consumed pointers,
+ *          which live in the ring header, are accessed as registers
+ */
+static uint32_t *pulFakeAddr( uint64_t ullAddr )
+{
+    uint32_t *pulAddr = NULL;
+
+    if( ullAddr >= TEST_GCQ_RING_ADDR )
+    {
+        assert_true( ullAddr < ( TEST_GCQ_RING_ADDR + TEST_GCQ_RING_SIZE ) );
+        pulAddr = &pulFakeRing[ ( ullAddr - TEST_GCQ_RING_ADDR ) / sizeof( uint32_t ) ];
+    }
+    else
+    {
+        assert_true( ullAddr < ( TEST_GCQ_BASE_ADDR + TEST_GCQ_REG_SIZE ) );
+        pulAddr = &pulFakeRegs[ ( ullAddr - TEST_GCQ_BASE_ADDR ) / sizeof( uint32_t ) ];
+    }
+
+    return pulAddr;
+}
+
+static uint32_t ulFakeReadReg32( uint64_t ullRegAddr )
+{
+    if( TEST_GCQ_INTERRUPT_REG == ullRegAddr )
+    {
+        xCounters.ulInterruptsCleared++;
+    }
+
+    return REG( ullRegAddr );
+}
+
+static void vFakeWriteReg32( uint64_t ullRegAddr, uint32_t ulValue )
+{
+    if( TEST_GCQ_PRODUCED_REG == ullRegAddr )
+    {
+        xCounters.ulProducedWrites++;
+    }
+    else if( TEST_GCQ_CONSUMED_ADDR == ullRegAddr )
+    {
+        xCounters.ulConsumedWrites++;
+    }
+    else if( TEST_GCQ_INTERRUPT_REG == ullRegAddr )
+    {
+        xCounters.ulInterruptsTriggered++;
+        ulValue = 0;
+    }
+
+    REG( ullRegAddr ) = ulValue;
+}
+
+static uint32_t ulFakeReadMem32( uint64_t ullMemAddr )
+{
+    return MEM( ullMemAddr );
+}
+
+static void vFakeWriteMem32( uint64_t ullMemAddr, uint32_t ulValue )
+{
+    if( TEST_GCQ_CONSUMED_ADDR == ullMemAddr )
+    {
+        xCounters.ulConsumedWrites++;
+    }
+
+    MEM( ullMemAddr ) = ulValue;
+}
+
+static const GCQ_IO_ACCESS_TYPE xFakeIO =
+{
+    ulFakeReadReg32,
+    vFakeWriteReg32,
+    ulFakeReadMem32,
+    vFakeWriteMem32
+};
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+/**
+ * @brief   Creates a producer mode instance over the fake IO and clears the counters
+ */
+static struct GCQ_INSTANCE_TYPE *pxCreateInstance( void )
+{
+    struct GCQ_INSTANCE_TYPE *pxInstance = NULL;
+
+    memset( pulFakeRegs, 0, sizeof( pulFakeRegs ) );
+    memset( pulFakeRing, 0, sizeof( pulFakeRing ) );
+
+    assert_int_equal( GCQ_ERRORS_NONE, xGCQInit( &pxInstance,
+                                                 &xFakeIO,
+                                                 GCQ_MODE_TYPE_PRODUCER_MODE,
+                                                 GCQ_INTERRUPT_MODE_INTERRUPT_REG,
+                                                 0,
+                                                 TEST_GCQ_BASE_ADDR,
+                                                 TEST_GCQ_RING_ADDR,
+                                                 TEST_GCQ_RING_SIZE,
+                                                 TEST_GCQ_SLOT_SIZE,
+                                                 TEST_GCQ_SLOT_SIZE ) );
+    assert_non_null( pxInstance );
+
+    memset( &xCounters, 0, sizeof( xCounters ) );
+
+    return pxInstance;
+}
+
+/**
+ * @brief   Peer side: consume everything produced on the CQ and check the payloads
+ */
+static uint32_t ulPeerDrainCQ( uint32_t ulNextMessage )
+{
+    uint32_t ulNumSlots = MEM( TEST_GCQ_RING_ADDR + offsetof( struct GCQ_HEADER_TYPE, ulHdrSlotNum ) );
+    uint32_t ulCQOffset = MEM( TEST_GCQ_RING_ADDR + offsetof( struct GCQ_HEADER_TYPE, ulHdrCQOffset ) );
+    uint32_t ulConsumed = MEM( TEST_GCQ_PEER_CONSUMED_ADDR );
+    uint32_t ulProduced = REG( TEST_GCQ_PRODUCED_REG );
+
+    for( ; ulConsumed != ulProduced; ulConsumed++ )
+    {
+        uint64_t ullSlot = TEST_GCQ_RING_ADDR + ulCQOffset +
+                           ( ( ulConsumed & ( ulNumSlots - 1 ) ) * TEST_GCQ_SLOT_SIZE );
+        assert_int_equal( ulNextMessage++, MEM( ullSlot ) );
+    }
+    MEM( TEST_GCQ_PEER_CONSUMED_ADDR ) = ulConsumed;
+
+    return ulNextMessage;
+}
+
+/**
+ * @brief   Peer side: fill as many free SQ slots as possible with sequential messages
+ */
+static uint32_t ulPeerFillSQ( uint32_t ulNextMessage, uint32_t ulLastMessage )
+{
+    uint32_t ulNumSlots = MEM( TEST_GCQ_RING_ADDR + offsetof( struct GCQ_HEADER_TYPE, ulHdrSlotNum ) );
+    uint32_t ulSQOffset = MEM( TEST_GCQ_RING_ADDR + offsetof( struct GCQ_HEADER_TYPE, ulHdrSQOffset ) );
+    uint32_t ulConsumed = MEM( TEST_GCQ_CONSUMED_ADDR );
+    uint32_t ulProduced = REG( TEST_GCQ_PEER_PRODUCED_REG );
+
+    while( ( ( ulProduced - ulConsumed ) < ulNumSlots ) && ( ulNextMessage < ulLastMessage ) )
+    {
+        uint64_t ullSlot = TEST_GCQ_RING_ADDR + ulSQOffset +
+                           ( ( ulProduced & ( ulNumSlots - 1 ) ) * TEST_GCQ_SLOT_SIZE );
+        MEM( ullSlot ) = ulNextMessage++;
+        ulProduced++;
+    }
+    REG( TEST_GCQ_PEER_PRODUCED_REG ) = ulProduced;
+
+    return ulNextMessage;
+}
+
+static void vPrintCounters( const char *pcName )
+{
+    print_message( "%-24s produced ptr writes: %4u consumed ptr writes: %4u "
+                   "irq triggers: %4u irq clears: %4u (per %d messages)\n",
+                   pcName,
+                   xCounters.ulProducedWrites, xCounters.ulConsumedWrites,
+                   xCounters.ulInterruptsTriggered, xCounters.ulInterruptsCleared,
+                   TEST_GCQ_NUM_MESSAGES );
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_produce_single( void **state )
+{
+    struct GCQ_INSTANCE_TYPE *pxInstance = pxCreateInstance();
+    uint8_t pucSlot[ TEST_GCQ_SLOT_SIZE ] = { 0 };
+    uint32_t ulMessage = 0;
+    uint32_t ulChecked = 0;
+
+    for( ulMessage = 0; ulMessage < TEST_GCQ_NUM_MESSAGES; ulMessage++ )
+    {
+        memcpy( pucSlot, &ulMessage, sizeof( ulMessage ) );
+        assert_int_equal( GCQ_ERRORS_NONE, xGCQProduceData( pxInstance, pucSlot, sizeof( pucSlot ) ) );
+        ulChecked = ulPeerDrainCQ( ulChecked );
+    }
+
+    vPrintCounters( "produce (single)" );
+    assert_int_equal( TEST_GCQ_NUM_MESSAGES, ulChecked );
+    assert_int_equal( TEST_GCQ_NUM_MESSAGES, xCounters.ulProducedWrites );
+    assert_int_equal( TEST_GCQ_NUM_MESSAGES, xCounters.ulInterruptsTriggered );
+
+    assert_int_equal( GCQ_ERRORS_NONE, xGCQDeinit( pxInstance ) );
+}
+
+static void test_produce_batch( void **state )
+{
+    struct GCQ_INSTANCE_TYPE *pxInstance = pxCreateInstance();
+    uint8_t pucSlots[ TEST_GCQ_BATCH_SIZE ][ TEST_GCQ_SLOT_SIZE ] = { { 0 } };
+    uint32_t ulMessage = 0;
+    uint32_t ulChecked = 0;
+    uint32_t ulBatches = 0;
+
+    while( ulMessage < TEST_GCQ_NUM_MESSAGES )
+    {
+        uint32_t ulWanted = TEST_GCQ_NUM_MESSAGES - ulMessage;
+        uint32_t ulProduced = 0;
+        uint32_t i = 0;
+
+        if( ulWanted > TEST_GCQ_BATCH_SIZE )
+        {
+            ulWanted = TEST_GCQ_BATCH_SIZE;
+        }
+        for( i = 0; i < ulWanted; i++ )
+        {
+            uint32_t ulValue = ulMessage + i;
+            memcpy( pucSlots[ i ], &ulValue, sizeof( ulValue ) );
+        }
+
+        assert_int_equal( GCQ_ERRORS_NONE, xGCQProduceDataBatch( pxInstance, &pucSlots[ 0 ][ 0 ],
+                                                                 TEST_GCQ_SLOT_SIZE, ulWanted, &ulProduced ) );
+        assert_int_equal( ulWanted, ulProduced );
+        ulMessage += ulProduced;
+        ulBatches++;
+
+        ulChecked = ulPeerDrainCQ( ulChecked );
+    }
+
+    vPrintCounters( "produce (batch of 8)" );
+    assert_int_equal( TEST_GCQ_NUM_MESSAGES, ulChecked );
+    assert_int_equal( ulBatches, xCounters.ulProducedWrites );
+    assert_int_equal( ulBatches, xCounters.ulInterruptsTriggered );
+
+    assert_int_equal( GCQ_ERRORS_NONE, xGCQDeinit( pxInstance ) );
+}
+
+static void test_produce_batch_partial( void **state )
+{
+    struct GCQ_INSTANCE_TYPE *pxInstance = pxCreateInstance();
+    uint32_t ulNumSlots = pxInstance->pxGCQProducer->ulRingSlotNum;
+    uint8_t pucSlots[ 2 * TEST_GCQ_RING_SIZE / TEST_GCQ_SLOT_SIZE ][ TEST_GCQ_SLOT_SIZE ] = { { 0 } };
+    uint32_t ulProduced = 0;
+
+    /* Only as many slots as the ring holds are accepted */
+    assert_int_equal( GCQ_ERRORS_NONE, xGCQProduceDataBatch( pxInstance, &pucSlots[ 0 ][ 0 ], TEST_GCQ_SLOT_SIZE,
+                                                             ulNumSlots + 1, &ulProduced ) );
+    assert_int_equal( ulNumSlots, ulProduced );
+
+    assert_int_equal( GCQ_ERRORS_PRODUCER_NO_FREE_SLOTS, xGCQProduceDataBatch( pxInstance, &pucSlots[ 0 ][ 0 ],
+                                                                               TEST_GCQ_SLOT_SIZE, 1, &ulProduced ) );
+    assert_int_equal( 0, ulProduced );
+    assert_int_equal( 1, xCounters.ulProducedWrites );
+    assert_int_equal( 1, xCounters.ulInterruptsTriggered );
+
+    assert_int_equal( GCQ_ERRORS_NONE, xGCQDeinit( pxInstance ) );
+}
+
+static void test_consume_single( void **state )
+{
+    struct GCQ_INSTANCE_TYPE *pxInstance = pxCreateInstance();
+    uint8_t pucSlot[ TEST_GCQ_SLOT_SIZE ] = { 0 };
+    uint32_t ulSent = 0;
+    uint32_t ulReceived = 0;
+
+    while( ulReceived < TEST_GCQ_NUM_MESSAGES )
+    {
+        ulSent = ulPeerFillSQ( ulSent, TEST_GCQ_NUM_MESSAGES );
+
+        while( GCQ_ERRORS_NONE == xGCQConsumeData( pxInstance, pucSlot, sizeof( pucSlot ) ) )
+        {
+            uint32_t ulValue = 0;
+            memcpy( &ulValue, pucSlot, sizeof( ulValue ) );
+            assert_int_equal( ulReceived++, ulValue );
+        }
+    }
+
+    vPrintCounters( "consume (single)" );
+    assert_int_equal( TEST_GCQ_NUM_MESSAGES, xCounters.ulConsumedWrites );
+    assert_int_equal( TEST_GCQ_NUM_MESSAGES, xCounters.ulInterruptsCleared );
+
+    assert_int_equal( GCQ_ERRORS_NONE, xGCQDeinit( pxInstance ) );
+}
+
+static void test_consume_batch( void **state )
+{
+    struct GCQ_INSTANCE_TYPE *pxInstance = pxCreateInstance();
+    uint8_t pucSlots[ TEST_GCQ_BATCH_SIZE ][ TEST_GCQ_SLOT_SIZE ] = { { 0 } };
+    uint32_t ulSent = 0;
+    uint32_t ulReceived = 0;
+    uint32_t ulBatches = 0;
+    uint32_t ulConsumed = 0;
+
+    while( ulReceived < TEST_GCQ_NUM_MESSAGES )
+    {
+        uint32_t i = 0;
+
+        ulSent = ulPeerFillSQ( ulSent, TEST_GCQ_NUM_MESSAGES );
+
+        assert_int_equal( GCQ_ERRORS_NONE, xGCQConsumeDataBatch( pxInstance, &pucSlots[ 0 ][ 0 ], TEST_GCQ_SLOT_SIZE,
+                                                                 TEST_GCQ_BATCH_SIZE, &ulConsumed ) );
+        assert_true( ( 0 < ulConsumed ) && ( TEST_GCQ_BATCH_SIZE >= ulConsumed ) );
+        ulBatches++;
+
+        for( i = 0; i < ulConsumed; i++ )
+        {
+            uint32_t ulValue = 0;
+            memcpy( &ulValue, pucSlots[ i ], sizeof( ulValue ) );
+            assert_int_equal( ulReceived++, ulValue );
+        }
+    }
+
+    assert_int_equal( GCQ_ERRORS_CONSUMER_NO_DATA_RECEIVED,
+                      xGCQConsumeDataBatch( pxInstance, &pucSlots[ 0 ][ 0 ], TEST_GCQ_SLOT_SIZE,
+                                            TEST_GCQ_BATCH_SIZE, &ulConsumed ) );
+    assert_int_equal( 0, ulConsumed );
+
+    vPrintCounters( "consume (batch of 8)" );
+    assert_int_equal( ulBatches, xCounters.ulConsumedWrites );
+    assert_int_equal( ulBatches, xCounters.ulInterruptsCleared );
+
+    assert_int_equal( GCQ_ERRORS_NONE, xGCQDeinit( pxInstance ) );
+}
+
+static void test_batch_invalid_args( void **state )
+{
+    struct GCQ_INSTANCE_TYPE *pxInstance = pxCreateInstance();
+    uint8_t pucSlot[ TEST_GCQ_SLOT_SIZE ] = { 0 };
+    uint32_t ulCount = 0;
+
+    assert_int_equal( GCQ_ERRORS_INVALID_INSTANCE, xGCQProduceDataBatch( NULL, pucSlot, sizeof( pucSlot ), 1, &ulCount ) );
+    assert_int_equal( GCQ_ERRORS_INVALID_ARG, xGCQProduceDataBatch( pxInstance, NULL, sizeof( pucSlot ), 1, &ulCount ) );
+    assert_int_equal( GCQ_ERRORS_INVALID_ARG, xGCQProduceDataBatch( pxInstance, pucSlot, sizeof( pucSlot ), 1, NULL ) );
+    assert_int_equal( GCQ_ERRORS_INVALID_ARG, xGCQProduceDataBatch( pxInstance, pucSlot, sizeof( pucSlot ), 0, &ulCount ) );
+    assert_int_equal( GCQ_ERRORS_INVALID_ARG, xGCQProduceDataBatch( pxInstance, pucSlot, 3, 1, &ulCount ) );
+    assert_int_equal( GCQ_ERRORS_INVALID_ARG, xGCQProduceDataBatch( pxInstance, pucSlot, TEST_GCQ_SLOT_SIZE + 4, 1, &ulCount ) );
+
+    assert_int_equal( GCQ_ERRORS_INVALID_INSTANCE, xGCQConsumeDataBatch( NULL, pucSlot, sizeof( pucSlot ), 1, &ulCount ) );
+    assert_int_equal( GCQ_ERRORS_INVALID_ARG, xGCQConsumeDataBatch( pxInstance, NULL, sizeof( pucSlot ), 1, &ulCount ) );
+    assert_int_equal( GCQ_ERRORS_INVALID_ARG, xGCQConsumeDataBatch( pxInstance, pucSlot, sizeof( pucSlot ), 1, NULL ) );
+    assert_int_equal( GCQ_ERRORS_INVALID_ARG, xGCQConsumeDataBatch( pxInstance, pucSlot, sizeof( pucSlot ), 0, &ulCount ) );
+
+    assert_int_equal( 0, xCounters.ulProducedWrites );
+    assert_int_equal( 0, xCounters.ulConsumedWrites );
+
+    assert_int_equal( GCQ_ERRORS_NONE, xGCQDeinit( pxInstance ) );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test( test_produce_single ),
+        cmocka_unit_test( test_produce_batch ),
+        cmocka_unit_test( test_produce_batch_partial ),
+        cmocka_unit_test( test_consume_single ),
+        cmocka_unit_test( test_consume_batch ),
+        cmocka_unit_test( test_batch_invalid_args ),
+    };
+
+    return cmocka_run_group_tests( tests, NULL, NULL );
+}
@@ -55,6 +55,8 @@
     DO( I2C_STATS_TAKE_MUTEX )                              \
     DO( I2C_STATS_RELEASE_MUTEX )                           \
     DO( I2C_STATS_REINIT_SUCCESSFUL )                       \
+    DO( I2C_STATS_PROBE_ACK )                               \
+    DO( I2C_STATS_PROBE_NACK )                              \
     DO( I2C_STATS_MAX )
 
 #define I2C_ERRORS( DO )                                    \
@@ -584,6 +586,87 @@ int iI2C_Send( uint8_t ucDeviceId,
     return iStatus;
 }
 
+/**
+ * @brief   This function checks whether a slave acknowledges a write.
+ */
+int iI2C_Probe( uint8_t ucDeviceId,
+                uint8_t ucAddr,
+                uint8_t *pucDataBuff,
+                uint32_t ulLength )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pucDataBuff ) &&
+        ( ucDeviceId < I2C_NUM_INSTANCES ) )
+    {
+        I2C_PROFILE *pxIicProfile  = &( pxThis->xIicProfile[ ucDeviceId ] );
+        XIicPs      *pxIicInstance = &( pxThis->xIicProfile[ ucDeviceId ].xIicInstance );
+
+        if( TRUE == pxIicProfile->iI2cEnabled )
+        {
+            if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxIicProfile->pvOsalMutexHdl,
+                                                      I2C_WAIT_TIMEOUT_MS ) )
+            {
+                INC_STAT_COUNTER( I2C_STATS_TAKE_MUTEX )
+
+                if( OK == iWaitForBusIdle( ucDeviceId ) )
+                {
+                    /* A busy slave NACKs its address - that is an answer, not a bus fault */
+                    if( XST_SUCCESS == XIicPs_MasterSendPolled( pxIicInstance,
+                                                                pucDataBuff,
+                                                                ulLength,
+                                                                ucAddr ) )
+                    {
+                        iStatus = OK;
+                        INC_STAT_COUNTER( I2C_STATS_PROBE_ACK )
+                    }
+                    else
+                    {
+                        INC_STAT_COUNTER( I2C_STATS_PROBE_NACK )
+                    }
+                }
+                else
+                {
+                    /* Attempt to recover the i2c if bus is busy */
+                    if( OK == iI2C_ReInit( ucDeviceId ) )
+                    {
+                        INC_STAT_COUNTER( I2C_STATS_REINIT_SUCCESSFUL )
+                    }
+                    else
+                    {
+                        INC_ERROR_COUNTER( I2C_ERRORS_REINIT_FAILED )
+                    }
+
+                    INC_ERROR_COUNTER( I2C_ERRORS_WAIT_FOR_BUS_IDLE_FAILED )
+                }
+
+                if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxIicProfile->pvOsalMutexHdl ) )
+                {
+                    INC_ERROR_COUNTER( I2C_ERRORS_MUTEX_RELEASE_FAILED )
+                    iStatus = ERROR;
+                }
+                else
+                {
+                    INC_STAT_COUNTER( I2C_STATS_RELEASE_MUTEX )
+                }
+            }
+            else
+            {
+                INC_ERROR_COUNTER( I2C_ERRORS_MUTEX_TAKE_FAILED )
+            }
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( I2C_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   This function reads data from the I2C device into a specified buffer.
  */
@@ -87,6 +87,27 @@ int iI2C_Send( uint8_t ucDeviceId,
                uint8_t *pucDataBuff,
                uint32_t ulLength );
 
+/**
+ * @brief   This function checks whether a slave acknowledges a write, without
+ *          treating a NACK as a bus fault.
+ *
+ * @param   ucDeviceId          the device id
+ * @param   ucAddr              is the address of the slave we are probing
+ * @param   pucDataBuff         is the pointer to the send buffer
+ * @param   ulLength            is the number of bytes to be sent
+ *
+ * @return  OK                  If the slave acknowledged the write.
+ *          ERROR               If the slave did not acknowledge, or the bus failed.
+ *
+ * @note    Used to poll devices that NACK while busy (e.g. an EEPROM write
+ *          cycle). The write is attempted once; a NACK is not logged, not
+ *          retried and does not re-initialise the controller.
+ */
+int iI2C_Probe( uint8_t ucDeviceId,
+                uint8_t ucAddr,
+                uint8_t *pucDataBuff,
+                uint32_t ulLength );
+
 /**
  * @brief   This function write data from the I2C device into a specified buffer.
  *
@@ -37,6 +37,7 @@
     DO( I2C_STATS_REINIT_COMPLETED )                        \
     DO( I2C_STATS_SEND_COMPLETED )                          \
     DO( I2C_STATS_RECEIVE_COMPLETED )                       \
+    DO( I2C_STATS_PROBE_ACK )                               \
     DO( I2C_STATS_MAX )
 
 #define I2C_ERRORS( DO )                                    \
@@ -204,6 +205,33 @@ int iI2C_Send( uint8_t ucDeviceId,
     return iStatus;
 }
 
+/**
+ * @brief   This function checks whether a slave acknowledges a write.
+ */
+int iI2C_Probe( uint8_t ucDeviceId,
+                uint8_t ucAddr,
+                uint8_t *pucDataBuff,
+                uint32_t ulLength )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pucDataBuff ) &&
+        ( ucDeviceId < I2C_NUM_INSTANCES ) )
+    {
+        INC_STAT_COUNTER( I2C_STATS_PROBE_ACK )
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( I2C_ERRORS_VALIDAION_FAILED )
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   This function reads data from the I2C device into a specified buffer.
  */
@@ -73,6 +73,14 @@ static void vGetCurrent( void );
  */
 static void vGetPower( void );
 
+/**
+ * @brief   Debug function to retrieve the voltage, current and power of all
+ *          channels in one sweep
+ *
+ * @return  N/A
+ */
+static void vGetAllChannels( void );
+
 
 /******************************************************************************/
 /* Public function implementations                                            */
@@ -105,6 +113,7 @@ void vINA3221_DebugInit( DAL_HDL pxParentHandle )
                 pxDAL_NewDebugFunction( "get_voltage", pxGetDir, vGetVoltage );
                 pxDAL_NewDebugFunction( "get_current", pxGetDir, vGetCurrent );
                 pxDAL_NewDebugFunction( "get_power",   pxGetDir, vGetPower );
+                pxDAL_NewDebugFunction( "get_all_channels", pxGetDir, vGetAllChannels );
             }
         }
 
@@ -238,3 +247,39 @@ static void vGetPower( void )
         PLL_DAL( INA3221_DBG_NAME, "Power (mW): %f\r\n", fPowerMw );
     }
 }
+
+/**
+ * @brief   Debug function to retrieve the voltage, current and power of all
+ *          channels in one sweep
+ */
+static void vGetAllChannels( void )
+{
+    INA3221_CHANNEL_READING pxReadings[ INA3221_NUM_CHANNELS ] = { { 0 } };
+    int                     iBusNum                            = 0;
+    uint32_t                ulI2cAddr                          = 0;
+    int                     i                                  = 0;
+
+    if( OK != iDAL_GetIntInRange( "Bus number:", &iBusNum, 0, UTIL_MAX_UINT8 ) )
+    {
+        PLL_DAL( INA3221_DBG_NAME, "Error retrieving bus number\r\n" );
+    }
+    else if( OK != iDAL_GetHexInRange( "I2C address:", &ulI2cAddr, 0, UTIL_MAX_UINT8 ) )
+    {
+        PLL_DAL( INA3221_DBG_NAME, "Error retrieving i2c address\r\n" );
+    }
+    else if( OK != iINA3221_ReadChannel( ( uint8_t )iBusNum,
+                                         ( uint8_t )ulI2cAddr,
+                                         INA3221_ALL_CHANNELS,
+                                         pxReadings ) )
+    {
+        PLL_DAL( INA3221_DBG_NAME, "Error retrieving INA3221 channels\r\n" );
+    }
+    else
+    {
+        for( i = 0; i < INA3221_NUM_CHANNELS; i++ )
+        {
+            PLL_DAL( INA3221_DBG_NAME, "Channel %d: %f mV, %f mA, %f mW\r\n",
+                     i, pxReadings[ i ].fVoltageInmV, pxReadings[ i ].fCurrentInmA, pxReadings[ i ].fPowerInmW );
+        }
+    }
+}
@@ -49,6 +49,7 @@
 #define INA3221_VOLTAGE_READ_LENGTH         ( 2 )
 #define INA3221_CURRENT_WRITE_LENGTH        ( 1 )
 #define INA3221_CURRENT_READ_LENGTH         ( 2 )
+#define INA3221_CHANNEL_REG_STRIDE         ( INA3221_CH2_SHUNT_VOLTAGE - INA3221_CH1_SHUNT_VOLTAGE )
 #define INA3221_POWER_SCALING_FACTOR        ( 1000 )
 #define INA3221_SHUNT_RESISTANCE_VALUE      ( 0.002 )
 /* Multiply by this instead of dividing by INA3221_SHUNT_RESISTANCE_VALUE: 1/0.002 is 500 */
@@ -58,12 +59,14 @@
     DO( INA3221_STATS_VOLTAGE_READ )    \
     DO( INA3221_STATS_CURRENT_READ )    \
     DO( INA3221_STATS_POWER_READ )      \
+    DO( INA3221_STATS_CHANNEL_READ )    \
     DO( INA3221_STATS_MAX )
 
 #define INA3221_ERRORS( DO )            \
     DO( INA3221_ERRORS_VOLTAGE_READ )   \
     DO( INA3221_ERRORS_CURRENT_READ )   \
     DO( INA3221_ERRORS_POWER_READ )     \
+    DO( INA3221_ERRORS_CHANNEL_READ )   \
     DO( INA3221_ERRORS_VALIDATION )     \
     DO( INA3221_ERRORS_MAX )
 
@@ -130,6 +133,29 @@ static INA3221_PRIVATE_DATA xPrivateData =
 static INA3221_PRIVATE_DATA *pxThis = &xPrivateData;
 
 
+/******************************************************************************/
+/* Local Function declarations                                                */
+/******************************************************************************/
+
+/**
+ * @brief   Convert a bus voltage register value to milli Volts
+ *
+ * @param   pucReg      Register value, MSB first
+ *
+ * @return  Bus voltage in milli Volts
+ */
+static float fBusVoltageInmV( uint8_t *pucReg );
+
+/**
+ * @brief   Convert a shunt voltage register value to current in milli Amps
+ *
+ * @param   pucReg      Register value, MSB first
+ *
+ * @return  Current through the shunt in milli Amps
+ */
+static float fShuntCurrentInmA( uint8_t *pucReg );
+
+
 /******************************************************************************/
 /* Public Function implementations                                            */
 /******************************************************************************/
@@ -142,7 +168,6 @@ int iINA3221_ReadVoltage( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChann
     int      iStatus                             = ERROR;
     uint8_t  pucWriteBuf[ INA3221_BUFFER_SIZE ]  = { 0 };
     uint8_t  pucReadBuf[ INA3221_BUFFER_SIZE ]   = { 0 };
-    uint16_t usReadData                          = 0;
 
     if( NULL != pfVoltageInMV )
     {
@@ -173,9 +198,7 @@ int iINA3221_ReadVoltage( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChann
         {
             INC_STAT_COUNTER( INA3221_STATS_VOLTAGE_READ );
 
-            pucReadBuf[ 1 ] = pucReadBuf[ 1 ] & ~INA3221_VOLTAGE_BIT_SHIFT_MASK;
-            usReadData= ( ( uint16_t ) pucReadBuf[ 1 ] ) | ( ( uint16_t ) pucReadBuf[ 0 ] << INA3221_MSB_TO_HEX_BIT_SHIFT );
-            *pfVoltageInMV = ( ( float ) usReadData );
+            *pfVoltageInMV = fBusVoltageInmV( pucReadBuf );
         }
         else
         {
@@ -198,7 +221,6 @@ int iINA3221_ReadCurrent( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChann
     int      iStatus                             = ERROR;
     uint8_t  pucWriteBuf[ INA3221_BUFFER_SIZE ]  = { 0 };
     uint8_t  pucReadBuf[ INA3221_BUFFER_SIZE ]   = { 0 };
-    uint16_t usReadData                          = 0;
 
     if( NULL != pfCurrentInmA )
     {
@@ -229,14 +251,7 @@ int iINA3221_ReadCurrent( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChann
         {
             INC_STAT_COUNTER( INA3221_STATS_CURRENT_READ );
 
-            pucReadBuf[ 1 ] = pucReadBuf[ 1 ] & ~INA3221_VOLTAGE_BIT_SHIFT_MASK;
-            usReadData = ( ( uint16_t ) pucReadBuf[ 1 ] ) | ( ( uint16_t ) pucReadBuf[ 0 ] << INA3221_MSB_TO_HEX_BIT_SHIFT );
-
-            float fShuntVolt = ( float ) ( usReadData >> INA3221_VOLTAGE_BIT_SHIFT );
-            fShuntVolt *= ( float ) INA3221_VOLTAGE_SCALING_FACTOR;
-            fShuntVolt *= INA3221_VOLTAGE_SCALING_MULTIPLIER;
-
-            *pfCurrentInmA = fShuntVolt * INA3221_1_OVER_SHUNT_RESISTANCE ;
+            *pfCurrentInmA = fShuntCurrentInmA( pucReadBuf );
         }
         else
         {
@@ -256,18 +271,17 @@ int iINA3221_ReadCurrent( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChann
  */
 int iINA3221_ReadPower( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChannelNum, float *pfPowerInmW )
 {
-    int   iStatus       = ERROR;
-    float fCurrentInmA  = 0.0;
-    float fVoltageInmV  = 0.0;
+    int                     iStatus  = ERROR;
+    INA3221_CHANNEL_READING xReading = { 0 };
 
-    if( NULL != pfPowerInmW )
+    if( ( NULL != pfPowerInmW ) &&
+        ( INA3221_NUM_CHANNELS > ucChannelNum ) )
     {
-        if( OK == ( iStatus = iINA3221_ReadCurrent( ucBusNum, ucSlaveAddr, ucChannelNum, &fCurrentInmA ) ) )
+        /* Voltage and current are two separate register reads, so they may
+           come from different conversion cycles */
+        if( OK == ( iStatus = iINA3221_ReadChannel( ucBusNum, ucSlaveAddr, ucChannelNum, &xReading ) ) )
         {
-            if( OK == ( iStatus = iINA3221_ReadVoltage( ucBusNum, ucSlaveAddr, ucChannelNum, &fVoltageInmV ) ) )
-            {
-                *pfPowerInmW = ( float ) ( ( ( double ) fVoltageInmV * ( double ) fCurrentInmA ) / INA3221_POWER_SCALING_FACTOR );
-            }
+            *pfPowerInmW = xReading.fPowerInmW;
         }
 
         if( OK == iStatus )
@@ -287,6 +301,76 @@ int iINA3221_ReadPower( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChannel
     return iStatus;
 }
 
+/**
+ * @brief   Read voltage, current and power of one or all channels in one pass
+ *          over the shunt and bus voltage registers
+ */
+int iINA3221_ReadChannel( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChannelNum, INA3221_CHANNEL_READING *pxReadings )
+{
+    int      iStatus                                     = ERROR;
+    uint8_t  ucWriteBuf                                  = 0;
+    uint8_t  pucShuntBuf[ INA3221_CURRENT_READ_LENGTH ]  = { 0 };
+    uint8_t  pucBusBuf[ INA3221_VOLTAGE_READ_LENGTH ]    = { 0 };
+    uint8_t  ucFirstChannel                              = 0;
+    uint8_t  ucNumChannels                               = 0;
+    uint8_t  i                                           = 0;
+
+    if( NULL != pxReadings )
+    {
+        if( INA3221_ALL_CHANNELS == ucChannelNum )
+        {
+            ucFirstChannel = INA3221_CH1_NUMBER;
+            ucNumChannels  = INA3221_NUM_CHANNELS;
+            iStatus        = OK;
+        }
+        else if( INA3221_NUM_CHANNELS > ucChannelNum )
+        {
+            ucFirstChannel = ucChannelNum;
+            ucNumChannels  = 1;
+            iStatus        = OK;
+        }
+
+        /* The register pointer does not auto-increment, so each register is addressed on its own */
+        for( i = 0; ( OK == iStatus ) && ( i < ucNumChannels ); i++ )
+        {
+            ucWriteBuf = INA3221_CH1_SHUNT_VOLTAGE + ( ( ucFirstChannel + i ) * INA3221_CHANNEL_REG_STRIDE );
+            iStatus    = iI2C_SendRecv( ucBusNum, ucSlaveAddr, &ucWriteBuf, INA3221_CURRENT_WRITE_LENGTH,
+                                        pucShuntBuf, INA3221_CURRENT_READ_LENGTH );
+
+            if( OK == iStatus )
+            {
+                ucWriteBuf = INA3221_CH1_BUS_VOLTAGE + ( ( ucFirstChannel + i ) * INA3221_CHANNEL_REG_STRIDE );
+                iStatus    = iI2C_SendRecv( ucBusNum, ucSlaveAddr, &ucWriteBuf, INA3221_VOLTAGE_WRITE_LENGTH,
+                                            pucBusBuf, INA3221_VOLTAGE_READ_LENGTH );
+            }
+
+            if( OK == iStatus )
+            {
+                pxReadings[ i ].fCurrentInmA = fShuntCurrentInmA( pucShuntBuf );
+                pxReadings[ i ].fVoltageInmV = fBusVoltageInmV( pucBusBuf );
+                pxReadings[ i ].fPowerInmW   = ( float ) ( ( ( double ) pxReadings[ i ].fVoltageInmV *
+                                                             ( double ) pxReadings[ i ].fCurrentInmA ) /
+                                                           INA3221_POWER_SCALING_FACTOR );
+            }
+        }
+
+        if( OK == iStatus )
+        {
+            INC_STAT_COUNTER( INA3221_STATS_CHANNEL_READ );
+        }
+        else
+        {
+            INC_ERROR_COUNTER( INA3221_ERRORS_CHANNEL_READ );
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( INA3221_ERRORS_VALIDATION )
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Display the current stats/errors
  */
@@ -342,3 +426,35 @@ int iINA3221_ClearStatistics( void )
 
     return iStatus;
 }
+
+
+/******************************************************************************/
+/* Local Function implementations                                             */
+/******************************************************************************/
+
+/**
+ * @brief   Convert a bus voltage register value to milli Volts
+ */
+static float fBusVoltageInmV( uint8_t *pucReg )
+{
+    uint16_t usReadData = ( ( uint16_t ) ( pucReg[ 1 ] & ~INA3221_VOLTAGE_BIT_SHIFT_MASK ) ) |
+                          ( ( uint16_t ) pucReg[ 0 ] << INA3221_MSB_TO_HEX_BIT_SHIFT );
+
+    /* The LSB is 8mV, which is the value with the reserved bits masked */
+    return ( float ) usReadData;
+}
+
+/**
+ * @brief   Convert a shunt voltage register value to current in milli Amps
+ */
+static float fShuntCurrentInmA( uint8_t *pucReg )
+{
+    uint16_t usReadData = ( ( uint16_t ) ( pucReg[ 1 ] & ~INA3221_VOLTAGE_BIT_SHIFT_MASK ) ) |
+                          ( ( uint16_t ) pucReg[ 0 ] << INA3221_MSB_TO_HEX_BIT_SHIFT );
+    float    fShuntVolt = ( float ) ( usReadData >> INA3221_VOLTAGE_BIT_SHIFT );
+
+    fShuntVolt *= ( float ) INA3221_VOLTAGE_SCALING_FACTOR;
+    fShuntVolt *= INA3221_VOLTAGE_SCALING_MULTIPLIER;
+
+    return fShuntVolt * INA3221_1_OVER_SHUNT_RESISTANCE;
+}
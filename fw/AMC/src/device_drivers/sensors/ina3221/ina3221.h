@@ -19,6 +19,34 @@
 #include "standard.h"
 
 
+/******************************************************************************/
+/* Defines                                                                    */
+/******************************************************************************/
+
+#define INA3221_NUM_CHANNELS    ( 3 )
+#define INA3221_ALL_CHANNELS    ( 0xFF )
+
+
+/******************************************************************************/
+/* Structs                                                                    */
+/******************************************************************************/
+
+/**
+ * @struct  INA3221_CHANNEL_READING
+ * @brief   Voltage, current and power of a channel
+ *
+ * @note    Power is calculated from the voltage and current, which are read
+ *          separately and may come from different conversion cycles.
+ */
+typedef struct INA3221_CHANNEL_READING
+{
+    float   fVoltageInmV;
+    float   fCurrentInmA;
+    float   fPowerInmW;
+
+} INA3221_CHANNEL_READING;
+
+
 /******************************************************************************/
 /* Function declarations                                                      */
 /******************************************************************************/
@@ -65,6 +93,28 @@ int iINA3221_ReadCurrent( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChann
  */
 int iINA3221_ReadPower( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChannelNum, float *pfPowerInmW );
 
+/**
+ * @brief   Read voltage, current and power of one or all channels in one pass
+ *          over the shunt and bus voltage registers
+ *
+ * @param   ucBusNum       I2C bus number
+ * @param   ucSlaveAddr    I2C slave address
+ * @param   ucChannelNum   Channel number, or INA3221_ALL_CHANNELS
+ * @param   pxReadings     Pointer to the reading, or to INA3221_NUM_CHANNELS
+ *                         readings if INA3221_ALL_CHANNELS is requested
+ *
+ * @return  OK             Channel(s) read successfully
+ *          ERROR          Channel(s) not read successfully
+ *
+ * @note    The register pointer does not auto-increment, so the shunt and
+ *          bus voltage registers of each channel are read one at a time.
+ *          The device may finish a conversion between any two reads, so the
+ *          shunt and bus values of a channel are not guaranteed to come from
+ *          the same conversion cycle.
+ *          The ASC sweep holds its mutex across the whole call.
+ */
+int iINA3221_ReadChannel( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChannelNum, INA3221_CHANNEL_READING *pxReadings );
+
 /**
  * @brief   Print all the stats gathered by the driver
  *
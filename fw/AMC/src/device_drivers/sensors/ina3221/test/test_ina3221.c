@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains tests for the INA3221 driver. The I2C bus is replaced
+ * by a fake register file, so the number and shape of bus transactions can
+ * be checked along with the decoded readings. Like the device, the fake does
+ * not auto-increment its register pointer.
+ *
+ * @file test_ina3221.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "ina3221.h"
+#include "pll.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_INA3221_BUS            ( 1 )
+#define TEST_INA3221_ADDR           ( 0x40 )
+#define TEST_INA3221_NUM_REGS       ( 8 )
+#define TEST_INA3221_REG_SIZE       ( 2 )
+#define TEST_INA3221_MAX_READS      ( 16 )
+
+#define TEST_INA3221_SHUNT_REG( c ) ( 0x01 + ( 2 * ( c ) ) )
+#define TEST_INA3221_BUS_REG( c )   ( 0x02 + ( 2 * ( c ) ) )
+
+#define assert_near( a, b, tol )    assert_true( ( ( ( a ) - ( b ) ) <= ( tol ) ) && ( ( ( b ) - ( a ) ) <= ( tol ) ) )
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+/* Register values for 12V, 3.3V and 1.8V rails at differing loads */
+static const uint16_t pusDefaultRegs[ TEST_INA3221_NUM_REGS ] =
+{
+    0x7127,                 /* configuration */
+    0x0A28, 0x5DC0,         /* CH1 shunt, bus */
+    0x03E8, 0x19C8,         /* CH2 shunt, bus */
+    0x00C8, 0x0E10,         /* CH3 shunt, bus */
+    0x0000
+};
+
+static uint16_t pusRegs[ TEST_INA3221_NUM_REGS ]      = { 0 };
+static uint8_t  pucRegsRead[ TEST_INA3221_MAX_READS ] = { 0 };
+static uint32_t ulTransactions                        = 0;
+static uint8_t  ucLastStartReg                        = 0;
+static int      iI2CResult                            = OK;
+
+
+/*****************************************************************************/
+/* Stubs                                                                     */
+/*****************************************************************************/
+
+/* A register pointer write followed by a read of that one register, MSB first */
+int iI2C_SendRecv( uint8_t ucDeviceId,
+                   uint8_t ucWriteAddr,
+                   uint8_t *pucWriteDataBuff,
+                   uint32_t ulWriteLength,
+                   uint8_t *pucReadDataBuff,
+                   uint32_t ulReadLength )
+{
+    uint16_t usReg = 0;
+
+    assert_int_equal( TEST_INA3221_BUS, ucDeviceId );
+    assert_int_equal( TEST_INA3221_ADDR, ucWriteAddr );
+    assert_int_equal( 1, ulWriteLength );
+    assert_int_equal( TEST_INA3221_REG_SIZE, ulReadLength );
+    assert_true( TEST_INA3221_NUM_REGS > pucWriteDataBuff[ 0 ] );
+    assert_true( TEST_INA3221_MAX_READS > ulTransactions );
+
+    ucLastStartReg                  = pucWriteDataBuff[ 0 ];
+    pucRegsRead[ ulTransactions++ ] = ucLastStartReg;
+
+    usReg                = pusRegs[ ucLastStartReg ];
+    pucReadDataBuff[ 0 ] = ( uint8_t )( usReg >> 8 );
+    pucReadDataBuff[ 1 ] = ( uint8_t )usReg;
+
+    return iI2CResult;
+}
+
+void *pvOSAL_MemSet( void *pvDestination, int iValue, uint16_t usSize )
+{
+    return memset( pvDestination, iValue, usSize );
+}
+
+void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+{
+}
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static int iTestSetup( void **state )
+{
+    memcpy( pusRegs, pusDefaultRegs, sizeof( pusRegs ) );
+    memset( pucRegsRead, 0, sizeof( pucRegsRead ) );
+    ulTransactions = 0;
+    ucLastStartReg = 0;
+    iI2CResult     = OK;
+
+    return 0;
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_all_channels_register_sweep( void **state )
+{
+    INA3221_CHANNEL_READING pxReadings[ INA3221_NUM_CHANNELS ] = { { 0 } };
+    uint8_t                 ucChannel                          = 0;
+
+    assert_int_equal( OK, iINA3221_ReadChannel( TEST_INA3221_BUS, TEST_INA3221_ADDR,
+                                                INA3221_ALL_CHANNELS, pxReadings ) );
+
+    /* Each shunt and bus register is addressed on its own, channel by channel */
+    assert_int_equal( INA3221_NUM_CHANNELS * 2, ulTransactions );
+    for( ucChannel = 0; ucChannel < INA3221_NUM_CHANNELS; ucChannel++ )
+    {
+        assert_int_equal( TEST_INA3221_SHUNT_REG( ucChannel ), pucRegsRead[ ( ucChannel * 2 ) ] );
+        assert_int_equal( TEST_INA3221_BUS_REG( ucChannel ), pucRegsRead[ ( ucChannel * 2 ) + 1 ] );
+    }
+}
+
+static void test_sweep_matches_register_reads( void **state )
+{
+    INA3221_CHANNEL_READING pxReadings[ INA3221_NUM_CHANNELS ] = { { 0 } };
+    uint8_t                 ucChannel                          = 0;
+
+    assert_int_equal( OK, iINA3221_ReadChannel( TEST_INA3221_BUS, TEST_INA3221_ADDR,
+                                                INA3221_ALL_CHANNELS, pxReadings ) );
+
+    for( ucChannel = 0; ucChannel < INA3221_NUM_CHANNELS; ucChannel++ )
+    {
+        float fVoltage = 0;
+        float fCurrent = 0;
+
+        assert_int_equal( OK, iINA3221_ReadVoltage( TEST_INA3221_BUS, TEST_INA3221_ADDR, ucChannel, &fVoltage ) );
+        assert_int_equal( TEST_INA3221_BUS_REG( ucChannel ), ucLastStartReg );
+        assert_int_equal( OK, iINA3221_ReadCurrent( TEST_INA3221_BUS, TEST_INA3221_ADDR, ucChannel, &fCurrent ) );
+        assert_int_equal( TEST_INA3221_SHUNT_REG( ucChannel ), ucLastStartReg );
+
+        assert_true( 0 < fVoltage );
+        assert_true( 0 < fCurrent );
+        assert_near( fVoltage, pxReadings[ ucChannel ].fVoltageInmV, 0.001 );
+        assert_near( fCurrent, pxReadings[ ucChannel ].fCurrentInmA, 0.001 );
+        assert_near( ( fVoltage * fCurrent ) / 1000, pxReadings[ ucChannel ].fPowerInmW, 0.01 );
+    }
+}
+
+static void test_single_channel( void **state )
+{
+    INA3221_CHANNEL_READING xAll[ INA3221_NUM_CHANNELS ] = { { 0 } };
+    INA3221_CHANNEL_READING xOne                         = { 0 };
+
+    assert_int_equal( OK, iINA3221_ReadChannel( TEST_INA3221_BUS, TEST_INA3221_ADDR,
+                                                INA3221_ALL_CHANNELS, xAll ) );
+    ulTransactions = 0;
+
+    assert_int_equal( OK, iINA3221_ReadChannel( TEST_INA3221_BUS, TEST_INA3221_ADDR, 2, &xOne ) );
+
+    assert_int_equal( 2, ulTransactions );
+    assert_int_equal( TEST_INA3221_SHUNT_REG( 2 ), pucRegsRead[ 0 ] );
+    assert_int_equal( TEST_INA3221_BUS_REG( 2 ), pucRegsRead[ 1 ] );
+    assert_near( xAll[ 2 ].fVoltageInmV, xOne.fVoltageInmV, 0.001 );
+    assert_near( xAll[ 2 ].fCurrentInmA, xOne.fCurrentInmA, 0.001 );
+    assert_near( xAll[ 2 ].fPowerInmW, xOne.fPowerInmW, 0.001 );
+}
+
+static void test_power_reads_one_channel( void **state )
+{
+    INA3221_CHANNEL_READING xReading = { 0 };
+    float                   fPower   = 0;
+
+    assert_int_equal( OK, iINA3221_ReadChannel( TEST_INA3221_BUS, TEST_INA3221_ADDR, 0, &xReading ) );
+    ulTransactions = 0;
+
+    /* Power needs one shunt and one bus register read, nothing more */
+    assert_int_equal( OK, iINA3221_ReadPower( TEST_INA3221_BUS, TEST_INA3221_ADDR, 0, &fPower ) );
+    assert_int_equal( 2, ulTransactions );
+    assert_near( xReading.fPowerInmW, fPower, 0.001 );
+}
+
+static void test_bus_error( void **state )
+{
+    INA3221_CHANNEL_READING pxReadings[ INA3221_NUM_CHANNELS ] = { { 0 } };
+    float                   fPower                             = 0;
+
+    iI2CResult = ERROR;
+
+    assert_int_equal( ERROR, iINA3221_ReadChannel( TEST_INA3221_BUS, TEST_INA3221_ADDR,
+                                                   INA3221_ALL_CHANNELS, pxReadings ) );
+
+    /* The sweep stops at the first failed read */
+    assert_int_equal( 1, ulTransactions );
+    assert_int_equal( ERROR, iINA3221_ReadPower( TEST_INA3221_BUS, TEST_INA3221_ADDR, 1, &fPower ) );
+}
+
+static void test_invalid_args( void **state )
+{
+    INA3221_CHANNEL_READING xReading = { 0 };
+    float                   fPower   = 0;
+
+    assert_int_equal( ERROR, iINA3221_ReadChannel( TEST_INA3221_BUS, TEST_INA3221_ADDR, 0, NULL ) );
+    assert_int_equal( ERROR, iINA3221_ReadChannel( TEST_INA3221_BUS, TEST_INA3221_ADDR,
+                                                   INA3221_NUM_CHANNELS, &xReading ) );
+    assert_int_equal( ERROR, iINA3221_ReadPower( TEST_INA3221_BUS, TEST_INA3221_ADDR,
+                                                 INA3221_NUM_CHANNELS, &fPower ) );
+    assert_int_equal( ERROR, iINA3221_ReadPower( TEST_INA3221_BUS, TEST_INA3221_ADDR, 0, NULL ) );
+    assert_int_equal( 0, ulTransactions );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup( test_all_channels_register_sweep, iTestSetup ),
+        cmocka_unit_test_setup( test_sweep_matches_register_reads, iTestSetup ),
+        cmocka_unit_test_setup( test_single_channel, iTestSetup ),
+        cmocka_unit_test_setup( test_power_reads_one_channel, iTestSetup ),
+        cmocka_unit_test_setup( test_bus_error, iTestSetup ),
+        cmocka_unit_test_setup( test_invalid_args, iTestSetup ),
+    };
+
+    return cmocka_run_group_tests( tests, NULL, NULL );
+}
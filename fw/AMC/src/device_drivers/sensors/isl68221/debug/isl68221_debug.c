@@ -74,6 +74,20 @@ static void vGetCurrent( void );
  */
 static void vGetTemperature( void );
 
+/**
+ * @brief   Debug function to retrieve voltage, current and temperature of a rail
+ *
+ * @return  N/A
+ */
+static void vGetRail( void );
+
+/**
+ * @brief   Debug function to forget the cached page of every device
+ *
+ * @return  N/A
+ */
+static void vResetPageCache( void );
+
 
 /******************************************************************************/
 /* Public function implementations                                            */
@@ -97,8 +111,9 @@ void vISL68221_DebugInit( DAL_HDL pxParentHandle )
 
         if( NULL != pxIsl68221Top )
         {
-            pxDAL_NewDebugFunction( "print_stats",    pxIsl68221Top, vPrintStats );
-            pxDAL_NewDebugFunction( "clear_stats",    pxIsl68221Top, vClearStats );
+            pxDAL_NewDebugFunction( "print_stats",      pxIsl68221Top, vPrintStats );
+            pxDAL_NewDebugFunction( "clear_stats",      pxIsl68221Top, vClearStats );
+            pxDAL_NewDebugFunction( "reset_page_cache", pxIsl68221Top, vResetPageCache );
             pxGetDir = pxDAL_NewSubDirectory( "gets", pxIsl68221Top );
 
             if( NULL != pxGetDir )
@@ -106,6 +121,7 @@ void vISL68221_DebugInit( DAL_HDL pxParentHandle )
                 pxDAL_NewDebugFunction( "get_voltage",     pxGetDir, vGetVoltage );
                 pxDAL_NewDebugFunction( "get_current",     pxGetDir, vGetCurrent );
                 pxDAL_NewDebugFunction( "get_temperature", pxGetDir, vGetTemperature );
+                pxDAL_NewDebugFunction( "get_rail",        pxGetDir, vGetRail );
             }
         }
 
@@ -240,3 +256,50 @@ static void vGetTemperature( void )
     }
 }
 
+/**
+ * @brief   Debug function to retrieve voltage, current and temperature of a rail
+ */
+static void vGetRail( void )
+{
+    ISL68221_RAIL_READING xReading  = { 0 };
+    int                   iBusNum   = 0;
+    uint32_t              ulI2cAddr = 0;
+    int                   iPageNum  = 0;
+
+    if( OK != iDAL_GetIntInRange( "Bus number:", &iBusNum, 0, UTIL_MAX_UINT8 ) )
+    {
+        PLL_DAL( ISL68221_DBG_NAME, "Error retrieving bus number\r\n" );
+    }
+    else if( OK != iDAL_GetHexInRange( "I2C address:", &ulI2cAddr, 0, UTIL_MAX_UINT8 ) )
+    {
+        PLL_DAL( ISL68221_DBG_NAME, "Error retrieving i2c address\r\n" );
+    }
+    else if( OK != iDAL_GetIntInRange( "Page number:", &iPageNum, 0, MAX_ISL68221_SENSOR_PAGE ) )
+    {
+        PLL_DAL( ISL68221_DBG_NAME, "Error retrieving page number\r\n" );
+    }
+    else if( OK != iISL68221_ReadRail( ( uint8_t )iBusNum,
+                                       ( uint8_t )ulI2cAddr,
+                                       ( uint8_t )iPageNum,
+                                       &xReading ) )
+    {
+        PLL_DAL( ISL68221_DBG_NAME, "Error retrieving ISL68221 rail %d\r\n", iPageNum );
+    }
+    else
+    {
+        PLL_DAL( ISL68221_DBG_NAME, "Voltage %d (mV): %f\r\n", iPageNum, xReading.fVoltageInMV );
+        PLL_DAL( ISL68221_DBG_NAME, "Current %d (A): %f\r\n", iPageNum, xReading.fCurrentInA );
+        PLL_DAL( ISL68221_DBG_NAME, "Temperature %d (C): %f\r\n", iPageNum, xReading.fTemperature );
+    }
+}
+
+/**
+ * @brief   Debug function to forget the cached page of every device
+ */
+static void vResetPageCache( void )
+{
+    if( OK != iISL68221_ResetPageCache() )
+    {
+        PLL_DAL( ISL68221_DBG_NAME, "Error resetting page cache\r\n" );
+    }
+}
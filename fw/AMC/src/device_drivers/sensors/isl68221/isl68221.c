@@ -50,12 +50,17 @@
 #define ISL68221_READ_TEMP_CONTROLLER           ( 0x8E )
 #define ISL68221_READ_TEMP_PIN                  ( 0x8F )
 
+#define ISL68221_MAX_CACHED_DEVICES             ( 4 )
+#define ISL68221_PAGE_UNKNOWN                   ( 0xFF )
+
 #define ISL68221_STATS( DO )                  \
     DO( ISL68221_STATS_REGISTER_WRITE )       \
     DO( ISL68221_STATS_REGISTER_READ  )       \
     DO( ISL68221_STATS_VOLTAGE_READ )         \
     DO( ISL68221_STATS_CURRENT_READ )         \
     DO( ISL68221_STATS_TEMPERATURE_READ )     \
+    DO( ISL68221_STATS_RAIL_READ )            \
+    DO( ISL68221_STATS_PAGE_SELECT_SKIPPED )  \
     DO( ISL68221_STATS_MAX )
 
 #define ISL68221_ERRORS( DO )                 \
@@ -64,6 +69,8 @@
     DO( ISL68221_ERRORS_VOLTAGE_READ )        \
     DO( ISL68221_ERRORS_CURRENT_READ )        \
     DO( ISL68221_ERRORS_TEMPERATURE_READ )    \
+    DO( ISL68221_ERRORS_RAIL_READ )           \
+    DO( ISL68221_ERRORS_PAGE_CACHE_FULL )     \
     DO( ISL68221_ERRORS_VALIDATION )          \
     DO( ISL68221_ERRORS_MAX )
 
@@ -99,18 +106,33 @@ UTIL_MAKE_ENUM_AND_STRINGS( ISL68221_ERRORS, ISL68221_ERRORS, ISL68221_ERRORS_ST
 /* Structs                                                                    */
 /******************************************************************************/
 
+/**
+ * @struct  ISL68221_PAGE_CACHE
+ * @brief   Last page selected on a device
+ */
+typedef struct ISL68221_PAGE_CACHE
+{
+    uint8_t     ucBusNum;
+    uint8_t     ucSlaveAddr;
+    uint8_t     ucPage;
+
+} ISL68221_PAGE_CACHE;
+
 /**
  * @struct  ISL68221_PRIVATE_DATA
  * @brief   Private driver data
  */
 typedef struct ISL68221_PRIVATE_DATA
 {
-    uint32_t    ulUpperFirewall;
+    uint32_t            ulUpperFirewall;
 
-    uint32_t    ulStats[ ISL68221_STATS_MAX ];
-    uint32_t    ulErrors[ ISL68221_ERRORS_MAX ];
+    ISL68221_PAGE_CACHE pxPageCache[ ISL68221_MAX_CACHED_DEVICES ];
+    uint8_t             ucNumCachedDevices;
 
-    uint32_t    ulLowerFirewall;
+    uint32_t            ulStats[ ISL68221_STATS_MAX ];
+    uint32_t            ulErrors[ ISL68221_ERRORS_MAX ];
+
+    uint32_t            ulLowerFirewall;
 
 } ISL68221_PRIVATE_DATA;
 
@@ -147,6 +169,42 @@ static int iWriteRegister( uint8_t ucI2cNum, uint8_t ucSlaveAddr, uint8_t ucRegi
  */
 static int iReadRegister( uint8_t ucI2cNum, uint8_t ucSlaveAddr, uint8_t ucRegisterAddress, uint8_t *pucRegisterContent );
 
+/**
+ * @brief   Select a page on an ISL68221 sensor, skipping the write if the
+ *          device is known to be on that page already
+ *
+ * @param   ucI2cNum            I2C number
+ * @param   ucSlaveAddr         I2C slave address
+ * @param   ucPageNum           Page number
+ *
+ * @return  OK                  Page selected successfully
+ *          ERROR               Page not selected successfully
+ *
+ */
+static int iSelectPage( uint8_t ucI2cNum, uint8_t ucSlaveAddr, uint8_t ucPageNum );
+
+/**
+ * @brief   Find the page cache entry for a device, adding one if there is room
+ *
+ * @param   ucI2cNum            I2C number
+ * @param   ucSlaveAddr         I2C slave address
+ *
+ * @return  Pointer to the entry, or NULL if the cache is full
+ *
+ */
+static ISL68221_PAGE_CACHE *pxGetPageCache( uint8_t ucI2cNum, uint8_t ucSlaveAddr );
+
+/**
+ * @brief   Mark the page of a device as unknown after a failed transfer
+ *
+ * @param   ucI2cNum            I2C number
+ * @param   ucSlaveAddr         I2C slave address
+ *
+ * @return  N/A
+ *
+ */
+static void vForgetPage( uint8_t ucI2cNum, uint8_t ucSlaveAddr );
+
 
 /******************************************************************************/
 /* Local variables                                                            */
@@ -155,6 +213,8 @@ static int iReadRegister( uint8_t ucI2cNum, uint8_t ucSlaveAddr, uint8_t ucRegis
 static ISL68221_PRIVATE_DATA xPrivateData =
 {
     UPPER_FIREWALL,     /* ulUpperFirewall */
+    { { 0 } },          /* pxPageCache */
+    0,                  /* ucNumCachedDevices */
     { 0 },              /* ulStats */
     { 0 },              /* ulErrors */
     LOWER_FIREWALL      /* ulLowerFirewall */
@@ -173,34 +233,12 @@ static ISL68221_PRIVATE_DATA *pxThis = &xPrivateData;
 int iISL68221_ReadVoltage( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPageNum, float *pfVoltageInMV )
 {
     int      iStatus                              = ERROR;
-    uint8_t  pucWriteBuf[ ISL68221_BUFFER_SIZE ]  = { 0 };
     uint8_t  pucReadBuf[ ISL68221_BUFFER_SIZE ]   = { 0 };
     uint16_t usReadData                           = 0;
 
     if( ( NULL != pfVoltageInMV ) && ( MAX_ISL68221_SENSOR_PAGE >ucPageNum ) )
     {
-        switch( ucPageNum )
-        {
-            case ISL68221_SENSOR_PAGE_0:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_0;
-                iStatus = OK;
-                break;
-            case ISL68221_SENSOR_PAGE_1:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_1;
-                iStatus = OK;
-                break;
-            case ISL68221_SENSOR_PAGE_2:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_2;
-                iStatus = OK;
-                break;
-            default:
-                break;
-        }
-
-        if( OK == iStatus )
-        {
-            iStatus = iWriteRegister( ucBusNum, ucSlaveAddr, ISL68221_PAGE_REGISTER, ( uint8_t* ) pucWriteBuf );
-        }
+        iStatus = iSelectPage( ucBusNum, ucSlaveAddr, ucPageNum );
 
         if( OK == iStatus )
         {
@@ -233,34 +271,12 @@ int iISL68221_ReadVoltage( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPage
 int iISL68221_ReadCurrent( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPageNum, float *pfCurrentInA )
 {
     int      iStatus                              = ERROR;
-    uint8_t  pucWriteBuf[ ISL68221_BUFFER_SIZE ]  = { 0 };
     uint8_t  pucReadBuf[ ISL68221_BUFFER_SIZE ]   = { 0 };
     uint16_t usReadData                           = 0;
 
     if( ( NULL != pfCurrentInA ) && ( MAX_ISL68221_SENSOR_PAGE > ucPageNum ) )
     {
-        switch( ucPageNum )
-        {
-            case ISL68221_SENSOR_PAGE_0:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_0;
-                iStatus = OK;
-                break;
-            case ISL68221_SENSOR_PAGE_1:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_1;
-                iStatus = OK;
-                break;
-            case ISL68221_SENSOR_PAGE_2:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_2;
-                iStatus = OK;
-                break;
-            default:
-                break;
-        }
-
-        if( OK == iStatus )
-        {
-            iStatus = iWriteRegister( ucBusNum, ucSlaveAddr, ISL68221_PAGE_REGISTER, ( uint8_t* ) pucWriteBuf );
-        }
+        iStatus = iSelectPage( ucBusNum, ucSlaveAddr, ucPageNum );
 
         if( OK == iStatus )
         {
@@ -293,50 +309,82 @@ int iISL68221_ReadCurrent( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPage
 int iISL68221_ReadTemperature( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPageNum, float *pfTemperature )
 {
     int      iStatus                              = ERROR;
-    uint8_t  pucWriteBuf[ ISL68221_BUFFER_SIZE ]  = { 0 };
     uint8_t  pucReadBuf[ ISL68221_BUFFER_SIZE ]   = { 0 };
     uint16_t usReadData                           = 0;
 
     if( ( NULL != pfTemperature ) && ( MAX_ISL68221_SENSOR_PAGE > ucPageNum ) )
     {
-        switch( ucPageNum )
+        iStatus = iSelectPage( ucBusNum, ucSlaveAddr, ucPageNum );
+
+        if( OK == iStatus )
         {
-            case ISL68221_SENSOR_PAGE_0:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_0;
-                iStatus = OK;
-                break;
-            case ISL68221_SENSOR_PAGE_1:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_1;
-                iStatus = OK;
-                break;
-            case ISL68221_SENSOR_PAGE_2:
-                pucWriteBuf[ 0 ] = ISL68221_SELECT_PAGE_RAIL_2;
-                iStatus = OK;
-                break;
-            default:
-                break;
+            iStatus = iReadRegister(ucBusNum, ucSlaveAddr, ISL68221_READ_TEMP_HOTTEST_POWER_STAGE, ( uint8_t* ) pucReadBuf );
         }
 
         if( OK == iStatus )
         {
-            iStatus = iWriteRegister( ucBusNum, ucSlaveAddr, ISL68221_PAGE_REGISTER, ( uint8_t* ) pucWriteBuf );
+            INC_STAT_COUNTER( ISL68221_STATS_TEMPERATURE_READ )
+
+            usReadData = ( pucReadBuf[ 1 ] << ISL68221_BIT_SHIFT ) | pucReadBuf[ 0 ];
+            *pfTemperature = ( ( float ) usReadData );
+        }
+        else
+        {
+            INC_ERROR_COUNTER( ISL68221_ERRORS_TEMPERATURE_READ )
         }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( ISL68221_ERRORS_VALIDATION )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Read voltage, current and temperature of one rail
+ */
+int iISL68221_ReadRail( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPageNum, ISL68221_RAIL_READING *pxReading )
+{
+    int      iStatus                              = ERROR;
+    uint8_t  pucReadBuf[ ISL68221_BUFFER_SIZE ]   = { 0 };
+    uint16_t usReadData                           = 0;
+
+    if( ( NULL != pxReading ) && ( MAX_ISL68221_SENSOR_PAGE > ucPageNum ) )
+    {
+        iStatus = iSelectPage( ucBusNum, ucSlaveAddr, ucPageNum );
 
         if( OK == iStatus )
         {
-            iStatus = iReadRegister(ucBusNum, ucSlaveAddr, ISL68221_READ_TEMP_HOTTEST_POWER_STAGE, ( uint8_t* ) pucReadBuf );
+            iStatus = iReadRegister( ucBusNum, ucSlaveAddr, ISL68221_OUTPUT_VOLTAGE_REGISTER, ( uint8_t* ) pucReadBuf );
         }
 
         if( OK == iStatus )
         {
-            INC_STAT_COUNTER( ISL68221_STATS_TEMPERATURE_READ )
+            usReadData = ( pucReadBuf[ 1 ] << ISL68221_BIT_SHIFT ) | pucReadBuf[ 0 ];
+            pxReading->fVoltageInMV = ( ( float ) usReadData );
+
+            iStatus = iReadRegister( ucBusNum, ucSlaveAddr, ISL68221_OUTPUT_CURRENT_REGISTER, ( uint8_t* ) pucReadBuf );
+        }
 
+        if( OK == iStatus )
+        {
             usReadData = ( pucReadBuf[ 1 ] << ISL68221_BIT_SHIFT ) | pucReadBuf[ 0 ];
-            *pfTemperature = ( ( float ) usReadData );
+            pxReading->fCurrentInA = ( ( float ) usReadData ) / ISL68221_CURRENT_SCALING_FACTOR;
+
+            iStatus = iReadRegister( ucBusNum, ucSlaveAddr, ISL68221_READ_TEMP_HOTTEST_POWER_STAGE, ( uint8_t* ) pucReadBuf );
+        }
+
+        if( OK == iStatus )
+        {
+            INC_STAT_COUNTER( ISL68221_STATS_RAIL_READ )
+
+            usReadData = ( pucReadBuf[ 1 ] << ISL68221_BIT_SHIFT ) | pucReadBuf[ 0 ];
+            pxReading->fTemperature = ( ( float ) usReadData );
         }
         else
         {
-            INC_ERROR_COUNTER( ISL68221_ERRORS_TEMPERATURE_READ )
+            INC_ERROR_COUNTER( ISL68221_ERRORS_RAIL_READ )
         }
     }
     else
@@ -347,6 +395,28 @@ int iISL68221_ReadTemperature( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t uc
     return iStatus;
 }
 
+/**
+ * @brief   Forget the cached page of every device
+ */
+int iISL68221_ResetPageCache( void )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) )
+    {
+        pvOSAL_MemSet( pxThis->pxPageCache, 0, sizeof( pxThis->pxPageCache ) );
+        pxThis->ucNumCachedDevices = 0;
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( ISL68221_ERRORS_VALIDATION )
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Display the current stats/errors
  */
@@ -456,6 +526,7 @@ static int iReadRegister( uint8_t ucI2cNum, uint8_t ucSlaveAddr, uint8_t ucRegis
         else
         {
             INC_ERROR_COUNTER( ISL68221_ERRORS_REGISTER_READ )
+            vForgetPage( ucI2cNum, ucSlaveAddr );
         }
     }
     else
@@ -466,3 +537,109 @@ static int iReadRegister( uint8_t ucI2cNum, uint8_t ucSlaveAddr, uint8_t ucRegis
     return( iStatus );
 }
 
+/**
+ * @brief   Select a page on an ISL68221 sensor
+ */
+static int iSelectPage( uint8_t ucI2cNum, uint8_t ucSlaveAddr, uint8_t ucPageNum )
+{
+    int                 iStatus  = ERROR;
+    uint8_t             ucSelect = 0;
+    ISL68221_PAGE_CACHE *pxCache = NULL;
+
+    switch( ucPageNum )
+    {
+        case ISL68221_SENSOR_PAGE_0:
+            ucSelect = ISL68221_SELECT_PAGE_RAIL_0;
+            iStatus = OK;
+            break;
+        case ISL68221_SENSOR_PAGE_1:
+            ucSelect = ISL68221_SELECT_PAGE_RAIL_1;
+            iStatus = OK;
+            break;
+        case ISL68221_SENSOR_PAGE_2:
+            ucSelect = ISL68221_SELECT_PAGE_RAIL_2;
+            iStatus = OK;
+            break;
+        default:
+            break;
+    }
+
+    if( OK == iStatus )
+    {
+        pxCache = pxGetPageCache( ucI2cNum, ucSlaveAddr );
+
+        if( ( NULL != pxCache ) && ( ucSelect == pxCache->ucPage ) )
+        {
+            INC_STAT_COUNTER( ISL68221_STATS_PAGE_SELECT_SKIPPED )
+        }
+        else
+        {
+            iStatus = iWriteRegister( ucI2cNum, ucSlaveAddr, ISL68221_PAGE_REGISTER, &ucSelect );
+
+            if( NULL != pxCache )
+            {
+                pxCache->ucPage = ( OK == iStatus ) ? ucSelect : ISL68221_PAGE_UNKNOWN;
+            }
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( ISL68221_ERRORS_VALIDATION )
+    }
+
+    return( iStatus );
+}
+
+/**
+ * @brief   Find the page cache entry for a device, adding one if there is room
+ */
+static ISL68221_PAGE_CACHE *pxGetPageCache( uint8_t ucI2cNum, uint8_t ucSlaveAddr )
+{
+    ISL68221_PAGE_CACHE *pxCache = NULL;
+    int                 i        = 0;
+
+    for( i = 0; i < pxThis->ucNumCachedDevices; i++ )
+    {
+        if( ( ucI2cNum == pxThis->pxPageCache[ i ].ucBusNum ) &&
+            ( ucSlaveAddr == pxThis->pxPageCache[ i ].ucSlaveAddr ) )
+        {
+            pxCache = &pxThis->pxPageCache[ i ];
+            break;
+        }
+    }
+
+    if( NULL == pxCache )
+    {
+        if( ISL68221_MAX_CACHED_DEVICES > pxThis->ucNumCachedDevices )
+        {
+            pxCache              = &pxThis->pxPageCache[ pxThis->ucNumCachedDevices++ ];
+            pxCache->ucBusNum    = ucI2cNum;
+            pxCache->ucSlaveAddr = ucSlaveAddr;
+            pxCache->ucPage      = ISL68221_PAGE_UNKNOWN;
+        }
+        else
+        {
+            /* Uncached devices have their page written on every read */
+            INC_ERROR_COUNTER( ISL68221_ERRORS_PAGE_CACHE_FULL )
+        }
+    }
+
+    return pxCache;
+}
+
+/**
+ * @brief   Mark the page of a device as unknown after a failed transfer
+ */
+static void vForgetPage( uint8_t ucI2cNum, uint8_t ucSlaveAddr )
+{
+    int i = 0;
+
+    for( i = 0; i < pxThis->ucNumCachedDevices; i++ )
+    {
+        if( ( ucI2cNum == pxThis->pxPageCache[ i ].ucBusNum ) &&
+            ( ucSlaveAddr == pxThis->pxPageCache[ i ].ucSlaveAddr ) )
+        {
+            pxThis->pxPageCache[ i ].ucPage = ISL68221_PAGE_UNKNOWN;
+        }
+    }
+}
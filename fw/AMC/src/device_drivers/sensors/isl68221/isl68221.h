@@ -38,6 +38,23 @@ typedef enum ISL68821_SENSOR_PAGE_ENUM
 } ISL68221_SENSOR_PAGE_ENUM;
 
 
+/******************************************************************************/
+/* Structs                                                                    */
+/******************************************************************************/
+
+/**
+ * @struct  ISL68221_RAIL_READING
+ * @brief   Voltage, current and temperature of one rail (page)
+ */
+typedef struct ISL68221_RAIL_READING
+{
+    float fVoltageInMV;
+    float fCurrentInA;
+    float fTemperature;
+
+} ISL68221_RAIL_READING;
+
+
 /******************************************************************************/
 /* Function declarations                                                      */
 /******************************************************************************/
@@ -84,6 +101,35 @@ int iISL68221_ReadCurrent( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPage
  */
 int iISL68221_ReadTemperature( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPageNum, float *pfTemperature );
 
+/**
+ * @brief   Read voltage, current and temperature of one rail, selecting the
+ *          page at most once
+ *
+ * @param   ucBusNum       I2C bus number
+ * @param   ucSlaveAddr    I2C slave address
+ * @param   ucPageNum      Page number
+ * @param   pxReading      Pointer to the rail reading
+ *
+ * @return  OK             Rail read successfully
+ *          ERROR          Rail not read successfully
+ *
+ * @note    The selected page is cached per device, so the PAGE register is
+ *          only written when the page changes
+ */
+int iISL68221_ReadRail( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucPageNum, ISL68221_RAIL_READING *pxReading );
+
+/**
+ * @brief   Forget the cached page of every device, so the next read of each
+ *          device writes the PAGE register
+ *
+ * @return  OK     Cache reset successfully
+ *          ERROR  Cache not reset successfully
+ *
+ * @note    Call this if a device may have been reset or had its page
+ *          changed by another bus master
+ */
+int iISL68221_ResetPageCache( void );
+
 /**
  * @brief   Print all the stats gathered by the driver
  *
@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains tests for the ISL68221 driver. The I2C bus is replaced
+ * by a fake PMBus device with three pages, so PAGE writes can be counted.
+ *
+ * @file test_isl68221.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "isl68221.h"
+#include "pll.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_ISL68221_BUS           ( 1 )
+#define TEST_ISL68221_ADDR          ( 0x60 )
+#define TEST_ISL68221_ADDR_2        ( 0x61 )
+
+#define TEST_PMBUS_PAGE             ( 0x00 )
+#define TEST_PMBUS_READ_VOUT        ( 0x8B )
+#define TEST_PMBUS_READ_IOUT        ( 0x8C )
+#define TEST_PMBUS_READ_TEMP        ( 0x8D )
+
+/* Distinct per page and register, so a read from the wrong page shows up */
+#define TEST_VALUE( page, reg )     ( ( uint16_t )( ( ( page ) + 1 ) * 1000 + ( ( reg ) - TEST_PMBUS_READ_VOUT ) * 100 ) )
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static uint8_t  ucDevicePage    = 0;
+static uint32_t ulPageWrites    = 0;
+static uint32_t ulRegisterReads = 0;
+static int      iI2CResult      = OK;
+
+
+/*****************************************************************************/
+/* Stubs                                                                     */
+/*****************************************************************************/
+
+int iI2C_Send( uint8_t ucDeviceId, uint8_t ucAddr, uint8_t *pucDataBuff, uint32_t ulLength )
+{
+    assert_int_equal( TEST_ISL68221_BUS, ucDeviceId );
+    assert_int_equal( 2, ulLength );
+    assert_int_equal( TEST_PMBUS_PAGE, pucDataBuff[ 0 ] );
+
+    ulPageWrites++;
+
+    if( OK == iI2CResult )
+    {
+        ucDevicePage = pucDataBuff[ 1 ];
+    }
+
+    return iI2CResult;
+}
+
+int iI2C_SendRecv( uint8_t ucDeviceId,
+                   uint8_t ucWriteAddr,
+                   uint8_t *pucWriteDataBuff,
+                   uint32_t ulWriteLength,
+                   uint8_t *pucReadDataBuff,
+                   uint32_t ulReadLength )
+{
+    uint16_t usValue = TEST_VALUE( ucDevicePage, pucWriteDataBuff[ 0 ] );
+
+    assert_int_equal( TEST_ISL68221_BUS, ucDeviceId );
+    assert_int_equal( 1, ulWriteLength );
+    assert_int_equal( 2, ulReadLength );
+
+    ulRegisterReads++;
+
+    /* PMBus words are little endian */
+    pucReadDataBuff[ 0 ] = ( uint8_t )usValue;
+    pucReadDataBuff[ 1 ] = ( uint8_t )( usValue >> 8 );
+
+    return iI2CResult;
+}
+
+void *pvOSAL_MemSet( void *pvDestination, int iValue, uint16_t usSize )
+{
+    return memset( pvDestination, iValue, usSize );
+}
+
+void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+{
+}
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static int iTestSetup( void **state )
+{
+    ucDevicePage    = 0;
+    ulPageWrites    = 0;
+    ulRegisterReads = 0;
+    iI2CResult      = OK;
+
+    return ( OK == iISL68221_ResetPageCache() ) ? 0 : -1;
+}
+
+static void vCheckRail( uint8_t ucPage, ISL68221_RAIL_READING *pxReading )
+{
+    assert_int_equal( TEST_VALUE( ucPage, TEST_PMBUS_READ_VOUT ), ( uint32_t )pxReading->fVoltageInMV );
+    assert_int_equal( TEST_VALUE( ucPage, TEST_PMBUS_READ_IOUT ), ( uint32_t )( pxReading->fCurrentInA * 10 + 0.5 ) );
+    assert_int_equal( TEST_VALUE( ucPage, TEST_PMBUS_READ_TEMP ), ( uint32_t )pxReading->fTemperature );
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_three_rail_sweep( void **state )
+{
+    ISL68221_RAIL_READING xReading = { 0 };
+    uint8_t               ucPage   = 0;
+
+    for( ucPage = 0; ucPage < MAX_ISL68221_SENSOR_PAGE; ucPage++ )
+    {
+        assert_int_equal( OK, iISL68221_ReadRail( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, ucPage, &xReading ) );
+        vCheckRail( ucPage, &xReading );
+    }
+
+    /* One page select per rail, three register reads per rail */
+    assert_int_equal( 3, ulPageWrites );
+    assert_int_equal( 9, ulRegisterReads );
+}
+
+static void test_same_page_is_not_reselected( void **state )
+{
+    float fValue = 0;
+
+    assert_int_equal( OK, iISL68221_ReadVoltage( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 1, &fValue ) );
+    assert_int_equal( OK, iISL68221_ReadCurrent( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 1, &fValue ) );
+    assert_int_equal( OK, iISL68221_ReadTemperature( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 1, &fValue ) );
+    assert_int_equal( TEST_VALUE( 1, TEST_PMBUS_READ_TEMP ), ( uint32_t )fValue );
+    assert_int_equal( 1, ulPageWrites );
+
+    assert_int_equal( OK, iISL68221_ReadVoltage( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 0, &fValue ) );
+    assert_int_equal( TEST_VALUE( 0, TEST_PMBUS_READ_VOUT ), ( uint32_t )fValue );
+    assert_int_equal( 2, ulPageWrites );
+}
+
+static void test_page_cached_per_device( void **state )
+{
+    float fValue = 0;
+
+    assert_int_equal( OK, iISL68221_ReadVoltage( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 0, &fValue ) );
+    assert_int_equal( OK, iISL68221_ReadVoltage( TEST_ISL68221_BUS, TEST_ISL68221_ADDR_2, 0, &fValue ) );
+    assert_int_equal( 2, ulPageWrites );
+
+    assert_int_equal( OK, iISL68221_ReadVoltage( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 0, &fValue ) );
+    assert_int_equal( OK, iISL68221_ReadVoltage( TEST_ISL68221_BUS, TEST_ISL68221_ADDR_2, 0, &fValue ) );
+    assert_int_equal( 2, ulPageWrites );
+}
+
+static void test_failure_forgets_page( void **state )
+{
+    ISL68221_RAIL_READING xReading = { 0 };
+
+    assert_int_equal( OK, iISL68221_ReadRail( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 2, &xReading ) );
+    assert_int_equal( 1, ulPageWrites );
+
+    iI2CResult = ERROR;
+    assert_int_equal( ERROR, iISL68221_ReadRail( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 2, &xReading ) );
+
+    /* The page is selected again once the bus recovers */
+    iI2CResult = OK;
+    assert_int_equal( OK, iISL68221_ReadRail( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 2, &xReading ) );
+    assert_int_equal( 2, ulPageWrites );
+    vCheckRail( 2, &xReading );
+}
+
+static void test_reset_page_cache( void **state )
+{
+    ISL68221_RAIL_READING xReading = { 0 };
+
+    assert_int_equal( OK, iISL68221_ReadRail( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 1, &xReading ) );
+    assert_int_equal( OK, iISL68221_ResetPageCache() );
+
+    /* e.g. the regulator was power cycled and is back on page 0 */
+    ucDevicePage = 0;
+    assert_int_equal( OK, iISL68221_ReadRail( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 1, &xReading ) );
+    assert_int_equal( 2, ulPageWrites );
+    vCheckRail( 1, &xReading );
+}
+
+static void test_invalid_args( void **state )
+{
+    ISL68221_RAIL_READING xReading = { 0 };
+
+    assert_int_equal( ERROR, iISL68221_ReadRail( TEST_ISL68221_BUS, TEST_ISL68221_ADDR, 0, NULL ) );
+    assert_int_equal( ERROR, iISL68221_ReadRail( TEST_ISL68221_BUS, TEST_ISL68221_ADDR,
+                                                 MAX_ISL68221_SENSOR_PAGE, &xReading ) );
+    assert_int_equal( 0, ulPageWrites );
+    assert_int_equal( 0, ulRegisterReads );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup( test_three_rail_sweep, iTestSetup ),
+        cmocka_unit_test_setup( test_same_page_is_not_reselected, iTestSetup ),
+        cmocka_unit_test_setup( test_page_cached_per_device, iTestSetup ),
+        cmocka_unit_test_setup( test_failure_forgets_page, iTestSetup ),
+        cmocka_unit_test_setup( test_reset_page_cache, iTestSetup ),
+        cmocka_unit_test_setup( test_invalid_args, iTestSetup ),
+    };
+
+    return cmocka_run_group_tests( tests, NULL, NULL );
+}
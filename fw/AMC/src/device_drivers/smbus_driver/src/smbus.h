@@ -26,6 +26,9 @@ extern "C"
 #define SMBUS_DATA_SIZE_MAX                     ( 256 )         /* 255 bytes of data + 1 byte block size */
 #define SMBUS_UDID_LENGTH                       ( 16 )
 #define SMBUS_MAX_CIRCULAR_LOG_ENTRIES          ( 5000 )
+#define SMBUS_LOG_ALL_INSTANCES                 ( 0xFFFFFFFF )
+#define SMBUS_BINARY_LOG_MAGIC                  ( 0x4C424D53 )  /* "SMBL" little endian */
+#define SMBUS_BINARY_LOG_VERSION                ( 1 )
 #define SMBUS_NUMBER_OF_SMBUS_INSTANCES         ( 8 )
 #define SMBUS_NUMBER_OF_SMBUS_NON_ARP_INSTANCES ( 7 )
 #define SMBUS_INVALID_INSTANCE                  ( 99 )
@@ -265,6 +268,44 @@ typedef struct SMBUS_LOG_TYPE
 } SMBUS_LOG_TYPE;
 
 
+/*
+ * @struct SMBUS_BINARY_LOG_HEADER_TYPE
+ * @brief  Header at the start of each binary log chunk (little endian)
+ *
+ *         ulDropped is the number of entries from the requested sequence
+ *         number onwards that were overwritten before they could be read.
+ */
+typedef struct SMBUS_BINARY_LOG_HEADER_TYPE
+{
+    uint32_t   ulMagic;
+    uint16_t   usVersion;
+    uint16_t   usEntrySize;
+    uint32_t   ulFirstSequence;
+    uint16_t   usNumEntries;
+    uint16_t   usReserved;
+    uint32_t   ulDropped;
+
+} SMBUS_BINARY_LOG_HEADER_TYPE;
+
+/*
+ * @struct SMBUS_BINARY_LOG_ENTRY_TYPE
+ * @brief  A single binary log entry (little endian)
+ *
+ *         ucEvent is an SMBUS_LOG_EVENT_TYPE; ulEntry1/ulEntry2 are interpreted
+ *         as for the text log (state/event, protocol, register values or line).
+ */
+typedef struct SMBUS_BINARY_LOG_ENTRY_TYPE
+{
+    uint32_t   ulSequence;
+    uint32_t   ulTicks;
+    uint32_t   ulEntry1;
+    uint32_t   ulEntry2;
+    uint8_t    ucEvent;
+    uint8_t    ucInstance;
+    uint16_t   usReserved;
+
+} SMBUS_BINARY_LOG_ENTRY_TYPE;
+
 /*
  * @struct SMBUS_VERSION_TYPE
  * @brief  Structure to hold the SMBus driver version informatin
@@ -462,6 +503,51 @@ SMBus_Error_Type xSMBusGetLog( struct SMBUS_PROFILE_TYPE* pxSMBusProfile,
 SMBus_Error_Type xSMBusLogReset( struct SMBUS_PROFILE_TYPE* pxSMBusProfile );
 
 
+/*******************************************************************************
+*
+* @brief    Retrieves a chunk of the SMBus log in binary form
+*
+* @param    pxSMBusProfile is the context to read the log from
+* @param    pulSequence is the first sequence number wanted (0 for the oldest
+*           entry held) - updated to the value to pass on the next call so the
+*           log can be streamed incrementally
+* @param    pucBuffer receives an SMBUS_BINARY_LOG_HEADER_TYPE followed by
+*           SMBUS_BINARY_LOG_ENTRY_TYPE entries
+* @param    ulBufferSize is the size of pucBuffer, must hold at least the header
+* @param    pulLogSizeBytes is a pointer to the number of bytes written
+*
+* @return   - SMBUS_ERROR if error
+*           - SMBUS_SUCCESS if successful
+*
+* @note     Does not stop logging - safe to call while the bus is active.
+*
+*******************************************************************************/
+SMBus_Error_Type xSMBusGetBinaryLog( struct SMBUS_PROFILE_TYPE* pxSMBusProfile,
+                                     uint32_t* pulSequence,
+                                     uint8_t* pucBuffer,
+                                     uint32_t ulBufferSize,
+                                     uint32_t* pulLogSizeBytes );
+
+
+/*******************************************************************************
+*
+* @brief    Selects which instances are recorded in the SMBus log
+*
+* @param    pxSMBusProfile is the context to filter
+* @param    ulInstanceMask has bit N set to log instance N
+*           (SMBUS_LOG_ALL_INSTANCES by default). Entries not tied to an
+*           instance are always logged.
+*
+* @return   - SMBUS_ERROR if error
+*           - SMBUS_SUCCESS if successful
+*
+* @note     None.
+*
+*******************************************************************************/
+SMBus_Error_Type xSMBusLogSetInstanceFilter( struct SMBUS_PROFILE_TYPE* pxSMBusProfile,
+                                             uint32_t ulInstanceMask );
+
+
 /*******************************************************************************
 *
 * @brief    Disables and then clears all SMBUs interrupts
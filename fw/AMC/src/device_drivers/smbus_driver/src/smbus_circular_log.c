@@ -9,13 +9,17 @@
  *
  */
 
+#include <string.h>
+
 #include "smbus_internal.h"
 #include "smbus.h"
 #include "smbus_state.h"
 #include "smbus_event.h"
+#include "smbus_hardware_access.h"
 
 #define SMBUS_LOG_IS_OCCUPIED               ( 0xAAABACAD )
 #define SMBUS_LOG_IS_NOT_OCCUPIED           ( 0 )
+#define SMBUS_LOG_INSTANCE_MASK_BITS        ( 32 )
 
 /********************** Static function declarations ***************************/
 
@@ -51,6 +55,23 @@ static char* prvpcConvertEventTypeToText( SMBUS_LOG_EVENT_TYPE xEvent );
 static void prvvFormatLine( SMBUS_PROFILE_TYPE* pxSMBusProfile, int entry, char* pcLogBuffer,
                                 int* pslLineSize );
 
+/******************************************************************************
+*
+* @brief    Takes a consistent copy of a log entry that may be rewritten by the
+*           interrupt handler while it is being read
+*
+* @param    pxSMBusProfile is a pointer to the SMBus profile structure
+* @param    ulIndex is the index of the log entry in the buffer
+* @param    pxEntry is where the copy is stored
+*
+* @return   SMBUS_TRUE if the copy is valid, SMBUS_FALSE if the slot is empty or was overwritten
+*
+* @note     None.
+*
+*****************************************************************************/
+static int prviReadEntry( SMBUS_PROFILE_TYPE* pxSMBusProfile, uint32_t ulIndex,
+                            SMBUS_LOG_BUFFER_ELEMENT_TYPE* pxEntry );
+
 /*******************************************************************************/
 
 /******************************************************************************
@@ -125,7 +146,8 @@ static void prvvFormatLine( SMBUS_PROFILE_TYPE* pxSMBusProfile, int entry, char*
         case SMBUS_LOG_EVENT_TRYWRITE:          /* Fall through deliberate */
         case SMBUS_LOG_EVENT_TRYREAD:           /* Fall through deliberate */
         case SMBUS_LOG_EVENT_DEBUG:
-            *pslLineSize = sprintf( pcLogBuffer, "%04d %07d %s %2d 0x%08x line %d\r\n", entry,
+            *pslLineSize = sprintf( pcLogBuffer, "%04u %07d %s %2d 0x%08x line %d\r\n",
+            ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulSequence,
             ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulTicks,
             prvpcConvertEventTypeToText( pxSMBusProfile->xCircularBuffer[entry].xEvent ),
             ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulInstance,
@@ -135,7 +157,8 @@ static void prvvFormatLine( SMBUS_PROFILE_TYPE* pxSMBusProfile, int entry, char*
 
         case SMBUS_LOG_EVENT_PROTOCOL:
             pcProtocol = pcProtocolToString( pxSMBusProfile->xCircularBuffer[entry].ulEntry2 );
-            *pslLineSize = sprintf( pcLogBuffer, "%04d %07d %s %2d 0x%08x %s\r\n", entry,
+            *pslLineSize = sprintf( pcLogBuffer, "%04u %07d %s %2d 0x%08x %s\r\n",
+            ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulSequence,
             ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulTicks,
             prvpcConvertEventTypeToText( pxSMBusProfile->xCircularBuffer[entry].xEvent ),
             ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulInstance,
@@ -146,7 +169,8 @@ static void prvvFormatLine( SMBUS_PROFILE_TYPE* pxSMBusProfile, int entry, char*
         case SMBUS_LOG_EVENT_HW_WRITE:          /* Fall through deliberate */
         case SMBUS_LOG_EVENT_HW_READ:           /* Fall through deliberate */
         case SMBUS_LOG_EVENT_INTERRUPT_EVENT:
-            *pslLineSize = sprintf( pcLogBuffer, "%04d %07d %s %2d 0x%08x 0x%08x\r\n", entry,
+            *pslLineSize = sprintf( pcLogBuffer, "%04u %07d %s %2d 0x%08x 0x%08x\r\n",
+            ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulSequence,
             ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulTicks,
             prvpcConvertEventTypeToText( pxSMBusProfile->xCircularBuffer[entry].xEvent ),
             ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulInstance,
@@ -158,7 +182,8 @@ static void prvvFormatLine( SMBUS_PROFILE_TYPE* pxSMBusProfile, int entry, char*
         case SMBUS_LOG_EVENT_FSM_EVENT:
             pcState = ( char* )pcStateToString( pxSMBusProfile->xCircularBuffer[entry].ulEntry1 );
             pcEvent = ( char* )pcEventToString( pxSMBusProfile->xCircularBuffer[entry].ulEntry2 );
-            *pslLineSize = sprintf( pcLogBuffer, "%04d %07d %s %2d %s %s\r\n", entry,
+            *pslLineSize = sprintf( pcLogBuffer, "%04u %07d %s %2d %s %s\r\n",
+            ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulSequence,
             ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulTicks,
             prvpcConvertEventTypeToText( pxSMBusProfile->xCircularBuffer[entry].xEvent ),
             ( unsigned int )pxSMBusProfile->xCircularBuffer[entry].ulInstance, pcState, pcEvent );
@@ -225,6 +250,7 @@ void vLogInitialize( SMBUS_PROFILE_TYPE* pxSMBusProfile )
         for( i = 0; i < ( SMBUS_MAX_CIRCULAR_LOG_ENTRIES ); i++ )
         {
             pxSMBusProfile->xCircularBuffer[i].ulIsOccupied = SMBUS_LOG_IS_NOT_OCCUPIED;
+            pxSMBusProfile->xCircularBuffer[i].ulSequence = 0x00;
             pxSMBusProfile->xCircularBuffer[i].ulEntry1 = 0x00;
             pxSMBusProfile->xCircularBuffer[i].ulEntry2 = 0x00;
             pxSMBusProfile->xCircularBuffer[i].ulTicks = 0x00;
@@ -232,6 +258,8 @@ void vLogInitialize( SMBUS_PROFILE_TYPE* pxSMBusProfile )
         
         pxSMBusProfile->xLogCircularBuffer.ulWrite = 0;
         pxSMBusProfile->xLogCircularBuffer.ulRead = 0;
+        pxSMBusProfile->xLogCircularBuffer.ulSequence = 0;
+        pxSMBusProfile->xLogCircularBuffer.ulCount = 0;
     }
 }
 
@@ -243,34 +271,187 @@ void vLogInitialize( SMBUS_PROFILE_TYPE* pxSMBusProfile )
 void vLogAddEntry( SMBUS_PROFILE_TYPE* pxSMBusProfile, SMBUS_LOG_LEVEL_TYPE xLogLevel, uint32_t ulInstance,
                     SMBUS_LOG_EVENT_TYPE  Log_Event, uint32_t ulEntry1, uint32_t ulEntry2 )
 {
-    uint32_t ulTicks  = 0;
+    uint32_t ulTicks     = 0;
+    uint32_t ulWrite     = 0;
+    uint32_t ulGIEEnable = 0;
+    volatile SMBUS_LOG_BUFFER_ELEMENT_TYPE* pxEntry = NULL;
 
     if( NULL != pxSMBusProfile )  
     {
-        if( xLogLevel <= pxSMBusProfile->xLogLevel )
+        if( ( xLogLevel <= pxSMBusProfile->xLogLevel ) &&
+            ( ( SMBUS_LOG_INSTANCE_MASK_BITS <= ulInstance ) ||
+              ( 0 != ( pxSMBusProfile->ulLogInstanceMask & ( 1UL << ulInstance ) ) ) ) )
         {
             if( NULL != pxSMBusProfile->pFnReadTicks )
             {
                 pxSMBusProfile->pFnReadTicks( &ulTicks );
             }
 
-            pxSMBusProfile->xCircularBuffer[pxSMBusProfile->xLogCircularBuffer.ulWrite].ulTicks = ulTicks;
-            pxSMBusProfile->xCircularBuffer[pxSMBusProfile->xLogCircularBuffer.ulWrite].xEvent = Log_Event;
-            pxSMBusProfile->xCircularBuffer[pxSMBusProfile->xLogCircularBuffer.ulWrite].ulInstance = ulInstance;
-            pxSMBusProfile->xCircularBuffer[pxSMBusProfile->xLogCircularBuffer.ulWrite].ulEntry1 = ulEntry1;
-            pxSMBusProfile->xCircularBuffer[pxSMBusProfile->xLogCircularBuffer.ulWrite].ulEntry2 = ulEntry2;
-            pxSMBusProfile->xCircularBuffer[pxSMBusProfile->xLogCircularBuffer.ulWrite].ulIsOccupied = SMBUS_LOG_IS_OCCUPIED;
+            /* Called from both task and interrupt context - keep the ISR out while
+               the slot is claimed and the indexes move on */
+            ulGIEEnable = ulSMBusHWLogEnterCritical( pxSMBusProfile );
+
+            ulWrite = pxSMBusProfile->xLogCircularBuffer.ulWrite;
+            pxEntry = &pxSMBusProfile->xCircularBuffer[ulWrite];
+
+            /* Mark the slot as in-flight so a concurrent reader discards it */
+            pxEntry->ulIsOccupied = SMBUS_LOG_IS_NOT_OCCUPIED;
+            pxEntry->ulTicks = ulTicks;
+            pxEntry->xEvent = Log_Event;
+            pxEntry->ulInstance = ulInstance;
+            pxEntry->ulEntry1 = ulEntry1;
+            pxEntry->ulEntry2 = ulEntry2;
+            pxEntry->ulSequence = pxSMBusProfile->xLogCircularBuffer.ulSequence;
+            pxEntry->ulIsOccupied = SMBUS_LOG_IS_OCCUPIED;
+
+            pxSMBusProfile->xLogCircularBuffer.ulSequence++;
+
+            if( SMBUS_MAX_CIRCULAR_LOG_ENTRIES > pxSMBusProfile->xLogCircularBuffer.ulCount )
+            {
+                pxSMBusProfile->xLogCircularBuffer.ulCount++;
+            }
+
+            /* Wrap around - the oldest entry is overwritten */
+            ulWrite++;
+            if( SMBUS_MAX_CIRCULAR_LOG_ENTRIES <= ulWrite )
+            {
+                ulWrite = 0;
+            }
+            pxSMBusProfile->xLogCircularBuffer.ulWrite = ulWrite;
+
+            vSMBusHWLogExitCritical( pxSMBusProfile, ulGIEEnable );
+        }
+    }
+}
+
+/*******************************************************************************
+*
+* @brief    Takes a consistent copy of a log entry
+*
+*******************************************************************************/
+static int prviReadEntry( SMBUS_PROFILE_TYPE* pxSMBusProfile, uint32_t ulIndex,
+                            SMBUS_LOG_BUFFER_ELEMENT_TYPE* pxEntry )
+{
+    int iValid = SMBUS_FALSE;
+    volatile SMBUS_LOG_BUFFER_ELEMENT_TYPE* pxSlot = &pxSMBusProfile->xCircularBuffer[ulIndex];
+    uint32_t ulSequence = 0;
+
+    if( SMBUS_LOG_IS_OCCUPIED == pxSlot->ulIsOccupied )
+    {
+        ulSequence = pxSlot->ulSequence;
+
+        pxEntry->ulTicks = pxSlot->ulTicks;
+        pxEntry->xEvent = pxSlot->xEvent;
+        pxEntry->ulInstance = pxSlot->ulInstance;
+        pxEntry->ulEntry1 = pxSlot->ulEntry1;
+        pxEntry->ulEntry2 = pxSlot->ulEntry2;
+
+        /* Reject the copy if the ISR rewrote the slot underneath us */
+        if( ( SMBUS_LOG_IS_OCCUPIED == pxSlot->ulIsOccupied ) &&
+            ( ulSequence == pxSlot->ulSequence ) )
+        {
+            pxEntry->ulSequence = ulSequence;
+            pxEntry->ulIsOccupied = SMBUS_LOG_IS_OCCUPIED;
+            iValid = SMBUS_TRUE;
+        }
+    }
+
+    return ( iValid );
+}
+
+/*******************************************************************************
+*
+* @brief    Will retrieve the log in binary form, starting at a sequence number
+*
+*******************************************************************************/
+uint32_t ulLogGetBinaryLog( SMBUS_PROFILE_TYPE* pxSMBusProfile, uint32_t* pulSequence,
+                            uint8_t* pucBuffer, uint32_t ulBufferSize )
+{
+    SMBUS_BINARY_LOG_HEADER_TYPE xHeader = { 0 };
+    SMBUS_LOG_BUFFER_ELEMENT_TYPE xEntry = { 0 };
+    SMBUS_BINARY_LOG_ENTRY_TYPE xOut = { 0 };
+    uint32_t ulSize       = 0;
+    uint32_t ulMaxEntries = 0;
+    uint32_t ulGIEEnable  = 0;
+    uint32_t ulWrite      = 0;
+    uint32_t ulEnd        = 0;
+    uint32_t ulOldest     = 0;
+    uint32_t ulNext       = 0;
+    uint32_t ulIndex      = 0;
+
+    if( ( NULL != pxSMBusProfile ) &&
+        ( NULL != pulSequence ) &&
+        ( NULL != pucBuffer ) &&
+        ( sizeof( xHeader ) <= ulBufferSize ) )
+    {
+        ulMaxEntries = ( ulBufferSize - sizeof( xHeader ) ) / sizeof( xOut );
+        ulNext = *pulSequence;
+        ulSize = sizeof( xHeader );
+
+        /* Take the indexes together so they describe the same point in the log */
+        ulGIEEnable = ulSMBusHWLogEnterCritical( pxSMBusProfile );
+        ulWrite = pxSMBusProfile->xLogCircularBuffer.ulWrite;
+        ulEnd = pxSMBusProfile->xLogCircularBuffer.ulSequence;
+        ulOldest = ulEnd - pxSMBusProfile->xLogCircularBuffer.ulCount;
+        vSMBusHWLogExitCritical( pxSMBusProfile, ulGIEEnable );
 
-            if( (SMBUS_MAX_CIRCULAR_LOG_ENTRIES - 1)  <= pxSMBusProfile->xLogCircularBuffer.ulWrite )
+        /* Anything before the oldest entry held has already been overwritten (wrap safe) */
+        if( 0 < ( int32_t )( ulOldest - ulNext ) )
+        {
+            xHeader.ulDropped = ulOldest - ulNext;
+            ulNext = ulOldest;
+        }
+
+        while( ( 0 < ( int32_t )( ulEnd - ulNext ) ) && ( xHeader.usNumEntries < ulMaxEntries ) )
+        {
+            /* Entries go in consecutive slots, so the slot follows from the sequence number */
+            ulIndex = ulWrite + SMBUS_MAX_CIRCULAR_LOG_ENTRIES - ( ulEnd - ulNext );
+            if( SMBUS_MAX_CIRCULAR_LOG_ENTRIES <= ulIndex )
             {
-                /* For debug Just write over last log */
-                pxSMBusProfile->xLogCircularBuffer.ulWrite = ( SMBUS_MAX_CIRCULAR_LOG_ENTRIES - 1 );
-                /* pxSMBusProfile->xLogCircularBuffer.ulWrite = 0; */
+                ulIndex -= SMBUS_MAX_CIRCULAR_LOG_ENTRIES;
+            }
+
+            if( ( SMBUS_TRUE == prviReadEntry( pxSMBusProfile, ulIndex, &xEntry ) ) &&
+                ( ulNext == xEntry.ulSequence ) )
+            {
+                if( 0 == xHeader.usNumEntries )
+                {
+                    xHeader.ulFirstSequence = xEntry.ulSequence;
+                }
+
+                xOut.ulSequence = xEntry.ulSequence;
+                xOut.ulTicks = xEntry.ulTicks;
+                xOut.ulEntry1 = xEntry.ulEntry1;
+                xOut.ulEntry2 = xEntry.ulEntry2;
+                xOut.ucEvent = ( uint8_t )xEntry.xEvent;
+                xOut.ucInstance = ( uint8_t )xEntry.ulInstance;
+                xOut.usReserved = 0;
+
+                memcpy( &pucBuffer[ulSize], &xOut, sizeof( xOut ) );
+                ulSize += sizeof( xOut );
+                xHeader.usNumEntries++;
             }
             else
             {
-                pxSMBusProfile->xLogCircularBuffer.ulWrite++;
+                /* Overwritten since the indexes were read */
+                xHeader.ulDropped++;
             }
+
+            ulNext++;
+        }
+
+        if( 0 == xHeader.usNumEntries )
+        {
+            xHeader.ulFirstSequence = ulNext;
         }
+
+        xHeader.ulMagic = SMBUS_BINARY_LOG_MAGIC;
+        xHeader.usVersion = SMBUS_BINARY_LOG_VERSION;
+        xHeader.usEntrySize = sizeof( xOut );
+        memcpy( pucBuffer, &xHeader, sizeof( xHeader ) );
+
+        *pulSequence = ulNext;
     }
+
+    return ( ulSize );
 }
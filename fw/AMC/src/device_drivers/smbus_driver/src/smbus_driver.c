@@ -286,6 +286,7 @@ SMBus_Error_Type xInitSMBus( struct SMBUS_PROFILE_TYPE** ppxSMBusProfile, SMBus_
         {
             /* Circular Event Log Initialize */
             vLogInitialize( *ppxSMBusProfile );
+            (*ppxSMBusProfile)->ulLogInstanceMask = SMBUS_LOG_ALL_INSTANCES;
             (*ppxSMBusProfile)->pFnReadTicks = pFnReadTicks;
             (*ppxSMBusProfile)->pvBaseAddress = pvBaseAddress;
             (*ppxSMBusProfile)->xLogLevel = xLogLevel;
@@ -1013,6 +1014,64 @@ SMBus_Error_Type xSMBusLogReset( struct SMBUS_PROFILE_TYPE* pxSMBusProfile )
     return ( xError );
 }
 
+/*******************************************************************************
+*
+* @brief    Retrieves a chunk of the SMBus log in binary form
+*
+*****************************************************************************/
+SMBus_Error_Type xSMBusGetBinaryLog( struct SMBUS_PROFILE_TYPE* pxSMBusProfile, uint32_t* pulSequence,
+                                     uint8_t* pucBuffer, uint32_t ulBufferSize, uint32_t* pulLogSizeBytes )
+{
+    SMBus_Error_Type xError = SMBUS_ERROR;
+
+    if( ( NULL != pxSMBusProfile ) &&
+        ( NULL != pulSequence ) &&
+        ( NULL != pucBuffer ) &&
+        ( NULL != pulLogSizeBytes ) &&
+        ( sizeof( SMBUS_BINARY_LOG_HEADER_TYPE ) <= ulBufferSize ) )
+    {
+        if( SMBUS_SUCCESS != xSMBusFirewallCheck( pxSMBusProfile ) )
+        {
+            vLogAddEntry( pxSMBusProfile, SMBUS_LOG_LEVEL_ERROR, SMBUS_INSTANCE_UNDETERMINED, SMBUS_LOG_EVENT_ERROR,
+                                    SMBUS_ERROR, __LINE__ );
+        }
+        else
+        {
+            *pulLogSizeBytes = ulLogGetBinaryLog( pxSMBusProfile, pulSequence, pucBuffer, ulBufferSize );
+            xError = SMBUS_SUCCESS;
+        }
+    }
+
+    return ( xError );
+}
+
+
+/*******************************************************************************
+*
+* @brief    Selects which instances are recorded in the SMBus log
+*
+*****************************************************************************/
+SMBus_Error_Type xSMBusLogSetInstanceFilter( struct SMBUS_PROFILE_TYPE* pxSMBusProfile, uint32_t ulInstanceMask )
+{
+    SMBus_Error_Type xError = SMBUS_ERROR;
+
+    if( NULL != pxSMBusProfile )
+    {
+        if( SMBUS_SUCCESS != xSMBusFirewallCheck( pxSMBusProfile ) )
+        {
+            vLogAddEntry( pxSMBusProfile, SMBUS_LOG_LEVEL_ERROR, SMBUS_INSTANCE_UNDETERMINED, SMBUS_LOG_EVENT_ERROR,
+                                    SMBUS_ERROR, __LINE__ );
+        }
+        else
+        {
+            pxSMBusProfile->ulLogInstanceMask = ulInstanceMask;
+            xError = SMBUS_SUCCESS;
+        }
+    }
+
+    return ( xError );
+}
+
 /*******************************************************************************
 *
 * @brief    Enables logging
@@ -1091,6 +1091,45 @@ uint32_t ulSMBusHWReadIRQGIEEnable( SMBUS_PROFILE_TYPE* pxSMBusProfile )
     return( ulReadValue );
 }
 
+/*******************************************************************************
+*
+* @brief    Masks the SMBus interrupt while the circular log is updated
+*
+*******************************************************************************/
+uint32_t ulSMBusHWLogEnterCritical( SMBUS_PROFILE_TYPE* pxSMBusProfile )
+{
+    uint32_t           ulGIEEnable = 0;
+    volatile uintptr_t xAddress    = 0;
+
+    if( ( NULL != pxSMBusProfile ) &&
+        ( NULL != pxSMBusProfile->pvBaseAddress ) )
+    {
+        /* Not via prvulSMBusHardwareRead/prvvSMBusHardwareWrite - they add log entries */
+        xAddress = ( uintptr_t )( ( ( SMBUS_BASE_ADDRESS_TYPE )pxSMBusProfile->pvBaseAddress ) + SMBUS_REG_IRQ_GIE / 4 );
+        ulGIEEnable = prvulSMBusIn32( ( void* )xAddress ) & SMBUS_IRQ_GIE_ENABLE_MASK;
+        prvvSMBusOut32( ( void* )xAddress, 0 );
+    }
+
+    return( ulGIEEnable );
+}
+
+/*******************************************************************************
+*
+* @brief    Restores the SMBus interrupt after the circular log is updated
+*
+*******************************************************************************/
+void vSMBusHWLogExitCritical( SMBUS_PROFILE_TYPE* pxSMBusProfile, uint32_t ulGIEEnable )
+{
+    volatile uintptr_t xAddress = 0;
+
+    if( ( NULL != pxSMBusProfile ) &&
+        ( NULL != pxSMBusProfile->pvBaseAddress ) )
+    {
+        xAddress = ( uintptr_t )( ( ( SMBUS_BASE_ADDRESS_TYPE )pxSMBusProfile->pvBaseAddress ) + SMBUS_REG_IRQ_GIE / 4 );
+        prvvSMBusOut32( ( void* )xAddress, ulGIEEnable );
+    }
+}
+
 /* SMBUS_REG_IRQ_IER */
 /*******************************************************************************
 *
@@ -125,6 +125,35 @@ uint32_t ulSMBusHWReadBuildConfig1( SMBUS_PROFILE_TYPE* pxSMBusProfile );
 *******************************************************************************/
 uint32_t ulSMBusHWReadIRQGIEEnable( SMBUS_PROFILE_TYPE* pxSMBusProfile );
 
+/*******************************************************************************
+*
+* @brief    Masks the SMBus interrupt so the circular log can be updated
+*           without the interrupt handler adding an entry part way through
+*
+* @param    pxSMBusProfile is a pointer to the SMBus profile structure.
+*
+* @return   uint32_t previous GIE_ENABLE bitfield, to pass to
+*           vSMBusHWLogExitCritical
+*
+* @note     Accesses the register directly - the access is not logged.
+*
+*******************************************************************************/
+uint32_t ulSMBusHWLogEnterCritical( SMBUS_PROFILE_TYPE* pxSMBusProfile );
+
+/*******************************************************************************
+*
+* @brief    Restores the SMBus interrupt after ulSMBusHWLogEnterCritical
+*
+* @param    pxSMBusProfile is a pointer to the SMBus profile structure.
+* @param    ulGIEEnable is the value returned by ulSMBusHWLogEnterCritical
+*
+* @return   None
+*
+* @note     Accesses the register directly - the access is not logged.
+*
+*******************************************************************************/
+void vSMBusHWLogExitCritical( SMBUS_PROFILE_TYPE* pxSMBusProfile, uint32_t ulGIEEnable );
+
 /*******************************************************************************
 *
 * @brief    Reads the hardware register SMBUS_REG_IRQ_IER
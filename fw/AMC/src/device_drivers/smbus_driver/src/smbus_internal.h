@@ -132,6 +132,7 @@ typedef enum SMBus_State_Type
 typedef struct SMBUS_LOG_BUFFER_ELEMENT_TYPE
 {
     uint32_t                ulIsOccupied;
+    uint32_t                ulSequence;
     uint32_t                ulTicks;
     uint32_t                ulEntry1;
     uint32_t                ulInstance;
@@ -148,6 +149,8 @@ typedef struct SMBUS_LOG_BUFFER_TYPE
 {
     uint32_t    ulWrite;
     uint32_t    ulRead;
+    uint32_t    ulSequence;
+    uint32_t    ulCount;
 
 } SMBUS_LOG_BUFFER_TYPE;
 
@@ -253,6 +256,7 @@ typedef struct SMBUS_PROFILE_TYPE
     uint8_t                                         ucInstanceInPlay;
     uint8_t                                         ucActiveTargetInstance;
     SMBUS_LOG_LEVEL_TYPE                            xLogLevel;
+    uint32_t                                        ulLogInstanceMask;
     uint8_t                                         ucUDIDMatch[SMBUS_NUMBER_OF_SMBUS_NON_ARP_INSTANCES];
 
 } SMBUS_PROFILE_TYPE;
@@ -295,7 +299,9 @@ SMBus_Error_Type xSMBusFirewallCheck(SMBUS_PROFILE_TYPE* pxSMBusProfile);
 *
 * @return   None
 *
-* @note     None.
+* @note     Safe to call from the interrupt handler. The log has a single producer:
+*           callers outside the ISR must have SMBus interrupts disabled.
+*           Entries for instances masked out by ulLogInstanceMask are dropped.
 *
 *******************************************************************************/
 void vLogAddEntry( SMBUS_PROFILE_TYPE* pxSMBusProfile, SMBUS_LOG_LEVEL_TYPE xLogLevel, uint32_t ulInstance,
@@ -352,6 +358,25 @@ void vLogInitialize( SMBUS_PROFILE_TYPE* pxSMBusProfile );
 *
 *******************************************************************************/
 void vLogDisplayLog( SMBUS_PROFILE_TYPE* pxSMBusProfile, char* pcLogBuffer, uint32_t* usLogSizeBytes );
+
+/*******************************************************************************
+*
+* @brief    Will retrieve the log in binary form, starting at a sequence number
+*
+* @param    pxSMBusProfile is a pointer to the SMBus profile structure.
+* @param    pulSequence is the first sequence number wanted - updated to the
+*           sequence number to request on the next call
+* @param    pucBuffer is the buffer to write the header and entries in to.
+* @param    ulBufferSize is the size of pucBuffer in bytes
+*
+* @return   Number of bytes written to pucBuffer
+*
+* @note     May run concurrently with the ISR adding entries - entries
+*           overwritten while being read are skipped and counted in ulDropped.
+*
+*******************************************************************************/
+uint32_t ulLogGetBinaryLog( SMBUS_PROFILE_TYPE* pxSMBusProfile, uint32_t* pulSequence,
+                            uint8_t* pucBuffer, uint32_t ulBufferSize );
 /******************************************************************************/
 /* Driver Internal APIs                                                       */
 /******************************************************************************/
@@ -212,6 +212,56 @@ static inline uint32_t prvulReadMemReg32( uint64_t ullSrcAddr )
     return ( ulValue );
 }
 
+/**
+ *
+ * @brief   Handle block memory writes in AMC
+ *
+ * @param   ullDestAddr is the 32-bit aligned destination address
+ * @param   pucData is the data to write
+ * @param   ulLen is the number of bytes to write, a multiple of 4
+ *
+ * @return  N/A
+ *
+ * @note    The cache is flushed once for the whole block rather than per word
+ *
+ */
+static void prvvWriteMemBlock( uint64_t ullDestAddr, const uint8_t *pucData, uint32_t ulLen )
+{
+    const uint32_t *pulSrc = ( const uint32_t * )pucData;
+    uint32_t i = 0;
+
+    for( i = 0; i < ( ulLen / sizeof( uint32_t ) ); i++ )
+    {
+        HAL_IO_WRITE32_NO_FLUSH( pulSrc[ i ], ullDestAddr + ( i * sizeof( uint32_t ) ) );
+    }
+    HAL_FLUSH_CACHE_DATA( ullDestAddr, ulLen );
+}
+
+/**
+ *
+ * @brief   Handle block memory reads in AMC
+ *
+ * @param   ullSrcAddr is the 32-bit aligned source address
+ * @param   pucData is the buffer to populate
+ * @param   ulLen is the number of bytes to read, a multiple of 4
+ *
+ * @return  N/A
+ *
+ * @note    The cache is flushed once for the whole block rather than per word
+ *
+ */
+static void prvvReadMemBlock( uint64_t ullSrcAddr, uint8_t *pucData, uint32_t ulLen )
+{
+    uint32_t *pulDest = ( uint32_t * )pucData;
+    uint32_t i = 0;
+
+    HAL_FLUSH_CACHE_DATA( ullSrcAddr, ulLen );
+    for( i = 0; i < ( ulLen / sizeof( uint32_t ) ); i++ )
+    {
+        pulDest[ i ] = HAL_IO_READ32_NO_FLUSH( ullSrcAddr + ( i * sizeof( uint32_t ) ) );
+    }
+}
+
 /**
  *
  * @brief   Map interface error return code
@@ -783,6 +833,8 @@ uint32_t ulFW_IF_GCQ_Init( FW_IF_GCQ_INIT_CFG *pxCfg )
             pxThis->xGcqIoAccess.xGCQWriteMem32 = prvvWriteMemReg32;
             pxThis->xGcqIoAccess.xGCQReadReg32 = prvulReadMemReg32;
             pxThis->xGcqIoAccess.xGCQWriteReg32 = prvvWriteMemReg32;
+            pxThis->xGcqIoAccess.xGCQReadMemBlock = prvvReadMemBlock;
+            pxThis->xGcqIoAccess.xGCQWriteMemBlock = prvvWriteMemBlock;
             pxThis->xLocalCfg.pvIOAccess = &pxThis->xGcqIoAccess;
             pxThis->iInitialised = FW_IF_TRUE;
 
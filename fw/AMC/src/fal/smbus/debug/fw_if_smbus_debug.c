@@ -50,6 +50,16 @@ static void vPrintStats( void );
  */
 static void vClearStats( void );
 
+/**
+ * @brief   Debug function to dump the driver trace in binary form.
+ */
+static void vDumpTrace( void );
+
+/**
+ * @brief   Debug function to select which instances are traced.
+ */
+static void vSetTraceFilter( void );
+
 /**
  * @brief   Debug function to open an SMBus instance.
  */
@@ -124,6 +134,8 @@ void vFW_IF_SMBUS_DebugInit( DAL_HDL pxParentHandle )
             pxDAL_NewDebugFunction( "read", pxFwIfSMBusTop, vRead );
             pxDAL_NewDebugFunction( "io_ctrl", pxFwIfSMBusTop, vIoCtrl );
             pxDAL_NewDebugFunction( "bind_callback", pxFwIfSMBusTop, vBindCallback );
+            pxDAL_NewDebugFunction( "dump_trace", pxFwIfSMBusTop, vDumpTrace );
+            pxDAL_NewDebugFunction( "set_trace_filter", pxFwIfSMBusTop, vSetTraceFilter );
         }
 
         iInitialised = TRUE;
@@ -377,3 +389,47 @@ static uint32_t iTestCallback( uint16_t usEventId, uint8_t *pucData, uint32_t ul
 
     return ulStatus;
 }
+
+/**
+ * @brief   Debug function to dump the driver trace in binary form.
+ */
+static void vDumpTrace( void )
+{
+    uint32_t ulSequence = 0;
+
+    if( OK != iDAL_GetHex( "Enter first sequence number (0 for oldest): ", &ulSequence ) )
+    {
+        char *pcSequence = "Sequence number";
+        vUserInputError( pcSequence );
+    }
+    else if( OK != iFW_IF_SMBUS_DumpTrace( &ulSequence ) )
+    {
+        PLL_DAL( FW_IF_SMBUS_DBG_NAME, "Error dumping trace\r\n" );
+    }
+    else
+    {
+        PLL_DAL( FW_IF_SMBUS_DBG_NAME, "Next sequence number: 0x%x\r\n", ulSequence );
+    }
+}
+
+/**
+ * @brief   Debug function to select which instances are traced.
+ */
+static void vSetTraceFilter( void )
+{
+    uint32_t ulInstanceMask = 0;
+
+    if( OK != iDAL_GetHex( "Enter instance mask (bit N traces instance N): ", &ulInstanceMask ) )
+    {
+        char *pcMask = "Instance mask";
+        vUserInputError( pcMask );
+    }
+    else if( OK != iFW_IF_SMBUS_SetTraceFilter( ulInstanceMask ) )
+    {
+        PLL_DAL( FW_IF_SMBUS_DBG_NAME, "Error setting trace filter\r\n" );
+    }
+    else
+    {
+        PLL_DAL( FW_IF_SMBUS_DBG_NAME, "Trace filter set to 0x%08x\r\n", ulInstanceMask );
+    }
+}
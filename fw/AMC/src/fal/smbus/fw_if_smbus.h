@@ -251,4 +251,31 @@ extern int iFW_IF_SMBUS_PrintStatistics( void );
  */
 extern int iFW_IF_SMBUS_ClearStatistics( void );
 
+/**
+ *
+ * @brief    Dumps the SMBus driver trace in binary form
+ *
+ * @param    pulSequence     First sequence number to dump (0 for the oldest held) -
+ *                           updated to the sequence number to continue from
+ *
+ * @return   OK                  Trace dumped successfully
+ *           ERROR               Trace not dumped
+ *
+ * @note     Each chunk is printed as a "SMBL:<hex>" line holding an
+ *           SMBUS_BINARY_LOG_HEADER_TYPE followed by its entries, for decoding
+ *           on the host. Tracing continues while the dump is taken.
+ */
+extern int iFW_IF_SMBUS_DumpTrace( uint32_t *pulSequence );
+
+/**
+ *
+ * @brief    Selects which SMBus instances are traced
+ *
+ * @param    ulInstanceMask  Bit N set to trace driver instance N
+ *
+ * @return   OK                  Filter set successfully
+ *           ERROR               Filter not set
+ */
+extern int iFW_IF_SMBUS_SetTraceFilter( uint32_t ulInstanceMask );
+
 #endif
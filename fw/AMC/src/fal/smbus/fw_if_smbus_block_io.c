@@ -34,6 +34,11 @@
 #define SMBUS_BLOCK_IO_UPPER_FIREWALL   ( 0xBEEFCAFE )
 #define SMBUS_BLOCK_IO_LOWER_FIREWALL   ( 0xDEADFACE )
 
+#define SMBUS_TRACE_CHUNK_ENTRIES       ( 4 )
+#define SMBUS_TRACE_CHUNK_SIZE          ( sizeof( SMBUS_BINARY_LOG_HEADER_TYPE ) + \
+                                          ( SMBUS_TRACE_CHUNK_ENTRIES * sizeof( SMBUS_BINARY_LOG_ENTRY_TYPE ) ) )
+#define SMBUS_TRACE_MAX_CHUNKS          ( ( SMBUS_MAX_CIRCULAR_LOG_ENTRIES / SMBUS_TRACE_CHUNK_ENTRIES ) + 1 )
+
 #define CHECK_DRIVER            if( FW_IF_FALSE == pxThis->iInitialised ) return FW_IF_ERRORS_DRIVER_NOT_INITIALISED
 #define CHECK_FIREWALLS( f )    if( ( f->upperFirewall != SMBUS_BLOCK_IO_UPPER_FIREWALL ) &&\
                                     ( f->lowerFirewall != SMBUS_BLOCK_IO_LOWER_FIREWALL ) ) return FW_IF_ERRORS_INVALID_HANDLE
@@ -59,6 +64,8 @@
     DO( FW_IF_SMBUS_BLOCK_IO_STATS_ANNOUNCE_RESULT_GENERIC )       \
     DO( FW_IF_SMBUS_BLOCK_IO_STATS_ANNOUNCE_ARP )   	           \
     DO( FW_IF_SMBUS_BLOCK_IO_STATS_SETUP_INTERRUPTS )              \
+    DO( FW_IF_SMBUS_BLOCK_IO_STATS_TRACE_DUMP )                    \
+    DO( FW_IF_SMBUS_BLOCK_IO_STATS_TRACE_FILTER )                  \
     DO( FW_IF_SMBUS_BLOCK_IO_STATS_MAX )
 
 #define FW_IF_SMBUS_BLOCK_IO_ERROR_COUNTS( DO )    \
@@ -80,6 +87,8 @@
     DO( FW_IF_SMBUS_BLOCK_IO_ERRORS_ANNOUNCE_BUS_WARN )            \
     DO( FW_IF_SMBUS_BLOCK_IO_ERRORS_VALIDATION_FAILED )            \
     DO( FW_IF_SMBUS_BLOCK_IO_STATS_SETUP_INTERRUPTS_FAILED )       \
+    DO( FW_IF_SMBUS_BLOCK_IO_ERRORS_TRACE_DUMP_FAILED )            \
+    DO( FW_IF_SMBUS_BLOCK_IO_ERRORS_TRACE_FILTER_FAILED )          \
     DO( FW_IF_SMBUS_BLOCK_IO_ERRORS_MAX )
 
 #define PRINT_STAT_COUNTER( x )             PLL_INF( FW_IF_SMBUS_BLOCK_IO_NAME, "%50s . . . . %d\r\n",    \
@@ -1051,3 +1060,89 @@ int iFW_IF_SMBUS_ClearStatistics( void )
 
     return iStatus;
 }
+
+/**
+ * @brief   Dumps the SMBus driver trace in binary form
+ */
+int iFW_IF_SMBUS_DumpTrace( uint32_t *pulSequence )
+{
+    int iStatus = ERROR;
+
+    if( ( SMBUS_BLOCK_IO_UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( SMBUS_BLOCK_IO_LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( FW_IF_TRUE == pxThis->iInitialised ) &&
+        ( NULL != pulSequence ) )
+    {
+        uint8_t pucChunk[ SMBUS_TRACE_CHUNK_SIZE ] = { 0 };
+        char pcHex[ ( 2 * SMBUS_TRACE_CHUNK_SIZE ) + 1 ] = { 0 };
+        uint32_t ulChunkSize = 0;
+        int iChunk = 0;
+        int i = 0;
+
+        iStatus = OK;
+
+        /* Bounded so a busy bus cannot keep the dump going forever */
+        for( iChunk = 0; ( OK == iStatus ) && ( SMBUS_TRACE_MAX_CHUNKS > iChunk ); iChunk++ )
+        {
+            if( SMBUS_ERROR == xSMBusGetBinaryLog( pxThis->pxSMBusProfile, pulSequence, pucChunk,
+                                                   sizeof( pucChunk ), &ulChunkSize ) )
+            {
+                INC_ERROR_COUNTER( FW_IF_SMBUS_BLOCK_IO_ERRORS_TRACE_DUMP_FAILED )
+                iStatus = ERROR;
+            }
+            else if( sizeof( SMBUS_BINARY_LOG_HEADER_TYPE ) >= ulChunkSize )
+            {
+                /* Caught up */
+                break;
+            }
+            else
+            {
+                for( i = 0; i < ulChunkSize; i++ )
+                {
+                    snprintf( &pcHex[ 2 * i ], 3, "%02x", pucChunk[ i ] );
+                }
+                vPLL_Printf( "SMBL:%s\r\n", pcHex );
+            }
+        }
+
+        if( OK == iStatus )
+        {
+            INC_STAT_COUNTER( FW_IF_SMBUS_BLOCK_IO_STATS_TRACE_DUMP )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( FW_IF_SMBUS_BLOCK_IO_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Selects which SMBus instances are traced
+ */
+int iFW_IF_SMBUS_SetTraceFilter( uint32_t ulInstanceMask )
+{
+    int iStatus = ERROR;
+
+    if( ( SMBUS_BLOCK_IO_UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( SMBUS_BLOCK_IO_LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( FW_IF_TRUE == pxThis->iInitialised ) )
+    {
+        if( SMBUS_ERROR != xSMBusLogSetInstanceFilter( pxThis->pxSMBusProfile, ulInstanceMask ) )
+        {
+            INC_STAT_COUNTER( FW_IF_SMBUS_BLOCK_IO_STATS_TRACE_FILTER )
+            iStatus = OK;
+        }
+        else
+        {
+            INC_ERROR_COUNTER( FW_IF_SMBUS_BLOCK_IO_ERRORS_TRACE_FILTER_FAILED )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( FW_IF_SMBUS_BLOCK_IO_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
@@ -358,3 +358,31 @@ int iFW_IF_SMBUS_ClearStatistics( void )
 
     return iStatus;
 }
+
+/**
+ * @brief   Dumps the SMBus driver trace in binary form
+ */
+int iFW_IF_SMBUS_DumpTrace( uint32_t *pulSequence )
+{
+    int iStatus = FW_IF_ERRORS_DRIVER_NOT_INITIALISED;
+
+    /*
+     * This is where the driver trace gets dumped
+     */
+
+    return iStatus;
+}
+
+/**
+ * @brief   Selects which SMBus instances are traced
+ */
+int iFW_IF_SMBUS_SetTraceFilter( uint32_t ulInstanceMask )
+{
+    int iStatus = FW_IF_ERRORS_DRIVER_NOT_INITIALISED;
+
+    /*
+     * This is where the driver trace filter gets set
+     */
+
+    return iStatus;
+}
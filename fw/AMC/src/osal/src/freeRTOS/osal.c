@@ -55,8 +55,28 @@
 #define DEFAULT_TIMER_BLOCK_TIME_MS ( 1000 )
 #define DEFAULT_TIMER_PERIOD_MS     ( 100 )
 #define DEFAULT_OS_NAME             ( "freeRTOS" )
+#define TICKS_TO_US( x )            ( ( uint64_t )( x ) * portTICK_PERIOD_MS * 1000 )
 #define LINE_SEPARATOR              ( "--------------------------------------------------------------------------------------------------------------------------\r\n" )
 
+/* Per-task CPU time needs both the run time counter and uxTaskGetSystemState */
+#if ( 1 == configGENERATE_RUN_TIME_STATS ) && ( 1 == configUSE_TRACE_FACILITY )
+#define OSAL_PROFILE_RUN_TIME
+#endif
+
+/* Rate of portGET_RUN_TIME_COUNTER_VALUE, the PMU cycle counter by default */
+#ifndef OSAL_RUN_TIME_COUNTER_HZ
+#define OSAL_RUN_TIME_COUNTER_HZ    ( configCPU_CLOCK_HZ )
+#endif
+
+#ifndef configRUN_TIME_COUNTER_TYPE
+#define configRUN_TIME_COUNTER_TYPE uint32_t
+#endif
+
+/* Thread local storage slot caching each task's OSAL_TASK_MEMORY */
+#if ( 0 < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+#define OSAL_PROFILE_TLS_INDEX      ( 0 )
+#endif
+
 
 /*****************************************************************************/
 /* Structs                                                                   */
@@ -65,7 +85,7 @@
 /**
  * @struct OSAL_TASK_MEMORY
  *
- * @brief Struct to store task's stack, TCB (Task control block) and handle.
+ * @brief Struct to store task's stack, TCB (Task control block), handle and profile.
  *        Used for static task allocation.
  */
 typedef struct OSAL_TASK_MEMORY
@@ -74,6 +94,13 @@ typedef struct OSAL_TASK_MEMORY
     StaticTask_t xTcb;
     TaskHandle_t xTaskHandle;
 
+    uint32_t ulStackSize;       /* bytes */
+    uint64_t ullAwakeTicks;     /* wakeup to next blocking call, including time preempted */
+    configRUN_TIME_COUNTER_TYPE xRunTimeBase;   /* run time counter when the profile was cleared */
+    TickType_t xLastWakeTick;
+    uint32_t ulWakeups;
+    uint32_t ulMaxLoopTicks;
+
 } OSAL_TASK_MEMORY;
 
 
@@ -366,6 +393,63 @@ static OSAL_TASK_MEMORY* pxAllocateTaskMemory( void );
 */
 static void vDeallocateTaskMemory( OSAL_TASK_MEMORY* pxMemory );
 
+/**
+ * @brief Resets the profile of a task that is about to be created.
+ *
+ * @param pxMemory    Task memory allocated for the task.
+ * @param ulStackSize Stack size in bytes.
+ */
+static void vInitTaskProfile( OSAL_TASK_MEMORY* pxMemory, uint32_t ulStackSize );
+
+/**
+ * @brief Binds task memory to its newly created task.
+ *
+ * @param pxMemory    Task memory allocated for the task.
+ * @param xTaskHandle Handle of the created task.
+ */
+static void vBindTaskMemory( OSAL_TASK_MEMORY* pxMemory, TaskHandle_t xTaskHandle );
+
+/**
+ * @brief Finds the task memory of the calling task.
+ *
+ * @returns Pointer to the task memory, NULL if the task was not created by the OSAL.
+ */
+static OSAL_TASK_MEMORY* pxFindCurrentTaskMemory( void );
+
+#ifdef OSAL_PROFILE_RUN_TIME
+/**
+ * @brief Takes a snapshot of every task's state, including its run time counter.
+ *
+ * @param puxNumTasks Number of entries in the returned array.
+ *
+ * @returns Array to be freed with vOSAL_MemFree, NULL if it could not be allocated.
+ */
+static TaskStatus_t* pxGetTaskStates( UBaseType_t* puxNumTasks );
+
+/**
+ * @brief Finds the run time counter of a task in a snapshot.
+ *
+ * @param pxStates    Snapshot from pxGetTaskStates.
+ * @param uxNumTasks  Number of entries in the snapshot.
+ * @param xTaskHandle Task to find.
+ * @param pxRunTime   Set to the task's run time counter.
+ *
+ * @returns TRUE if the task was found.
+ */
+static int iFindTaskRunTime( TaskStatus_t* pxStates, UBaseType_t uxNumTasks,
+                             TaskHandle_t xTaskHandle, configRUN_TIME_COUNTER_TYPE* pxRunTime );
+#endif
+
+/**
+ * @brief Profiles the end of a loop, called before a blocking call.
+ */
+static void vProfileBlock( void );
+
+/**
+ * @brief Profiles a wakeup, called after a blocking call returns.
+ */
+static void vProfileWake( void );
+
 
 /*****************************************************************************/
 /* Function implementations                                                  */
@@ -453,6 +537,8 @@ int iOSAL_StartOS( int         iRoundRobinEnabled,
 
         if( NULL != pxMemory )
         {
+            vInitTaskProfile( pxMemory, usStartTaskStackSize * sizeof( StackType_t ) );
+
             *ppvTaskHandle = xTaskCreateStatic( ( TaskFunction_t )pvStartTask,
                                                 "OSAL Main Task",
                                                 ( configSTACK_DEPTH_TYPE )usStartTaskStackSize,
@@ -463,7 +549,7 @@ int iOSAL_StartOS( int         iRoundRobinEnabled,
 
             if( NULL != *ppvTaskHandle )
             {
-                pxMemory->xTaskHandle = *ppvTaskHandle;
+                vBindTaskMemory( pxMemory, *ppvTaskHandle );
 
                 /* Task created successfully, create thread safe mutexes and binary semaphores */
                 pvPrintfMutexHandle  = xSemaphoreCreateMutex();
@@ -640,6 +726,8 @@ int iOSAL_Task_Create( void**      ppvTaskHandle,
 
         if( NULL != pxMemory )
         {
+            vInitTaskProfile( pxMemory, usTaskStackSize * sizeof( StackType_t ) );
+
             *ppvTaskHandle = xTaskCreateStatic( ( TaskFunction_t )pvTaskFunction,
                                                 pcTaskName,
                                                 ( configSTACK_DEPTH_TYPE )usTaskStackSize,
@@ -650,7 +738,7 @@ int iOSAL_Task_Create( void**      ppvTaskHandle,
 
             if( NULL != *ppvTaskHandle )
             {
-                pxMemory->xTaskHandle = *ppvTaskHandle;
+                vBindTaskMemory( pxMemory, *ppvTaskHandle );
 
                 /* Add task to debug stats */
                 OSAL_TASK_STATS_LINKED_LIST *pxNewNode = ( OSAL_TASK_STATS_LINKED_LIST* ) pvOSAL_MemAlloc( sizeof( OSAL_TASK_STATS_LINKED_LIST ) );
@@ -798,7 +886,9 @@ int iOSAL_Task_SleepTicks( uint32_t ulSleepTicks )
 
     if( 0 < ulSleepTicks )
     {
+        vProfileBlock();
         vTaskDelay( ( TickType_t )ulSleepTicks );
+        vProfileWake();
         iStatus = OSAL_ERRORS_NONE;
     }
 
@@ -823,13 +913,127 @@ int iOSAL_Task_SleepMs( uint32_t ulSleepMs )
             xSleepTicks = ONE_TICK;
         }
 
+        vProfileBlock();
         vTaskDelay( xSleepTicks );
+        vProfileWake();
+        iStatus = OSAL_ERRORS_NONE;
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Get the profile of every task created with iOSAL_Task_Create.
+ */
+int iOSAL_Task_GetProfile( OSAL_TASK_PROFILE* pxProfiles, uint32_t* pulNumTasks )
+{
+    int iStatus = OSAL_ERRORS_PARAMS;
+
+    RETURN_IF_OS_NOT_STARTED;
+
+    if( ( NULL != pxProfiles ) &&
+        ( NULL != pulNumTasks ) )
+    {
+        uint32_t ulCount = 0;
+        int i = 0;
+#ifdef OSAL_PROFILE_RUN_TIME
+        UBaseType_t uxNumStates = 0;
+        TaskStatus_t* pxStates = pxGetTaskStates( &uxNumStates );
+#endif
+
+        for( i = 0; ( i < OSAL_MAX_TASKS ) && ( ulCount < *pulNumTasks ); i++ )
+        {
+            OSAL_TASK_MEMORY* pxMemory = &xTaskMemoryPool[ i ];
+
+            if( ( MEM_USED == xTaskMemoryUsed[ i ] ) &&
+                ( NULL != pxMemory->xTaskHandle ) )
+            {
+                OSAL_TASK_PROFILE* pxProfile = &pxProfiles[ ulCount++ ];
+                UBaseType_t uxFreeWords = uxTaskGetStackHighWaterMark( pxMemory->xTaskHandle );
+
+                strncpy( pxProfile->pcName, pcTaskGetName( pxMemory->xTaskHandle ), OSAL_TASK_NAME_LEN - 1 );
+                pxProfile->pcName[ OSAL_TASK_NAME_LEN - 1 ] = '\0';
+                pxProfile->ulStackSize = pxMemory->ulStackSize;
+                pxProfile->ulStackHighWaterMark = pxMemory->ulStackSize - ( uxFreeWords * sizeof( StackType_t ) );
+
+                pxProfile->ullRunTimeUs = 0;
+#ifdef OSAL_PROFILE_RUN_TIME
+                {
+                    configRUN_TIME_COUNTER_TYPE xRunTime = 0;
+
+                    if( TRUE == iFindTaskRunTime( pxStates, uxNumStates, pxMemory->xTaskHandle, &xRunTime ) )
+                    {
+                        /* Unsigned difference - valid until the counter laps since the last clear */
+                        pxProfile->ullRunTimeUs = ( ( uint64_t )( configRUN_TIME_COUNTER_TYPE )( xRunTime - pxMemory->xRunTimeBase ) * 1000000ULL ) /
+                                                  OSAL_RUN_TIME_COUNTER_HZ;
+                    }
+                }
+#endif
+
+                /* Counters are updated by the task itself */
+                vOSAL_EnterCritical();
+                pxProfile->ullAwakeTimeUs = TICKS_TO_US( pxMemory->ullAwakeTicks );
+                pxProfile->ulWakeups = pxMemory->ulWakeups;
+                pxProfile->ulMaxLoopUs = ( uint32_t )TICKS_TO_US( pxMemory->ulMaxLoopTicks );
+                vOSAL_ExitCritical();
+            }
+        }
+
+#ifdef OSAL_PROFILE_RUN_TIME
+        if( NULL != pxStates )
+        {
+            vOSAL_MemFree( ( void ** )&pxStates );
+        }
+#endif
+
+        *pulNumTasks = ulCount;
         iStatus = OSAL_ERRORS_NONE;
     }
 
     return iStatus;
 }
 
+/**
+ * @brief   Clear the run time, awake time, wakeup and loop time counters of every task.
+ */
+int iOSAL_Task_ClearProfile( void )
+{
+    int i = 0;
+#ifdef OSAL_PROFILE_RUN_TIME
+    UBaseType_t uxNumStates = 0;
+    TaskStatus_t* pxStates = NULL;
+#endif
+
+    RETURN_IF_OS_NOT_STARTED;
+
+#ifdef OSAL_PROFILE_RUN_TIME
+    pxStates = pxGetTaskStates( &uxNumStates );
+#endif
+
+    vOSAL_EnterCritical();
+    for( i = 0; i < OSAL_MAX_TASKS; i++ )
+    {
+        xTaskMemoryPool[ i ].ullAwakeTicks = 0;
+        xTaskMemoryPool[ i ].ulWakeups = 0;
+        xTaskMemoryPool[ i ].ulMaxLoopTicks = 0;
+#ifdef OSAL_PROFILE_RUN_TIME
+        ( void )iFindTaskRunTime( pxStates, uxNumStates, xTaskMemoryPool[ i ].xTaskHandle,
+                                  &xTaskMemoryPool[ i ].xRunTimeBase );
+#endif
+    }
+    vOSAL_ExitCritical();
+
+#ifdef OSAL_PROFILE_RUN_TIME
+    if( NULL != pxStates )
+    {
+        vOSAL_MemFree( ( void ** )&pxStates );
+    }
+#endif
+
+    return OSAL_ERRORS_NONE;
+}
+
+
 /*****************************************************************************/
 /* Semaphore APIs                                                            */
 /*****************************************************************************/
@@ -944,7 +1148,20 @@ int iOSAL_Semaphore_Pend( void* pvSemHandle, uint32_t ulTimeoutMs )
             }
         }
 
-        if( pdPASS != xSemaphoreTake( ( SemaphoreHandle_t )pvSemHandle, xTimeoutTicks ) )
+        BaseType_t xReturn = pdFAIL;
+
+        if( 0 != xTimeoutTicks )
+        {
+            vProfileBlock();
+            xReturn = xSemaphoreTake( ( SemaphoreHandle_t )pvSemHandle, xTimeoutTicks );
+            vProfileWake();
+        }
+        else
+        {
+            xReturn = xSemaphoreTake( ( SemaphoreHandle_t )pvSemHandle, xTimeoutTicks );
+        }
+
+        if( pdPASS != xReturn )
         {
             /* Semaphore not taken */
             iStatus = OSAL_ERRORS_OS_IMPLEMENTATION;
@@ -1328,9 +1545,20 @@ int iOSAL_MBox_Pend( void*    pvMBoxHandle,
             }
         }
 
-        xReturn = xQueueReceive( ( QueueHandle_t )pvMBoxHandle,
-                                    pvMBoxBuffer,
-                                    xTimeoutTicks );
+        if( 0 != xTimeoutTicks )
+        {
+            vProfileBlock();
+            xReturn = xQueueReceive( ( QueueHandle_t )pvMBoxHandle,
+                                     pvMBoxBuffer,
+                                     xTimeoutTicks );
+            vProfileWake();
+        }
+        else
+        {
+            xReturn = xQueueReceive( ( QueueHandle_t )pvMBoxHandle,
+                                     pvMBoxBuffer,
+                                     xTimeoutTicks );
+        }
 
         if( pdPASS != xReturn )
         {
@@ -1567,12 +1795,22 @@ int iOSAL_EventFlag_Pend( void* pvEventFlagHandle, uint32_t ulFlagWait, uint32_t
             }
         }
 
+        if( 0 != xTimeoutTicks )
+        {
+            vProfileBlock();
+        }
+
         xEventGroupWaitBits( ( EventGroupHandle_t  )pvEventFlagHandle,
                              ( EventBits_t )ulFlagWait,
                              xClearOnExit,
                              xWaitForAllBits,
                              xTimeoutTicks );
 
+        if( 0 != xTimeoutTicks )
+        {
+            vProfileWake();
+        }
+
         OSAL_EVENT_STATS_LINKED_LIST *pxCurrent = pxFindEvent( pvEventFlagHandle );
         if( NULL != pxCurrent)
         {
@@ -2321,6 +2559,138 @@ static void vDeallocateTaskMemory( OSAL_TASK_MEMORY* pxMemory )
     }
 }
 
+/**
+ * @brief   Resets the profile of a task that is about to be created.
+ */
+static void vInitTaskProfile( OSAL_TASK_MEMORY* pxMemory, uint32_t ulStackSize )
+{
+    if( NULL != pxMemory )
+    {
+        pxMemory->xTaskHandle = NULL;
+        pxMemory->ulStackSize = ulStackSize;
+        pxMemory->ullAwakeTicks = 0;
+        pxMemory->xRunTimeBase = 0;
+        pxMemory->xLastWakeTick = xTaskGetTickCount();
+        pxMemory->ulWakeups = 0;
+        pxMemory->ulMaxLoopTicks = 0;
+    }
+}
+
+/**
+ * @brief   Binds task memory to its newly created task.
+ */
+static void vBindTaskMemory( OSAL_TASK_MEMORY* pxMemory, TaskHandle_t xTaskHandle )
+{
+    pxMemory->xTaskHandle = xTaskHandle;
+#ifdef OSAL_PROFILE_TLS_INDEX
+    vTaskSetThreadLocalStoragePointer( xTaskHandle, OSAL_PROFILE_TLS_INDEX, pxMemory );
+#endif
+}
+
+/**
+ * @brief   Finds the task memory of the calling task.
+ */
+static OSAL_TASK_MEMORY* pxFindCurrentTaskMemory( void )
+{
+    OSAL_TASK_MEMORY* pxMemory = NULL;
+
+#ifdef OSAL_PROFILE_TLS_INDEX
+    pxMemory = ( OSAL_TASK_MEMORY* )pvTaskGetThreadLocalStoragePointer( NULL, OSAL_PROFILE_TLS_INDEX );
+#else
+    TaskHandle_t xCurrent = xTaskGetCurrentTaskHandle();
+    int i = 0;
+
+    for( i = 0; i < OSAL_MAX_TASKS; i++ )
+    {
+        if( ( MEM_USED == xTaskMemoryUsed[ i ] ) &&
+            ( xCurrent == xTaskMemoryPool[ i ].xTaskHandle ) )
+        {
+            pxMemory = &xTaskMemoryPool[ i ];
+            break;
+        }
+    }
+#endif
+
+    return pxMemory;
+}
+
+#ifdef OSAL_PROFILE_RUN_TIME
+/**
+ * @brief   Takes a snapshot of every task's state, including its run time counter.
+ */
+static TaskStatus_t* pxGetTaskStates( UBaseType_t* puxNumTasks )
+{
+    UBaseType_t uxArraySize = uxTaskGetNumberOfTasks();
+    TaskStatus_t* pxStates = pvOSAL_MemAlloc( uxArraySize * sizeof( TaskStatus_t ) );
+
+    *puxNumTasks = 0;
+    if( NULL != pxStates )
+    {
+        *puxNumTasks = uxTaskGetSystemState( pxStates, uxArraySize, NULL );
+    }
+
+    return pxStates;
+}
+
+/**
+ * @brief   Finds the run time counter of a task in a snapshot.
+ */
+static int iFindTaskRunTime( TaskStatus_t* pxStates, UBaseType_t uxNumTasks,
+                             TaskHandle_t xTaskHandle, configRUN_TIME_COUNTER_TYPE* pxRunTime )
+{
+    int iFound = FALSE;
+    UBaseType_t x = 0;
+
+    if( ( NULL != pxStates ) && ( NULL != xTaskHandle ) )
+    {
+        for( x = 0; x < uxNumTasks; x++ )
+        {
+            if( xTaskHandle == pxStates[ x ].xHandle )
+            {
+                *pxRunTime = pxStates[ x ].ulRunTimeCounter;
+                iFound = TRUE;
+                break;
+            }
+        }
+    }
+
+    return iFound;
+}
+#endif
+
+/**
+ * @brief   Profiles the end of a loop, called before a blocking call.
+ */
+static void vProfileBlock( void )
+{
+    OSAL_TASK_MEMORY* pxMemory = pxFindCurrentTaskMemory();
+
+    if( NULL != pxMemory )
+    {
+        uint32_t ulLoopTicks = ( uint32_t )( xTaskGetTickCount() - pxMemory->xLastWakeTick );
+
+        pxMemory->ullAwakeTicks += ulLoopTicks;
+        if( ulLoopTicks > pxMemory->ulMaxLoopTicks )
+        {
+            pxMemory->ulMaxLoopTicks = ulLoopTicks;
+        }
+    }
+}
+
+/**
+ * @brief   Profiles a wakeup, called after a blocking call returns.
+ */
+static void vProfileWake( void )
+{
+    OSAL_TASK_MEMORY* pxMemory = pxFindCurrentTaskMemory();
+
+    if( NULL != pxMemory )
+    {
+        pxMemory->ulWakeups++;
+        pxMemory->xLastWakeTick = xTaskGetTickCount();
+    }
+}
+
 
 /*****************************************************************************/
 /* Debug stats functions                                                     */
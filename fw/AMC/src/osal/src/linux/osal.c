@@ -44,6 +44,10 @@
 /* Defines                                                                   */
 /*****************************************************************************/
 
+#ifndef OSAL_MAX_TASKS
+#define OSAL_MAX_TASKS                       ( 16 )
+#endif
+
 #define DEFAULT_TASK_PRIORITY                ( 5 )  
 #define MAX_TASK_NAME_LEN                    ( 30 )
 #define NULL_CHARACTER_LEN                   ( 1 )
@@ -70,6 +74,8 @@
 #define NANOSECONDS_TO_MILLISECONDS_FACTOR   1000000
 #define NANOSECONDS_TO_TICKS_FACTOR          10000000
 #define NANOSECONDS_TO_SECONDS_FACTOR        1000000000
+#define SECONDS_TO_MICROSECONDS_FACTOR       1000000
+#define NANOSECONDS_TO_MICROSECONDS_FACTOR   1000
 
 #define DEFAULT_OS_NAME                      ( "Linux" )
 
@@ -90,6 +96,7 @@ static pthread_mutex_t xMemAllocMutexHandle        = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t xCriticalSectionMutexHandle = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t xStrNCpyMutexHandle         = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t xMemCmpMutexHandle          = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t xTaskProfileMutexHandle     = PTHREAD_MUTEX_INITIALIZER;
 
 static int iOsStarted = FALSE;
 static uint32_t ulSemNo = 0;
@@ -123,6 +130,26 @@ typedef struct OSAL_MUTEX_STRUCT
 
 } OSAL_MUTEX_STRUCT;
 
+/**
+ * @struct  OSAL_TASK_PROFILE_SLOT
+ * @brief   Stores the profile of an OSAL Task, updated by the task itself
+ */
+typedef struct OSAL_TASK_PROFILE_SLOT
+{
+    int iInUse;
+    char cName[ OSAL_TASK_NAME_LEN ];
+    void ( *pvTaskFunction )( void* pvTaskParam );
+    void* pvTaskParam;
+    uint32_t ulStackSize;
+    uint64_t ullRunTimeUs;
+    uint64_t ullAwakeTimeUs;
+    uint64_t ullLastWakeUs;
+    uint64_t ullLastWakeCpuUs;
+    uint32_t ulWakeups;
+    uint32_t ulMaxLoopUs;
+
+} OSAL_TASK_PROFILE_SLOT;
+
 /**
  * @struct  OSAL_TASK_STRUCT
  * @brief   Stores the OSAL Task information
@@ -131,6 +158,7 @@ typedef struct OSAL_TASK_STRUCT
 {
     pthread_t xThread;
     pthread_mutex_t xMutex;
+    OSAL_TASK_PROFILE_SLOT* pxProfile;
 
 } OSAL_TASK_STRUCT;
 
@@ -190,6 +218,10 @@ typedef struct OSAL_TIMER_STRUCT
  */
 static struct timespec OSAL_GLOBAL_START_TIME = { 0 };
 
+/* Slots are never freed, so a task being deleted can still safely update its own */
+static OSAL_TASK_PROFILE_SLOT xTaskProfiles[ OSAL_MAX_TASKS ] = { { 0 } };
+static __thread OSAL_TASK_PROFILE_SLOT* pxCurrentTaskProfile = NULL;
+
 
 /*****************************************************************************/
 /* Function implementations                                                  */
@@ -203,6 +235,120 @@ static void vOSAL_InitUptime( void )
     clock_gettime( CLOCK_MONOTONIC, &OSAL_GLOBAL_START_TIME );
 }
 
+/**
+ * @brief   Reads a clock in microseconds.
+ */
+static uint64_t ullGetTimeUs( clockid_t xClock )
+{
+    struct timespec xNow = { 0 };
+    uint64_t ullTimeUs = 0;
+
+    if( OK == clock_gettime( xClock, &xNow ) )
+    {
+        ullTimeUs = ( ( uint64_t )xNow.tv_sec * SECONDS_TO_MICROSECONDS_FACTOR ) +
+                    ( ( uint64_t )xNow.tv_nsec / NANOSECONDS_TO_MICROSECONDS_FACTOR );
+    }
+
+    return ullTimeUs;
+}
+
+/**
+ * @brief   Entry point of a profiled task, binds the profile slot to the thread.
+ */
+static void* pvTaskEntry( void* pvArg )
+{
+    OSAL_TASK_PROFILE_SLOT* pxSlot = ( OSAL_TASK_PROFILE_SLOT* )pvArg;
+
+    pxCurrentTaskProfile = pxSlot;
+    pxSlot->ullLastWakeUs = ullGetTimeUs( CLOCK_MONOTONIC );
+    pxSlot->ullLastWakeCpuUs = ullGetTimeUs( CLOCK_THREAD_CPUTIME_ID );
+
+    pxSlot->pvTaskFunction( pxSlot->pvTaskParam );
+
+    return NULL;
+}
+
+/**
+ * @brief   Profiles the end of a loop, called before a blocking call.
+ */
+static void vProfileBlock( void )
+{
+    OSAL_TASK_PROFILE_SLOT* pxSlot = pxCurrentTaskProfile;
+
+    if( NULL != pxSlot )
+    {
+        uint64_t ullLoopUs = ullGetTimeUs( CLOCK_MONOTONIC ) - pxSlot->ullLastWakeUs;
+
+        pxSlot->ullRunTimeUs += ullGetTimeUs( CLOCK_THREAD_CPUTIME_ID ) - pxSlot->ullLastWakeCpuUs;
+        pxSlot->ullAwakeTimeUs += ullLoopUs;
+        if( ullLoopUs > pxSlot->ulMaxLoopUs )
+        {
+            pxSlot->ulMaxLoopUs = ( ullLoopUs > UINT32_MAX ) ? UINT32_MAX : ( uint32_t )ullLoopUs;
+        }
+    }
+}
+
+/**
+ * @brief   Profiles a wakeup, called after a blocking call returns.
+ */
+static void vProfileWake( void )
+{
+    OSAL_TASK_PROFILE_SLOT* pxSlot = pxCurrentTaskProfile;
+
+    if( NULL != pxSlot )
+    {
+        pxSlot->ulWakeups++;
+        pxSlot->ullLastWakeUs = ullGetTimeUs( CLOCK_MONOTONIC );
+        pxSlot->ullLastWakeCpuUs = ullGetTimeUs( CLOCK_THREAD_CPUTIME_ID );
+    }
+}
+
+/**
+ * @brief   Allocates a profile slot for a new task.
+ */
+static OSAL_TASK_PROFILE_SLOT* pxAllocateTaskProfile( void ( *pvTaskFunction )( void* pvTaskParam ),
+                                                      void*       pvTaskParam,
+                                                      uint32_t    ulStackSize,
+                                                      const char* pcTaskName )
+{
+    OSAL_TASK_PROFILE_SLOT* pxSlot = NULL;
+    int i = 0;
+
+    pthread_mutex_lock( &xTaskProfileMutexHandle );
+
+    for( i = 0; i < OSAL_MAX_TASKS; i++ )
+    {
+        if( FALSE == xTaskProfiles[ i ].iInUse )
+        {
+            pxSlot = &xTaskProfiles[ i ];
+            memset( pxSlot, 0, sizeof( *pxSlot ) );
+            strncpy( pxSlot->cName, pcTaskName, OSAL_TASK_NAME_LEN - NULL_CHARACTER_LEN );
+            pxSlot->pvTaskFunction = pvTaskFunction;
+            pxSlot->pvTaskParam = pvTaskParam;
+            pxSlot->ulStackSize = ulStackSize;
+            pxSlot->iInUse = TRUE;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock( &xTaskProfileMutexHandle );
+
+    return pxSlot;
+}
+
+/**
+ * @brief   Releases a task's profile slot.
+ */
+static void vReleaseTaskProfile( OSAL_TASK_PROFILE_SLOT* pxSlot )
+{
+    if( NULL != pxSlot )
+    {
+        pthread_mutex_lock( &xTaskProfileMutexHandle );
+        pxSlot->iInUse = FALSE;
+        pthread_mutex_unlock( &xTaskProfileMutexHandle );
+    }
+}
+
 /**
  * @brief   Wrapper for the Timer Callback function.
  */
@@ -290,6 +436,8 @@ int iOSAL_StartOS( int         iRoundRobinEnabled,
 
         if( NULL != pxTask )
         {
+            pxTask->pxProfile = NULL;
+
             /* Creating pthread attribute object */
             pthread_attr_t xAttr = { { 0 } };
             assert( OK == pthread_attr_init( &xAttr ) );
@@ -446,10 +594,21 @@ int iOSAL_Task_Create( void**      ppvTaskHandle,
             assert( OK == pthread_attr_setschedparam( &xAttr, &xParam ) );
             assert( OK == pthread_attr_setstacksize( &xAttr, usTaskStackSize ) );
 
+            /* Tasks beyond OSAL_MAX_TASKS still run, they are just not profiled */
+            void* ( *pvEntry )( void* ) = ( void* ( * )( void* ) )pvTaskFunction;
+            void* pvEntryParam = pvTaskParam;
+
+            pxTask->pxProfile = pxAllocateTaskProfile( pvTaskFunction, pvTaskParam, usTaskStackSize, pcTaskName );
+            if( NULL != pxTask->pxProfile )
+            {
+                pvEntry = pvTaskEntry;
+                pvEntryParam = ( void* )pxTask->pxProfile;
+            }
+
             if( OSAL_ERRORS_NONE == pthread_create( &pxTask->xThread,
                                         &xAttr,
-                                        ( void* )*pvTaskFunction,
-                                        pvTaskParam ) )
+                                        pvEntry,
+                                        pvEntryParam ) )
             {
                 *ppvTaskHandle = ( void* )pxTask;
                 assert( OK == pthread_attr_destroy( &xAttr ) );
@@ -460,6 +619,7 @@ int iOSAL_Task_Create( void**      ppvTaskHandle,
             {
                 /* The task was not created. */ 
                 iStatus = OSAL_ERRORS_OS_IMPLEMENTATION;
+                vReleaseTaskProfile( pxTask->pxProfile );
                 free( pxTask );
             }
         }
@@ -492,6 +652,7 @@ int iOSAL_Task_Delete( void** ppvTaskHandle )
             }
             else
             {
+                vReleaseTaskProfile( pxTask->pxProfile );
                 free( *ppvTaskHandle );
                 *ppvTaskHandle = NULL;
             }
@@ -530,7 +691,9 @@ int iOSAL_Task_SleepTicks( uint32_t ulSleepTicks )
     if( 0 < ulSleepTicks )
     {
         /* Convert ticks to microseconds */
+        vProfileBlock();
         usleep( ulSleepTicks * TICKS_TO_MICROSECONDS_FACTOR );
+        vProfileWake();
         iStatus = OSAL_ERRORS_NONE;
     }
 
@@ -549,7 +712,9 @@ int iOSAL_Task_SleepMs( uint32_t ulSleepMs )
     if( MINIMUM_TIMEOUT_MS <= ulSleepMs )
     {
         /* Convert milliseconds to microseconds */
+        vProfileBlock();
         usleep( ulSleepMs * MILLISECONDS_TO_MICROSECONDS_FACTOR );
+        vProfileWake();
         iStatus = OSAL_ERRORS_NONE;
     }
 
@@ -557,6 +722,76 @@ int iOSAL_Task_SleepMs( uint32_t ulSleepMs )
 }
 
 
+/**
+ * @brief   Get the profile of every task created with iOSAL_Task_Create.
+ */
+int iOSAL_Task_GetProfile( OSAL_TASK_PROFILE* pxProfiles, uint32_t* pulNumTasks )
+{
+    int iStatus = OSAL_ERRORS_PARAMS;
+
+    RETURN_IF_OS_NOT_STARTED;
+
+    if( ( NULL != pxProfiles ) &&
+        ( NULL != pulNumTasks ) )
+    {
+        uint32_t ulCount = 0;
+        int i = 0;
+
+        pthread_mutex_lock( &xTaskProfileMutexHandle );
+
+        for( i = 0; ( i < OSAL_MAX_TASKS ) && ( ulCount < *pulNumTasks ); i++ )
+        {
+            OSAL_TASK_PROFILE_SLOT* pxSlot = &xTaskProfiles[ i ];
+
+            if( TRUE == pxSlot->iInUse )
+            {
+                OSAL_TASK_PROFILE* pxProfile = &pxProfiles[ ulCount++ ];
+
+                memcpy( pxProfile->pcName, pxSlot->cName, OSAL_TASK_NAME_LEN );
+                pxProfile->ullRunTimeUs = pxSlot->ullRunTimeUs;
+                pxProfile->ullAwakeTimeUs = pxSlot->ullAwakeTimeUs;
+                pxProfile->ulWakeups = pxSlot->ulWakeups;
+                pxProfile->ulMaxLoopUs = pxSlot->ulMaxLoopUs;
+                pxProfile->ulStackSize = pxSlot->ulStackSize;
+                /* pthreads do not track stack usage */
+                pxProfile->ulStackHighWaterMark = 0;
+            }
+        }
+
+        pthread_mutex_unlock( &xTaskProfileMutexHandle );
+
+        *pulNumTasks = ulCount;
+        iStatus = OSAL_ERRORS_NONE;
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Clear the run time, awake time, wakeup and loop time counters of every task.
+ */
+int iOSAL_Task_ClearProfile( void )
+{
+    int i = 0;
+
+    RETURN_IF_OS_NOT_STARTED;
+
+    pthread_mutex_lock( &xTaskProfileMutexHandle );
+
+    for( i = 0; i < OSAL_MAX_TASKS; i++ )
+    {
+        xTaskProfiles[ i ].ullRunTimeUs = 0;
+        xTaskProfiles[ i ].ullAwakeTimeUs = 0;
+        xTaskProfiles[ i ].ulWakeups = 0;
+        xTaskProfiles[ i ].ulMaxLoopUs = 0;
+    }
+
+    pthread_mutex_unlock( &xTaskProfileMutexHandle );
+
+    return OSAL_ERRORS_NONE;
+}
+
+
 /*****************************************************************************/
 /* Semaphore APIs                                                            */
 /*****************************************************************************/
@@ -661,12 +896,11 @@ int iOSAL_Semaphore_Destroy( void** ppvSemHandle )
 }
 
 /**
- * @brief   Pends to / obtains a previously created semaphore, to which the handle refers. 
+ * @brief   Pends on a semaphore without profiling, for OSAL calls that profile themselves.
  */
-int iOSAL_Semaphore_Pend( void* pvSemHandle, uint32_t ulTimeoutMs )
+static int iSemaphorePend( void* pvSemHandle, uint32_t ulTimeoutMs )
 {
     int iStatus = OSAL_ERRORS_INVALID_HANDLE;
-    RETURN_IF_OS_NOT_STARTED;
 
     if( NULL != pvSemHandle )
     {
@@ -720,6 +954,29 @@ int iOSAL_Semaphore_Pend( void* pvSemHandle, uint32_t ulTimeoutMs )
     return iStatus;
 }
 
+/**
+ * @brief   Pends to / obtains a previously created semaphore, to which the handle refers. 
+ */
+int iOSAL_Semaphore_Pend( void* pvSemHandle, uint32_t ulTimeoutMs )
+{
+    int iStatus = OSAL_ERRORS_INVALID_HANDLE;
+    RETURN_IF_OS_NOT_STARTED;
+
+    /* A poll does not end the loop, as on FreeRTOS */
+    if( OSAL_TIMEOUT_NO_WAIT != ulTimeoutMs )
+    {
+        vProfileBlock();
+        iStatus = iSemaphorePend( pvSemHandle, ulTimeoutMs );
+        vProfileWake();
+    }
+    else
+    {
+        iStatus = iSemaphorePend( pvSemHandle, ulTimeoutMs );
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Posts / Releases a previously created semaphore, to which the handle refers. 
  */
@@ -1044,8 +1301,21 @@ int iOSAL_MBox_Pend( void *pvMBoxHandle, void *pvMBoxBuffer, uint32_t ulTimeoutM
         ( NULL != pvMBoxBuffer ) )
     {
         OSAL_MAILBOX *pxMailbox = ( OSAL_MAILBOX* )pvMBoxHandle;
+        int iReceived = OSAL_ERRORS_OS_IMPLEMENTATION;
 
-        if( ( OSAL_ERRORS_NONE == iOSAL_Semaphore_Pend( ( void* )pxMailbox->pxFull, ulTimeoutMs ) ) &&
+        /* A poll does not end the loop, as on FreeRTOS */
+        if( OSAL_TIMEOUT_NO_WAIT != ulTimeoutMs )
+        {
+            vProfileBlock();
+            iReceived = iSemaphorePend( ( void* )pxMailbox->pxFull, ulTimeoutMs );
+            vProfileWake();
+        }
+        else
+        {
+            iReceived = iSemaphorePend( ( void* )pxMailbox->pxFull, ulTimeoutMs );
+        }
+
+        if( ( OSAL_ERRORS_NONE == iReceived ) &&
             ( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( ( void* )pxMailbox->xMutex, ulTimeoutMs ) ) )
         {
             OSAL_MAILBOX_ITEM *pxMailboxItem = pxMailbox->pxHead;
@@ -1108,7 +1378,7 @@ int iOSAL_MBox_Post( void *pvMBoxHandle, void *pvMBoxItem, uint32_t ulTimeoutMs
             pvOSAL_MemCpy( pxNewMailboxItem->pvItem, pvMBoxItem, pxMailbox->ulItemSize );
             pxNewMailboxItem->pxNext = NULL;
 
-            if( ( OSAL_ERRORS_NONE == iOSAL_Semaphore_Pend( ( void* )pxMailbox->pxEmpty, ulTimeoutMs ) ) &&
+            if( ( OSAL_ERRORS_NONE == iSemaphorePend( ( void* )pxMailbox->pxEmpty, ulTimeoutMs ) ) &&
                 ( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( ( void* )pxMailbox->xMutex, ulTimeoutMs ) ) )
             {
                 if( pxMailbox->pxHead == NULL )
@@ -1257,6 +1527,11 @@ int iOSAL_EventFlag_Pend( void* pvEventFlagHandle, uint32_t ulFlagWait, uint32_t
             }
         }
 
+        if( OSAL_TIMEOUT_NO_WAIT != ulTimeoutMs )
+        {
+            vProfileBlock();
+        }
+
         if( OK == pthread_mutex_lock( &pxEvent->xMutex ) )
         {
             while( 0 == ( pxEvent->ulFlags & ulFlagWait ) )
@@ -1293,6 +1568,11 @@ int iOSAL_EventFlag_Pend( void* pvEventFlagHandle, uint32_t ulFlagWait, uint32_t
         {
             iStatus = OSAL_ERRORS_OS_IMPLEMENTATION;
         }
+
+        if( OSAL_TIMEOUT_NO_WAIT != ulTimeoutMs )
+        {
+            vProfileWake();
+        }
     }
 
     return iStatus;
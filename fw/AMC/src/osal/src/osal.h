@@ -31,6 +31,8 @@
 #define OSAL_TIMEOUT_WAIT_FOREVER  ( -1 )
 #define OSAL_TIMEOUT_TASK_WAIT_MS  ( 5  )
 #define OSAL_OS_NAME_LEN           ( 15 )
+#define OSAL_TASK_NAME_LEN         ( 16 )
+#define OSAL_TASK_PROFILE_MAX      ( 16 )     /* profiles that fit every task the OSAL can create */
 
 /*****************************************************************************/
 /* Enums                                                                     */
@@ -100,6 +102,30 @@ typedef enum _OSAL_STATS_TYPE
 
 } OSAL_STATS_TYPE;
 
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * @struct  OSAL_TASK_PROFILE
+ * @brief   Profile of a task created with iOSAL_Task_Create
+ *
+ * @note    A wakeup is a return from a blocking OSAL call (sleep or pend with a timeout),
+ *          and a loop is the time between a wakeup and the next blocking call.
+ *          Awake time is the sum of the loops, so it includes time the task was preempted.
+ */
+typedef struct OSAL_TASK_PROFILE
+{
+    char     pcName[ OSAL_TASK_NAME_LEN ];     /* task name, truncated and NULL terminated */
+    uint64_t ullRunTimeUs;                     /* CPU time spent running, 0 if the OS does not measure it */
+    uint64_t ullAwakeTimeUs;                   /* time spent in loops */
+    uint32_t ulWakeups;                        /* number of wakeups */
+    uint32_t ulMaxLoopUs;                      /* longest loop */
+    uint32_t ulStackSize;                      /* stack size in bytes */
+    uint32_t ulStackHighWaterMark;             /* peak stack usage in bytes, 0 if not known */
+
+} OSAL_TASK_PROFILE;
+
 /*****************************************************************************/
 /* Public APIs                                                               */
 /*****************************************************************************/
@@ -280,6 +306,29 @@ int iOSAL_Task_SleepTicks( uint32_t ulSleepTicks );
  */
 int iOSAL_Task_SleepMs( uint32_t ulSleepMs );
 
+/**
+ * @brief   Get the profile of every task created with iOSAL_Task_Create.
+ *
+ * @param   pxProfiles    Array to fill with one entry per task.
+ * @param   pulNumTasks   In: the number of entries in pxProfiles. Out: the number filled in.
+ *
+ * @return  OSAL_ERRORS_NONE                no errors, call was successful
+ *          OSAL_ERRORS_PARAMS              invalid parameters passed in to function
+ *          OSAL_ERRORS_OS_NOT_STARTED      OS has not been started
+ *
+ * @note    Tasks that do not fit in pxProfiles are left out.
+ */
+int iOSAL_Task_GetProfile( OSAL_TASK_PROFILE* pxProfiles, uint32_t* pulNumTasks );
+
+/**
+ * @brief   Clear the run time, awake time, wakeup and loop time counters of every task.
+ *
+ * @return  OSAL_ERRORS_NONE                no errors, call was successful
+ *          OSAL_ERRORS_OS_NOT_STARTED      OS has not been started
+ *
+ */
+int iOSAL_Task_ClearProfile( void );
+
 /*****************************************************************************/
 /* Semaphore APIs                                                            */
 /*****************************************************************************/
@@ -74,6 +74,12 @@
 #define HAL_PARTITION_TABLE_SIZE     ( 0x1000 )
 #define HAL_PARTITION_TABLE_MAGIC_NO ( 0x564D5230 )
 #define HAL_ENABLE_AMI_COMMS         ( 0x1 )
+#define HAL_STATUS_WORD_ENABLE       ( 0 )
+#define HAL_STATUS_WORD_HEARTBEAT    ( 1 )
+#define HAL_STATUS_WORD_HEALTH       ( 2 )
+#define HAL_STATUS_NUM_WORDS         ( 3 )
+#define HAL_AMC_HEALTH_OK            ( 0x0 )
+#define HAL_AMC_HEALTH_INIT_ERROR    ( 0x1 )
 #define HAL_GCQ_BASE_ADDR_SIZE       ( 0x110 )
 #define HAL_RPU_RING_BUFFER_LEN      ( 0x1000 )
 #define HAL_RPU_SHARED_MEMORY_SIZE   ( 0x7FFF000 )
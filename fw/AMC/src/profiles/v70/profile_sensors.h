@@ -50,6 +50,43 @@ static inline int iSYS_MON_WrappedReadTemperature( uint8_t unused1, uint8_t unus
 	return iSYS_MON_ReadTemperature( pfValue );
 }
 
+/**
+ * @brief   Wrapper for the iINA3221_ReadChannel function, reading all channels of the
+ *          device once per ASC sweep rather than once per sensor type
+ *
+ * @param   ucBusNum    I2C bus number
+ * @param   ucSlaveAddr I2C slave address
+ * @param   ppfValues   Values for each channel, indexed by ASC sensor type
+ * @param   pulTypeMask Set to the sensor types filled in
+ *
+ * @return  The return value of iINA3221_ReadChannel
+ */
+static inline int iINA3221_WrappedReadDevice( uint8_t ucBusNum, uint8_t ucSlaveAddr,
+                                              float ppfValues[ ASC_DEVICE_MAX_CHANNELS ][ MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ],
+                                              uint32_t *pulTypeMask )
+{
+	INA3221_CHANNEL_READING pxReadings[ INA3221_NUM_CHANNELS ] = { { 0 } };
+	int                     iStatus                            = ERROR;
+	int                     i                                  = 0;
+
+	*pulTypeMask = ASC_DEVICE_TYPE_MASK( ASC_PROXY_DRIVER_SENSOR_TYPE_VOLTAGE ) |
+	               ASC_DEVICE_TYPE_MASK( ASC_PROXY_DRIVER_SENSOR_TYPE_CURRENT ) |
+	               ASC_DEVICE_TYPE_MASK( ASC_PROXY_DRIVER_SENSOR_TYPE_POWER );
+
+	iStatus = iINA3221_ReadChannel( ucBusNum, ucSlaveAddr, INA3221_ALL_CHANNELS, pxReadings );
+	if( OK == iStatus )
+	{
+		for( i = 0; ( i < INA3221_NUM_CHANNELS ) && ( i < ASC_DEVICE_MAX_CHANNELS ); i++ )
+		{
+			ppfValues[ i ][ ASC_PROXY_DRIVER_SENSOR_TYPE_VOLTAGE ] = pxReadings[ i ].fVoltageInmV;
+			ppfValues[ i ][ ASC_PROXY_DRIVER_SENSOR_TYPE_CURRENT ] = pxReadings[ i ].fCurrentInmA;
+			ppfValues[ i ][ ASC_PROXY_DRIVER_SENSOR_TYPE_POWER ]   = pxReadings[ i ].fPowerInmW;
+		}
+	}
+
+	return iStatus;
+}
+
 /**
  * @brief   Function pointer called in profile to enable sensors
  *
@@ -71,21 +108,21 @@ ASC_PROXY_DRIVER_SENSOR_DATA PROFILE_SENSORS_SENSOR_DATA[ PROFILE_SENSORS_NUM_SE
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI },
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI },
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_NONE } },
-	  ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+	  ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
 	},
 	{ "3v3_pex", VR_3V3_PEX_DEVICE_ID, ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE | ASC_PROXY_DRIVER_SENSOR_BITFIELD_CURRENT | ASC_PROXY_DRIVER_SENSOR_BITFIELD_POWER, TRUE, 0x40, { ASC_SENSOR_I2C_BUS_INVALID, 1, 1, 1 }, iSensorIsEnabled, { NULL, iINA3221_ReadVoltage, iINA3221_ReadCurrent, iINA3221_ReadPower }, {
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_NONE },
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI },
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI },
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_NONE } },
-	  ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+	  ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
 	},
 	{ "3V3AUX", VR_3V3_AUX_DEVICE_ID, ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE, FALSE, 0x40, { ASC_SENSOR_I2C_BUS_INVALID, 2, ASC_SENSOR_I2C_BUS_INVALID, ASC_SENSOR_I2C_BUS_INVALID }, iSensorIsEnabled, { NULL, iINA3221_ReadVoltage, NULL, NULL }, {
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_NONE },
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI },
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI },
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_NONE } },
-	  ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+	  ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
 	},
 	{ "vccint", VR_VCCINT_DEVICE_ID, ASC_PROXY_DRIVER_SENSOR_BITFIELD_TEMPERATURE | ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE | ASC_PROXY_DRIVER_SENSOR_BITFIELD_CURRENT, FALSE, 0x60, { 0, 0, 0, ASC_SENSOR_I2C_BUS_INVALID }, iSensorIsEnabled, { iISL68221_ReadTemperature, iISL68221_ReadVoltage, iISL68221_ReadCurrent, NULL }, {
 		  { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT, ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED,  ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_NONE },
@@ -95,6 +95,43 @@ static inline int iSYS_MON_WrappedReadVoltage( uint8_t unused1, uint8_t unused2,
     return iSYS_MON_ReadVoltage( ucVType, pfValue );
 }
 
+/**
+ * @brief   Wrapper for the iINA3221_ReadChannel function, reading all channels of the
+ *          device once per ASC sweep rather than once per sensor type
+ *
+ * @param   ucBusNum    I2C bus number
+ * @param   ucSlaveAddr I2C slave address
+ * @param   ppfValues   Values for each channel, indexed by ASC sensor type
+ * @param   pulTypeMask Set to the sensor types filled in
+ *
+ * @return  The return value of iINA3221_ReadChannel
+ */
+static inline int iINA3221_WrappedReadDevice( uint8_t ucBusNum, uint8_t ucSlaveAddr,
+                                              float ppfValues[ ASC_DEVICE_MAX_CHANNELS ][ MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ],
+                                              uint32_t *pulTypeMask )
+{
+    INA3221_CHANNEL_READING pxReadings[ INA3221_NUM_CHANNELS ] = { { 0 } };
+    int                     iStatus                            = ERROR;
+    int                     i                                  = 0;
+
+    *pulTypeMask = ASC_DEVICE_TYPE_MASK( ASC_PROXY_DRIVER_SENSOR_TYPE_VOLTAGE ) |
+                   ASC_DEVICE_TYPE_MASK( ASC_PROXY_DRIVER_SENSOR_TYPE_CURRENT ) |
+                   ASC_DEVICE_TYPE_MASK( ASC_PROXY_DRIVER_SENSOR_TYPE_POWER );
+
+    iStatus = iINA3221_ReadChannel( ucBusNum, ucSlaveAddr, INA3221_ALL_CHANNELS, pxReadings );
+    if( OK == iStatus )
+    {
+        for( i = 0; ( i < INA3221_NUM_CHANNELS ) && ( i < ASC_DEVICE_MAX_CHANNELS ); i++ )
+        {
+            ppfValues[ i ][ ASC_PROXY_DRIVER_SENSOR_TYPE_VOLTAGE ] = pxReadings[ i ].fVoltageInmV;
+            ppfValues[ i ][ ASC_PROXY_DRIVER_SENSOR_TYPE_CURRENT ] = pxReadings[ i ].fCurrentInmA;
+            ppfValues[ i ][ ASC_PROXY_DRIVER_SENSOR_TYPE_POWER ]   = pxReadings[ i ].fPowerInmW;
+        }
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Function pointer called in profile to enable sensors that are used for V80 and V80P
  *
@@ -345,7 +382,7 @@ ASC_PROXY_DRIVER_SENSOR_DATA PROFILE_SENSORS_SENSOR_DATA[ PROFILE_SENSORS_NUM_SE
           { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL,
             ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT,
             ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED, ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI } },
-      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
     },
     { "12V_AUX2", VR_12V_AUX2_DEVICE_ID,
       ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE | ASC_PROXY_DRIVER_SENSOR_BITFIELD_CURRENT |
@@ -365,7 +402,7 @@ ASC_PROXY_DRIVER_SENSOR_DATA PROFILE_SENSORS_SENSOR_DATA[ PROFILE_SENSORS_NUM_SE
           { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL,
             ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT,
             ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED, ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI } },
-      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
     },
     { "1V2_VCCO_DIMM", VR_1V2_VCCO_DIMM_DEVICE_ID,
       ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE | ASC_PROXY_DRIVER_SENSOR_BITFIELD_CURRENT, FALSE, 0x41,
@@ -384,7 +421,7 @@ ASC_PROXY_DRIVER_SENSOR_DATA PROFILE_SENSORS_SENSOR_DATA[ PROFILE_SENSORS_NUM_SE
           { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL,
             ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT,
             ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED, ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI } },
-      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
     },
     { "3V3_PEX", VR_3V3_PEX_DEVICE_ID,
       ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE | ASC_PROXY_DRIVER_SENSOR_BITFIELD_CURRENT |
@@ -404,7 +441,7 @@ ASC_PROXY_DRIVER_SENSOR_DATA PROFILE_SENSORS_SENSOR_DATA[ PROFILE_SENSORS_NUM_SE
           { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL,
             ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT,
             ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED, ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI } },
-      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
     },
     { "12V_PEX", VR_12V_PEX_DEVICE_ID,
       ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE | ASC_PROXY_DRIVER_SENSOR_BITFIELD_CURRENT |
@@ -424,7 +461,7 @@ ASC_PROXY_DRIVER_SENSOR_DATA PROFILE_SENSORS_SENSOR_DATA[ PROFILE_SENSORS_NUM_SE
           { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL,
             ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT,
             ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED, ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI } },
-      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
     },
     { "3V3_QSFP", VR_3V3_QSFP_DEVICE_ID,
       ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE | ASC_PROXY_DRIVER_SENSOR_BITFIELD_CURRENT |
@@ -444,7 +481,7 @@ ASC_PROXY_DRIVER_SENSOR_DATA PROFILE_SENSORS_SENSOR_DATA[ PROFILE_SENSORS_NUM_SE
           { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL,
             ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, 0, 0, ASC_PROXY_DRIVER_SENSOR_STATUS_NOT_PRESENT,
             ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED, ASC_PROXY_DRIVER_SENSOR_UNIT_MOD_MILLI } },
-      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY
+      ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY, iINA3221_WrappedReadDevice
     },
     { "1V5_VCCAUX", VR_1V5_VCCAUX_DEVICE_ID, ASC_PROXY_DRIVER_SENSOR_BITFIELD_VOLTAGE, FALSE, 0,
       { ASC_SENSOR_I2C_BUS_INVALID, SYS_MON_VOLTAGES_VCCAUX, ASC_SENSOR_I2C_BUS_INVALID, ASC_SENSOR_I2C_BUS_INVALID },
@@ -67,6 +67,8 @@
     DO( AMI_PROXY_STATS_HEARTBEAT_MBOX_POST )          \
     DO( AMI_PROXY_STATS_EEPROM_RW_MBOX_POST )          \
     DO( AMI_PROXY_STATS_MODULE_RW_MBOX_POST )          \
+    DO( AMI_PROXY_STATS_MODULE_SG_MBOX_POST )          \
+    DO( AMI_PROXY_STATS_TASK_PROFILE_MBOX_POST )       \
     DO( AMI_PROXY_STATS_DEBUG_VERBOSITY_MBOX_PEND )    \
     DO( AMI_PROXY_STATS_PDI_DOWNLOAD_MBOX_PEND )       \
     DO( AMI_PROXY_STATS_PDI_COPY_MBOX_PEND )           \
@@ -76,6 +78,8 @@
     DO( AMI_PROXY_STATS_HEARTBEAT_MBOX_PEND )          \
     DO( AMI_PROXY_STATS_EEPROM_RW_MBOX_PEND )          \
     DO( AMI_PROXY_STATS_MODULE_RW_MBOX_PEND )          \
+    DO( AMI_PROXY_STATS_MODULE_SG_MBOX_PEND )          \
+    DO( AMI_PROXY_STATS_TASK_PROFILE_MBOX_PEND )       \
     DO( AMI_PROXY_STATS_GET_PDI_DOWNLOAD_REQUEST )     \
     DO( AMI_PROXY_STATS_GET_PDI_COPY_REQUEST )         \
     DO( AMI_PROXY_STATS_GET_SENSOR_REQUEST )           \
@@ -84,6 +88,8 @@
     DO( AMI_PROXY_STATS_GET_EEPROM_RW_REQUEST )        \
     DO( AMI_PROXY_STATS_STATUS_RETRIEVAL )             \
     DO( AMI_PROXY_STATS_GET_MODULE_RW_REQUEST )        \
+    DO( AMI_PROXY_STATS_GET_MODULE_SG_REQUEST )        \
+    DO( AMI_PROXY_STATS_GET_TASK_PROFILE_REQUEST )     \
     DO( AMI_PROXY_STATS_MAX )
 
 #define AMI_PROXY_ERRORS( DO )    \
@@ -94,12 +100,16 @@
     DO( AMI_PROXY_ERRORS_PDI_COPY_REQUEST )            \
     DO( AMI_PROXY_ERRORS_EEPROM_RW_REQUEST )           \
     DO( AMI_PROXY_ERRORS_MODULE_RW_REQUEST )           \
+    DO( AMI_PROXY_ERRORS_MODULE_SG_REQUEST )           \
+    DO( AMI_PROXY_ERRORS_TASK_PROFILE_REQUEST )        \
     DO( AMI_PROXY_ERRORS_DEBUG_VERBOSITY_REQUEST )     \
     DO( AMI_PROXY_ERRORS_GET_SENSOR_REQUEST )          \
     DO( AMI_PROXY_ERRORS_GET_BOOT_SELECT_REQUEST )     \
     DO( AMI_PROXY_ERRORS_GET_HEARTBEAT_REQUEST )       \
     DO( AMI_PROXY_ERRORS_GET_EEPROM_RW_REQUEST )       \
     DO( AMI_PROXY_ERRORS_GET_MODULE_RW_REQUEST )       \
+    DO( AMI_PROXY_ERRORS_GET_MODULE_SG_REQUEST )       \
+    DO( AMI_PROXY_ERRORS_GET_TASK_PROFILE_REQUEST )    \
     DO( AMI_PROXY_ERRORS_GET_DEBUG_VERBOSITY_REQUEST ) \
     DO( AMI_PROXY_RAISE_EVENT_PDI_DOWNLOAD_FAILED )    \
     DO( AMI_PROXY_RAISE_EVENT_PDI_COPY_FAILED )        \
@@ -109,6 +119,8 @@
     DO( AMI_PROXY_RAISE_EVENT_HEARTBEAT_FAILED )       \
     DO( AMI_PROXY_RAISE_EVENT_EEPROM_RW_FAILED )       \
     DO( AMI_PROXY_RAISE_EVENT_MODULE_RW_FAILED )       \
+    DO( AMI_PROXY_RAISE_EVENT_MODULE_SG_FAILED )       \
+    DO( AMI_PROXY_RAISE_EVENT_TASK_PROFILE_FAILED )    \
     DO( AMI_PROXY_RAISE_EVENT_DEBUG_VERBOSITY_FAILED ) \
     DO( AMI_PROXY_INIT_FW_IF_OPEN_FAILED )             \
     DO( AMI_PROXY_INIT_MUTEX_CREATE_FAILED )           \
@@ -156,6 +168,8 @@ typedef enum AMI_MSG_TYPES
     AMI_MSG_TYPE_EEPROM_RW_COMPLETE,
     AMI_MSG_TYPE_MODULE_RW_COMPLETE,
     AMI_MSG_TYPE_DEBUG_VERBOSITY_COMPLETE,
+    AMI_MSG_TYPE_MODULE_SG_COMPLETE,
+    AMI_MSG_TYPE_TASK_PROFILE_COMPLETE,
 
     MAX_AMI_MSG_TYPE
 
@@ -172,6 +186,9 @@ typedef enum AMI_CMD_OPCODE_REQ
     AMI_CMD_OPCODE_EEPROM_RW_REQ       = 0x3,
     AMI_CMD_OPCODE_MODULE_RW_REQ       = 0x4,
     AMI_CMD_OPCODE_DEBUG_VERBOSITY_REQ = 0x5,
+    AMI_CMD_OPCODE_EEPROM_BULK_RW_REQ  = 0x6,
+    AMI_CMD_OPCODE_MODULE_SG_RD_REQ    = 0x7,
+    AMI_CMD_OPCODE_TASK_PROFILE_REQ    = 0x8,
     AMI_CMD_OPCODE_PDI_DOWNLOAD_REQ    = 0xA,
     AMI_CMD_OPCODE_SENSOR_REQ          = 0xC,
     AMI_CMD_OPCODE_PDI_COPY_REQ        = 0xD,
@@ -231,6 +248,8 @@ typedef struct AMI_RX_DATA
         AMI_PROXY_BOOT_SELECT_REQUEST      xBootSelectRequest;
         AMI_PROXY_EEPROM_RW_REQUEST        xEepromReadWriteRequest;
         AMI_PROXY_MODULE_RW_REQUEST        xModuleReadWriteRequest;
+        AMI_PROXY_MODULE_SG_REQUEST        xModuleSgRequest;
+        AMI_PROXY_TASK_PROFILE_REQUEST     xTaskProfileRequest;
         uint8_t                            ucDebugVerbosityRequest;
     };
 
@@ -280,6 +299,7 @@ typedef struct AMI_MBOX_MSG
     {
         AMI_PROXY_IDENTITY_RESPONSE xIdentity;
         AMI_PROXY_HEARTBEAT_RESPONSE xHeartbeat;
+        AMI_PROXY_TASK_PROFILE_RESPONSE xTaskProfile;
     };
 
 } AMI_MBOX_MSG;
@@ -419,6 +439,20 @@ typedef struct AMI_CMD_EEPROM_PAYLOAD
 
 } AMI_CMD_EEPROM_PAYLOAD;
 
+/**
+ * @struct  AMI_CMD_EEPROM_BULK_PAYLOAD
+ * @brief   The bulk eeprom payload, 16-bit offset and 32-bit length
+ */
+typedef struct AMI_CMD_EEPROM_BULK_PAYLOAD
+{
+    uint64_t ullAddress;
+    uint32_t ulLen;
+    uint32_t ulOffset:16;
+    uint32_t ulReqType:1;
+    uint32_t ulReserved:15;
+
+} AMI_CMD_EEPROM_BULK_PAYLOAD;
+
 /**
  * @struct  AMI_CMD_MODULE_PAYLOAD
  * @brief   The module payload
@@ -435,6 +469,30 @@ typedef struct AMI_CMD_MODULE_PAYLOAD
 
 } AMI_CMD_MODULE_PAYLOAD;
 
+/**
+ * @struct  AMI_CMD_MODULE_SG_PAYLOAD
+ * @brief   The module scatter-gather read payload
+ */
+typedef struct AMI_CMD_MODULE_SG_PAYLOAD
+{
+    uint64_t ullAddress;
+    uint32_t ulLength;
+    uint32_t ulNumEntries:16;
+    uint32_t ulReserved:16;
+
+} AMI_CMD_MODULE_SG_PAYLOAD;
+
+/**
+ * @struct  AMI_CMD_TASK_PROFILE_PAYLOAD
+ * @brief   The task profile payload
+ */
+typedef struct AMI_CMD_TASK_PROFILE_PAYLOAD
+{
+    uint64_t ullAddress;
+    uint32_t ulLength;
+
+} AMI_CMD_TASK_PROFILE_PAYLOAD;
+
 /**
  * @struct  AMI_CMD_REQUEST
  * @brief   The request command header & payload
@@ -450,7 +508,10 @@ typedef struct AMI_CMD_REQUEST
         AMI_CMD_DATA_PAYLOAD xBootSelect;
         AMI_CMD_HEARTBEAT_PAYLOAD xHeartbeatPayload;
         AMI_CMD_EEPROM_PAYLOAD xEepromPayload;
+        AMI_CMD_EEPROM_BULK_PAYLOAD xEepromBulkPayload;
         AMI_CMD_MODULE_PAYLOAD xModulePayload;
+        AMI_CMD_MODULE_SG_PAYLOAD xModuleSgPayload;
+        AMI_CMD_TASK_PROFILE_PAYLOAD xTaskProfilePayload;
         uint8_t ucDebugVerbosityPayload;
     };
 
@@ -536,6 +597,26 @@ static int iHandleEepromRequest( AMI_CMD_REQUEST *pxCmdRequest );
  */
 static int iHandleModuleRequest( AMI_CMD_REQUEST *pxCmdRequest );
 
+/**
+ * @brief   Handle the module scatter-gather read request
+ *
+ * @param   pxCmdRequest The request details
+ *
+ * @return  OK/ERROR
+ *
+ */
+static int iHandleModuleScatterGatherRequest( AMI_CMD_REQUEST *pxCmdRequest );
+
+/**
+ * @brief   Handle the task profile request
+ *
+ * @param   pxCmdRequest The request details
+ *
+ * @return  OK/ERROR
+ *
+ */
+static int iHandleTaskProfileRequest( AMI_CMD_REQUEST *pxCmdRequest );
+
 /**
  * @brief   Handle the debug verbosity request
  *
@@ -915,6 +996,82 @@ int iAMI_SetModuleReadWriteCompleteResponse( EVL_SIGNAL *pxSignal, AMI_PROXY_RES
     return iStatus;
 }
 
+/**
+ * @brief   Set the module scatter-gather read response
+ */
+int iAMI_SetModuleScatterGatherCompleteResponse( EVL_SIGNAL *pxSignal, AMI_PROXY_RESULT xResult )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pxSignal ) )
+    {
+        AMI_MBOX_MSG xMsg = { 0 };
+        xMsg.ucRxDataIndex = pxSignal->ucInstance;
+        xMsg.eMsgType = AMI_MSG_TYPE_MODULE_SG_COMPLETE;
+        xMsg.xResult = xResult;
+        if( OSAL_ERRORS_NONE == iOSAL_MBox_Post( pxThis->pvOsalMBoxHdl,
+                                                 ( void* )&xMsg,
+                                                 OSAL_TIMEOUT_NO_WAIT ) )
+        {
+            INC_STAT_COUNTER( AMI_PROXY_STATS_MODULE_SG_MBOX_POST )
+            iStatus = OK;
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MAILBOX_POST_FAILED )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( AMI_PROXY_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Set the task profile response
+ */
+int iAMI_SetTaskProfileCompleteResponse( EVL_SIGNAL *pxSignal,
+                                         AMI_PROXY_RESULT xResult,
+                                         AMI_PROXY_TASK_PROFILE_RESPONSE *pxTaskProfileResponse )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pxSignal ) &&
+        ( NULL != pxTaskProfileResponse ) )
+    {
+        AMI_MBOX_MSG xMsg = { 0 };
+        xMsg.ucRxDataIndex = pxSignal->ucInstance;
+        xMsg.eMsgType = AMI_MSG_TYPE_TASK_PROFILE_COMPLETE;
+        xMsg.xResult = xResult;
+        pvOSAL_MemCpy( &xMsg.xTaskProfile, pxTaskProfileResponse, sizeof( xMsg.xTaskProfile ) );
+        if( OSAL_ERRORS_NONE == iOSAL_MBox_Post( pxThis->pvOsalMBoxHdl,
+                                                 ( void* )&xMsg,
+                                                 OSAL_TIMEOUT_NO_WAIT ) )
+        {
+            INC_STAT_COUNTER( AMI_PROXY_STATS_TASK_PROFILE_MBOX_POST )
+            iStatus = OK;
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MAILBOX_POST_FAILED )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( AMI_PROXY_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Set the debug verbosity response
  */
@@ -1250,7 +1407,8 @@ int iAMI_GetEepromReadWriteRequest( EVL_SIGNAL *pxSignal,
 
             if( AMI_CHECK_VALID_INDEX( ucIndex ) &&
                 ( TRUE == pxThis->xRxData[ ucIndex ].ucInUse ) &&
-                AMI_CMD_OPCODE_EEPROM_RW_REQ == pxThis->xRxData[ ucIndex ].xOpCode )
+                ( ( AMI_CMD_OPCODE_EEPROM_RW_REQ == pxThis->xRxData[ ucIndex ].xOpCode ) ||
+                  ( AMI_CMD_OPCODE_EEPROM_BULK_RW_REQ == pxThis->xRxData[ ucIndex ].xOpCode ) ) )
             {
                 pxEepromReadWriteRequest->xRequest =
                             pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.xRequest;
@@ -1363,6 +1521,134 @@ int iAMI_GetModuleReadWriteRequest( EVL_SIGNAL *pxSignal,
     return iStatus;
 }
 
+/**
+ * @brief   Get the module scatter-gather read request
+ */
+int iAMI_GetModuleScatterGatherRequest( EVL_SIGNAL *pxSignal,
+                                        AMI_PROXY_MODULE_SG_REQUEST *pxModuleSgRequest )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pxSignal ) &&
+        ( NULL != pxModuleSgRequest ) )
+    {
+        INC_STAT_COUNTER( AMI_PROXY_STATS_GET_MODULE_SG_REQUEST )
+
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                  OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            uint8_t ucIndex = pxSignal->ucInstance;
+
+            INC_STAT_COUNTER( AMI_PROXY_STATS_TAKE_MUTEX )
+
+            if( AMI_CHECK_VALID_INDEX( ucIndex ) &&
+                ( TRUE == pxThis->xRxData[ ucIndex ].ucInUse ) &&
+                ( AMI_CMD_OPCODE_MODULE_SG_RD_REQ == pxThis->xRxData[ ucIndex ].xOpCode ) )
+            {
+                pxModuleSgRequest->ullAddress =
+                            pxThis->xRxData[ ucIndex ].xModuleSgRequest.ullAddress;
+                pxModuleSgRequest->ulLength =
+                            pxThis->xRxData[ ucIndex ].xModuleSgRequest.ulLength;
+                pxModuleSgRequest->usNumEntries =
+                            pxThis->xRxData[ ucIndex ].xModuleSgRequest.usNumEntries;
+
+                iStatus = OK;
+            }
+            else
+            {
+                PLL_ERR( AMI_NAME, "Error invalid get module scatter-gather request for instance\r\n" );
+                INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MODULE_SG_REQUEST )
+            }
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( AMI_PROXY_STATS_RELEASE_MUTEX )
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( AMI_PROXY_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Get the task profile request
+ */
+int iAMI_GetTaskProfileRequest( EVL_SIGNAL *pxSignal,
+                                AMI_PROXY_TASK_PROFILE_REQUEST *pxTaskProfileRequest )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pxSignal ) &&
+        ( NULL != pxTaskProfileRequest ) )
+    {
+        INC_STAT_COUNTER( AMI_PROXY_STATS_GET_TASK_PROFILE_REQUEST )
+
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                  OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            uint8_t ucIndex = pxSignal->ucInstance;
+
+            INC_STAT_COUNTER( AMI_PROXY_STATS_TAKE_MUTEX )
+
+            if( AMI_CHECK_VALID_INDEX( ucIndex ) &&
+                ( TRUE == pxThis->xRxData[ ucIndex ].ucInUse ) &&
+                ( AMI_CMD_OPCODE_TASK_PROFILE_REQ == pxThis->xRxData[ ucIndex ].xOpCode ) )
+            {
+                pxTaskProfileRequest->ullAddress =
+                            pxThis->xRxData[ ucIndex ].xTaskProfileRequest.ullAddress;
+                pxTaskProfileRequest->ulLength =
+                            pxThis->xRxData[ ucIndex ].xTaskProfileRequest.ulLength;
+
+                iStatus = OK;
+            }
+            else
+            {
+                PLL_ERR( AMI_NAME, "Error invalid get task profile request for instance\r\n" );
+                INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_TASK_PROFILE_REQUEST )
+            }
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( AMI_PROXY_STATS_RELEASE_MUTEX )
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( AMI_PROXY_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Get the debug verbosity request
  */
@@ -1840,6 +2126,7 @@ static void vProxyDriverTask( void *pvArgs )
                     break;
                 }
                 case AMI_CMD_OPCODE_EEPROM_RW_REQ:
+                case AMI_CMD_OPCODE_EEPROM_BULK_RW_REQ:
                 {
                     iStatus = iHandleEepromRequest( &xCmdRequest );
                     if( ERROR == iStatus )
@@ -1857,6 +2144,24 @@ static void vProxyDriverTask( void *pvArgs )
                     }
                     break;
                 }
+                case AMI_CMD_OPCODE_MODULE_SG_RD_REQ:
+                {
+                    iStatus = iHandleModuleScatterGatherRequest( &xCmdRequest );
+                    if( ERROR == iStatus )
+                    {
+                        INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_GET_MODULE_SG_REQUEST )
+                    }
+                    break;
+                }
+                case AMI_CMD_OPCODE_TASK_PROFILE_REQ:
+                {
+                    iStatus = iHandleTaskProfileRequest( &xCmdRequest );
+                    if( ERROR == iStatus )
+                    {
+                        INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_GET_TASK_PROFILE_REQUEST )
+                    }
+                    break;
+                }
                 case AMI_CMD_OPCODE_DEBUG_VERBOSITY_REQ:
                 {
                     iStatus = iHandleDebugVerbosityRequest( &xCmdRequest );
@@ -1923,6 +2228,15 @@ static void vProxyDriverTask( void *pvArgs )
                 case AMI_MSG_TYPE_MODULE_RW_COMPLETE:
                     INC_STAT_COUNTER( AMI_PROXY_STATS_MODULE_RW_MBOX_PEND )
                     break;
+                case AMI_MSG_TYPE_MODULE_SG_COMPLETE:
+                    /* Per-entry results are returned in shared memory */
+                    INC_STAT_COUNTER( AMI_PROXY_STATS_MODULE_SG_MBOX_PEND )
+                    break;
+                case AMI_MSG_TYPE_TASK_PROFILE_COMPLETE:
+                    /* The profiles are returned in shared memory */
+                    INC_STAT_COUNTER( AMI_PROXY_STATS_TASK_PROFILE_MBOX_PEND )
+                    xCmdResponse.ulPayload[ 0 ] = xMBoxData.xTaskProfile.ulNumTasks;
+                    break;
                 case AMI_MSG_TYPE_DEBUG_VERBOSITY_COMPLETE:
                     INC_STAT_COUNTER( AMI_PROXY_STATS_DEBUG_VERBOSITY_MBOX_PEND )
                     break;
@@ -2117,14 +2431,28 @@ static int iHandleEepromRequest( AMI_CMD_REQUEST *pxCmdRequest )
             {
                 pxThis->xRxData[ ucIndex ].usCid = pxCmdRequest->xHdr.usCid;
                 pxThis->xRxData[ ucIndex ].xOpCode = pxCmdRequest->xHdr.ulOpCode;
-                pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.xRequest =
-                    pxCmdRequest->xEepromPayload.ucReqType;
-                pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ullAddress =
-                    pxCmdRequest->xEepromPayload.ullAddress;
-                pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ulLength =
-                    pxCmdRequest->xEepromPayload.ucLen;
-                pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ulOffset =
-                    pxCmdRequest->xEepromPayload.ucOffset;
+                if( AMI_CMD_OPCODE_EEPROM_BULK_RW_REQ == pxCmdRequest->xHdr.ulOpCode )
+                {
+                    pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.xRequest =
+                        pxCmdRequest->xEepromBulkPayload.ulReqType;
+                    pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ullAddress =
+                        pxCmdRequest->xEepromBulkPayload.ullAddress;
+                    pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ulLength =
+                        pxCmdRequest->xEepromBulkPayload.ulLen;
+                    pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ulOffset =
+                        pxCmdRequest->xEepromBulkPayload.ulOffset;
+                }
+                else
+                {
+                    pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.xRequest =
+                        pxCmdRequest->xEepromPayload.ucReqType;
+                    pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ullAddress =
+                        pxCmdRequest->xEepromPayload.ullAddress;
+                    pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ulLength =
+                        pxCmdRequest->xEepromPayload.ucLen;
+                    pxThis->xRxData[ ucIndex ].xEepromReadWriteRequest.ulOffset =
+                        pxCmdRequest->xEepromPayload.ucOffset;
+                }
                 pxThis->xRxData[ ucIndex ].ucInUse = TRUE;
             }
             else
@@ -2237,6 +2565,138 @@ static int iHandleModuleRequest( AMI_CMD_REQUEST *pxCmdRequest )
     return iStatus;
 }
 
+/**
+ * @brief   Handle the module scatter-gather read request
+ */
+static int iHandleModuleScatterGatherRequest( AMI_CMD_REQUEST *pxCmdRequest )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( NULL != pxCmdRequest ) &&
+        ( TRUE == pxThis->iInitialised ) )
+    {
+        uint8_t ucIndex = 0;
+
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                  OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            INC_STAT_COUNTER( AMI_PROXY_STATS_TAKE_MUTEX )
+
+            iStatus = iFindNextFreeRxDataIndex( &ucIndex );
+            if( ERROR != iStatus )
+            {
+                pxThis->xRxData[ ucIndex ].usCid = pxCmdRequest->xHdr.usCid;
+                pxThis->xRxData[ ucIndex ].xOpCode = pxCmdRequest->xHdr.ulOpCode;
+                pxThis->xRxData[ ucIndex ].xModuleSgRequest.ullAddress =
+                    pxCmdRequest->xModuleSgPayload.ullAddress;
+                pxThis->xRxData[ ucIndex ].xModuleSgRequest.ulLength =
+                    pxCmdRequest->xModuleSgPayload.ulLength;
+                pxThis->xRxData[ ucIndex ].xModuleSgRequest.usNumEntries =
+                    ( uint16_t )pxCmdRequest->xModuleSgPayload.ulNumEntries;
+                pxThis->xRxData[ ucIndex ].ucInUse = TRUE;
+            }
+            else
+            {
+                INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_RX_DATA_INDEX_FAILED )
+            }
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+            }
+
+            if( ERROR != iStatus )
+            {
+                INC_STAT_COUNTER( AMI_PROXY_STATS_RELEASE_MUTEX )
+                EVL_SIGNAL xNewSignal = { pxThis->ucMyId,
+                                          AMI_PROXY_DRIVER_E_MODULE_READ_SG,
+                                          ucIndex,
+                                          0 };
+                iStatus = iEVL_RaiseEvent( pxThis->pxEvlRecord, &xNewSignal );
+                if( ERROR == iStatus )
+                {
+                    PLL_ERR( AMI_NAME, "Error attempting to raise event 0x%x\r\n",
+                                 AMI_PROXY_DRIVER_E_MODULE_READ_SG );
+                    INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_RAISE_EVENT_MODULE_SG_FAILED )
+                }
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Handle the task profile request
+ */
+static int iHandleTaskProfileRequest( AMI_CMD_REQUEST *pxCmdRequest )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( NULL != pxCmdRequest ) &&
+        ( TRUE == pxThis->iInitialised ) )
+    {
+        uint8_t ucIndex = 0;
+
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                  OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            INC_STAT_COUNTER( AMI_PROXY_STATS_TAKE_MUTEX )
+
+            iStatus = iFindNextFreeRxDataIndex( &ucIndex );
+            if( ERROR != iStatus )
+            {
+                pxThis->xRxData[ ucIndex ].usCid = pxCmdRequest->xHdr.usCid;
+                pxThis->xRxData[ ucIndex ].xOpCode = pxCmdRequest->xHdr.ulOpCode;
+                pxThis->xRxData[ ucIndex ].xTaskProfileRequest.ullAddress =
+                    pxCmdRequest->xTaskProfilePayload.ullAddress;
+                pxThis->xRxData[ ucIndex ].xTaskProfileRequest.ulLength =
+                    pxCmdRequest->xTaskProfilePayload.ulLength;
+                pxThis->xRxData[ ucIndex ].ucInUse = TRUE;
+            }
+            else
+            {
+                INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_RX_DATA_INDEX_FAILED )
+            }
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+            }
+
+            if( ERROR != iStatus )
+            {
+                INC_STAT_COUNTER( AMI_PROXY_STATS_RELEASE_MUTEX )
+                EVL_SIGNAL xNewSignal = { pxThis->ucMyId,
+                                          AMI_PROXY_DRIVER_E_TASK_PROFILE,
+                                          ucIndex,
+                                          0 };
+                iStatus = iEVL_RaiseEvent( pxThis->pxEvlRecord, &xNewSignal );
+                if( ERROR == iStatus )
+                {
+                    PLL_ERR( AMI_NAME, "Error attempting to raise event 0x%x\r\n",
+                                 AMI_PROXY_DRIVER_E_TASK_PROFILE );
+                    INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_RAISE_EVENT_TASK_PROFILE_FAILED )
+                }
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( AMI_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Handle the debug verbosity request
  */
@@ -26,6 +26,8 @@
 
 #define AMI_PROXY_REQUEST_SIZE              ( 512 )
 #define AMI_PROXY_RESPONSE_SIZE             ( 16 )
+#define AMI_PROXY_MODULE_SG_MAX_ENTRIES     ( 64 )
+#define AMI_PROXY_TASK_NAME_LEN             ( 16 )
 
 
 /******************************************************************************/
@@ -47,6 +49,8 @@ typedef enum AMI_PROXY_DRIVER_EVENTS
     AMI_PROXY_DRIVER_E_EEPROM_READ_WRITE,
     AMI_PROXY_DRIVER_E_MODULE_READ_WRITE,
     AMI_PROXY_DRIVER_E_DEBUG_VERBOSITY,
+    AMI_PROXY_DRIVER_E_MODULE_READ_SG,
+    AMI_PROXY_DRIVER_E_TASK_PROFILE,
 
     MAX_AMI_PROXY_DRIVER_EVENTS
 
@@ -208,6 +212,66 @@ typedef struct AMI_PROXY_MODULE_RW_REQUEST
 
 } AMI_PROXY_MODULE_RW_REQUEST;
 
+/**
+ * @struct  AMI_PROXY_MODULE_SG_REQUEST
+ * @brief   Scatter-gather read from one or more QSFP modules
+ *
+ * @note    The shared memory at ullAddress holds usNumEntries AMI_PROXY_MODULE_SG_ENTRY
+ *          descriptors, followed by the data for each entry packed in descriptor order.
+ *          ulLength is the total size of the region.
+ */
+typedef struct AMI_PROXY_MODULE_SG_REQUEST
+{
+    uint64_t ullAddress;
+    uint32_t ulLength;
+    uint16_t usNumEntries;
+
+} AMI_PROXY_MODULE_SG_REQUEST;
+
+/**
+ * @struct  AMI_PROXY_MODULE_SG_ENTRY
+ * @brief   A single scatter-gather descriptor, as laid out in shared memory
+ */
+typedef struct AMI_PROXY_MODULE_SG_ENTRY
+{
+    uint8_t  ucExDeviceId;
+    uint8_t  ucPage;
+    uint8_t  ucByteOffset;
+    uint8_t  ucResult;      /* AMI_PROXY_RESULT, written back by the AMC */
+    uint16_t usLength;
+    uint16_t usReserved;
+
+} AMI_PROXY_MODULE_SG_ENTRY;
+
+/**
+ * @struct  AMI_PROXY_TASK_PROFILE_REQUEST
+ * @brief   Request for the profile of every AMC task
+ *
+ * @note    ulLength is the size of the shared memory region at ullAddress,
+ *          which is filled with AMI_PROXY_TASK_PROFILE_ENTRY records.
+ */
+typedef struct AMI_PROXY_TASK_PROFILE_REQUEST
+{
+    uint64_t ullAddress;
+    uint32_t ulLength;
+
+} AMI_PROXY_TASK_PROFILE_REQUEST;
+
+/**
+ * @struct  AMI_PROXY_TASK_PROFILE_ENTRY
+ * @brief   Profile of a single task, as laid out in shared memory
+ */
+typedef struct AMI_PROXY_TASK_PROFILE_ENTRY
+{
+    char     cName[ AMI_PROXY_TASK_NAME_LEN ];     /* NULL terminated */
+    uint64_t ullRunTimeUs;
+    uint32_t ulWakeups;
+    uint32_t ulMaxLoopUs;
+    uint32_t ulStackSize;
+    uint32_t ulStackHighWaterMark;
+
+} AMI_PROXY_TASK_PROFILE_ENTRY;
+
 /**
  * @struct  AMI_PROXY_IDENTITY_RESPONSE
  * @brief   Identity reponse
@@ -235,6 +299,16 @@ typedef struct AMI_PROXY_HEARTBEAT_RESPONSE
 
 } AMI_PROXY_HEARTBEAT_RESPONSE;
 
+/**
+ * @struct  AMI_PROXY_TASK_PROFILE_RESPONSE
+ * @brief   Task profile response
+ */
+typedef struct AMI_PROXY_TASK_PROFILE_RESPONSE
+{
+    uint32_t ulNumTasks;        /* entries written to shared memory */
+
+} AMI_PROXY_TASK_PROFILE_RESPONSE;
+
 
 /******************************************************************************/
 /* Function declarations                                                      */
@@ -352,6 +426,34 @@ int iAMI_SetEepromReadWriteCompleteResponse( EVL_SIGNAL *pxSignal, AMI_PROXY_RES
  */
 int iAMI_SetModuleReadWriteCompleteResponse( EVL_SIGNAL *pxSignal, AMI_PROXY_RESULT xResult );
 
+/**
+ * @brief   Set the response after the module scatter-gather read has completed
+ *
+ * @param   pxSignal    Current event occurance (used for tracking)
+ * @param   xResult     The result of the module scatter-gather request
+ *
+ * @return  OK          Data passed to proxy driver successfully
+ *          ERROR       Data not passed successfully
+ *
+ * @note    Per-entry results are returned in the shared memory descriptors,
+ *          xResult only reports whether the descriptor list was processed.
+ */
+int iAMI_SetModuleScatterGatherCompleteResponse( EVL_SIGNAL *pxSignal, AMI_PROXY_RESULT xResult );
+
+/**
+ * @brief   Set the response after the task profile request has completed
+ *
+ * @param   pxSignal                Current event occurance (used for tracking)
+ * @param   xResult                 The result of the task profile request
+ * @param   pxTaskProfileResponse   The number of entries written to shared memory
+ *
+ * @return  OK                      Data passed to proxy driver successfully
+ *          ERROR                   Data not passed successfully
+ */
+int iAMI_SetTaskProfileCompleteResponse( EVL_SIGNAL *pxSignal,
+                                         AMI_PROXY_RESULT xResult,
+                                         AMI_PROXY_TASK_PROFILE_RESPONSE *pxTaskProfileResponse );
+
 /**
  * @brief   Set the response after the debug verbosity request has completed
  *
@@ -438,6 +540,32 @@ int iAMI_GetEepromReadWriteRequest( EVL_SIGNAL *pxSignal,
 int iAMI_GetModuleReadWriteRequest( EVL_SIGNAL *pxSignal,
                                     AMI_PROXY_MODULE_RW_REQUEST *pxModuleReadWriteRequest );
 
+/**
+ * @brief   Get the module scatter-gather read request
+ *
+ * @param   pxSignal                    Current event occurance (used for tracking)
+ * @param   pxModuleSgRequest           Pointer to module scatter-gather request structure
+ *
+ * @return  OK                          Data retrieved from proxy driver successfully
+ *          ERROR                       Data not retrieved successfully
+ *
+ */
+int iAMI_GetModuleScatterGatherRequest( EVL_SIGNAL *pxSignal,
+                                        AMI_PROXY_MODULE_SG_REQUEST *pxModuleSgRequest );
+
+/**
+ * @brief   Get the task profile request
+ *
+ * @param   pxSignal                    Current event occurance (used for tracking)
+ * @param   pxTaskProfileRequest        Pointer to task profile request structure
+ *
+ * @return  OK                          Data retrieved from proxy driver successfully
+ *          ERROR                       Data not retrieved successfully
+ *
+ */
+int iAMI_GetTaskProfileRequest( EVL_SIGNAL *pxSignal,
+                                AMI_PROXY_TASK_PROFILE_REQUEST *pxTaskProfileRequest );
+
 /**
  * @brief   Get the debug verbosity request
  *
@@ -17,6 +17,7 @@
 #include "pll.h"
 #include "osal.h"
 #include "asc_proxy_driver.h"
+#include "asc_sensor_stats.h"
 
 
 /******************************************************************************/
@@ -28,6 +29,8 @@
 
 #define ASC_TASK_SLEEP_MS ( 100 )
 
+#define ASC_DEVICE_CACHE_SIZE ( 4 )                                            /* devices read with one call per sweep */
+
 #define ASC_NAME "ASC"
 
 /* Stat & Error definitions */
@@ -48,6 +51,12 @@
         DO( ASC_PROXY_GET_OPERATIONAL_STATE )                  \
         DO( ASC_PROXY_STATS_SET_OPERATIONAL_STATE_BY_ID )      \
         DO( ASC_PROXY_STATS_GET_OPERATIONAL_STATE_BY_ID )      \
+        DO( ASC_PROXY_STATS_SET_HYSTERESIS_BY_ID )             \
+        DO( ASC_PROXY_STATS_SET_EVENT_REPEAT_INTERVAL )        \
+        DO( ASC_PROXY_STATS_THRESHOLD_EVENT )                  \
+        DO( ASC_PROXY_STATS_SET_STATS_WINDOW )                 \
+        DO( ASC_PROXY_STATS_GET_SENSOR_STATS )                 \
+        DO( ASC_PROXY_STATS_DEVICE_READ )                      \
         DO( ASC_PROXY_STATS_MAX )
 
 #define ASC_PROXY_ERRORS( DO )                                  \
@@ -71,6 +80,10 @@
         DO( ASC_PROXY_ERRORS_SET_SENSOR_THRESHOLD_BY_ID )       \
         DO( ASC_PROXY_ERRORS_GET_OPERATIONAL_STATE_BY_ID )      \
         DO( ASC_PROXY_ERRORS_SET_OPERATIONAL_STATE_BY_ID )      \
+        DO( ASC_PROXY_ERRORS_SET_HYSTERESIS_BY_ID )             \
+        DO( ASC_PROXY_ERRORS_GET_SENSOR_STATS )                 \
+        DO( ASC_PROXY_ERRORS_DEVICE_READ )                      \
+        DO( ASC_PROXY_ERRORS_DEVICE_CACHE_FULL )                \
         DO( ASC_PROXY_ERRORS_MAX )
 
 #define PRINT_STAT_COUNTER( x )  PLL_INF( ASC_NAME,                 \
@@ -87,6 +100,7 @@
 #define INC_ERROR_COUNTER_WITH_STATE( x ) { pxThis->xState = MODULE_STATE_ERROR; INC_ERROR_COUNTER( x ) }
 #define SET_STAT_COUNTER( x, y )          { if( x < ASC_PROXY_ERRORS_MAX ) pxThis->pulStatCounters[ x ] = y; }
 #define ASC_ELAPSED_TIME_MS( x, y )       ( ( x - y ) / 10 );
+#define ASC_STATS_IDX( s, t )             ( ( ( s ) * MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ) + ( t ) )
 
 
 /******************************************************************************/
@@ -108,6 +122,20 @@ UTIL_MAKE_ENUM_AND_STRINGS( ASC_PROXY_ERRORS, ASC_PROXY_ERRORS, ASC_PROXY_ERRORS
 /******************************************************************************/
 /* Structures                                                                 */
 /******************************************************************************/
+/**
+ * @brief   Result of a device read, shared by all sensors at the address for one sweep
+ */
+typedef struct ASC_DEVICE_READING
+{
+    ASC_PROXY_DRIVER_READ_DEVICE_FUNC *pxReadDeviceFunc;
+    uint8_t                           ucSensorAddress;
+    int                               iStatus;
+    uint32_t                          ulLatencyMs;
+    uint32_t                          ulTypeMask;
+    float                             ppfValues[ ASC_DEVICE_MAX_CHANNELS ][ MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ];
+
+} ASC_DEVICE_READING;
+
 /**
  * @brief   Structure to hold ths proxy driver's private data
  */
@@ -126,6 +154,14 @@ typedef struct ASC_PRIVATE_DATA
     ASC_PROXY_DRIVER_SENSOR_DATA *pxSensorData;
     uint8_t                      ucNumSensors;
 
+    ASC_SENSOR_STATS             *pxSensorStats;
+    ASC_PROXY_DRIVER_STATS_WINDOW xStatsWindow;
+
+    uint32_t                     ulEventRepeatMs;
+
+    ASC_DEVICE_READING           pxDeviceReadings[ ASC_DEVICE_CACHE_SIZE ];
+    uint8_t                      ucNumDeviceReadings;
+
     uint32_t                     pulStatCounters[ ASC_PROXY_STATS_MAX ];
     uint32_t                     pulErrorCounters[ ASC_PROXY_ERRORS_MAX ];
 
@@ -150,6 +186,15 @@ static ASC_PRIVATE_DATA xLocalData =
     NULL,                                                                      /* pvOsalTaskHdl */
     NULL,                                                                      /* pxSensorData */
     0,                                                                         /* ucNumSensors */
+    NULL,                                                                      /* pxSensorStats */
+    ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME,                                    /* xStatsWindow */
+    0,                                                                         /* ulEventRepeatMs */
+    {
+        {
+            0
+        }
+    },                                                                         /* pxDeviceReadings */
+    0,                                                                         /* ucNumDeviceReadings */
     {
         0
     },                                                                         /* pulStatCounters */
@@ -176,6 +221,57 @@ static ASC_PRIVATE_DATA *pxThis = &xLocalData;
  */
 static void vProxyDriverTask( void *pvArgs );
 
+/**
+ * @brief   Gets the upper limit for a threshold level
+ *
+ * @param   pxReading   Pointer to the sensor reading
+ * @param   xLevel      Threshold level
+ *
+ * @return  The limit, or ASC_SENSOR_INVALID_VAL if the level has no limit
+ *
+ */
+static uint32_t ulGetUpperLimit( ASC_PROXY_DRIVER_SENSOR_READINGS *pxReading,
+                                 ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS xLevel );
+
+/**
+ * @brief   Gets the threshold level of a reading, applying its hysteresis
+ *
+ * @param   pxReading   Pointer to the sensor reading
+ *
+ * @return  The new threshold level
+ *
+ * @note    Rising through a limit takes effect immediately; a breached limit
+ *          is only cleared once the reading falls below it by ulHysteresis.
+ */
+static ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS xGetThresholdLevel( ASC_PROXY_DRIVER_SENSOR_READINGS *pxReading );
+
+/**
+ * @brief   Raise a threshold event if the threshold level of a reading has
+ *          changed, or the repeat interval has elapsed
+ *
+ * @param   pxReading   Pointer to the sensor reading
+ * @param   pxSignal    Pointer to the signal, with the instance and additional data set
+ * @param   ulNowMs     Current uptime in ms
+ *
+ * @return  N/A
+ *
+ * @note    The level and event time of the reading are only updated once the
+ *          event has been raised, so a failed raise is retried next sweep.
+ *
+ */
+static void vCheckThresholds( ASC_PROXY_DRIVER_SENSOR_READINGS *pxReading, EVL_SIGNAL *pxSignal, uint32_t ulNowMs );
+
+/**
+ * @brief   Get the device reading for a sensor, reading the device if it has
+ *          not already been read this sweep
+ *
+ * @param   pxSensor    Pointer to the sensor, with pxReadDeviceFunc set
+ *
+ * @return  The device reading, or NULL if there is no room to keep it
+ *
+ */
+static ASC_DEVICE_READING *pxGetDeviceReading( ASC_PROXY_DRIVER_SENSOR_DATA *pxSensor );
+
 
 /******************************************************************************/
 /* Public Function implementations                                            */
@@ -225,12 +321,24 @@ int iASC_Initialise( uint8_t ucProxyId,
                     ( ASC_PROXY_DRIVER_SENSOR_DATA * )pvOSAL_MemAlloc( sizeof ( ASC_PROXY_DRIVER_SENSOR_DATA ) *
                                                                        ucNumSensors );
 
-                if( NULL != pxThis->pxSensorData )
+                pxThis->pxSensorStats =
+                    ( ASC_SENSOR_STATS * )pvOSAL_MemAlloc( sizeof ( ASC_SENSOR_STATS ) * ucNumSensors *
+                                                           MAX_ASC_PROXY_DRIVER_SENSOR_TYPE );
+
+                if( ( NULL != pxThis->pxSensorData ) && ( NULL != pxThis->pxSensorStats ) )
                 {
+                    int i = 0;
+
                     pvOSAL_MemCpy( pxThis->pxSensorData,
                                    pxSensorData,
                                    sizeof( ASC_PROXY_DRIVER_SENSOR_DATA ) * ucNumSensors );
                     pxThis->ucNumSensors = ucNumSensors;
+
+                    for( i = 0; i < ( ucNumSensors * MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ); i++ )
+                    {
+                        iASC_StatsReset( &pxThis->pxSensorStats[ i ], pxThis->xStatsWindow );
+                    }
+
                     if( OSAL_ERRORS_NONE != iOSAL_Task_Create( &pxThis->pvOsalTaskHdl,
                                                                vProxyDriverTask,
                                                                ulTaskStack,
@@ -250,6 +358,10 @@ int iASC_Initialise( uint8_t ucProxyId,
                 }
                 else
                 {
+                    /* Either allocation may have succeeded on its own */
+                    vOSAL_MemFree( ( void** )&pxThis->pxSensorData );
+                    vOSAL_MemFree( ( void** )&pxThis->pxSensorStats );
+
                     PLL_ERR( ASC_NAME, "pvOSAL_MemAlloc failed\r\n" );
                     INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_MEM_ALLOC_FAILED )
                 }
@@ -322,6 +434,10 @@ int iASC_ResetAllSensorData( void )
                     pxThis->pxSensorData[ i ].pxReadings[ j ].ulMaxSensorValue         = 0;
                     pxThis->pxSensorData[ i ].pxReadings[ j ].xSensorOperationalStatus =
                         ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED;
+                    pxThis->pxSensorData[ i ].pxReadings[ j ].xThresholdLevel =
+                        ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY;
+                    pxThis->pxSensorData[ i ].pxReadings[ j ].ulLastEventMs = 0;
+                    iASC_StatsReset( &pxThis->pxSensorStats[ ASC_STATS_IDX( i, j ) ], pxThis->xStatsWindow );
                 }
             }
 
@@ -383,6 +499,10 @@ int iASC_ResetSingleSensorDataById( uint8_t ucId )
                         pxThis->pxSensorData[ i ].pxReadings[ j ].ulMaxSensorValue         = 0;
                         pxThis->pxSensorData[ i ].pxReadings[ j ].xSensorOperationalStatus =
                             ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED;
+                        pxThis->pxSensorData[ i ].pxReadings[ j ].xThresholdLevel =
+                            ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY;
+                        pxThis->pxSensorData[ i ].pxReadings[ j ].ulLastEventMs = 0;
+                        iASC_StatsReset( &pxThis->pxSensorStats[ ASC_STATS_IDX( i, j ) ], pxThis->xStatsWindow );
                     }
 
                     INC_STAT_COUNTER( ASC_PROXY_STATS_RESET_SINGLE_SENSOR_DATA_BY_ID );
@@ -451,6 +571,10 @@ int iASC_ResetSingleSensorDataByName( const char *pcName )
                         pxThis->pxSensorData[ i ].pxReadings[ j ].ulMaxSensorValue         = 0;
                         pxThis->pxSensorData[ i ].pxReadings[ j ].xSensorOperationalStatus =
                             ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS_ENABLED;
+                        pxThis->pxSensorData[ i ].pxReadings[ j ].xThresholdLevel =
+                            ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY;
+                        pxThis->pxSensorData[ i ].pxReadings[ j ].ulLastEventMs = 0;
+                        iASC_StatsReset( &pxThis->pxSensorStats[ ASC_STATS_IDX( i, j ) ], pxThis->xStatsWindow );
                     }
 
                     INC_STAT_COUNTER( ASC_PROXY_STATS_RESET_SINGLE_SENSOR_DATA_BY_NAME );
@@ -721,6 +845,196 @@ int iASC_SetSingleSensorThresholdStatusById( uint8_t ucId, ASC_PROXY_DRIVER_SENS
     return iStatus;
 }
 
+/**
+ * @brief   Sets the threshold hysteresis of a single sensor reading
+ */
+int iASC_SetSingleSensorHysteresisById( uint8_t ucId, uint8_t ucSensorType, uint32_t ulHysteresis )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( MAX_ASC_PROXY_DRIVER_SENSOR_TYPE > ucSensorType ) )
+    {
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl, OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            INC_STAT_COUNTER( ASC_PROXY_STATS_TAKE_MUTEX )
+
+            int i = 0;
+
+            for( i = 0; i < pxThis->ucNumSensors; i++ )
+            {
+                if( pxThis->pxSensorData[ i ].ucSensorId == ucId )
+                {
+                    pxThis->pxSensorData[ i ].pxReadings[ ucSensorType ].ulHysteresis = ulHysteresis;
+                    INC_STAT_COUNTER( ASC_PROXY_STATS_SET_HYSTERESIS_BY_ID )
+                    iStatus = OK;
+                    break;
+                }
+            }
+
+            if( ERROR == iStatus )
+            {
+                INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_SET_HYSTERESIS_BY_ID )
+            }
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( ASC_PROXY_STATS_RELEASE_MUTEX )
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( ASC_PROXY_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Sets the minimum interval between repeated threshold events
+ */
+int iASC_SetThresholdEventRepeatInterval( uint32_t ulIntervalMs )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) )
+    {
+        pxThis->ulEventRepeatMs = ulIntervalMs;
+        INC_STAT_COUNTER( ASC_PROXY_STATS_SET_EVENT_REPEAT_INTERVAL )
+        iStatus = OK;
+    }
+    else
+    {
+        INC_ERROR_COUNTER( ASC_PROXY_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Selects the window used for the mean of every sensor reading
+ */
+int iASC_SetSensorStatsWindow( ASC_PROXY_DRIVER_STATS_WINDOW xWindow )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( MAX_ASC_PROXY_DRIVER_STATS_WINDOW > xWindow ) )
+    {
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl, OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            INC_STAT_COUNTER( ASC_PROXY_STATS_TAKE_MUTEX )
+
+            int i = 0;
+
+            pxThis->xStatsWindow = xWindow;
+            for( i = 0; i < ( pxThis->ucNumSensors * MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ); i++ )
+            {
+                iASC_StatsReset( &pxThis->pxSensorStats[ i ], xWindow );
+            }
+
+            INC_STAT_COUNTER( ASC_PROXY_STATS_SET_STATS_WINDOW )
+            iStatus = OK;
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( ASC_PROXY_STATS_RELEASE_MUTEX )
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( ASC_PROXY_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Gets the statistics of a single sensor reading by ID
+ */
+int iASC_GetSensorStats( uint8_t ucId, uint8_t ucSensorType, ASC_PROXY_DRIVER_SENSOR_STATS *pxStats )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( MAX_ASC_PROXY_DRIVER_SENSOR_TYPE > ucSensorType ) &&
+        ( NULL != pxStats ) )
+    {
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl, OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            INC_STAT_COUNTER( ASC_PROXY_STATS_TAKE_MUTEX )
+
+            int i = 0;
+
+            for( i = 0; i < pxThis->ucNumSensors; i++ )
+            {
+                if( pxThis->pxSensorData[ i ].ucSensorId == ucId )
+                {
+                    iStatus = iASC_StatsGet( &pxThis->pxSensorStats[ ASC_STATS_IDX( i, ucSensorType ) ], pxStats );
+                    break;
+                }
+            }
+
+            if( OK == iStatus )
+            {
+                INC_STAT_COUNTER( ASC_PROXY_STATS_GET_SENSOR_STATS )
+            }
+            else
+            {
+                INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_GET_SENSOR_STATS )
+            }
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+                iStatus = ERROR;
+            }
+            else
+            {
+                INC_STAT_COUNTER( ASC_PROXY_STATS_RELEASE_MUTEX )
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+        }
+    }
+    else
+    {
+        INC_ERROR_COUNTER( ASC_PROXY_ERRORS_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Set single sensor operational state by ID
  */
@@ -964,16 +1278,8 @@ static void vProxyDriverTask( void *pvArgs )
         0
     };
 
-    int iNumberOfReadings[ pxThis->ucNumSensors ][ MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ];
-
-    pvOSAL_MemSet( iNumberOfReadings, 0, pxThis->ucNumSensors * sizeof( int ) * MAX_ASC_PROXY_DRIVER_SENSOR_TYPE );
-
-    uint32_t ulSumOfSensorValues[ pxThis->ucNumSensors ][ MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ];
-    pvOSAL_MemSet( ulSumOfSensorValues,
-                   0,
-                   pxThis->ucNumSensors * sizeof( uint32_t ) * MAX_ASC_PROXY_DRIVER_SENSOR_TYPE );
-
     uint32_t ulStartMs = 0;
+    uint32_t ulNowMs   = 0;
 
     FOREVER
     {
@@ -985,44 +1291,63 @@ static void vProxyDriverTask( void *pvArgs )
             int i = 0;
             int j = 0;
 
+            /* Devices are read at most once per sweep */
+            pxThis->ucNumDeviceReadings = 0;
+
             for( i = 0; i < pxThis->ucNumSensors; i++ )
             {
                 if( TRUE == pxThis->pxSensorData[ i ].pxSensorEnabled() )
                 {
+                    ASC_DEVICE_READING *pxDevice = NULL;
+
+                    if( NULL != pxThis->pxSensorData[ i ].pxReadDeviceFunc )
+                    {
+                        pxDevice = pxGetDeviceReading( &pxThis->pxSensorData[ i ] );
+                    }
+
                     for( j = 0; j < MAX_ASC_PROXY_DRIVER_SENSOR_TYPE; j++ )
                     {
                         if( NULL != pxThis->pxSensorData[ i ].ppxReadSensorFunc[ j ] )
                         {
-                            float fTempSensorVal = 0.0;
-
-                            if( OK == pxThis->pxSensorData[ i ].ppxReadSensorFunc[ j ]( ASC_SENSOR_I2C_BUS_NUM,
-                                                                                        pxThis->pxSensorData[ i ].
-                                                                                        ucSensorAddress,
-                                                                                        pxThis->pxSensorData[ i ].
-                                                                                        ucChannelNumber[ j ],
-                                                                                        &fTempSensorVal ) )
+                            float    fTempSensorVal = 0.0;
+                            uint32_t ulReadStartMs  = ulOSAL_GetUptimeMs();
+                            uint32_t ulLatencyMs    = 0;
+                            uint8_t  ucChannel      = pxThis->pxSensorData[ i ].ucChannelNumber[ j ];
+                            int      iReadStatus    = ERROR;
+
+                            /* Only types the device read filled in; the rest are read individually */
+                            if( ( NULL != pxDevice ) && ( ASC_DEVICE_MAX_CHANNELS > ucChannel ) &&
+                                ( 0 != ( pxDevice->ulTypeMask & ASC_DEVICE_TYPE_MASK( j ) ) ) )
+                            {
+                                iReadStatus    = pxDevice->iStatus;
+                                fTempSensorVal = pxDevice->ppfValues[ ucChannel ][ j ];
+                                ulLatencyMs    = pxDevice->ulLatencyMs;
+                            }
+                            else
                             {
+                                iReadStatus = pxThis->pxSensorData[ i ].ppxReadSensorFunc[ j ]( ASC_SENSOR_I2C_BUS_NUM,
+                                                                                               pxThis->pxSensorData[ i ].
+                                                                                               ucSensorAddress,
+                                                                                               ucChannel,
+                                                                                               &fTempSensorVal );
+                                ulLatencyMs = ulOSAL_GetUptimeMs() - ulReadStartMs;
+                            }
+
+                            if( OK == iReadStatus )
+                            {
+                                ASC_SENSOR_STATS              *pxStats = &pxThis->pxSensorStats[ ASC_STATS_IDX( i, j ) ];
+                                ASC_PROXY_DRIVER_SENSOR_STATS xResult  = { 0 };
+
                                 /* Assigning float to uint32_t sensor value */
                                 pxThis->pxSensorData[ i ].pxReadings[ j ].ulSensorValue = fTempSensorVal;
                                 pxThis->pxSensorData[ i ].pxReadings[ j ].xSensorStatus =
                                     ASC_PROXY_DRIVER_SENSOR_STATUS_PRESENT_AND_VALID;
 
-                                iNumberOfReadings[ i ][ j ]++;
-                                ulSumOfSensorValues[ i ][ j ] +=
-                                    pxThis->pxSensorData[ i ].pxReadings[ j ].ulSensorValue;
-
-                                pxThis->pxSensorData[ i ].pxReadings[ j ].ulAverageSensorValue =
-                                    ( pxThis->pxSensorData[ i ].pxReadings[ j ].ulAverageSensorValue
-                                      - ( pxThis->pxSensorData[ i ].pxReadings[ j ].ulAverageSensorValue /
-                                          iNumberOfReadings[ i ][ j ] )
-                                      + ( fTempSensorVal / iNumberOfReadings[ i ][ j ] ) );
-
-                                if( pxThis->pxSensorData[ i ].pxReadings[ j ].ulSensorValue >
-                                    pxThis->pxSensorData[ i ].pxReadings[ j ].ulMaxSensorValue )
-                                {
-                                    pxThis->pxSensorData[ i ].pxReadings[ j ].ulMaxSensorValue =
-                                        pxThis->pxSensorData[ i ].pxReadings[ j ].ulSensorValue;
-                                }
+                                /* Average and max are kept in fixed-point and rounded on the way out */
+                                iASC_StatsAddSample( pxStats, fTempSensorVal, ulLatencyMs );
+                                iASC_StatsGet( pxStats, &xResult );
+                                pxThis->pxSensorData[ i ].pxReadings[ j ].ulAverageSensorValue = xResult.ulMeanValue;
+                                pxThis->pxSensorData[ i ].pxReadings[ j ].ulMaxSensorValue     = xResult.ulMaxValue;
                             }
                             else
                             {
@@ -1042,7 +1367,9 @@ static void vProxyDriverTask( void *pvArgs )
             {
                 INC_STAT_COUNTER( ASC_PROXY_STATS_RELEASE_MUTEX )
 
-                /* Signal event if sensor reading exceeds thresholds */
+                /* Signal event if sensor reading moves between threshold levels */
+                ulNowMs = ulOSAL_GetUptimeMs();
+
                 for( i = 0; i < pxThis->ucNumSensors; i++ )
                 {
                     if( TRUE == pxThis->pxSensorData[ i ].pxSensorEnabled() )
@@ -1053,51 +1380,7 @@ static void vProxyDriverTask( void *pvArgs )
                         {
                             /* Record Sensor type in the event */
                             xNewSignal.ucAdditionalData = j;
-                            if( ( ASC_SENSOR_INVALID_VAL !=
-                                  pxThis->pxSensorData[ i ].pxReadings[ j ].ulUpperFatalLimit ) &&
-                                ( pxThis->pxSensorData[ i ].pxReadings[ j ].ulSensorValue >=
-                                  pxThis->pxSensorData[ i ].pxReadings[ j ].ulUpperFatalLimit ) )
-                            {
-                                xNewSignal.ucEventType = ASC_PROXY_DRIVER_E_SENSOR_UPPER_FATAL;
-
-                                if( ERROR == iEVL_RaiseEvent( pxThis->pxEvlRecord, &xNewSignal ) )
-                                {
-                                    PLL_ERR( ASC_NAME,
-                                             "Error attempting to raise event 0x%x\r\n",
-                                             ASC_PROXY_DRIVER_E_SENSOR_UPPER_FATAL );
-                                    INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_RAISE_EVENT_FAILED )
-                                }
-                            }
-                            else if( ( ASC_SENSOR_INVALID_VAL !=
-                                       pxThis->pxSensorData[ i ].pxReadings[ j ].ulUpperCriticalLimit ) &&
-                                     ( pxThis->pxSensorData[ i ].pxReadings[ j ].ulSensorValue >=
-                                       pxThis->pxSensorData[ i ].pxReadings[ j ].ulUpperCriticalLimit ) )
-                            {
-                                xNewSignal.ucEventType = ASC_PROXY_DRIVER_E_SENSOR_UPPER_CRITICAL;
-
-                                if( ERROR == iEVL_RaiseEvent( pxThis->pxEvlRecord, &xNewSignal ) )
-                                {
-                                    PLL_ERR( ASC_NAME,
-                                             "Error attempting to raise event 0x%x\r\n",
-                                             ASC_PROXY_DRIVER_E_SENSOR_UPPER_CRITICAL );
-                                    INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_RAISE_EVENT_FAILED )
-                                }
-                            }
-                            else if( ( ASC_SENSOR_INVALID_VAL !=
-                                       pxThis->pxSensorData[ i ].pxReadings[ j ].ulUpperWarningLimit ) &&
-                                     ( pxThis->pxSensorData[ i ].pxReadings[ j ].ulSensorValue >=
-                                       pxThis->pxSensorData[ i ].pxReadings[ j ].ulUpperWarningLimit ) )
-                            {
-                                xNewSignal.ucEventType = ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING;
-
-                                if( ERROR == iEVL_RaiseEvent( pxThis->pxEvlRecord, &xNewSignal ) )
-                                {
-                                    PLL_ERR( ASC_NAME,
-                                             "Error attempting to raise event 0x%x\r\n",
-                                             ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING );
-                                    INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_RAISE_EVENT_FAILED )
-                                }
-                            }
+                            vCheckThresholds( &pxThis->pxSensorData[ i ].pxReadings[ j ], &xNewSignal, ulNowMs );
                         }
                     }
                 }
@@ -1124,3 +1407,191 @@ static void vProxyDriverTask( void *pvArgs )
                                                                   iOSAL_Task_SleepMs( ASC_TASK_SLEEP_MS );
     }
 }
+
+/**
+ * @brief   Gets the upper limit for a threshold level
+ */
+static uint32_t ulGetUpperLimit( ASC_PROXY_DRIVER_SENSOR_READINGS *pxReading,
+                                 ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS xLevel )
+{
+    uint32_t ulLimit = ASC_SENSOR_INVALID_VAL;
+
+    if( NULL != pxReading )
+    {
+        switch( xLevel )
+        {
+        case ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_WARNING:
+            ulLimit = pxReading->ulUpperWarningLimit;
+            break;
+
+        case ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_CRITICAL:
+            ulLimit = pxReading->ulUpperCriticalLimit;
+            break;
+
+        case ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_FATAL:
+            ulLimit = pxReading->ulUpperFatalLimit;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return ulLimit;
+}
+
+/**
+ * @brief   Gets the threshold level of a reading, applying its hysteresis
+ */
+static ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS xGetThresholdLevel( ASC_PROXY_DRIVER_SENSOR_READINGS *pxReading )
+{
+    ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS xRawLevel = ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY;
+    ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS xLevel    = ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY;
+    uint32_t                                 ulLimit   = ASC_SENSOR_INVALID_VAL;
+
+    if( NULL != pxReading )
+    {
+        /* Highest limit the reading is currently at or above */
+        for( xLevel = ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_FATAL;
+             ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY < xLevel;
+             xLevel-- )
+        {
+            ulLimit = ulGetUpperLimit( pxReading, xLevel );
+            if( ( ASC_SENSOR_INVALID_VAL != ulLimit ) && ( pxReading->ulSensorValue >= ulLimit ) )
+            {
+                xRawLevel = xLevel;
+                break;
+            }
+        }
+
+        xLevel = pxReading->xThresholdLevel;
+
+        if( ( xRawLevel >= xLevel ) || ( MAX_ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS <= xLevel ) )
+        {
+            xLevel = xRawLevel;
+        }
+        else
+        {
+            /* Only drop out of a level once the reading is below its hysteresis band */
+            while( xRawLevel < xLevel )
+            {
+                ulLimit = ulGetUpperLimit( pxReading, xLevel );
+                if( ( ASC_SENSOR_INVALID_VAL != ulLimit ) &&
+                    ( pxReading->ulSensorValue >=
+                      ( ( ulLimit > pxReading->ulHysteresis ) ? ( ulLimit - pxReading->ulHysteresis ) : 0 ) ) )
+                {
+                    break;
+                }
+                xLevel--;
+            }
+        }
+    }
+
+    return xLevel;
+}
+
+/**
+ * @brief   Raise a threshold event if the threshold level of a reading has
+ *          changed, or the repeat interval has elapsed
+ */
+static void vCheckThresholds( ASC_PROXY_DRIVER_SENSOR_READINGS *pxReading, EVL_SIGNAL *pxSignal, uint32_t ulNowMs )
+{
+    static const uint8_t pucLevelEvents[ MAX_ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS ] =
+    {
+        ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED,  /* ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY */
+        ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING,  /* ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_WARNING */
+        ASC_PROXY_DRIVER_E_SENSOR_UPPER_CRITICAL, /* ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_CRITICAL */
+        ASC_PROXY_DRIVER_E_SENSOR_UPPER_FATAL     /* ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_FATAL */
+    };
+    ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS xLevel = ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY;
+    int iRaise = FALSE;
+
+    if( ( NULL != pxReading ) && ( NULL != pxSignal ) )
+    {
+        xLevel = xGetThresholdLevel( pxReading );
+
+        if( xLevel != pxReading->xThresholdLevel )
+        {
+            iRaise = TRUE;
+        }
+        else if( ( ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS_HEALTHY != xLevel ) &&
+                 ( 0 != pxThis->ulEventRepeatMs ) &&
+                 ( ( ulNowMs - pxReading->ulLastEventMs ) >= pxThis->ulEventRepeatMs ) )
+        {
+            iRaise = TRUE;
+        }
+
+        if( TRUE == iRaise )
+        {
+            pxSignal->ucEventType = pucLevelEvents[ xLevel ];
+
+            if( ERROR == iEVL_RaiseEvent( pxThis->pxEvlRecord, pxSignal ) )
+            {
+                /* Leave the level unchanged so the event is retried next sweep */
+                PLL_ERR( ASC_NAME, "Error attempting to raise event 0x%x\r\n", pxSignal->ucEventType );
+                INC_ERROR_COUNTER_WITH_STATE( ASC_PROXY_ERRORS_RAISE_EVENT_FAILED )
+            }
+            else
+            {
+                pxReading->xThresholdLevel = xLevel;
+                pxReading->ulLastEventMs   = ulNowMs;
+
+                INC_STAT_COUNTER( ASC_PROXY_STATS_THRESHOLD_EVENT )
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Get the device reading for a sensor, reading the device if it has
+ *          not already been read this sweep
+ */
+static ASC_DEVICE_READING *pxGetDeviceReading( ASC_PROXY_DRIVER_SENSOR_DATA *pxSensor )
+{
+    ASC_DEVICE_READING *pxDevice = NULL;
+    int                i         = 0;
+
+    if( NULL != pxSensor )
+    {
+        for( i = 0; i < pxThis->ucNumDeviceReadings; i++ )
+        {
+            if( ( pxSensor->pxReadDeviceFunc == pxThis->pxDeviceReadings[ i ].pxReadDeviceFunc ) &&
+                ( pxSensor->ucSensorAddress == pxThis->pxDeviceReadings[ i ].ucSensorAddress ) )
+            {
+                pxDevice = &pxThis->pxDeviceReadings[ i ];
+                break;
+            }
+        }
+
+        if( ( NULL == pxDevice ) && ( ASC_DEVICE_CACHE_SIZE > pxThis->ucNumDeviceReadings ) )
+        {
+            uint32_t ulReadStartMs = ulOSAL_GetUptimeMs();
+
+            pxDevice = &pxThis->pxDeviceReadings[ pxThis->ucNumDeviceReadings++ ];
+            pvOSAL_MemSet( pxDevice, 0, sizeof( ASC_DEVICE_READING ) );
+            pxDevice->pxReadDeviceFunc = pxSensor->pxReadDeviceFunc;
+            pxDevice->ucSensorAddress  = pxSensor->ucSensorAddress;
+            pxDevice->iStatus          = pxSensor->pxReadDeviceFunc( ASC_SENSOR_I2C_BUS_NUM,
+                                                                     pxSensor->ucSensorAddress,
+                                                                     pxDevice->ppfValues,
+                                                                     &pxDevice->ulTypeMask );
+            pxDevice->ulLatencyMs      = ulOSAL_GetUptimeMs() - ulReadStartMs;
+
+            if( OK == pxDevice->iStatus )
+            {
+                INC_STAT_COUNTER( ASC_PROXY_STATS_DEVICE_READ )
+            }
+            else
+            {
+                INC_ERROR_COUNTER( ASC_PROXY_ERRORS_DEVICE_READ )
+            }
+        }
+        else if( NULL == pxDevice )
+        {
+            /* Fall back to reading each sensor type individually */
+            INC_ERROR_COUNTER( ASC_PROXY_ERRORS_DEVICE_CACHE_FULL )
+        }
+    }
+
+    return pxDevice;
+}
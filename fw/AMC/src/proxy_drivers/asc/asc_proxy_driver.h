@@ -31,6 +31,14 @@
 #define ASC_SENSOR_I2C_BUS_NUM     ( 0 )
 #define ASC_SENSOR_I2C_BUS_INVALID ( -1 )
 
+#define ASC_STATS_FRAC_BITS        ( 8 )    /* fractional bits of fixed-point statistics */
+#define ASC_STATS_EWMA_SHIFT       ( 3 )    /* EWMA weight of each new sample is 1/2^n */
+#define ASC_STATS_RING_LEN         ( 8 )    /* samples in the ring window */
+#define ASC_STATS_LATENCY_BUCKETS  ( 8 )    /* 0ms, 1ms, 2-3ms, 4-7ms ... >= 64ms */
+
+#define ASC_DEVICE_MAX_CHANNELS    ( 3 )    /* channels returned by a device read */
+#define ASC_DEVICE_TYPE_MASK( t )  ( 1u << ( t ) )  /* sensor type bit in a device read mask */
+
 
 /******************************************************************************/
 /* Enums                                                                      */
@@ -54,6 +62,7 @@ typedef enum ASC_PROXY_DRIVER_EVENTS
     ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING,
     ASC_PROXY_DRIVER_E_SENSOR_UPPER_CRITICAL,
     ASC_PROXY_DRIVER_E_SENSOR_UPPER_FATAL,
+    ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED,
     MAX_ASC_PROXY_DRIVER_EVENTS
 
 } ASC_PROXY_DRIVER_EVENTS;
@@ -142,6 +151,19 @@ typedef enum ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS
 
 } ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS;
 
+/**
+ * @enum    ASC_PROXY_DRIVER_STATS_WINDOW
+ * @brief   Window used to calculate the mean sensor value
+ */
+typedef enum ASC_PROXY_DRIVER_STATS_WINDOW
+{
+    ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME = 0,   /* mean of every sample since the last reset */
+    ASC_PROXY_DRIVER_STATS_WINDOW_EWMA,           /* exponentially weighted moving average */
+    ASC_PROXY_DRIVER_STATS_WINDOW_RING,           /* mean of the last ASC_STATS_RING_LEN samples */
+    MAX_ASC_PROXY_DRIVER_STATS_WINDOW
+
+} ASC_PROXY_DRIVER_STATS_WINDOW;
+
 
 /******************************************************************************/
 /* Typedefs                                                                   */
@@ -156,6 +178,21 @@ typedef int ( ASC_PROXY_DRIVER_READ_SENSOR_FUNC ) ( uint8_t ucBusNum,
                                                     uint8_t ucChannelNum,
                                                     float *pfValue );
 
+/**
+ * @typedef  ASC_PROXY_DRIVER_READ_DEVICE_FUNC
+ * @brief    Function definition for reading every channel of a device at once
+ *
+ * @note     ppfValues is indexed by channel number then sensor type. The
+ *           function sets ASC_DEVICE_TYPE_MASK( type ) in pulTypeMask for each
+ *           sensor type it provides, even if the read fails, so those types
+ *           share its status. Other types are read with ppxReadSensorFunc.
+ */
+typedef int ( ASC_PROXY_DRIVER_READ_DEVICE_FUNC ) ( uint8_t ucBusNum,
+                                                    uint8_t ucSlaveAddr,
+                                                    float ppfValues[ ASC_DEVICE_MAX_CHANNELS ]
+                                                                   [ MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ],
+                                                    uint32_t *pulTypeMask );
+
 /**
  * @typedef  ASC_PROXY_DRIVER_ENABLE_SENSOR_FUNC
  *
@@ -191,6 +228,10 @@ typedef struct ASC_PROXY_DRIVER_SENSOR_READINGS
     ASC_PROXY_DRIVER_SENSOR_OPERATIONAL_STATUS xSensorOperationalStatus;
     ASC_PROXY_DRIVER_SENSOR_UNIT_MOD           xSensorUnitModifier;
 
+    uint32_t                                   ulHysteresis;     /* band below a limit before it is cleared */
+    ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS   xThresholdLevel;  /* last threshold level an event was raised for */
+    uint32_t                                   ulLastEventMs;    /* uptime of the last threshold event */
+
 } ASC_PROXY_DRIVER_SENSOR_READINGS;
 
 /**
@@ -215,8 +256,32 @@ typedef struct ASC_PROXY_DRIVER_SENSOR_DATA
 
     ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS ulThresholdStatus;
 
+    /*
+     * Optional - if set, all sensors at this address are read with one call per
+     * sweep instead of one ppxReadSensorFunc call each
+     */
+    ASC_PROXY_DRIVER_READ_DEVICE_FUNC        *pxReadDeviceFunc;
+
 } ASC_PROXY_DRIVER_SENSOR_DATA;
 
+/**
+ * @struct  ASC_PROXY_DRIVER_SENSOR_STATS
+ * @brief   Statistics of a single sensor reading
+ */
+typedef struct ASC_PROXY_DRIVER_SENSOR_STATS
+{
+    ASC_PROXY_DRIVER_STATS_WINDOW xWindow;
+    uint64_t                      ullSampleCount;
+
+    uint32_t                      ulMinValue;
+    uint32_t                      ulMaxValue;
+    uint32_t                      ulMeanValue;
+    uint64_t                      ullMeanFixed;     /* mean with ASC_STATS_FRAC_BITS fractional bits */
+
+    uint32_t                      pulLatencyHistogram[ ASC_STATS_LATENCY_BUCKETS ];
+
+} ASC_PROXY_DRIVER_SENSOR_STATS;
+
 
 /******************************************************************************/
 /* Function declarations                                                      */
@@ -341,6 +406,66 @@ int iASC_GetSingleSensorDataByName( const char *pcName, ASC_PROXY_DRIVER_SENSOR_
  */
 int iASC_SetSingleSensorThresholdStatusById( uint8_t ucId, ASC_PROXY_DRIVER_SENSOR_THRESHOLD_STATUS xStatus );
 
+/**
+ * @brief   Sets the threshold hysteresis of a single sensor reading
+ *
+ * @param   ucId            Sensor ID
+ * @param   ucSensorType    The sensor type
+ * @param   ulHysteresis    Amount the reading must fall below a breached limit
+ *                          before the limit is considered cleared
+ *
+ * @return  OK          Hysteresis set successfully
+ *          ERROR       Hysteresis not set
+ *
+ * @note    Threshold events are edge-triggered - they are only raised when a
+ *          reading moves between the healthy, warning, critical and fatal bands.
+ */
+int iASC_SetSingleSensorHysteresisById( uint8_t ucId, uint8_t ucSensorType, uint32_t ulHysteresis );
+
+/**
+ * @brief   Sets the minimum interval between repeated threshold events
+ *
+ * @param   ulIntervalMs    Interval in ms after which the event for a breached
+ *                          threshold is raised again, 0 to only raise events
+ *                          on threshold transitions
+ *
+ * @return  OK          Interval set successfully
+ *          ERROR       Interval not set
+ */
+int iASC_SetThresholdEventRepeatInterval( uint32_t ulIntervalMs );
+
+/**
+ * @brief   Selects the window used for the mean of every sensor reading
+ *
+ * @param   xWindow     Lifetime (the default), EWMA or ring of the last
+ *                      ASC_STATS_RING_LEN samples
+ *
+ * @return  OK          Window set successfully
+ *          ERROR       Window not set
+ *
+ * @note    Changing the window clears the statistics of all sensors. The
+ *          window also sets the ulAverageSensorValue reported to the host,
+ *          which is the lifetime mean unless another window is selected.
+ */
+int iASC_SetSensorStatsWindow( ASC_PROXY_DRIVER_STATS_WINDOW xWindow );
+
+/**
+ * @brief   Gets the statistics of a single sensor reading by ID
+ *
+ * @param   ucId            Sensor ID
+ * @param   ucSensorType    Sensor type (ASC_PROXY_DRIVER_SENSOR_TYPE)
+ * @param   pxStats         Pointer to the statistics to populate
+ *
+ * @return  OK          Statistics retrieved successfully
+ *          ERROR       Statistics not retrieved
+ *
+ * @note    The ulAverageSensorValue and ulMaxSensorValue of the reading are
+ *          the rounded mean and max of these statistics. ASDM appends the
+ *          min, sample count and latency histogram to its single sensor
+ *          response.
+ */
+int iASC_GetSensorStats( uint8_t ucId, uint8_t ucSensorType, ASC_PROXY_DRIVER_SENSOR_STATS *pxStats );
+
 /**
  * @brief   Set single sensor operational state by ID
  *
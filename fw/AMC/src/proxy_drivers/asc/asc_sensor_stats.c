@@ -0,0 +1,268 @@
+/**
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains the fixed-point sensor statistics used by the
+ * Alveo Sensor Control (ASC) proxy driver
+ *
+ * @file asc_sensor_stats.c
+ *
+ */
+
+
+/******************************************************************************/
+/* Includes                                                                   */
+/******************************************************************************/
+
+#include "asc_sensor_stats.h"
+
+
+/******************************************************************************/
+/* Defines                                                                    */
+/******************************************************************************/
+
+#define ASC_STATS_FIXED_HALF    ( ASC_STATS_FIXED_ONE >> 1 )
+
+
+/******************************************************************************/
+/* Local Function declarations                                                */
+/******************************************************************************/
+
+/**
+ * @brief   Converts a sensor value to fixed-point
+ *
+ * @param   fValue      Sensor value
+ *
+ * @return  The value with ASC_STATS_FRAC_BITS fractional bits, clamped to
+ *          the range 0 - UINT32_MAX
+ */
+static uint64_t ullToFixed( float fValue );
+
+/**
+ * @brief   Rounds a fixed-point value to the nearest integer
+ *
+ * @param   ullFixed    Fixed-point value, no greater than ASC_STATS_FIXED_MAX
+ *
+ * @return  The rounded value
+ */
+static uint32_t ulFromFixed( uint64_t ullFixed );
+
+/**
+ * @brief   Gets the latency histogram bucket for a sample
+ *
+ * @param   ulLatencyMs     Time taken to read the sample
+ *
+ * @return  0 for 0ms, otherwise 1 + log2( ulLatencyMs ), up to
+ *          ASC_STATS_LATENCY_BUCKETS - 1
+ */
+static uint8_t ucGetLatencyBucket( uint32_t ulLatencyMs );
+
+
+/******************************************************************************/
+/* Public Function implementations                                            */
+/******************************************************************************/
+
+/**
+ * @brief   Clears a set of sensor statistics
+ */
+int iASC_StatsReset( ASC_SENSOR_STATS *pxStats, ASC_PROXY_DRIVER_STATS_WINDOW xWindow )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pxStats ) &&
+        ( MAX_ASC_PROXY_DRIVER_STATS_WINDOW > xWindow ) )
+    {
+        memset( pxStats, 0, sizeof( ASC_SENSOR_STATS ) );
+        pxStats->xWindow = xWindow;
+        iStatus          = OK;
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Adds a sample to a set of sensor statistics
+ */
+int iASC_StatsAddSample( ASC_SENSOR_STATS *pxStats, float fValue, uint32_t ulLatencyMs )
+{
+    int iStatus = ERROR;
+
+    if( NULL != pxStats )
+    {
+        uint64_t ullSample = ullToFixed( fValue );
+        uint8_t  ucBucket  = ucGetLatencyBucket( ulLatencyMs );
+
+        if( 0 == pxStats->ullSampleCount )
+        {
+            pxStats->ullMin  = ullSample;
+            pxStats->ullMax  = ullSample;
+            pxStats->ullEwma = ullSample;
+        }
+        else
+        {
+            if( ullSample < pxStats->ullMin )
+            {
+                pxStats->ullMin = ullSample;
+            }
+            if( ullSample > pxStats->ullMax )
+            {
+                pxStats->ullMax = ullSample;
+            }
+
+            /* Move the average 1/2^n of the way towards the sample */
+            if( ullSample >= pxStats->ullEwma )
+            {
+                pxStats->ullEwma += ( ullSample - pxStats->ullEwma ) >> ASC_STATS_EWMA_SHIFT;
+            }
+            else
+            {
+                pxStats->ullEwma -= ( pxStats->ullEwma - ullSample ) >> ASC_STATS_EWMA_SHIFT;
+            }
+        }
+
+        /* Halve the lifetime count and scale the sum to keep the mean, rather than let the sum wrap */
+        if( ( UINT64_MAX - pxStats->ullLifetimeSum ) < ullSample )
+        {
+            uint64_t ullQuotient  = pxStats->ullLifetimeSum / pxStats->ullLifetimeCount;
+            uint64_t ullRemainder = pxStats->ullLifetimeSum % pxStats->ullLifetimeCount;
+
+            pxStats->ullLifetimeCount >>= 1;
+            pxStats->ullLifetimeSum     = ( ullQuotient * pxStats->ullLifetimeCount ) + ( ullRemainder >> 1 );
+        }
+        pxStats->ullLifetimeSum += ullSample;
+        pxStats->ullLifetimeCount++;
+
+        /* Replace the oldest sample in the ring, the sum only ever holds ASC_STATS_RING_LEN samples */
+        if( ASC_STATS_RING_LEN <= pxStats->ucRingCount )
+        {
+            pxStats->ullRingSum -= pxStats->pullRing[ pxStats->ucRingHead ];
+        }
+        else
+        {
+            pxStats->ucRingCount++;
+        }
+        pxStats->pullRing[ pxStats->ucRingHead ] = ullSample;
+        pxStats->ullRingSum                     += ullSample;
+        pxStats->ucRingHead                      = ( pxStats->ucRingHead + 1 ) % ASC_STATS_RING_LEN;
+
+        if( UINT64_MAX != pxStats->ullSampleCount )
+        {
+            pxStats->ullSampleCount++;
+        }
+        if( UINT32_MAX != pxStats->pulLatencyHistogram[ ucBucket ] )
+        {
+            pxStats->pulLatencyHistogram[ ucBucket ]++;
+        }
+
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Gets the min, max and mean of a set of sensor statistics
+ */
+int iASC_StatsGet( const ASC_SENSOR_STATS *pxStats, ASC_PROXY_DRIVER_SENSOR_STATS *pxResult )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pxStats ) &&
+        ( NULL != pxResult ) )
+    {
+        uint64_t ullMean = 0;
+
+        switch( pxStats->xWindow )
+        {
+        case ASC_PROXY_DRIVER_STATS_WINDOW_EWMA:
+            ullMean = pxStats->ullEwma;
+            break;
+
+        case ASC_PROXY_DRIVER_STATS_WINDOW_RING:
+            if( 0 != pxStats->ucRingCount )
+            {
+                ullMean = ( pxStats->ullRingSum + ( pxStats->ucRingCount / 2 ) ) / pxStats->ucRingCount;
+            }
+            break;
+
+        case ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME:
+        default:
+            if( 0 != pxStats->ullLifetimeCount )
+            {
+                uint64_t ullRemainder = pxStats->ullLifetimeSum % pxStats->ullLifetimeCount;
+
+                /* Round to nearest without adding to a sum that may be close to wrapping */
+                ullMean = pxStats->ullLifetimeSum / pxStats->ullLifetimeCount;
+                if( ullRemainder >= ( pxStats->ullLifetimeCount - ullRemainder ) )
+                {
+                    ullMean++;
+                }
+            }
+            break;
+        }
+
+        pxResult->xWindow        = pxStats->xWindow;
+        pxResult->ullSampleCount = pxStats->ullSampleCount;
+        pxResult->ulMinValue     = ulFromFixed( pxStats->ullMin );
+        pxResult->ulMaxValue     = ulFromFixed( pxStats->ullMax );
+        pxResult->ulMeanValue    = ulFromFixed( ullMean );
+        pxResult->ullMeanFixed   = ullMean;
+        memcpy( pxResult->pulLatencyHistogram,
+                pxStats->pulLatencyHistogram,
+                sizeof( pxResult->pulLatencyHistogram ) );
+
+        iStatus = OK;
+    }
+
+    return iStatus;
+}
+
+
+/******************************************************************************/
+/* Local Function implementations                                             */
+/******************************************************************************/
+
+/**
+ * @brief   Converts a sensor value to fixed-point
+ */
+static uint64_t ullToFixed( float fValue )
+{
+    uint64_t ullFixed = 0;
+
+    if( fValue >= ( float )UINT32_MAX )
+    {
+        ullFixed = ASC_STATS_FIXED_MAX;
+    }
+    else if( fValue > 0.0f )
+    {
+        ullFixed = ( uint64_t )( fValue * ( float )ASC_STATS_FIXED_ONE + 0.5f );
+    }
+
+    return ullFixed;
+}
+
+/**
+ * @brief   Rounds a fixed-point value to the nearest integer
+ */
+static uint32_t ulFromFixed( uint64_t ullFixed )
+{
+    uint64_t ullValue = ( ullFixed + ASC_STATS_FIXED_HALF ) >> ASC_STATS_FRAC_BITS;
+
+    return ( UINT32_MAX < ullValue ) ? UINT32_MAX : ( uint32_t )ullValue;
+}
+
+/**
+ * @brief   Gets the latency histogram bucket for a sample
+ */
+static uint8_t ucGetLatencyBucket( uint32_t ulLatencyMs )
+{
+    uint8_t ucBucket = 0;
+
+    while( ( 0 != ulLatencyMs ) && ( ( ASC_STATS_LATENCY_BUCKETS - 1 ) > ucBucket ) )
+    {
+        ulLatencyMs >>= 1;
+        ucBucket++;
+    }
+
+    return ucBucket;
+}
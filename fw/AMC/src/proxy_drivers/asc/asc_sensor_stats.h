@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains the fixed-point sensor statistics used by the
+ * Alveo Sensor Control (ASC) proxy driver
+ *
+ * @file asc_sensor_stats.h
+ *
+ */
+
+#ifndef _ASC_SENSOR_STATS_H_
+#define _ASC_SENSOR_STATS_H_
+
+/******************************************************************************/
+/* Includes                                                                   */
+/******************************************************************************/
+
+#include "standard.h"
+#include "asc_proxy_driver.h"
+
+
+/******************************************************************************/
+/* Defines                                                                    */
+/******************************************************************************/
+
+#define ASC_STATS_FIXED_ONE     ( 1ULL << ASC_STATS_FRAC_BITS )
+#define ASC_STATS_FIXED_MAX     ( ( uint64_t )UINT32_MAX << ASC_STATS_FRAC_BITS )
+
+
+/******************************************************************************/
+/* Structs                                                                    */
+/******************************************************************************/
+
+/**
+ * @struct  ASC_SENSOR_STATS
+ * @brief   Running statistics of a single sensor reading
+ *
+ * @note    All values are unsigned fixed-point with ASC_STATS_FRAC_BITS
+ *          fractional bits. The ring sum holds at most ASC_STATS_RING_LEN
+ *          samples and the sample count is 64-bit, so none of them wrap.
+ *          The lifetime count is halved, and the sum scaled to match,
+ *          before the sum would wrap.
+ */
+typedef struct ASC_SENSOR_STATS
+{
+    ASC_PROXY_DRIVER_STATS_WINDOW xWindow;
+    uint64_t                      ullSampleCount;
+
+    uint64_t                      ullMin;
+    uint64_t                      ullMax;
+    uint64_t                      ullEwma;
+
+    uint64_t                      ullLifetimeSum;
+    uint64_t                      ullLifetimeCount;
+
+    uint64_t                      pullRing[ ASC_STATS_RING_LEN ];
+    uint64_t                      ullRingSum;
+    uint8_t                       ucRingHead;
+    uint8_t                       ucRingCount;
+
+    uint32_t                      pulLatencyHistogram[ ASC_STATS_LATENCY_BUCKETS ];
+
+} ASC_SENSOR_STATS;
+
+
+/******************************************************************************/
+/* Function declarations                                                      */
+/******************************************************************************/
+
+/**
+ * @brief   Clears a set of sensor statistics
+ *
+ * @param   pxStats     Pointer to the statistics
+ * @param   xWindow     Window used to calculate the mean
+ *
+ * @return  OK          Statistics cleared
+ *          ERROR       Invalid arguments
+ */
+int iASC_StatsReset( ASC_SENSOR_STATS *pxStats, ASC_PROXY_DRIVER_STATS_WINDOW xWindow );
+
+/**
+ * @brief   Adds a sample to a set of sensor statistics
+ *
+ * @param   pxStats         Pointer to the statistics
+ * @param   fValue          Sensor value read (negative values are clamped to 0)
+ * @param   ulLatencyMs     Time taken to read the sensor value
+ *
+ * @return  OK          Sample added
+ *          ERROR       Invalid arguments
+ */
+int iASC_StatsAddSample( ASC_SENSOR_STATS *pxStats, float fValue, uint32_t ulLatencyMs );
+
+/**
+ * @brief   Gets the min, max and mean of a set of sensor statistics
+ *
+ * @param   pxStats     Pointer to the statistics
+ * @param   pxResult    Pointer to the result to populate
+ *
+ * @return  OK          Result populated
+ *          ERROR       Invalid arguments
+ */
+int iASC_StatsGet( const ASC_SENSOR_STATS *pxStats, ASC_PROXY_DRIVER_SENSOR_STATS *pxResult );
+
+#endif
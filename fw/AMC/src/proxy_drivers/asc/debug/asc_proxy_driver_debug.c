@@ -103,6 +103,34 @@ static void vResetSingleSensorById( void );
  */
 static void vResetSingleSensorByName( void );
 
+/**
+ * @brief   Debug function to set the threshold hysteresis of a single sensor by its ID
+ *
+ * @return  N/A
+ */
+static void vSetHysteresisById( void );
+
+/**
+ * @brief   Debug function to set the minimum interval between repeated threshold events
+ *
+ * @return  N/A
+ */
+static void vSetEventRepeatInterval( void );
+
+/**
+ * @brief   Debug function to select the window used for sensor mean values
+ *
+ * @return  N/A
+ */
+static void vSetStatsWindow( void );
+
+/**
+ * @brief   Debug function to display the statistics of a single sensor reading by ID
+ *
+ * @return  N/A
+ */
+static void vGetSensorStats( void );
+
 /***** Helper functions *****/
 
 /**
@@ -135,6 +163,11 @@ static const char *pcTypeStrings[ MAX_ASC_PROXY_DRIVER_SENSOR_TYPE ] =
     "Temperature", "Voltage", "Current", "Power"
 };
 
+static const char *pcWindowStrings[ MAX_ASC_PROXY_DRIVER_STATS_WINDOW ] =
+{
+    "Lifetime", "EWMA", "Ring"
+};
+
 static const char *pcStatusStrings[ MAX_ASC_PROXY_DRIVER_SENSOR_STATUS ] =
 {
     "Not present", "Present and valid", "No data", "Not available"
@@ -179,12 +212,16 @@ void vASC_DebugInit( DAL_HDL pxParentHandle )
                 pxDAL_NewDebugFunction( "reset_all_sensors",    pxSetDir, vResetAllSensors );
                 pxDAL_NewDebugFunction( "reset_sensor_by_id",   pxSetDir, vResetSingleSensorById );
                 pxDAL_NewDebugFunction( "reset_sensor_by_name", pxSetDir, vResetSingleSensorByName );
+                pxDAL_NewDebugFunction( "set_hysteresis_by_id", pxSetDir, vSetHysteresisById );
+                pxDAL_NewDebugFunction( "set_event_repeat_ms",  pxSetDir, vSetEventRepeatInterval );
+                pxDAL_NewDebugFunction( "set_stats_window",     pxSetDir, vSetStatsWindow );
             }
             if( NULL != pxGetDir )
             {
                 pxDAL_NewDebugFunction( "get_all_sensors",    pxGetDir, vGetAllSensors );
                 pxDAL_NewDebugFunction( "get_sensor_by_id",   pxGetDir, vGetSingleSensorById );
                 pxDAL_NewDebugFunction( "get_sensor_by_name", pxGetDir, vGetSingleSensorByName );
+                pxDAL_NewDebugFunction( "get_sensor_stats",   pxGetDir, vGetSensorStats );
             }
         }
 
@@ -265,6 +302,82 @@ static void vResetSingleSensorById( void )
     }
 }
 
+/**
+ * @brief   Debug function to set the threshold hysteresis of a single sensor by its ID
+ */
+static void vSetHysteresisById( void )
+{
+    int iId         = 0;
+    int iType       = 0;
+    int iHysteresis = 0;
+
+    if( OK != iDAL_GetIntInRange( "Enter sensor ID:", &iId, 0, UTIL_MAX_UINT8 ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error retrieving sensor ID\r\n" );
+    }
+    else if( OK != iDAL_GetIntInRange( "Enter sensor type:", &iType, 0, MAX_ASC_PROXY_DRIVER_SENSOR_TYPE - 1 ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error retrieving sensor type\r\n" );
+    }
+    else if( OK != iDAL_GetIntInRange( "Enter hysteresis:", &iHysteresis, 0, UTIL_MAX_UINT16 ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error retrieving hysteresis\r\n" );
+    }
+    else if( OK != iASC_SetSingleSensorHysteresisById( ( uint8_t )iId, ( uint8_t )iType, ( uint32_t )iHysteresis ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error setting sensor %d hysteresis\r\n", iId );
+    }
+    else
+    {
+        PLL_DAL( ASC_DBG_NAME, "Sensor %d %s hysteresis set to %d\r\n", iId, pcTypeStrings[ iType ], iHysteresis );
+    }
+}
+
+/**
+ * @brief   Debug function to set the minimum interval between repeated threshold events
+ */
+static void vSetEventRepeatInterval( void )
+{
+    int iIntervalMs = 0;
+
+    if( OK != iDAL_GetIntInRange( "Enter repeat interval in ms (0 to disable):", &iIntervalMs, 0, UTIL_MAX_UINT16 ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error retrieving interval\r\n" );
+    }
+    else if( OK != iASC_SetThresholdEventRepeatInterval( ( uint32_t )iIntervalMs ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error setting repeat interval\r\n" );
+    }
+    else
+    {
+        PLL_DAL( ASC_DBG_NAME, "Threshold event repeat interval set to %dms\r\n", iIntervalMs );
+    }
+}
+
+/**
+ * @brief   Debug function to select the window used for sensor mean values
+ */
+static void vSetStatsWindow( void )
+{
+    int iWindow = 0;
+
+    if( OK != iDAL_GetIntInRange( "Enter stats window (0 = lifetime, 1 = EWMA, 2 = ring):",
+                                  &iWindow,
+                                  0,
+                                  MAX_ASC_PROXY_DRIVER_STATS_WINDOW - 1 ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error retrieving stats window\r\n" );
+    }
+    else if( OK != iASC_SetSensorStatsWindow( ( ASC_PROXY_DRIVER_STATS_WINDOW )iWindow ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error setting stats window\r\n" );
+    }
+    else
+    {
+        PLL_DAL( ASC_DBG_NAME, "Stats window set to %s\r\n", pcWindowStrings[ iWindow ] );
+    }
+}
+
 /**
  * @brief   Debug function to reset a single sensor by its name
  */
@@ -401,6 +514,49 @@ static int iTestCallback( EVL_SIGNAL *pxSignal )
     return iStatus;
 }
 
+/**
+ * @brief   Debug function to display the statistics of a single sensor reading by ID
+ */
+static void vGetSensorStats( void )
+{
+    ASC_PROXY_DRIVER_SENSOR_STATS xStats = { 0 };
+    int iId   = 0;
+    int iType = 0;
+
+    if( OK != iDAL_GetIntInRange( "Enter sensor ID:", &iId, 0, UTIL_MAX_UINT8 ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error retrieving sensor ID\r\n" );
+    }
+    else if( OK != iDAL_GetIntInRange( "Enter sensor type:", &iType, 0, MAX_ASC_PROXY_DRIVER_SENSOR_TYPE - 1 ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error retrieving sensor type\r\n" );
+    }
+    else if( OK != iASC_GetSensorStats( ( uint8_t )iId, ( uint8_t )iType, &xStats ) )
+    {
+        PLL_DAL( ASC_DBG_NAME, "Error retrieving sensor %d stats\r\n", iId );
+    }
+    else
+    {
+        int i = 0;
+
+        PLL_DAL( ASC_DBG_NAME, "Sensor %d %s\r\n", iId, pcTypeStrings[ iType ] );
+        PLL_DAL( ASC_DBG_NAME, "- Window . . . . . . . . . . . . . %s\r\n", pcWindowStrings[ xStats.xWindow ] );
+        PLL_DAL( ASC_DBG_NAME, "- Samples. . . . . . . . . . . . . 0x%08X%08X\r\n",
+                 ( uint32_t )( xStats.ullSampleCount >> 32 ), ( uint32_t )xStats.ullSampleCount );
+        PLL_DAL( ASC_DBG_NAME, "- Min. . . . . . . . . . . . . . . %u\r\n", xStats.ulMinValue );
+        PLL_DAL( ASC_DBG_NAME, "- Max. . . . . . . . . . . . . . . %u\r\n", xStats.ulMaxValue );
+        PLL_DAL( ASC_DBG_NAME, "- Mean . . . . . . . . . . . . . . %u (%u.%03u)\r\n",
+                 xStats.ulMeanValue,
+                 ( uint32_t )( xStats.ullMeanFixed >> ASC_STATS_FRAC_BITS ),
+                 ( uint32_t )( ( ( xStats.ullMeanFixed & ( ( 1 << ASC_STATS_FRAC_BITS ) - 1 ) ) * 1000 ) >>
+                               ASC_STATS_FRAC_BITS ) );
+        for( i = 0; i < ASC_STATS_LATENCY_BUCKETS; i++ )
+        {
+            PLL_DAL( ASC_DBG_NAME, "- Read latency bucket %d. . . . . . %u\r\n", i, xStats.pulLatencyHistogram[ i ] );
+        }
+    }
+}
+
 /**
  * @brief   Display the full data of a single sensor
  */
@@ -431,6 +587,8 @@ static void vPrintSensorData( ASC_PROXY_DRIVER_SENSOR_DATA *pxSensor )
             PLL_DAL( ASC_DBG_NAME, "- reading: upper fatal limit . . . %d\r\n", pxSensor->pxReadings[ i ].ulUpperFatalLimit );
             PLL_DAL( ASC_DBG_NAME, "- reading: average sensor value. . %d\r\n", pxSensor->pxReadings[ i ].ulAverageSensorValue );
             PLL_DAL( ASC_DBG_NAME, "- reading: max sensor value. . . . %d\r\n", pxSensor->pxReadings[ i ].ulMaxSensorValue );
+            PLL_DAL( ASC_DBG_NAME, "- reading: hysteresis. . . . . . . %d\r\n", pxSensor->pxReadings[ i ].ulHysteresis );
+            PLL_DAL( ASC_DBG_NAME, "- reading: threshold level . . . . %d\r\n", pxSensor->pxReadings[ i ].xThresholdLevel );
             PLL_DAL( ASC_DBG_NAME, "- reading: sensor status . . . . . %s\r\n",
                      pcStatusStrings[ pxSensor->pxReadings[ i ].xSensorStatus ] );
             PLL_DAL( ASC_DBG_NAME, "- reading: sensor unit modifier. . %s\r\n",
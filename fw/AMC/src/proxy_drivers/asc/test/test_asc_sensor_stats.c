@@ -0,0 +1,334 @@
+/**
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains tests for the ASC fixed-point sensor statistics.
+ * Synthetic sample sequences are fed in and the min, max, mean and
+ * latency histogram checked, including counts beyond 2^32 samples.
+ *
+ * @file test_asc_sensor_stats.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "asc_sensor_stats.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_FIXED( x )     ( ( uint64_t )( ( x ) * ( 1 << ASC_STATS_FRAC_BITS ) ) )
+#define TEST_TWO_POW_32     ( 1ULL << 32 )
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static void vAddSamples( ASC_SENSOR_STATS *pxStats, float fValue, uint32_t ulCount )
+{
+    uint32_t i = 0;
+
+    for( i = 0; i < ulCount; i++ )
+    {
+        assert_int_equal( OK, iASC_StatsAddSample( pxStats, fValue, 0 ) );
+    }
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_empty( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_RING ) );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_int_equal( ASC_PROXY_DRIVER_STATS_WINDOW_RING, xResult.xWindow );
+    assert_int_equal( 0, xResult.ullSampleCount );
+    assert_int_equal( 0, xResult.ulMinValue );
+    assert_int_equal( 0, xResult.ulMaxValue );
+    assert_int_equal( 0, xResult.ulMeanValue );
+}
+
+static void test_lifetime_mean( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME ) );
+    vAddSamples( &xStats, 10.0f, 30 );
+    vAddSamples( &xStats, 50.0f, 10 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    /* Every sample carries the same weight - the EWMA would be close to 50 */
+    assert_int_equal( ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME, xResult.xWindow );
+    assert_int_equal( 40, xResult.ullSampleCount );
+    assert_int_equal( 10, xResult.ulMinValue );
+    assert_int_equal( 50, xResult.ulMaxValue );
+    assert_int_equal( 20, xResult.ulMeanValue );
+    assert_int_equal( TEST_FIXED( 20 ), xResult.ullMeanFixed );
+}
+
+static void test_lifetime_sum_does_not_wrap( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+    uint64_t                      ullSample = TEST_FIXED( 4000000000ULL );
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME ) );
+    vAddSamples( &xStats, 4000000000.0f, 1 );
+
+    /* Jump to the most samples the sum can hold rather than feeding them all in */
+    xStats.ullLifetimeCount = UINT64_MAX / ullSample;
+    xStats.ullLifetimeSum   = ullSample * xStats.ullLifetimeCount;
+
+    vAddSamples( &xStats, 4000000000.0f, 4 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_true( ( UINT64_MAX / ullSample ) > xStats.ullLifetimeCount );
+    assert_int_equal( 4000000000U, xResult.ulMeanValue );
+    assert_int_equal( ullSample, xResult.ullMeanFixed );
+}
+
+static void test_ewma_constant( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_EWMA ) );
+    vAddSamples( &xStats, 42.0f, 100 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_int_equal( 100, xResult.ullSampleCount );
+    assert_int_equal( 42, xResult.ulMinValue );
+    assert_int_equal( 42, xResult.ulMaxValue );
+    assert_int_equal( 42, xResult.ulMeanValue );
+    assert_int_equal( TEST_FIXED( 42 ), xResult.ullMeanFixed );
+}
+
+static void test_ewma_step( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_EWMA ) );
+    vAddSamples( &xStats, 50.0f, 1 );
+    vAddSamples( &xStats, 100.0f, 1 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    /* One step of 1/2^n towards the new sample */
+    assert_int_equal( TEST_FIXED( 50 ) + ( TEST_FIXED( 50 ) >> ASC_STATS_EWMA_SHIFT ), xResult.ullMeanFixed );
+
+    vAddSamples( &xStats, 100.0f, 64 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_int_equal( 50, xResult.ulMinValue );
+    assert_int_equal( 100, xResult.ulMaxValue );
+    assert_int_equal( 100, xResult.ulMeanValue );
+
+    vAddSamples( &xStats, 20.0f, 64 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_int_equal( 20, xResult.ulMinValue );
+    assert_int_equal( 20, xResult.ulMeanValue );
+}
+
+static void test_fractional_values_are_kept( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_RING ) );
+    vAddSamples( &xStats, 10.5f, 4 );
+    vAddSamples( &xStats, 10.75f, 4 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    /* Truncating each sample would give a mean of 10 */
+    assert_int_equal( TEST_FIXED( 10.625 ), xResult.ullMeanFixed );
+    assert_int_equal( 11, xResult.ulMeanValue );
+    assert_int_equal( 11, xResult.ulMinValue );
+    assert_int_equal( 11, xResult.ulMaxValue );
+}
+
+static void test_ring_window( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+    int i = 0;
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_RING ) );
+
+    /* Partially filled ring: mean of the samples so far */
+    for( i = 1; i <= 3; i++ )
+    {
+        vAddSamples( &xStats, ( float )i, 1 );
+    }
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+    assert_int_equal( 2, xResult.ulMeanValue );
+
+    /* Full ring: mean of the last ASC_STATS_RING_LEN samples */
+    for( i = 4; i <= 20; i++ )
+    {
+        vAddSamples( &xStats, ( float )i, 1 );
+    }
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_int_equal( 20, xResult.ullSampleCount );
+    assert_int_equal( 1, xResult.ulMinValue );
+    assert_int_equal( 20, xResult.ulMaxValue );
+    assert_int_equal( TEST_FIXED( ( 20 + 20 - ASC_STATS_RING_LEN + 1 ) / 2.0 ), xResult.ullMeanFixed );
+}
+
+static void test_large_values_do_not_overflow( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    /* A 32-bit sum of these would wrap on the second sample */
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_RING ) );
+    vAddSamples( &xStats, 4000000000.0f, 3 * ASC_STATS_RING_LEN );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_int_equal( 4000000000U, xResult.ulMeanValue );
+    assert_int_equal( 4000000000U, xResult.ulMaxValue );
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_EWMA ) );
+    vAddSamples( &xStats, 4000000000.0f, 3 );
+    vAddSamples( &xStats, 1e12f, 200 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    /* Out of range values clamp rather than wrap */
+    assert_int_equal( 4000000000U, xResult.ulMinValue );
+    assert_int_equal( UINT32_MAX, xResult.ulMaxValue );
+    assert_int_equal( UINT32_MAX, xResult.ulMeanValue );
+}
+
+static void test_negative_values_clamp_to_zero( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_EWMA ) );
+    vAddSamples( &xStats, -5.0f, 1 );
+    vAddSamples( &xStats, 8.0f, 1 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_int_equal( 0, xResult.ulMinValue );
+    assert_int_equal( 8, xResult.ulMaxValue );
+    assert_int_equal( TEST_FIXED( 1 ), xResult.ullMeanFixed );
+}
+
+static void test_sample_count_past_2_32( void **state )
+{
+    ASC_PROXY_DRIVER_STATS_WINDOW xWindow = ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME;
+
+    for( xWindow = ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME; MAX_ASC_PROXY_DRIVER_STATS_WINDOW > xWindow; xWindow++ )
+    {
+        ASC_SENSOR_STATS              xStats  = { 0 };
+        ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+        assert_int_equal( OK, iASC_StatsReset( &xStats, xWindow ) );
+        vAddSamples( &xStats, 75.0f, ASC_STATS_RING_LEN );
+
+        /* Jump to just short of 2^32 samples rather than feeding them all in */
+        xStats.ullSampleCount = TEST_TWO_POW_32 - 3;
+
+        vAddSamples( &xStats, 75.0f, 2 * ASC_STATS_RING_LEN );
+        assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+        /* A 32-bit count would have wrapped to 0 and taken the mean with it */
+        assert_true( TEST_TWO_POW_32 == xResult.ullSampleCount - ( ( 2 * ASC_STATS_RING_LEN ) - 3 ) );
+        assert_int_equal( 75, xResult.ulMinValue );
+        assert_int_equal( 75, xResult.ulMaxValue );
+        assert_int_equal( 75, xResult.ulMeanValue );
+        assert_int_equal( TEST_FIXED( 75 ), xResult.ullMeanFixed );
+    }
+}
+
+static void test_counters_saturate( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_EWMA ) );
+    vAddSamples( &xStats, 1.0f, 1 );
+
+    xStats.ullSampleCount            = UINT64_MAX;
+    xStats.pulLatencyHistogram[ 0 ] = UINT32_MAX;
+
+    vAddSamples( &xStats, 1.0f, 1 );
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_true( UINT64_MAX == xResult.ullSampleCount );
+    assert_int_equal( UINT32_MAX, xResult.pulLatencyHistogram[ 0 ] );
+}
+
+static void test_latency_histogram( void **state )
+{
+    static const uint32_t pulLatencies[ ] = { 0, 1, 2, 3, 4, 7, 8, 63, 64, 1000 };
+    static const uint32_t pulExpected[ ASC_STATS_LATENCY_BUCKETS ] = { 1, 1, 2, 2, 1, 0, 1, 2 };
+
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+    int i = 0;
+
+    assert_int_equal( OK, iASC_StatsReset( &xStats, ASC_PROXY_DRIVER_STATS_WINDOW_EWMA ) );
+
+    for( i = 0; i < ( sizeof( pulLatencies ) / sizeof( pulLatencies[ 0 ] ) ); i++ )
+    {
+        assert_int_equal( OK, iASC_StatsAddSample( &xStats, 1.0f, pulLatencies[ i ] ) );
+    }
+    assert_int_equal( OK, iASC_StatsGet( &xStats, &xResult ) );
+
+    assert_memory_equal( pulExpected, xResult.pulLatencyHistogram, sizeof( pulExpected ) );
+}
+
+static void test_invalid_args( void **state )
+{
+    ASC_SENSOR_STATS              xStats  = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_STATS xResult = { 0 };
+
+    assert_int_equal( ERROR, iASC_StatsReset( NULL, ASC_PROXY_DRIVER_STATS_WINDOW_EWMA ) );
+    assert_int_equal( ERROR, iASC_StatsReset( &xStats, MAX_ASC_PROXY_DRIVER_STATS_WINDOW ) );
+    assert_int_equal( ERROR, iASC_StatsAddSample( NULL, 1.0f, 0 ) );
+    assert_int_equal( ERROR, iASC_StatsGet( NULL, &xResult ) );
+    assert_int_equal( ERROR, iASC_StatsGet( &xStats, NULL ) );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test( test_empty ),
+        cmocka_unit_test( test_lifetime_mean ),
+        cmocka_unit_test( test_lifetime_sum_does_not_wrap ),
+        cmocka_unit_test( test_ewma_constant ),
+        cmocka_unit_test( test_ewma_step ),
+        cmocka_unit_test( test_fractional_values_are_kept ),
+        cmocka_unit_test( test_ring_window ),
+        cmocka_unit_test( test_large_values_do_not_overflow ),
+        cmocka_unit_test( test_negative_values_clamp_to_zero ),
+        cmocka_unit_test( test_sample_count_past_2_32 ),
+        cmocka_unit_test( test_counters_saturate ),
+        cmocka_unit_test( test_latency_histogram ),
+        cmocka_unit_test( test_invalid_args ),
+    };
+
+    return cmocka_run_group_tests( tests, NULL, NULL );
+}
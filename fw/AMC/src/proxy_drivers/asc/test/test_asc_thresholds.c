@@ -0,0 +1,471 @@
+/**
+ * Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains threshold event tests for the ASC proxy driver.
+ * The proxy task is run against a scripted sensor sweep and every
+ * threshold event it raises is counted.
+ *
+ * @file test_asc_thresholds.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "asc_proxy_driver.h"
+#include "pll.h"
+#include "osal.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_ASC_PROXY_ID       ( 0x10 )
+#define TEST_ASC_SENSOR_ID      ( 5 )
+#define TEST_ASC_SWEEP_MS       ( 100 )     /* matches the proxy task period */
+
+#define TEST_ASC_WARNING_LIMIT  ( 80 )
+#define TEST_ASC_CRITICAL_LIMIT ( 90 )
+#define TEST_ASC_FATAL_LIMIT    ( 100 )
+
+#define TEST_ASC_MAX_SWEEPS     ( 64 )
+
+#define TEST_ASC_NO_LIMITS      ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, \
+                                ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL
+
+
+/*****************************************************************************/
+/* Local function declarations                                               */
+/*****************************************************************************/
+
+static int iFakeSensorEnabled( void );
+static int iFakeReadSensor( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChannelNum, float *pfSensorValue );
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static ASC_PROXY_DRIVER_SENSOR_DATA pxTestSensors[ ] =
+{
+    {
+        "test_temp", TEST_ASC_SENSOR_ID, ASC_PROXY_DRIVER_SENSOR_BITFIELD_TEMPERATURE, 0, 0x4C, { 0 },
+        iFakeSensorEnabled,
+        { iFakeReadSensor, NULL, NULL, NULL },
+        {
+            { 0, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL, ASC_SENSOR_INVALID_VAL,
+              TEST_ASC_WARNING_LIMIT, TEST_ASC_CRITICAL_LIMIT, TEST_ASC_FATAL_LIMIT },
+            { 0, TEST_ASC_NO_LIMITS },
+            { 0, TEST_ASC_NO_LIMITS },
+            { 0, TEST_ASC_NO_LIMITS }
+        }
+    }
+};
+
+static void ( *pvTaskFunc )( void * ) = NULL;
+static jmp_buf xTaskExit;
+
+static const uint32_t *pulScript   = NULL;
+static uint32_t       ulScriptLen  = 0;
+static uint32_t       ulSweep      = 0;
+static uint32_t       ulFakeTimeMs = 0;
+
+static uint32_t pulEventCounts[ MAX_ASC_PROXY_DRIVER_EVENTS ] = { 0 };
+static uint32_t ulFailThresholdRaises                         = 0;
+
+static int      iFailAlloc = -1;    /* index of the allocation to fail, -1 for none */
+static int      iNumAllocs = 0;
+static int      iNumFrees  = 0;
+
+
+/*****************************************************************************/
+/* Stubs                                                                     */
+/*****************************************************************************/
+
+static int iFakeSensorEnabled( void )
+{
+    return TRUE;
+}
+
+static int iFakeReadSensor( uint8_t ucBusNum, uint8_t ucSlaveAddr, uint8_t ucChannelNum, float *pfSensorValue )
+{
+    *pfSensorValue = ( float )pulScript[ ulSweep ];
+    return OK;
+}
+
+int iEVL_CreateRecord( EVL_RECORD **ppxRecord )
+{
+    static uint8_t ucRecord = 0;
+
+    *ppxRecord = ( EVL_RECORD * )&ucRecord;
+    return OK;
+}
+
+int iEVL_BindCallback( EVL_RECORD *pxRecord, EVL_CALLBACK *pxCallback )
+{
+    return OK;
+}
+
+int iEVL_RaiseEvent( EVL_RECORD *pxRecord, EVL_SIGNAL *pxSignal )
+{
+    assert_int_equal( TEST_ASC_PROXY_ID, pxSignal->ucModule );
+    assert_true( MAX_ASC_PROXY_DRIVER_EVENTS > pxSignal->ucEventType );
+
+    if( ASC_PROXY_DRIVER_E_SENSOR_UPDATE_COMPLETE != pxSignal->ucEventType )
+    {
+        assert_int_equal( TEST_ASC_SENSOR_ID, pxSignal->ucInstance );
+        assert_int_equal( ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, pxSignal->ucAdditionalData );
+
+        if( 0 < ulFailThresholdRaises )
+        {
+            ulFailThresholdRaises--;
+            return ERROR;
+        }
+    }
+
+    pulEventCounts[ pxSignal->ucEventType ]++;
+    return OK;
+}
+
+int iOSAL_Mutex_Create( void **ppvMutexHandle, const char *pcMutexName )
+{
+    static uint8_t ucMutex = 0;
+
+    *ppvMutexHandle = &ucMutex;
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Take( void *pvMutexHandle, uint32_t ulTimeoutMs )
+{
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Release( void *pvMutexHandle )
+{
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Task_Create( void **ppvTaskHandle,
+                       void ( *pvStartTask )( void * pvParameters ),
+                       uint16_t usStackSize,
+                       void *pvParameters,
+                       uint32_t ulPriority,
+                       const char *pcTaskName )
+{
+    *ppvTaskHandle = ( void * )&pvTaskFunc;
+    pvTaskFunc     = pvStartTask;
+    return OSAL_ERRORS_NONE;
+}
+
+/* Each proxy task sweep ends with a sleep - step the script and stop the task once it is exhausted */
+int iOSAL_Task_SleepMs( uint32_t ulSleepMs )
+{
+    ulFakeTimeMs += ulSleepMs;
+
+    if( ++ulSweep >= ulScriptLen )
+    {
+        longjmp( xTaskExit, 1 );
+    }
+
+    return OSAL_ERRORS_NONE;
+}
+
+uint32_t ulOSAL_GetUptimeTicks( void )
+{
+    return ulFakeTimeMs;
+}
+
+uint32_t ulOSAL_GetUptimeMs( void )
+{
+    return ulFakeTimeMs;
+}
+
+void *pvOSAL_MemAlloc( uint16_t xSize )
+{
+    return ( iFailAlloc == iNumAllocs++ ) ? NULL : malloc( xSize );
+}
+
+void vOSAL_MemFree( void **ppv )
+{
+    if( ( NULL != ppv ) && ( NULL != *ppv ) )
+    {
+        free( *ppv );
+        *ppv = NULL;
+        iNumFrees++;
+    }
+}
+
+void *pvOSAL_MemSet( void *pvDestination, int iValue, uint16_t usSize )
+{
+    return memset( pvDestination, iValue, usSize );
+}
+
+void *pvOSAL_MemCpy( void *pvDestination, const void *pvSource, uint16_t usSize )
+{
+    return memcpy( pvDestination, pvSource, usSize );
+}
+
+void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+{
+}
+
+void vPLL_Printf( const char *pcFormat, ... )
+{
+}
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+/**
+ * @brief   Run the proxy task once per scripted sensor value
+ */
+static void vRunSweeps( const uint32_t *pulValues, uint32_t ulNumValues )
+{
+    assert_true( ( 0 < ulNumValues ) && ( TEST_ASC_MAX_SWEEPS >= ulNumValues ) );
+
+    pulScript   = pulValues;
+    ulScriptLen = ulNumValues;
+    ulSweep     = 0;
+
+    if( 0 == setjmp( xTaskExit ) )
+    {
+        pvTaskFunc( NULL );
+    }
+
+    assert_int_equal( ulNumValues, ulSweep );
+}
+
+static uint32_t ulThresholdEvents( void )
+{
+    return pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING ] +
+           pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CRITICAL ] +
+           pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_FATAL ] +
+           pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED ];
+}
+
+static int iGroupSetup( void **state )
+{
+    /* The sensor data is freed again if the statistics cannot be allocated */
+    iFailAlloc = 1;
+    if( ( ERROR != iASC_Initialise( TEST_ASC_PROXY_ID, 0, 0x1000, pxTestSensors, 1 ) ) ||
+        ( 2 != iNumAllocs ) ||
+        ( 1 != iNumFrees ) )
+    {
+        return -1;
+    }
+    iFailAlloc = -1;
+
+    return ( OK == iASC_Initialise( TEST_ASC_PROXY_ID, 0, 0x1000, pxTestSensors, 1 ) ) ? 0 : -1;
+}
+
+static int iTestSetup( void **state )
+{
+    memset( pulEventCounts, 0, sizeof( pulEventCounts ) );
+    ulFakeTimeMs          = 0;
+    ulFailThresholdRaises = 0;
+
+    if( ( OK != iASC_ResetAllSensorData() ) ||
+        ( OK != iASC_SetSingleSensorHysteresisById( TEST_ASC_SENSOR_ID,
+                                                    ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, 0 ) ) ||
+        ( OK != iASC_SetThresholdEventRepeatInterval( 0 ) ) )
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_levels_are_edge_triggered( void **state )
+{
+    static const uint32_t pulValues[ ] =
+    {
+        50, 50, 85, 85, 85, 85, 95, 95, 95, 95, 105, 105, 105, 105, 95, 95, 85, 85, 50, 50, 50
+    };
+
+    vRunSweeps( pulValues, sizeof( pulValues ) / sizeof( pulValues[ 0 ] ) );
+
+    /* One event per level change: W, C, F, C, W, cleared */
+    assert_int_equal( 2, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING ] );
+    assert_int_equal( 2, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CRITICAL ] );
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_FATAL ] );
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED ] );
+    assert_int_equal( sizeof( pulValues ) / sizeof( pulValues[ 0 ] ),
+                      pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPDATE_COMPLETE ] );
+}
+
+static void test_jump_straight_to_fatal( void **state )
+{
+    static const uint32_t pulValues[ ] = { 20, 120, 120, 120, 20 };
+
+    vRunSweeps( pulValues, sizeof( pulValues ) / sizeof( pulValues[ 0 ] ) );
+
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_FATAL ] );
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED ] );
+    assert_int_equal( 2, ulThresholdEvents() );
+}
+
+static void test_no_hysteresis_chatters( void **state )
+{
+    static const uint32_t pulValues[ ] = { 79, 81, 79, 81, 79, 81, 79, 81, 79, 81 };
+
+    vRunSweeps( pulValues, sizeof( pulValues ) / sizeof( pulValues[ 0 ] ) );
+
+    assert_int_equal( 5, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING ] );
+    assert_int_equal( 4, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED ] );
+}
+
+static void test_hysteresis_suppresses_chatter( void **state )
+{
+    static const uint32_t pulValues[ ] = { 79, 81, 79, 81, 79, 81, 79, 76, 75, 74, 81, 70 };
+
+    assert_int_equal( OK, iASC_SetSingleSensorHysteresisById( TEST_ASC_SENSOR_ID,
+                                                              ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, 5 ) );
+
+    vRunSweeps( pulValues, sizeof( pulValues ) / sizeof( pulValues[ 0 ] ) );
+
+    /* Warning is only cleared below 75 (80 - 5), then raised again at 81 */
+    assert_int_equal( 2, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING ] );
+    assert_int_equal( 2, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED ] );
+    assert_int_equal( 4, ulThresholdEvents() );
+}
+
+static void test_hysteresis_steps_down_one_level( void **state )
+{
+    static const uint32_t pulValues[ ] = { 101, 97, 96, 95, 88, 86, 85, 60 };
+
+    assert_int_equal( OK, iASC_SetSingleSensorHysteresisById( TEST_ASC_SENSOR_ID,
+                                                              ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, 5 ) );
+
+    vRunSweeps( pulValues, sizeof( pulValues ) / sizeof( pulValues[ 0 ] ) );
+
+    /* F at 101, C once below 95 and cleared at 60 without passing back through W */
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_FATAL ] );
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CRITICAL ] );
+    assert_int_equal( 0, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING ] );
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED ] );
+}
+
+static void test_repeat_interval( void **state )
+{
+    uint32_t pulValues[ 25 ] = { 0 };
+    int i = 0;
+
+    for( i = 0; i < 25; i++ )
+    {
+        pulValues[ i ] = ( 20 > i ) ? 85 : 50;
+    }
+
+    assert_int_equal( OK, iASC_SetThresholdEventRepeatInterval( 10 * TEST_ASC_SWEEP_MS ) );
+
+    vRunSweeps( pulValues, 25 );
+
+    /* Warning held for 20 sweeps (0 - 1900ms): raised at 0, 1000ms - cleared is not repeated */
+    assert_int_equal( 2, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING ] );
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED ] );
+}
+
+static void test_failed_raise_is_retried( void **state )
+{
+    static const uint32_t pulValues[ ] = { 50, 85, 85, 85, 85, 50 };
+
+    ulFailThresholdRaises = 2;
+
+    vRunSweeps( pulValues, sizeof( pulValues ) / sizeof( pulValues[ 0 ] ) );
+
+    /* The warning is not lost - it is raised on the first sweep that succeeds */
+    assert_int_equal( 0, ulFailThresholdRaises );
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_WARNING ] );
+    assert_int_equal( 1, pulEventCounts[ ASC_PROXY_DRIVER_E_SENSOR_UPPER_CLEARED ] );
+    assert_int_equal( 2, ulThresholdEvents() );
+}
+
+static void test_sensor_stats_follow_sweeps( void **state )
+{
+    static const uint32_t pulValues[ ] = { 10, 20, 30, 40 };
+
+    ASC_PROXY_DRIVER_SENSOR_STATS xStats = { 0 };
+    ASC_PROXY_DRIVER_SENSOR_DATA  xData  = { 0 };
+
+    /* By default the average passed on to ASDM is the mean of every reading */
+    vRunSweeps( pulValues, sizeof( pulValues ) / sizeof( pulValues[ 0 ] ) );
+    vRunSweeps( pulValues, 1 );
+
+    assert_int_equal( OK, iASC_GetSensorStats( TEST_ASC_SENSOR_ID, ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, &xStats ) );
+    assert_int_equal( ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME, xStats.xWindow );
+    assert_int_equal( 5, xStats.ullSampleCount );
+    assert_int_equal( 22, xStats.ulMeanValue );
+
+    assert_int_equal( OK, iASC_GetSingleSensorDataById( TEST_ASC_SENSOR_ID, &xData ) );
+    assert_int_equal( 22, xData.pxReadings[ ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE ].ulAverageSensorValue );
+
+    assert_int_equal( OK, iASC_SetSensorStatsWindow( ASC_PROXY_DRIVER_STATS_WINDOW_RING ) );
+
+    vRunSweeps( pulValues, sizeof( pulValues ) / sizeof( pulValues[ 0 ] ) );
+
+    assert_int_equal( OK, iASC_GetSensorStats( TEST_ASC_SENSOR_ID, ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, &xStats ) );
+    assert_int_equal( ASC_PROXY_DRIVER_STATS_WINDOW_RING, xStats.xWindow );
+    assert_int_equal( 4, xStats.ullSampleCount );
+    assert_int_equal( 10, xStats.ulMinValue );
+    assert_int_equal( 40, xStats.ulMaxValue );
+    assert_int_equal( 25, xStats.ulMeanValue );
+
+    /* The readings passed on to ASDM carry the same mean and max */
+    assert_int_equal( OK, iASC_GetSingleSensorDataById( TEST_ASC_SENSOR_ID, &xData ) );
+    assert_int_equal( 25, xData.pxReadings[ ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE ].ulAverageSensorValue );
+    assert_int_equal( 40, xData.pxReadings[ ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE ].ulMaxSensorValue );
+
+    assert_int_equal( OK, iASC_SetSensorStatsWindow( ASC_PROXY_DRIVER_STATS_WINDOW_LIFETIME ) );
+    assert_int_equal( OK, iASC_GetSensorStats( TEST_ASC_SENSOR_ID, ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, &xStats ) );
+    assert_int_equal( 0, xStats.ullSampleCount );
+}
+
+static void test_invalid_args( void **state )
+{
+    ASC_PROXY_DRIVER_SENSOR_STATS xStats = { 0 };
+
+    assert_int_equal( ERROR, iASC_SetSingleSensorHysteresisById( TEST_ASC_SENSOR_ID + 1,
+                                                                 ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, 5 ) );
+    assert_int_equal( ERROR, iASC_SetSingleSensorHysteresisById( TEST_ASC_SENSOR_ID,
+                                                                 MAX_ASC_PROXY_DRIVER_SENSOR_TYPE, 5 ) );
+    assert_int_equal( ERROR, iASC_SetSensorStatsWindow( MAX_ASC_PROXY_DRIVER_STATS_WINDOW ) );
+    assert_int_equal( ERROR, iASC_GetSensorStats( TEST_ASC_SENSOR_ID + 1,
+                                                  ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, &xStats ) );
+    assert_int_equal( ERROR, iASC_GetSensorStats( TEST_ASC_SENSOR_ID,
+                                                  ASC_PROXY_DRIVER_SENSOR_TYPE_TEMPERATURE, NULL ) );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup( test_levels_are_edge_triggered, iTestSetup ),
+        cmocka_unit_test_setup( test_jump_straight_to_fatal, iTestSetup ),
+        cmocka_unit_test_setup( test_no_hysteresis_chatters, iTestSetup ),
+        cmocka_unit_test_setup( test_hysteresis_suppresses_chatter, iTestSetup ),
+        cmocka_unit_test_setup( test_hysteresis_steps_down_one_level, iTestSetup ),
+        cmocka_unit_test_setup( test_repeat_interval, iTestSetup ),
+        cmocka_unit_test_setup( test_failed_raise_is_retried, iTestSetup ),
+        cmocka_unit_test_setup( test_sensor_stats_follow_sweeps, iTestSetup ),
+        cmocka_unit_test_setup( test_invalid_args, iTestSetup ),
+    };
+
+    return cmocka_run_group_tests( tests, iGroupSetup, NULL );
+}
@@ -631,6 +631,116 @@ int iAXC_GetByte( uint8_t ucExDeviceId, uint32_t ulPage, uint32_t ulByteOffset,
     return iStatus;
 }
 
+/**
+ * @brief   Read a contiguous range of real-time byte values from desired External Device memory map
+ */
+int iAXC_GetBytes( uint8_t ucExDeviceId,
+                   uint32_t ulPage,
+                   uint32_t ulByteOffset,
+                   uint32_t ulLength,
+                   uint8_t *pucData )
+{
+    int iStatus = ERROR;
+    uint32_t ulValueSize = ulLength;
+    AXC_PRIVATE_EXTERNAL_DEVICE_LINKED_LIST *ppxCurrentExDev = NULL;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pucData ) &&
+        ( 0 < ulLength ) &&
+        ( AXC_PAGE_SIZE >= ( ulByteOffset + ulLength ) ) )
+    {
+        if( ( OK == iGetExDevFromList( &ppxCurrentExDev, ucExDeviceId ) ) &&
+            ( NULL != ppxCurrentExDev ) )
+        {
+            /* the upper page is only selected if the range reaches into it */
+            int iSelectPage = ( AXC_LOWER_PAGE_SIZE < ( ulByteOffset + ulLength ) ) ? TRUE : FALSE;
+
+            if( ( TRUE == iSelectPage ) || ( 0 == ulPage ) )
+            {
+                /* hold the mutex across the page select and the read so no other
+                   access can move the page select byte in between */
+                if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                          OSAL_TIMEOUT_WAIT_FOREVER ) )
+                {
+                    INC_STAT_COUNTER( AXC_PROXY_STATS_TAKE_MUTEX )
+
+                    /* set hw config - External Device memory map */
+                    if( FW_IF_ERRORS_NONE == ppxCurrentExDev->pxExDevLocalDeviceCfg->pxExDevIf->ioctrl( ppxCurrentExDev->pxExDevLocalDeviceCfg->pxExDevIf,
+                                                                                                    FW_IF_MUXED_DEVICE_IOCTL_SET_MEMORY_MAP,
+                                                                                                    NULL ) )
+                    {
+                        INC_STAT_COUNTER( AXC_PROXY_STATS_FW_IF_IOCTRL )
+                        iStatus = OK;
+
+                        if( TRUE == iSelectPage )
+                        {
+                            if( FW_IF_ERRORS_NONE == ppxCurrentExDev->pxExDevLocalDeviceCfg->pxExDevIf->write( ppxCurrentExDev->pxExDevLocalDeviceCfg->pxExDevIf,
+                                                                                                            AXC_PAGE_SELECT_BYTE,
+                                                                                                            ( uint8_t* )&ulPage,
+                                                                                                            sizeof( uint8_t ),
+                                                                                                            FW_IF_TIMEOUT_NO_WAIT ) )
+                            {
+                                INC_STAT_COUNTER( AXC_PROXY_STATS_FW_IF_WRITE )
+                            }
+                            else
+                            {
+                                INC_ERROR_COUNTER_WITH_STATE( AXC_PROXY_ERRORS_FW_IF_WRITE_FAILED )
+                                iStatus = ERROR;
+                            }
+                        }
+
+                        if( OK == iStatus )
+                        {
+                            if( FW_IF_ERRORS_NONE == ppxCurrentExDev->pxExDevLocalDeviceCfg->pxExDevIf->read( ppxCurrentExDev->pxExDevLocalDeviceCfg->pxExDevIf,
+                                                                                                           ( uint64_t )ulByteOffset,
+                                                                                                           pucData,
+                                                                                                           &ulValueSize,
+                                                                                                           FW_IF_TIMEOUT_NO_WAIT ) )
+                            {
+                                INC_STAT_COUNTER( AXC_PROXY_STATS_FW_IF_READ )
+
+                                if( ulLength != ulValueSize )
+                                {
+                                    INC_ERROR_COUNTER_WITH_STATE( AXC_PROXY_ERRORS_FW_IF_READ_FAILED )
+                                    iStatus = ERROR;
+                                }
+                            }
+                            else
+                            {
+                                INC_ERROR_COUNTER_WITH_STATE( AXC_PROXY_ERRORS_FW_IF_READ_FAILED )
+                                iStatus = ERROR;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        INC_ERROR_COUNTER_WITH_STATE( AXC_PROXY_ERRORS_FW_IF_IOCTRL_FAILED )
+                    }
+
+                    /* release mutex */
+                    if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+                    {
+                        INC_ERROR_COUNTER_WITH_STATE( AXC_PROXY_ERRORS_MUTEX_RELEASE_FAILED );
+                        iStatus = ERROR;
+                    }
+                    else
+                    {
+                        INC_STAT_COUNTER( AXC_PROXY_STATS_RELEASE_MUTEX )
+                    }
+                }
+                else
+                {
+                    INC_ERROR_COUNTER_WITH_STATE( AXC_PROXY_ERRORS_MUTEX_TAKE_FAILED );
+                }
+            }
+        }
+    }
+
+    return iStatus;
+}
+
 /**
  * @brief   Read real-time memory map from desired DEVICE page
  */
@@ -186,6 +186,30 @@ int iAXC_SetByte( uint8_t ucExDeviceId, uint32_t ulPage, uint32_t ulByteOffset,
  */
 int iAXC_GetByte( uint8_t ucExDeviceId, uint32_t ulPage, uint32_t ulByteOffset, uint8_t *pucValue );
 
+/**
+ * @brief   Read a contiguous range of real-time byte values from desired External Device memory map
+ *
+ * @param   ucExDeviceId    External Device Unique ID
+ * @param   ulPage          Page to be accessed within QSFP memory map
+ *                          N/A for DIMM
+ * @param   ulByteOffset    Byte address/offset of the first byte within memory map page
+ * @param   ulLength        Number of bytes to read
+ * @param   pucData         Pointer to buffer of at least ulLength bytes
+ *
+ * @return  OK              Data retrieved from proxy driver successfully
+ *          ERROR           Data not retrieved successfully
+ *
+ * @note    The range must not run past the end of the 256 byte memory map.
+ *
+ *          The upper page is selected and read under a single lock, and only
+ *          if the range extends beyond the lower page 00h.
+ */
+int iAXC_GetBytes( uint8_t ucExDeviceId,
+                   uint32_t ulPage,
+                   uint32_t ulByteOffset,
+                   uint32_t ulLength,
+                   uint8_t *pucData );
+
 /**
  * @brief   Read real-time memory map from desired QSFP
  *
@@ -33,10 +33,17 @@
 #define LOWER_FIREWALL ( 0xDEADFACE )
 
 #define BMC_TASK_SLEEP_MS               ( 10 )
-#define MAX_RX_DATA_SIZE                ( 256 )
 #define BMC_TERMINUS_LOCATOR_VALUE_SIZE ( 17 )
 #define BMC_TERMINUS_INSTANCE_1         ( 1 )
 
+#define BMC_SNAPSHOT_MAX_SENSORS        ( 128 )
+#define BMC_SNAPSHOT_INDEX_SIZE         ( 256 )                                /* power of 2, at least twice the max sensors */
+#define BMC_SNAPSHOT_INDEX_MASK         ( BMC_SNAPSHOT_INDEX_SIZE - 1 )
+#define BMC_SNAPSHOT_SLOT_EMPTY         ( 0 )
+
+/* Sensor Ids are device Id + ( sensor type << 8 ), fold the type into the top bits */
+#define BMC_SNAPSHOT_HASH( x )          ( ( ( x ) ^ ( ( x ) >> 2 ) ) & BMC_SNAPSHOT_INDEX_MASK )
+
 /* Stat & Error definitions */
 #define BMC_PROXY_STATS( DO )                       \
         DO( BMC_PROXY_STATS_INIT_OVERALL_COMPLETE ) \
@@ -49,6 +56,9 @@
         DO( BMC_PROXY_STATS_TASK_TIME_MS )          \
         DO( BMC_PROXY_STATS_STATUS_RETRIEVAL )      \
         DO( BMC_PROXY_STATS_GET_SENSOR_ID_REQUEST ) \
+        DO( BMC_PROXY_STATS_SNAPSHOT_REFRESH )      \
+        DO( BMC_PROXY_STATS_SNAPSHOT_HIT )          \
+        DO( BMC_PROXY_STATS_SNAPSHOT_MISS )         \
         DO( BMC_PROXY_STATS_MAX )
 
 #define BMC_PROXY_ERRORS( DO )                        \
@@ -71,6 +81,8 @@
         DO( BMC_PROXY_RAISE_EVENT_FAIL )              \
         DO( BMC_UNEXPECTED_SENSOR_ID )                \
         DO( BMC_UNEXPECTED_FLAG )                     \
+        DO( BMC_PROXY_ERRORS_SNAPSHOT_FULL )          \
+        DO( BMC_PROXY_ERRORS_SNAPSHOT_READ_FAILED )   \
         DO( BMC_PROXY_ERRORS_MAX )
 
 #define PRINT_STAT_COUNTER( x )  PLL_INF( BMC_NAME,                 \
@@ -151,6 +163,20 @@ UTIL_MAKE_ENUM_AND_STRINGS( BMC_PROXY_ERRORS, BMC_PROXY_ERRORS, BMC_PROXY_ERRORS
 /* Structs                                                                    */
 /******************************************************************************/
 
+/**
+ * @struct  BMC_SENSOR_SNAPSHOT
+ * @brief   The last sweep's result for one numeric sensor
+ */
+typedef struct BMC_SENSOR_SNAPSHOT
+{
+    uint16_t usSensorId;
+    int16_t  ssReading;
+    uint8_t  ucOperationalState;
+    uint8_t  ucResponse;
+    uint32_t ulUpdatedMs;
+
+} BMC_SENSOR_SNAPSHOT;
+
 /**
  * @struct  BMC_PRIVATE_DATA
  * @brief   Structure to hold ths proxy driver's private data
@@ -172,9 +198,7 @@ typedef struct BMC_PRIVATE_DATA
     void                         *pvOsalTaskHdl;
     void                         *pvOsalSemHdl;
 
-    uint8_t                      pucRxData[ MAX_RX_DATA_SIZE ];
     uint32_t                     ulRxDataSize;
-    uint8_t                      ucProcessRxData;
 
     uint8_t                      ucAwaitingSensorData;
     uint16_t                     usRequestedSensorId;
@@ -197,6 +221,11 @@ typedef struct BMC_PRIVATE_DATA
     int                          iTotalPdrPower;
     int                          iTotalPdrName;
 
+    void                         *pvSnapshotMutexHdl;
+    BMC_SENSOR_SNAPSHOT          *pxSnapshot;
+    int                          iTotalSnapshot;
+    uint8_t                      pucSnapshotIndex[ BMC_SNAPSHOT_INDEX_SIZE ];
+
     uint8_t                      pucUuid[ HAL_UUID_SIZE ];
 
     uint32_t                     pulStatCounters[ BMC_PROXY_STATS_MAX ];
@@ -213,10 +242,6 @@ typedef struct BMC_PRIVATE_DATA
 /* Global Variables used in PLDM and MCTP code                                */
 /******************************************************************************/
 
-uint8_t ReqBuffer[ MAX_BUFFER_SIZE ] =
-{
-    0
-};
 uint8_t RespBuffer[ MAX_BUFFER_SIZE ] =
 {
     0
@@ -255,11 +280,7 @@ static BMC_PRIVATE_DATA xLocalData =
     NULL,                                                                      /* pvOsalMBoxHdl */
     NULL,                                                                      /* pvOsalTaskHdl */
     NULL,                                                                      /* pvOsalSemaphoreHdl */
-    {
-        0
-    },                                                                         /* pucRxData */
     0,                                                                         /* ulRxDataSize */
-    FALSE,                                                                     /* ucProcessRxData */
     FALSE,                                                                     /* ucAwaitingSensorData */
     0,                                                                         /* usRequestedSensorId */
     0,                                                                         /* ucRequestedSensorOperationalState */
@@ -280,6 +301,13 @@ static BMC_PRIVATE_DATA xLocalData =
     0,                                                                         /* int iTotalPdrPower */
     0,                                                                         /* int iTotalPdrName */
 
+    NULL,                                                                      /* pvSnapshotMutexHdl */
+    NULL,                                                                      /* BMC_SENSOR_SNAPSHOT *pxSnapshot */
+    0,                                                                         /* int iTotalSnapshot */
+    {
+        0
+    },                                                                         /* pucSnapshotIndex */
+
     {
         0
     },                                                                         /* pucUuid */
@@ -302,7 +330,7 @@ extern PDR_RepositoryInfo MSP432_PDR_Repository;
 /******************************************************************************/
 
 /**
- * @brief   Check for incoming  message
+ * @brief   Process received MCTP packets and continue any response being sent
  *
  */
 static void vProcessRxMessage( void );
@@ -443,6 +471,51 @@ int iGetUuid( uint8_t *pucUuid );
  */
 static int iCheckSensorValid( uint16_t usSensorId );
 
+/**
+ * @brief   Build the sensor snapshot table and its index from the numeric PDRs
+ *
+ * @return  OK or ERROR
+ */
+static int iBuildSensorSnapshot( void );
+
+/**
+ * @brief   Add every sensor in a numeric PDR to the sensor snapshot table
+ *
+ * @param   pxSensorPDR Pointer to the Sensor PDR
+ * @param   iTotalPdr   Number of entries in the PDR
+ */
+static void vAddSnapshotSensors( PLDM_NUMERIC_SENSOR_PDR *pxSensorPDR, int iTotalPdr );
+
+/**
+ * @brief   Look up a sensor in the sensor snapshot table
+ *
+ * @param   usSensorId  Sensor id
+ *
+ * @return  Pointer to the snapshot entry, or NULL if the sensor is not in the PDR
+ */
+static BMC_SENSOR_SNAPSHOT *pxFindSnapshot( uint16_t usSensorId );
+
+/**
+ * @brief   Copy a sensor snapshot entry out under the snapshot mutex
+ *
+ * @param   pxEntry     Pointer to the snapshot entry
+ * @param   pxCopy      Pointer to the copy, left unchanged on error
+ *
+ * @return  OK or ERROR
+ */
+static int iCopySnapshot( BMC_SENSOR_SNAPSHOT *pxEntry, BMC_SENSOR_SNAPSHOT *pxCopy );
+
+/**
+ * @brief   Set the operational state of a sensor snapshot entry under the
+ *          snapshot mutex
+ *
+ * @param   pxEntry             Pointer to the snapshot entry
+ * @param   ucOperationalState  New operational state
+ *
+ * @return  OK or ERROR
+ */
+static int iSetSnapshotState( BMC_SENSOR_SNAPSHOT *pxEntry, uint8_t ucOperationalState );
+
 /******************************************************************************/
 /* Public Function implementations                                            */
 /******************************************************************************/
@@ -498,6 +571,12 @@ int iBMC_Initialise( uint8_t ucProxyId,
             PLL_ERR( BMC_NAME, "Error initialising mutex\r\n" );
             INC_ERROR_COUNTER_WITH_STATE( BMC_PROXY_INIT_MUTEX_CREATE_FAILED )
         }
+        else if( OSAL_ERRORS_NONE != iOSAL_Mutex_Create( &pxThis->pvSnapshotMutexHdl,
+                                                         "bmc_proxy snapshot mutex" ) )
+        {
+            PLL_ERR( BMC_NAME, "Error initialising snapshot mutex\r\n" );
+            INC_ERROR_COUNTER_WITH_STATE( BMC_PROXY_INIT_MUTEX_CREATE_FAILED )
+        }
         else if( OSAL_ERRORS_NONE != iOSAL_Semaphore_Create( &pxThis->pvOsalSemHdl,
                                                              1,
                                                              1,
@@ -576,6 +655,11 @@ int iBMC_Initialise( uint8_t ucProxyId,
                 }
             }
 
+            if( OK == iStatus )
+            {
+                iStatus = iBuildSensorSnapshot();
+            }
+
             if( OK == iStatus )
             {
                 /* Now open the FW_IF to receive data */
@@ -730,6 +814,75 @@ int iBMC_SetResponse( EVL_SIGNAL *pxSignal, uint16_t usSensorId, BMC_SENSOR_RESP
     return iStatus;
 }
 
+/**
+ * @brief   Refresh the sensor snapshot used to answer GetSensorReading requests
+ */
+int iBMC_RefreshSensorSnapshot( BMC_SENSOR_SNAPSHOT_READ_FUNC *pxReadFunc )
+{
+    int iStatus = ERROR;
+
+    if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
+        ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
+        ( TRUE == pxThis->iInitialised ) &&
+        ( NULL != pxReadFunc ) )
+    {
+        int i = 0;
+
+        iStatus = OK;
+
+        for( i = 0; i < pxThis->iTotalSnapshot; i++ )
+        {
+            BMC_SENSOR_SNAPSHOT     *pxEntry      = &pxThis->pxSnapshot[ i ];
+            int16_t                 ssReading     = 0;
+            uint8_t                 ucSensorState = 0;
+            BMC_GET_SENSOR_RESPONSE xResponse     = BMC_GET_SENSOR_RESP_NONE;
+
+            /* Read outside the mutex so requests are not held up by the reader */
+            if( OK != pxReadFunc( pxEntry->usSensorId, &ssReading, &ucSensorState, &xResponse ) )
+            {
+                /* Leave this sensor to the event path until the next refresh */
+                xResponse = BMC_GET_SENSOR_RESP_NONE;
+                iStatus   = ERROR;
+                INC_ERROR_COUNTER( BMC_PROXY_ERRORS_SNAPSHOT_READ_FAILED )
+            }
+
+            if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvSnapshotMutexHdl,
+                                                      OSAL_TIMEOUT_WAIT_FOREVER ) )
+            {
+                INC_STAT_COUNTER( BMC_PROXY_STATS_TAKE_MUTEX )
+
+                pxEntry->ssReading          = ssReading;
+                pxEntry->ucOperationalState = ucSensorState;
+                pxEntry->ucResponse         = ( uint8_t )xResponse;
+                pxEntry->ulUpdatedMs        = ulOSAL_GetUptimeMs();
+
+                if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvSnapshotMutexHdl ) )
+                {
+                    INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+                    iStatus = ERROR;
+                }
+                else
+                {
+                    INC_STAT_COUNTER( BMC_PROXY_STATS_RELEASE_MUTEX )
+                }
+            }
+            else
+            {
+                INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+                iStatus = ERROR;
+            }
+        }
+
+        INC_STAT_COUNTER( BMC_PROXY_STATS_SNAPSHOT_REFRESH )
+    }
+    else
+    {
+        INC_ERROR_COUNTER( BMC_PROXY_VALIDATION_FAILED )
+    }
+
+    return iStatus;
+}
+
 /* Get Functions **************************************************************/
 
 /**
@@ -831,73 +984,197 @@ int iBMC_GetSensorIdRequest( EVL_SIGNAL *pxSignal, int16_t *pssSensorId, uint8_t
  */
 static int iCheckSensorValid( uint16_t usSensorId )
 {
-    int iStatus     = ERROR;
-    int iNumSensors = 0;
-    int i           = 0;
+    int iStatus = ERROR;
 
     if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
         ( LOWER_FIREWALL == pxThis->ulLowerFirewall ) &&
         ( TRUE == pxThis->iInitialised ) )
     {
-        /*
-         * Check the Temperature sensors PDR
-         */
-        iNumSensors = iGetNumTemperatureSensors();
-        for( i = 0; i < iNumSensors ; i++ )
+        /* Every numeric PDR sensor has a snapshot entry */
+        if( NULL != pxFindSnapshot( usSensorId ) )
         {
-            if( pxThis->pxPdrTemperatureSensors[ i ].usSensorId  == usSensorId )
-            {
-                iStatus = OK;
-                break;
-            }
+            iStatus = OK;
         }
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Build the sensor snapshot table and its index from the numeric PDRs
+ */
+static int iBuildSensorSnapshot( void )
+{
+    int iStatus     = ERROR;
+    int iNumSensors = pxThis->iTotalPdrTemperature +
+                      pxThis->iTotalPdrVoltage +
+                      pxThis->iTotalPdrCurrent +
+                      pxThis->iTotalPdrPower;
 
-        if( OK != iStatus )
+    pvOSAL_MemSet( pxThis->pucSnapshotIndex, BMC_SNAPSHOT_SLOT_EMPTY, sizeof( pxThis->pucSnapshotIndex ) );
+    pxThis->iTotalSnapshot = 0;
+
+    if( BMC_SNAPSHOT_MAX_SENSORS < iNumSensors )
+    {
+        PLL_ERR( BMC_NAME, "Too many sensors for snapshot (%d)\r\n", iNumSensors );
+        INC_ERROR_COUNTER_WITH_STATE( BMC_PROXY_ERRORS_SNAPSHOT_FULL )
+    }
+    else if( 0 == iNumSensors )
+    {
+        iStatus = OK;
+    }
+    else
+    {
+        pxThis->pxSnapshot =
+            ( BMC_SENSOR_SNAPSHOT * )pvOSAL_MemAlloc( sizeof( BMC_SENSOR_SNAPSHOT ) * iNumSensors );
+        if( NULL != pxThis->pxSnapshot )
         {
-            /*
-             * Check the Voltage sensors PDR
-             */
-            iNumSensors = iGetNumVoltageSensors();
-            for( i = 0; i < iNumSensors; i++ )
+            vAddSnapshotSensors( pxThis->pxPdrTemperatureSensors, pxThis->iTotalPdrTemperature );
+            vAddSnapshotSensors( pxThis->pxPdrVoltageSensors, pxThis->iTotalPdrVoltage );
+            vAddSnapshotSensors( pxThis->pxPdrCurrentSensors, pxThis->iTotalPdrCurrent );
+            vAddSnapshotSensors( pxThis->pxPdrPowerSensors, pxThis->iTotalPdrPower );
+            iStatus = OK;
+        }
+        else
+        {
+            PLL_ERR( BMC_NAME, "pvOSAL_MemAlloc failed\r\n" );
+            INC_ERROR_COUNTER_WITH_STATE( BMC_PROXY_ERRORS_MEM_ALLOC_FAILED )
+        }
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Add every sensor in a numeric PDR to the sensor snapshot table
+ */
+static void vAddSnapshotSensors( PLDM_NUMERIC_SENSOR_PDR *pxSensorPDR, int iTotalPdr )
+{
+    int i = 0;
+
+    for( i = 0; i < iTotalPdr; i++ )
+    {
+        uint16_t usSensorId = pxSensorPDR[ i ].usSensorId;
+        uint32_t ulSlot     = BMC_SNAPSHOT_HASH( usSensorId );
+
+        /* The first PDR entry for an id wins, as it did with the linear search */
+        if( NULL == pxFindSnapshot( usSensorId ) )
+        {
+            BMC_SENSOR_SNAPSHOT *pxEntry = &pxThis->pxSnapshot[ pxThis->iTotalSnapshot ];
+
+            pxEntry->usSensorId         = usSensorId;
+            pxEntry->ssReading          = 0;
+            pxEntry->ucOperationalState = 0;
+            pxEntry->ucResponse         = BMC_GET_SENSOR_RESP_NONE;
+            pxEntry->ulUpdatedMs        = 0;
+
+            /* The index is at most half full, so there is always a free slot */
+            while( BMC_SNAPSHOT_SLOT_EMPTY != pxThis->pucSnapshotIndex[ ulSlot ] )
             {
-                if( pxThis->pxPdrVoltageSensors[ i ].usSensorId  == usSensorId )
-                {
-                    iStatus = OK;
-                    break;
-                }
+                ulSlot = ( ulSlot + 1 ) & BMC_SNAPSHOT_INDEX_MASK;
             }
+
+            pxThis->iTotalSnapshot++;
+            pxThis->pucSnapshotIndex[ ulSlot ] = ( uint8_t )pxThis->iTotalSnapshot;
         }
+    }
+}
 
-        if( OK != iStatus )
+/**
+ * @brief   Look up a sensor in the sensor snapshot table
+ */
+static BMC_SENSOR_SNAPSHOT *pxFindSnapshot( uint16_t usSensorId )
+{
+    BMC_SENSOR_SNAPSHOT *pxEntry = NULL;
+    uint32_t            ulSlot   = BMC_SNAPSHOT_HASH( usSensorId );
+    int                 i        = 0;
+
+    for( i = 0; i < BMC_SNAPSHOT_INDEX_SIZE; i++ )
+    {
+        uint8_t ucIndex = pxThis->pucSnapshotIndex[ ulSlot ];
+
+        if( BMC_SNAPSHOT_SLOT_EMPTY == ucIndex )
+        {
+            break;
+        }
+
+        if( usSensorId == pxThis->pxSnapshot[ ucIndex - 1 ].usSensorId )
+        {
+            pxEntry = &pxThis->pxSnapshot[ ucIndex - 1 ];
+            break;
+        }
+
+        ulSlot = ( ulSlot + 1 ) & BMC_SNAPSHOT_INDEX_MASK;
+    }
+
+    return pxEntry;
+}
+
+/**
+ * @brief   Copy a sensor snapshot entry out under the snapshot mutex
+ */
+static int iCopySnapshot( BMC_SENSOR_SNAPSHOT *pxEntry, BMC_SENSOR_SNAPSHOT *pxCopy )
+{
+    int iStatus = ERROR;
+
+    if( ( NULL != pxEntry ) && ( NULL != pxCopy ) )
+    {
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvSnapshotMutexHdl,
+                                                  OSAL_TIMEOUT_WAIT_FOREVER ) )
         {
-            /*
-             * Check the Current sensors PDR
-             */
-            iNumSensors = iGetNumCurrentSensors();
-            for( i = 0; i < iNumSensors; i++ )
+            INC_STAT_COUNTER( BMC_PROXY_STATS_TAKE_MUTEX )
+
+            pvOSAL_MemCpy( pxCopy, pxEntry, sizeof( BMC_SENSOR_SNAPSHOT ) );
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvSnapshotMutexHdl ) )
             {
-                if( pxThis->pxPdrCurrentSensors[ i ].usSensorId  == usSensorId )
-                {
-                    iStatus = OK;
-                    break;
-                }
+                INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
             }
+            else
+            {
+                INC_STAT_COUNTER( BMC_PROXY_STATS_RELEASE_MUTEX )
+                iStatus = OK;
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
         }
+    }
+
+    return iStatus;
+}
+
+/**
+ * @brief   Set the operational state of a sensor snapshot entry under the
+ *          snapshot mutex
+ */
+static int iSetSnapshotState( BMC_SENSOR_SNAPSHOT *pxEntry, uint8_t ucOperationalState )
+{
+    int iStatus = ERROR;
 
-        if( OK != iStatus )
+    if( NULL != pxEntry )
+    {
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvSnapshotMutexHdl,
+                                                  OSAL_TIMEOUT_WAIT_FOREVER ) )
         {
-            /*
-             * Check the Power PDR
-             */
-            iNumSensors = iGetNumPowerSensors();
-            for( i = 0; i < iNumSensors; i++ )
+            INC_STAT_COUNTER( BMC_PROXY_STATS_TAKE_MUTEX )
+
+            pxEntry->ucOperationalState = ucOperationalState;
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvSnapshotMutexHdl ) )
             {
-                if( pxThis->pxPdrPowerSensors[ i ].usSensorId  == usSensorId )
-                {
-                    iStatus = OK;
-                    break;
-                }
+                INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
             }
+            else
+            {
+                INC_STAT_COUNTER( BMC_PROXY_STATS_RELEASE_MUTEX )
+                iStatus = OK;
+            }
+        }
+        else
+        {
+            INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
         }
     }
 
@@ -944,73 +1221,65 @@ static int iAllocateNumericSensorPDR( PLDM_NUMERIC_SENSOR_PDR *pxIncomingSensorP
  */
 static void vProxyDriverTask( void *pvArgs )
 {
-    uint32_t ulStartMs = 0;
+    uint32_t ulStartMs  = 0;
+    uint8_t  *pucRxSlot = NULL;
 
     FOREVER
     {
         ulStartMs = ulOSAL_GetUptimeMs();
 
-        if( FW_IF_ERRORS_NONE != pxThis->pxFwIf->read( pxThis->pxFwIf,
-                                                       0,
-                                                       pxThis->pucRxData,
-                                                       &( pxThis->ulRxDataSize ),
-                                                       0 ) )
-        {
-            INC_ERROR_COUNTER_WITH_STATE( BMC_PROXY_ERRORS_FW_IF_READ_FAILED )
-        }
-        else
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                  OSAL_TIMEOUT_WAIT_FOREVER ) )
         {
-            if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
-                                                      OSAL_TIMEOUT_WAIT_FOREVER ) )
-            {
-                INC_STAT_COUNTER( BMC_PROXY_STATS_TAKE_MUTEX )
-
-                /* Reset any variables that may be used */
-                pxThis->ucAwaitingSensorData                = FALSE;
-                pxThis->usRequestedSensorId                 = 0;
-                pxThis->ucRequestedSensorOperationalState   = 0;
-                pxThis->ucRequestedSensorEventMessageEnable = 0;
-                pxThis->ucSetNumericSensorEnableResponse    = 0;
-                pxThis->ucGetNumericSensorResponse          = 0;
-                pxThis->ucGetNumericSensorState             = 0;
-                pxThis->ssSensorInfo = 0;
+            INC_STAT_COUNTER( BMC_PROXY_STATS_TAKE_MUTEX )
 
-                pxThis->ucProcessRxData = TRUE;
+            /* Receive straight into the MCTP ring, even while a response is still being sent */
+            pucRxSlot = mctp_rx_slot_acquire( &( pxThis->ulRxDataSize ) );
 
-                if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            if( NULL != pucRxSlot )
+            {
+                if( FW_IF_ERRORS_NONE != pxThis->pxFwIf->read( pxThis->pxFwIf,
+                                                               0,
+                                                               pucRxSlot,
+                                                               &( pxThis->ulRxDataSize ),
+                                                               0 ) )
                 {
-                    INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+                    INC_ERROR_COUNTER_WITH_STATE( BMC_PROXY_ERRORS_FW_IF_READ_FAILED )
                 }
                 else
                 {
-                    INC_STAT_COUNTER( BMC_PROXY_STATS_RELEASE_MUTEX )
+                    mctp_rx_slot_commit( pxThis->ulRxDataSize );
                 }
             }
+
+            if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
+            {
+                INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_RELEASE_FAILED )
+            }
             else
             {
-                INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
+                INC_STAT_COUNTER( BMC_PROXY_STATS_RELEASE_MUTEX )
             }
         }
-
-        if( TRUE == pxThis->ucProcessRxData )
+        else
         {
-            /* We have received a message so work on it */
-            vProcessRxMessage();
-
+            INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
         }
 
+        vProcessRxMessage();
+
         pxThis->pulStatCounters[ BMC_PROXY_STATS_TASK_TIME_MS ] = UTIL_ELAPSED_TIME_MS( ulStartMs )
     }
 }
 
 /**
- * @brief   Check for incoming  message
+ * @brief   Process received MCTP packets and continue any response being sent
  *
  */
 static void vProcessRxMessage( void )
 {
     int      iStatus                 = ERROR;
-    uint32_t ulRequestMessageTimeMs  = ulOSAL_GetUptimeMs();
+    uint32_t ulRequestMessageTimeMs  = 0;
     uint32_t ulResponseMessageTimeMs = 0;
 
     if( ( UPPER_FIREWALL == pxThis->ulUpperFirewall ) &&
@@ -1022,49 +1291,49 @@ static void vProcessRxMessage( void )
         {
             INC_STAT_COUNTER( BMC_PROXY_STATS_TAKE_MUTEX )
 
-            /* raise event that  message arrived to anyone interested */
-            EVL_SIGNAL xNewSignal =
-            {
-                pxThis->ucMyId,
-                BMC_PROXY_DRIVER_E_MSG_ARRIVAL,
-                0,
-                0
-            };
-            xNewSignal.ucEventType = BMC_PROXY_DRIVER_E_MSG_ARRIVAL;
-            iStatus                = iEVL_RaiseEvent( pxThis->pxEvlRecord, &xNewSignal );
-
-            if( ERROR == iStatus )
-            {
-                PLL_ERR( BMC_NAME,
-                         "Error attempting to raise event 0x%x\r\n",
-                         BMC_PROXY_DRIVER_E_MSG_ARRIVAL );
-                INC_ERROR_COUNTER( BMC_PROXY_RAISE_EVENT_FAIL )
-            }
-            else
-            {
-                int iMessageDataSize = ERROR;
-
-                ( void )pvOSAL_MemSet( ReqBuffer, 0, MAX_BUFFER_SIZE );
-                ( void )pvOSAL_MemSet( RespBuffer, 0, MAX_BUFFER_SIZE );
+            /* Packets queued behind a multi-packet response wait until it has been sent */
+            ( void )mctp_tx_service();
 
-                iMessageDataSize = pxThis->ulRxDataSize;
+            while( TRUE == mctp_rx_ready() )
+            {
+                ulRequestMessageTimeMs = ulOSAL_GetUptimeMs();
 
-                /* Leave 2 spaces at the beginning of request buffer for dest_slave_addr and size */
-                ReqBuffer[ BMC_PAYLOAD_SIZE_LOCATION ] = pxThis->ulRxDataSize;
-                ( void )pvOSAL_MemCpy( ReqBuffer + BMC_PAYLOAD_LOCATION, pxThis->pucRxData, pxThis->ulRxDataSize );
+                /* Reset any variables that may be used */
+                pxThis->ucAwaitingSensorData                = FALSE;
+                pxThis->usRequestedSensorId                 = 0;
+                pxThis->ucRequestedSensorOperationalState   = 0;
+                pxThis->ucRequestedSensorEventMessageEnable = 0;
+                pxThis->ucSetNumericSensorEnableResponse    = 0;
+                pxThis->ucGetNumericSensorResponse          = 0;
+                pxThis->ucGetNumericSensorState             = 0;
+                pxThis->ssSensorInfo = 0;
 
-                if( 0 < iMessageDataSize )
+                /* raise event that  message arrived to anyone interested */
+                EVL_SIGNAL xNewSignal =
                 {
-                    /* Call into existing PLDM / MCTP Code process_OoB_request
-                       We add on 2 bytes since the message is missing bytes that existing
-                       i2c message would have */
-                    process_pmci_request( iMessageDataSize + BMC_PAYLOAD_LOCATION );
-
-                    ulResponseMessageTimeMs = ulOSAL_GetUptimeMs();
-                    PLL_DBG( BMC_NAME,
-                             "Message processing took %d mS\r\n",
-                             ( ulResponseMessageTimeMs - ulRequestMessageTimeMs ) );
+                    pxThis->ucMyId,
+                    BMC_PROXY_DRIVER_E_MSG_ARRIVAL,
+                    0,
+                    0
+                };
+                xNewSignal.ucEventType = BMC_PROXY_DRIVER_E_MSG_ARRIVAL;
+                iStatus                = iEVL_RaiseEvent( pxThis->pxEvlRecord, &xNewSignal );
+
+                if( ERROR == iStatus )
+                {
+                    PLL_ERR( BMC_NAME,
+                             "Error attempting to raise event 0x%x\r\n",
+                             BMC_PROXY_DRIVER_E_MSG_ARRIVAL );
+                    INC_ERROR_COUNTER( BMC_PROXY_RAISE_EVENT_FAIL )
                 }
+
+                /* Call into existing PLDM / MCTP Code, the packet is processed in its ring slot */
+                ( void )mctp_rx_process();
+
+                ulResponseMessageTimeMs = ulOSAL_GetUptimeMs();
+                PLL_DBG( BMC_NAME,
+                         "Message processing took %d mS\r\n",
+                         ( ulResponseMessageTimeMs - ulRequestMessageTimeMs ) );
             }
 
             if( OSAL_ERRORS_NONE != iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl ) )
@@ -1080,9 +1349,6 @@ static void vProcessRxMessage( void )
         {
             INC_ERROR_COUNTER( BMC_PROXY_ERRORS_MUTEX_TAKE_FAILED )
         }
-
-        /* Clear the flag */
-        pxThis->ucProcessRxData = FALSE;
     }
 }
 
@@ -1156,6 +1422,14 @@ int iSetNumericSensorEnable( uint16_t usSensorId,
                 {
                 case BMC_SENSOR_ENABLE_RESP_OK:
                 {
+                    BMC_SENSOR_SNAPSHOT *pxEntry = pxFindSnapshot( usSensorId );
+
+                    /* Report the new state before the next sweep refreshes it */
+                    if( NULL != pxEntry )
+                    {
+                        ( void )iSetSnapshotState( pxEntry, ucSensorOperationalState );
+                    }
+
                     pucResponseMessage[ ( *piResponseSize )++ ] = RESP_PLDM_SUCCESS;
                     break;
                 }
@@ -1219,15 +1493,43 @@ int iGetNumericSensorReading( uint16_t usSensorId,
         ( NULL != pucSensorOperationalState ) &&
         ( NULL != pssReading ) )
     {
+        BMC_SENSOR_SNAPSHOT *pxEntry = pxFindSnapshot( usSensorId );
+        BMC_SENSOR_SNAPSHOT xEntry   = { 0 };
+
         pxThis->usRequestedSensorId = usSensorId;
 
-        if( OK == iCheckSensorValid( usSensorId ) )
+        if( NULL != pxEntry )
         {
-            if( OK == iRaiseBmcEvent( BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ) )
+            /* If the copy fails it stays empty, and the request falls back to the event */
+            xEntry.ucResponse = BMC_GET_SENSOR_RESP_NONE;
+            ( void )iCopySnapshot( pxEntry, &xEntry );
+
+            if( ( BMC_GET_SENSOR_RESP_NONE != xEntry.ucResponse ) &&
+                ( BMC_SNAPSHOT_MAX_AGE_MS >= ( ulOSAL_GetUptimeMs() - xEntry.ulUpdatedMs ) ) )
             {
+                /* Answer from the last sweep, no round trip to the OoB application */
+                INC_STAT_COUNTER( BMC_PROXY_STATS_SNAPSHOT_HIT )
+                pxThis->ucGetNumericSensorResponse        = xEntry.ucResponse;
+                pxThis->ucRequestedSensorOperationalState = xEntry.ucOperationalState;
+                pxThis->ssSensorInfo                      = xEntry.ssReading;
                 iStatus = OK;
+            }
+            else
+            {
+                INC_STAT_COUNTER( BMC_PROXY_STATS_SNAPSHOT_MISS )
+                if( OK == iRaiseBmcEvent( BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ) )
+                {
+                    /* OoB applicatiion will respond */
+                    iStatus = OK;
+                }
+                else
+                {
+                    *pucCompletionCode = RESP_PLDM_ERROR_GENERIC;
+                }
+            }
 
-                /* OoB applicatiion will respond */
+            if( OK == iStatus )
+            {
                 /* Now check the response */
                 switch( pxThis->ucGetNumericSensorResponse )
                 {
@@ -1264,10 +1566,6 @@ int iGetNumericSensorReading( uint16_t usSensorId,
                 }
                 }
             }
-            else
-            {
-                *pucCompletionCode = RESP_PLDM_ERROR_GENERIC;
-            }
         }
         else
         {
@@ -1561,9 +1859,20 @@ void vEmulateReceivedMessage( uint8_t *pucData, uint16_t usDatasize )
         ( TRUE == pxThis->iInitialised ) &&
         ( NULL != pucData ) )
     {
-        pvOSAL_MemCpy( pxThis->pucRxData, pucData, usDatasize );
-        pxThis->ulRxDataSize    = usDatasize;
-        pxThis->ucProcessRxData = TRUE;
+        if( OSAL_ERRORS_NONE == iOSAL_Mutex_Take( pxThis->pvOsalMutexHdl,
+                                                  OSAL_TIMEOUT_WAIT_FOREVER ) )
+        {
+            uint32_t ulSlotSize = 0;
+            uint8_t  *pucRxSlot = mctp_rx_slot_acquire( &ulSlotSize );
+
+            if( ( NULL != pucRxSlot ) && ( usDatasize <= ulSlotSize ) )
+            {
+                pvOSAL_MemCpy( pucRxSlot, pucData, usDatasize );
+                mctp_rx_slot_commit( usDatasize );
+            }
+
+            ( void )iOSAL_Mutex_Release( pxThis->pvOsalMutexHdl );
+        }
     }
 }
 
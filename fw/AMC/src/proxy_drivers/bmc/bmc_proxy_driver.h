@@ -26,6 +26,8 @@
 /* Defines                                                                    */
 /******************************************************************************/
 
+#define BMC_SNAPSHOT_MAX_AGE_MS ( 1000 )
+
 /******************************************************************************/
 /* Structs                                                                    */
 /******************************************************************************/
@@ -106,6 +108,23 @@ typedef enum BMC_GET_SENSOR_RESPONSE
 
 } BMC_GET_SENSOR_RESPONSE;
 
+
+/******************************************************************************/
+/* Typedefs                                                                   */
+/******************************************************************************/
+
+/**
+ * @typedef  BMC_SENSOR_SNAPSHOT_READ_FUNC
+ * @brief    Function definition for reading one sensor into the snapshot
+ *
+ * @note     The response is stored alongside the reading and returned as-is
+ *           to any GetSensorReading request for this sensor
+ */
+typedef int ( BMC_SENSOR_SNAPSHOT_READ_FUNC ) ( uint16_t usSensorId,
+                                                int16_t *pssReading,
+                                                uint8_t *pucSensorState,
+                                                BMC_GET_SENSOR_RESPONSE *pxResponse );
+
 /******************************************************************************/
 /* Function declarations                                                      */
 /******************************************************************************/
@@ -190,6 +209,20 @@ int iBMC_SendResponseForGetSensor( EVL_SIGNAL *pxSignal,
  */
 int iBMC_SetResponse( EVL_SIGNAL *pxSignal, uint16_t usSensorId, BMC_SENSOR_RESPONSE xBmcResponse );
 
+/**
+ * @brief   Refresh the sensor snapshot used to answer GetSensorReading requests
+ *
+ * @param   pxReadFunc  Function called once for every numeric sensor in the PDR
+ *
+ * @return  OK          Every sensor was refreshed
+ *          ERROR       One or more sensors were not refreshed
+ *
+ * @note    Intended to be called once per sensor sweep. Requests for a sensor
+ *          that has not been refreshed in the last BMC_SNAPSHOT_MAX_AGE_MS fall
+ *          back to the BMC_PROXY_DRIVER_E_GET_SENSOR_INFO event.
+ */
+int iBMC_RefreshSensorSnapshot( BMC_SENSOR_SNAPSHOT_READ_FUNC *pxReadFunc );
+
 /**
  * @brief   Print all the stats gathered by the application
  *
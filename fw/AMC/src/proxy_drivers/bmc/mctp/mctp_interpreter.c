@@ -46,15 +46,70 @@
 #define PKT_SEQ_MODULO                               4
 #define MAX_MULTIPART_BUFFER_SIZE                    1024
 #define SPDM_OOB_THREAD_FLASH_SET_RESYNC_FLAG_BITSET 0x80
+#define MCTP_SMBUS_PREFIX_SIZE                       2                         //dest_slave_addr + byte_count, not counted in byte_count
+#define MCTP_RX_RING_SLOTS                           4                         //packets that can be queued while a response is transmitting
+#define MCTP_RX_SLOT_SIZE                            ( MCTP_SMBUS_PREFIX_SIZE + 256 )
+#define MCTP_RX_CONTEXTS                             2                         //endpoints that can be mid-way through a multi-packet message
+#define MCTP_RX_CONTEXT_TIMEOUT_MS                   ( 500 )                   //a message with no packet for this long is abandoned
+
 
 /******************************************************************************/
-/* Locals                                                                     */
+/* Structs                                                                    */
 /******************************************************************************/
 
-uint8_t multiPartReqBuffer[ MAX_MULTIPART_BUFFER_SIZE ] =
+/**
+ * @struct  mctp_rx_ring
+ * @brief   Preallocated ring of received packets waiting to be processed
+ */
+typedef struct mctp_rx_ring
+{
+    uint8_t  slot[ MCTP_RX_RING_SLOTS ][ MCTP_RX_SLOT_SIZE ];
+    uint16_t size[ MCTP_RX_RING_SLOTS ];
+    uint8_t  head;                                                             /* next slot to receive into */
+    uint8_t  tail;                                                             /* next slot to process */
+    uint8_t  count;
+
+} mctp_rx_ring;
+
+/**
+ * @struct  mctp_rx_context
+ * @brief   Reassembly state of a multi-packet message from one endpoint
+ */
+typedef struct mctp_rx_context
+{
+    uint8_t  in_use;
+    uint8_t  src_slave_addr;
+    uint8_t  src_ep_id;
+    uint8_t  tag;
+    uint8_t  seq_num;
+    uint16_t size;
+    uint32_t last_rx_ms;
+    uint8_t  buffer[ MAX_MULTIPART_BUFFER_SIZE ];
+
+} mctp_rx_context;
+
+/**
+ * @struct  mctp_tx_context
+ * @brief   State of the response being transmitted from RespBuffer
+ */
+typedef struct mctp_tx_context
 {
-    0
-};
+    uint8_t  active;
+    uint8_t  header[ MCTP_HEADER ];                                            /* header of the first packet, reused for the rest */
+    uint16_t payload_size;
+    uint16_t sent_size;
+    uint32_t last_sent_ms;
+
+} mctp_tx_context;
+
+
+/******************************************************************************/
+/* Locals                                                                     */
+/******************************************************************************/
+
+static mctp_rx_ring    rx_ring                        = { 0 };
+static mctp_rx_context rx_context[ MCTP_RX_CONTEXTS ] = { 0 };
+static mctp_tx_context tx_context                     = { 0 };
 
 int request_pkt = TRUE;
 
@@ -139,28 +194,186 @@ uint16_t process_request( mctp_message *req, mctp_message *resp )
 }
 
 /**
- * @brief   Process a received PMCI message
- *
+ * @brief   Find the reassembly context for the endpoint that sent a packet
  */
-void process_pmci_request( int i2cSlaveReadCount )
+static mctp_rx_context *get_rx_context( mctp_message *req, int start_of_message )
 {
-    unsigned pkt_size     = 0U;
-    unsigned ret_size     = 0U;
-    unsigned sent_size    = 0U;
-    unsigned payload_size = 0U;
-    uint8_t  saved_byte   = 0U;
-    uint8_t  byte_count   = 0U;
-
-    mctp_message *req  = ( mctp_message * ) ReqBuffer;
-    mctp_message *resp = ( mctp_message * ) RespBuffer;
-
-    uint8_t         SOM               = req->som;
-    uint8_t         EOM               = ( req->eom ) << 1;
-    uint8_t         flag              = SOM | EOM;
-    uint8_t         seq_num           = req->seq_num;
-    uint8_t         expected_seq_num  = 0;
-    static uint8_t  prv_seq_num       = 0;
-    static uint32_t staging_buff_size = 0;
+    mctp_rx_context *ctx    = NULL;
+    mctp_rx_context *spare  = NULL;
+    mctp_rx_context *oldest = NULL;
+    uint32_t        now_ms  = ulOSAL_GetUptimeMs();
+    int             i       = 0;
+
+    for( i = 0; i < MCTP_RX_CONTEXTS; i++ )
+    {
+        /* An endpoint that stopped part way through a message must not hold its context forever */
+        if( ( TRUE == rx_context[ i ].in_use ) &&
+            ( MCTP_RX_CONTEXT_TIMEOUT_MS <= ( now_ms - rx_context[ i ].last_rx_ms ) ) )
+        {
+            PLL_INF( BMC_NAME, "\r\nAbandoned message from endpoint %d timed out", rx_context[ i ].src_ep_id );
+            rx_context[ i ].in_use = FALSE;
+        }
+
+        if( TRUE == rx_context[ i ].in_use )
+        {
+            if( ( rx_context[ i ].src_slave_addr == req->src_slave_addr ) &&
+                ( rx_context[ i ].src_ep_id == req->src_ep_id ) )
+            {
+                ctx = &rx_context[ i ];
+                break;
+            }
+
+            if( ( NULL == oldest ) ||
+                ( ( now_ms - rx_context[ i ].last_rx_ms ) > ( now_ms - oldest->last_rx_ms ) ) )
+            {
+                oldest = &rx_context[ i ];
+            }
+        }
+        else if( NULL == spare )
+        {
+            spare = &rx_context[ i ];
+        }
+    }
+
+    /*
+     * A SOM from an endpoint starts a new context, dropping any message already in progress.
+     * If every context is busy with another endpoint, the least recently active one is dropped.
+     */
+    if( ( TRUE == start_of_message ) && ( NULL == ctx ) )
+    {
+        if( NULL == spare )
+        {
+            PLL_INF( BMC_NAME, "\r\nDropping message in progress from endpoint %d", oldest->src_ep_id );
+            spare = oldest;
+        }
+
+        ctx                 = spare;
+        ctx->in_use         = TRUE;
+        ctx->src_slave_addr = req->src_slave_addr;
+        ctx->src_ep_id      = req->src_ep_id;
+    }
+
+    if( NULL != ctx )
+    {
+        ctx->last_rx_ms = now_ms;
+    }
+
+    return ctx;
+}
+
+/**
+ * @brief   Build the response to a complete MCTP message in RespBuffer
+ */
+static unsigned build_response( mctp_message *req )
+{
+    ( void )pvOSAL_MemSet( RespBuffer, 0, MAX_BUFFER_SIZE );
+
+    return process_request( req, ( mctp_message * )RespBuffer );
+}
+
+/**
+ * @brief   Send the next packet of the response in RespBuffer
+ */
+static void send_next_packet( void )
+{
+    unsigned     remaining = tx_context.payload_size - tx_context.sent_size;
+    unsigned     pkt_size  = MIN( remaining, MCTP_MAX_PAYLOAD_SIZE );
+    unsigned     ret_size  = MCTP_HEADER + pkt_size;                           /* add 7 bytes of header (dest addr through msg_tag) */
+    unsigned     sent_size = 0U;
+    mctp_message *pkt      = ( mctp_message * )( RespBuffer + tx_context.sent_size );
+
+    /*
+     * Each packet's header goes in the 7 bytes immediately before its payload,
+     * which held the tail of the packet already sent - no payload is moved
+     */
+    if( 0 != tx_context.sent_size )
+    {
+        pvOSAL_MemCpy( pkt, tx_context.header, MCTP_HEADER );
+    }
+
+    /* SOM = first packet, EOM = remaining size <= MCTP_MAX_PAYLOAD_SIZE */
+    pkt->som        = ( 0 == tx_context.sent_size ) ? 1 : 0;
+    pkt->eom        = ( remaining <= MCTP_MAX_PAYLOAD_SIZE ) ? 1 : 0;
+    pkt->seq_num    = ( tx_context.sent_size / MCTP_MAX_PAYLOAD_SIZE ) % PKT_SEQ_MODULO;
+    pkt->byte_count = ret_size - 2;                                            /* subtract dest addr and byte count; */
+
+#if defined( SPDM_DEBUG )
+    /*
+     * Print the Response command packet
+     */
+    int resp_pkt_print_index = 0;
+    PLL_INF( BMC_NAME, "Response Packet : " );
+    for(resp_pkt_print_index = 0; resp_pkt_print_index < ret_size; resp_pkt_print_index++)
+    {
+        PLL_INF( BMC_NAME, "0x%x ", ( ( uint8_t * )pkt )[ resp_pkt_print_index ] );
+    }
+    PLL_INF( BMC_NAME, "\r\n" );
+#endif
+
+    /* send MCTP response */
+    sent_size = send_mctp_response( ( uint8_t * )pkt, ret_size );
+
+    if( sent_size != ret_size )
+    {
+        tx_context.active = FALSE;                                             /* send failed; abort */
+    }
+    else
+    {
+        tx_context.sent_size   += pkt_size;
+        tx_context.last_sent_ms = ulOSAL_GetUptimeMs();
+
+        if( tx_context.sent_size >= tx_context.payload_size )
+        {
+            tx_context.active = FALSE;
+        }
+    }
+}
+
+/**
+ * @brief   Start transmitting the response built in RespBuffer
+ */
+static void start_response( mctp_message *req, unsigned payload_size )
+{
+    mctp_message *resp = ( mctp_message * )RespBuffer;
+
+    if( 0 == payload_size )
+    {
+        PLL_INF( BMC_NAME, "PLDM processing failed\n\r" );
+        return;
+    }
+
+    /*
+     * Preparing the Response header
+     */
+    resp->src_slave_addr = ( 0x18 << 1 ) | 0x1;
+    resp->hdr_version    = req->hdr_version;
+    resp->dest_ep_id     = req->src_ep_id;
+    resp->src_ep_id      = req->dest_ep_id;
+    resp->tag            = req->tag;
+    /* Destination address needs to be 7-bit address */
+    resp->dest_slave_addr = ( ( req->src_slave_addr & ~( 0x1 ) ) >> 1 );
+
+    pvOSAL_MemCpy( tx_context.header, resp, MCTP_HEADER );
+    tx_context.payload_size = payload_size;
+    tx_context.sent_size    = 0;
+    tx_context.active       = TRUE;
+
+    /* The first packet goes straight away, the rest are paced by mctp_tx_service */
+    send_next_packet();
+}
+
+/**
+ * @brief   Process a received MCTP packet
+ */
+static void process_pmci_packet( uint8_t *packet, unsigned packet_size )
+{
+    unsigned        payload_size     = 0U;
+    unsigned        fragment_size    = 0U;
+    uint8_t         byte_count       = 0U;
+    mctp_rx_context *ctx             = NULL;
+    mctp_message    *req             = ( mctp_message * )packet;
+    uint8_t         flag             = req->som | ( req->eom << 1 );
+    uint8_t         expected_seq_num = 0;
 
     /* collect source and destination eid's
      * will be help full to raise an request to BMC
@@ -170,45 +383,37 @@ void process_pmci_request( int i2cSlaveReadCount )
     MCTP_header_version_g = req->hdr_version;
     BMC_slave_address_g   = req->src_slave_addr;
 
-    if( i2cSlaveReadCount < ( sizeof( mctp_message ) ) /*  || req->cmd_code != MCTP_COMMAND_CODE */ ) /* Not a valid MCTP message */
+    if( packet_size < ( sizeof( mctp_message ) ) )                             /* Not a valid MCTP message */
     {
         PLL_INF( BMC_NAME, "\n\r Invalid mctp request\n\r" );
         PLL_INF( BMC_NAME,
-                 "\n\r i2cSlaveReadCount %d sizeof( mctp_message ) %d\n\r",
-                 i2cSlaveReadCount,
+                 "\n\r packet_size %d sizeof( mctp_message ) %d\n\r",
+                 packet_size,
                  sizeof( mctp_message ) );
         return;
     }
 
     /*
-     * Drop the the request if the PEC is incorrect
-     * incoming request doesn't have msp432 slave address passed in message.
-     * Add the slave address.
+     * Incoming request doesn't have the slave address passed in message.
+     * This is the address we set our SMBus up with
      */
-    /* This is the address we set our SMBus up with */
     req->dest_slave_addr = ( 0x18 << 1 );
 
 #if defined( SPDM_DEBUG )
     /*
      * Print the request command packet
      */
-    uint8_t print_req_pkt[ 64 ] =
-    {
-        0x00
-    };
-    pvOSAL_MemCpy( print_req_pkt, req, req->byte_count + 4 );
-    PLL_INF( BMC_NAME, "Request Packet : " );
-
     int req_pkt_print_index = 0;
-    for(req_pkt_print_index = 0; req_pkt_print_index < ( req->byte_count + 4 ); req_pkt_print_index++)
+    PLL_INF( BMC_NAME, "Request Packet : " );
+    for(req_pkt_print_index = 0; req_pkt_print_index < packet_size; req_pkt_print_index++)
     {
-        PLL_INF( BMC_NAME, "0x%x ", print_req_pkt[ req_pkt_print_index ] );
+        PLL_INF( BMC_NAME, "0x%x ", packet[ req_pkt_print_index ] );
     }
     PLL_INF( BMC_NAME, "\r\n" );
 #endif
 
     byte_count = req->byte_count + 2;
-    if( byte_count != i2cSlaveReadCount )
+    if( byte_count != packet_size )
     {
         PLL_INF( BMC_NAME, "Invalid mctp request - byte count is wrong\n\r" );
         return;
@@ -229,13 +434,8 @@ void process_pmci_request( int i2cSlaveReadCount )
     {
     case BOTH_SOM_EOM_HEADER:                                                  //single packet
     {
-        payload_size = process_request( req, resp );
-
-        /* LOG_ERROR_MSG("SIN_PKT : DS %d CC %d BC %d SA %d MH %d DEID %d SEID %d SOM %d EOM %d TO %d Tag %d \n",
-                             req->dest_slave_addr,req->cmd_code,req->byte_count,req->src_slave_addr,
-                             req->mctp_msg_header,req->dest_ep_id,req->src_ep_id,req->som,
-                             req->eom,req->to,req->tag); */
-
+        /* Processed in place in its ring slot */
+        payload_size = build_response( req );
         break;
     }
 
@@ -243,174 +443,147 @@ void process_pmci_request( int i2cSlaveReadCount )
     {
         /* start of a new message - start the new context for
          * future message reception. If an existing context is
-         * already present, drop it.
-           LOG_ERROR_MSG("START : DS %d CC %d BC %d SA %d MH %d DEID %d SEID %d SOM %d EOM %d TO %d Tag %d \n",
-                     req->dest_slave_addr,req->cmd_code,req->byte_count,req->src_slave_addr,
-                     req->mctp_msg_header,req->dest_ep_id,req->src_ep_id,req->som,
-                     req->eom,req->to,req->tag); */
-
-        pvOSAL_MemSet( multiPartReqBuffer, '0', sizeof( multiPartReqBuffer ) );
-
-        if( staging_buff_size == 0 )
-        {
-            pvOSAL_MemCpy( multiPartReqBuffer, req, byte_count );
-            staging_buff_size = byte_count;
-            prv_seq_num       = seq_num;
-        }
-        else
+         * already present for this endpoint, drop it.
+         */
+        ctx = get_rx_context( req, TRUE );
+        if( NULL == ctx )
         {
-            pvOSAL_MemSet( multiPartReqBuffer, '0', sizeof( multiPartReqBuffer ) );
-            staging_buff_size = 0;
-            prv_seq_num       = 0;
+            PLL_INF( BMC_NAME, "\r\nNo free reassembly context for endpoint %d", req->src_ep_id );
+            return;
         }
+
+        pvOSAL_MemCpy( ctx->buffer, req, byte_count );
+        ctx->size    = byte_count;
+        ctx->tag     = req->tag;
+        ctx->seq_num = req->seq_num;
         return;
     }
 
     case ONLY_EOM_HEADER:                                                      /* End of Packet */
+    case NEITHER_SOM_NOR_EOM_HEADER:                                           //Middle Packet
     {
-        /* LOG_ERROR_MSG("END : DS %d CC %d BC %d SA %d MH %d DEID %d SEID %d SOM %d EOM %d TO %d Tag %d \n",
-                     req->dest_slave_addr,req->cmd_code,req->byte_count,req->src_slave_addr,
-                     req->mctp_msg_header,req->dest_ep_id,req->src_ep_id,req->som,
-                     req->eom,req->to,req->tag); */
+        ctx = get_rx_context( req, FALSE );
+        if( NULL == ctx )
+        {
+            PLL_INF( BMC_NAME, "\r\nNo message in progress from endpoint %d", req->src_ep_id );
+            return;
+        }
 
         /* Out-of-sequence packet sequence number - DSP0236 sec 8.8 */
-        expected_seq_num = ( prv_seq_num + 1 ) % PKT_SEQ_MODULO;
+        expected_seq_num = ( ctx->seq_num + 1 ) % PKT_SEQ_MODULO;
 
-        if( expected_seq_num != req->seq_num )
+        if( ( expected_seq_num != req->seq_num ) || ( ctx->tag != req->tag ) )
         {
             PLL_INF( BMC_NAME, "\r\nSequence number %d does not match expected %d", req->seq_num, expected_seq_num );
-            pvOSAL_MemSet( multiPartReqBuffer, '0', sizeof( multiPartReqBuffer ) );
-            staging_buff_size = 0;
-            prv_seq_num       = 0;
+            ctx->in_use = FALSE;
             return;
         }
 
-        pvOSAL_MemCpy( multiPartReqBuffer + staging_buff_size, req->payl.mctp_msg_payload, byte_count - MCTP_HEADER );
-        staging_buff_size = staging_buff_size + byte_count - MCTP_HEADER;
-        payload_size      = process_request( ( mctp_message * )multiPartReqBuffer, resp );
-        staging_buff_size = 0;
-        prv_seq_num       = 0;
-        break;
-    }
-
-    case NEITHER_SOM_NOR_EOM_HEADER:                                           //Middle Packet
-    {
-        /* Neither SOM nor EOM
-           LOG_ERROR_MSG("MIDDLE : DS %d CC %d BC %d SA %d MH %d DEID %d SEID %d SOM %d EOM %d TO %d Tag %d \n",
-                     req->dest_slave_addr,req->cmd_code,req->byte_count,req->src_slave_addr,
-                     req->mctp_msg_header,req->dest_ep_id,req->src_ep_id,req->som,
-                     req->eom,req->to,req->tag);*/
+        fragment_size = byte_count - MCTP_HEADER;
+        if( ( ctx->size + fragment_size ) > MAX_MULTIPART_BUFFER_SIZE )
+        {
+            PLL_INF( BMC_NAME, "\r\nMessage from endpoint %d is too large", req->src_ep_id );
+            ctx->in_use = FALSE;
+            return;
+        }
 
-        /* Out-of-sequence packet sequence number - DSP0236 sec 8.8 */
-        expected_seq_num = ( prv_seq_num + 1 ) % PKT_SEQ_MODULO;
+        pvOSAL_MemCpy( ctx->buffer + ctx->size, req->payl.mctp_msg_payload, fragment_size );
+        ctx->size   += fragment_size;
+        ctx->seq_num = req->seq_num;
 
-        if( expected_seq_num != req->seq_num )
+        if( ONLY_EOM_HEADER != flag )
         {
-            PLL_INF( BMC_NAME, "\r\nSequence number %d does not match expected %d", req->seq_num, expected_seq_num );
-            pvOSAL_MemSet( multiPartReqBuffer, '0', sizeof( multiPartReqBuffer ) );
-            staging_buff_size = 0;
-            prv_seq_num       = 0;
             return;
         }
 
-        pvOSAL_MemCpy( multiPartReqBuffer + staging_buff_size, req->payl.mctp_msg_payload, byte_count - MCTP_HEADER );
-        staging_buff_size += ( byte_count - MCTP_HEADER );
-        prv_seq_num        = seq_num;
-        return;
+        payload_size = build_response( ( mctp_message * )ctx->buffer );
+        ctx->in_use  = FALSE;
+        break;
     }
     }
 
     if( request_pkt )
     {
-        /*
-         * Preparing the Response header
-         */
-        /* We only respond to MCTP command so removed cmd_code from struct
-           resp->cmd_code = MCTP_COMMAND_CODE;
-         */
+        start_response( req, payload_size );
+    }
+}
 
-        resp->src_slave_addr = ( 0x18 << 1 ) | 0x1;
-        resp->hdr_version    = req->hdr_version;
-        resp->dest_ep_id     = req->src_ep_id;
-        resp->src_ep_id      = req->dest_ep_id;
-        /* SOM = first time through loop */
-        /* EOM = remaining size <= MCTP_MAX_PAYLOAD_SIZE */
-        resp->tag     = req->tag;
-        resp->seq_num = 0;
-        resp->som     = 1;
-        while( payload_size > 0 )                                              /* implement MCTP message disassembly to enforce maximum payload size */
-        {
-            if( payload_size > MCTP_MAX_PAYLOAD_SIZE )
-            {
-                pkt_size   = MCTP_MAX_PAYLOAD_SIZE;
-                resp->eom  = 0;                                                /* not the last packet */
-                saved_byte = resp->payl.mctp_msg_payload[ MCTP_MAX_PAYLOAD_SIZE ]; /* save byte that will get wiped out by PEC */
-            }
-            else
-            {
-                pkt_size  = payload_size;
-                resp->eom = 1;                                                 /* last packet */
-            }
-            /* Destination address needs to be 7-bit address */
-            resp->dest_slave_addr = ( ( req->src_slave_addr & ~( 0x1 ) ) >> 1 );
-            /* Update the byte count at the end before pec calculation */
-            ret_size         = MCTP_HEADER + pkt_size;                         /* add 7 bytes of header (dest addr through msg_tag) */
-            resp->byte_count = ret_size - 2;                                   /* subtract dest addr and byte count; */
 
-#if defined( SPDM_DEBUG )
-            /*
-             * Print the Response command packet
-             */
-            uint8_t print_resp_pkt[ 64 ] =
-            {
-                0x00
-            };
-            pvOSAL_MemCpy( &print_resp_pkt[ 0 ], RespBuffer, ret_size );
-            PLL_INF( BMC_NAME, "Response Packet : " );
+/******************************************************************************/
+/* Public Function Implementations                                            */
+/******************************************************************************/
 
-            int resp_pkt_print_index = 0;
-            for(resp_pkt_print_index = 0; resp_pkt_print_index < ret_size; resp_pkt_print_index++)
-            {
-                PLL_INF( BMC_NAME, "0x%x ", print_resp_pkt[ resp_pkt_print_index ] );
-            }
-            PLL_INF( BMC_NAME, "\r\n" );
-#endif
+/**
+ * @brief   Get the next free slot in the receive ring
+ */
+uint8_t *mctp_rx_slot_acquire( uint32_t *slot_size )
+{
+    uint8_t *slot = NULL;
 
-            /* send MCTP response */
-            sent_size = send_mctp_response( RespBuffer, ret_size );
+    if( ( NULL != slot_size ) && ( MCTP_RX_RING_SLOTS > rx_ring.count ) )
+    {
+        /* Leave 2 spaces at the beginning of the slot for dest_slave_addr and size */
+        slot       = &rx_ring.slot[ rx_ring.head ][ MCTP_SMBUS_PREFIX_SIZE ];
+        *slot_size = MCTP_RX_SLOT_SIZE - MCTP_SMBUS_PREFIX_SIZE;
+    }
 
-            if( sent_size != ret_size )
-            {
-                return;                                                        /* send failed; abort */
-            }
+    return slot;
+}
 
-            payload_size -= pkt_size;                                          /* calculate the remaining payload */
-            if( payload_size > 0 )
-            {
-                iOSAL_Task_SleepMs( MCTP_MESSAGE_DELAY_MS );
-                resp->payl.mctp_msg_payload[ MCTP_MAX_PAYLOAD_SIZE ] = saved_byte; /* restore byte wiped out by PEC */
-                resp->seq_num += 1;                                            /* increment sequence number */
-                resp->som      = 0;                                            /* no longer start of message */
-
-                vOSAL_MemMove( resp->payl.mctp_msg_payload,
-                               &resp->payl.mctp_msg_payload[ MCTP_MAX_PAYLOAD_SIZE ],
-                               payload_size );                                 /* move remaining payload to the start of the payload buffer */
-            }
-        }
-        if( ret_size )
-        {
-            //PLL_INF( BMC_NAME, "\n\r MCTP response Success \n\r");
-#if defined( SPDM_DEBUG )
-            PLL_INF( BMC_NAME,
-                     "\r\nTime taken to process the SPDM command : %d ms \r\n",
-                     spdm_tick_stop_time - spdm_tick_start_time );
-#endif
-        }
-        else
-        {
-            PLL_INF( BMC_NAME, "PLDM processing failed\n\r" );
-        }
+/**
+ * @brief   Queue the packet received into the slot from mctp_rx_slot_acquire
+ */
+void mctp_rx_slot_commit( uint32_t packet_size )
+{
+    if( ( MCTP_RX_RING_SLOTS > rx_ring.count ) &&
+        ( 0 < packet_size ) &&
+        ( UINT8_MAX >= packet_size ) )                                         /* must fit the SMBus byte count */
+    {
+        /* The byte count is as the existing i2c message would have it */
+        rx_ring.slot[ rx_ring.head ][ 1 ] = ( uint8_t )packet_size;
+        rx_ring.size[ rx_ring.head ]      = ( uint16_t )( packet_size + MCTP_SMBUS_PREFIX_SIZE );
+        rx_ring.head                      = ( rx_ring.head + 1 ) % MCTP_RX_RING_SLOTS;
+        rx_ring.count++;
+    }
+}
+
+/**
+ * @brief   Check if a received packet can be processed
+ */
+int mctp_rx_ready( void )
+{
+    return ( ( 0 < rx_ring.count ) && ( FALSE == tx_context.active ) ) ? TRUE : FALSE;
+}
 
+/**
+ * @brief   Process the oldest packet in the receive ring
+ */
+int mctp_rx_process( void )
+{
+    int processed = FALSE;
+
+    if( TRUE == mctp_rx_ready() )
+    {
+        process_pmci_packet( rx_ring.slot[ rx_ring.tail ], rx_ring.size[ rx_ring.tail ] );
+
+        rx_ring.tail = ( rx_ring.tail + 1 ) % MCTP_RX_RING_SLOTS;
+        rx_ring.count--;
+        processed = TRUE;
+    }
+
+    return processed;
+}
+
+/**
+ * @brief   Send the next packet of a multi-packet response when it is due
+ */
+int mctp_tx_service( void )
+{
+    if( ( TRUE == tx_context.active ) &&
+        ( MCTP_MESSAGE_DELAY_MS <= ( ulOSAL_GetUptimeMs() - tx_context.last_sent_ms ) ) )
+    {
+        send_next_packet();
     }
 
+    return tx_context.active;
 }
@@ -42,7 +42,6 @@
 /* Externs                                                                    */
 /******************************************************************************/
 
-extern uint8_t ReqBuffer[ MAX_BUFFER_SIZE ];
 extern uint8_t RespBuffer[ MAX_BUFFER_SIZE ];
 
 
@@ -251,51 +250,63 @@ typedef struct PLDM_NUMERIC_SENSOR_NAME_PDR
 /******************************************************************************/
 
 /**
- * @brief   Get a CRC 32 for supplied data
+ * @brief   Build the PLDM command table
  *
- * @param   data    Pointer to the data
- * @param   size    Size of the data
+ * @return  0 on success
+ */
+int pldm_command_init( void );
+
+/**
+ * @brief   Process a PLDM message
  *
- * @return  32-bit CRC
+ * @param   ReqBuff     Pointer to the request message
+ * @param   RespBuff    Pointer to the response message
+ * @param   request_pkt Request or response
  *
+ * @return  Size of the response
  */
-uint32_t ulGetCrc32( const uint8_t data[], size_t size );
+int process_pldm_request( void *ReqBuff, void *RespBuff, int request_pkt );
 
 /**
- * @brief   Get a CRC 8 for supplied data
+ * @brief   Get the next free slot in the MCTP receive ring
  *
- * @param   data    Pointer to the data
- * @param   size    Size of the data
+ * @param   slot_size   Returns the maximum packet size the slot can hold
  *
- * @return  8-bit CRC
+ * @return  Pointer to receive the packet into, or NULL if the ring is full
  *
+ * @note    The packet is not queued until mctp_rx_slot_commit is called
  */
-uint8_t ucGetCrc8( const uint8_t data[], size_t size );
+uint8_t *mctp_rx_slot_acquire( uint32_t *slot_size );
 
 /**
- * @brief   Build the PLDM command table
+ * @brief   Queue the packet received into the slot from mctp_rx_slot_acquire
+ *
+ * @param   packet_size The size of the packet received, 0 to leave the slot free
  *
- * @return  0 on success
  */
-int pldm_command_init( void );
+void mctp_rx_slot_commit( uint32_t packet_size );
 
 /**
- * @brief   Process a PLDM message
- *
- * @param   ReqBuff     Pointer to the request message
- * @param   RespBuff    Pointer to the response message
- * @param   request_pkt Request or response
+ * @brief   Check if a received packet can be processed
  *
- * @return  Size of the response
+ * @return  TRUE if a packet is queued and no response is transmitting
  */
-int process_pldm_request( void *ReqBuff, void *RespBuff, int request_pkt );
+int mctp_rx_ready( void );
 
 /**
- * @brief   Process a received message
+ * @brief   Process the oldest packet in the MCTP receive ring
+ *
+ * @return  TRUE if a packet was processed
  *
- * @param   i2cSlaveReadCount    The size of the data to process
+ * @note    Any response is built in RespBuffer and its first packet sent
+ */
+int mctp_rx_process( void );
+
+/**
+ * @brief   Send the next packet of a multi-packet response when it is due
  *
+ * @return  TRUE while the response is still transmitting
  */
-void process_pmci_request( int i2cSlaveReadCount );
+int mctp_tx_service( void );
 
 #endif /* PLDM_COMMANDS_H_ */
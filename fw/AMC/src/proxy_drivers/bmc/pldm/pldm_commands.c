@@ -167,6 +167,7 @@ int pldm_command_init( void )
      * Do the PDR initiliazations
      */
     vPdrRepoInit();
+    vPdrIndexInit();
 
     if( !CHECK_RANGE( MAX_PLDM_TYPE, 0, POSSIBLE_MAX_PLDM_TYPE ) )
     {
@@ -19,6 +19,7 @@
 #include "pldm_sensors.h"
 #include "eeprom.h"
 #include "bmc_proxy_driver.h"
+#include "crc.h"
 
 
 /******************************************************************************/
@@ -51,6 +52,35 @@ PDR_RepositoryInfo MSP432_PDR_Repository =
 };
 
 
+/******************************************************************************/
+/* Local variables                                                            */
+/******************************************************************************/
+
+static PDR_Index xPdrIndex      = { 0 };
+static int       iPdrIndexBuilt = 0;
+
+
+/******************************************************************************/
+/* Local function declarations                                                */
+/******************************************************************************/
+
+/**
+ * @brief   Find a record in the PDR index
+ *
+ * @param   recordHandle    Handle of the record
+ *
+ * @return  The index entry, or NULL if there is no record with this handle
+ */
+static PDR_IndexEntry *pxPdrIndexFind( uint32_t recordHandle );
+
+/**
+ * @brief   Recalculate the size and CRC of an indexed record
+ *
+ * @param   entry   Index entry to refresh
+ */
+static void vPdrIndexRefreshEntry( PDR_IndexEntry *entry );
+
+
 /******************************************************************************/
 /* Function definitions                                                       */
 /******************************************************************************/
@@ -127,6 +157,7 @@ void update_tid( uint8_t tid )
     repo->repositoryState = ERepoStateUpdateInprogress;
     terminusPDR->TID      = tid;
     terminusPDR->commonHeader.recordChangeNumber += 1;
+    vPdrIndexUpdateRecord( PLDM_TERMINUS_HANDLE );
     vUpdateTimestamp( &repo->updateTimestamp );
     repo->repositoryState = ERepoStateAvailable;
 }
@@ -142,3 +173,141 @@ const PDR_RepositoryInfo *getPDRRepository( void )
 
     return &MSP432_PDR_Repository;
 }
+
+/**
+ * @brief   Build the record handle index of the PDR repository
+ */
+void vPdrIndexInit( void )
+{
+    const PDR_RepositoryInfo *repo = getPDRRepository();
+    uint32_t                 i     = 0;
+    uint32_t                 j     = 0;
+
+    xPdrIndex.entryCount = 0;
+
+    for( i = 0; ( i < repo->recordCount ) && ( i < TOTAL_PDR_COUNT ); i++ )
+    {
+        const CommonPDRFormat *header = repo->PDRRecords[ i ];
+
+        if( NULL != header )
+        {
+            /* Insertion sort by handle - records are normally already in handle order */
+            for( j = xPdrIndex.entryCount;
+                 ( j > 0 ) && ( xPdrIndex.entries[ j - 1 ].recordHandle > header->recordHandle );
+                 j-- )
+            {
+                xPdrIndex.entries[ j ] = xPdrIndex.entries[ j - 1 ];
+            }
+
+            xPdrIndex.entries[ j ].recordHandle = header->recordHandle;
+            xPdrIndex.entries[ j ].record       = ( const uint8_t * )header;
+            xPdrIndex.entryCount++;
+        }
+    }
+
+    for( i = 0; i < xPdrIndex.entryCount; i++ )
+    {
+        vPdrIndexRefreshEntry( &xPdrIndex.entries[ i ] );
+        xPdrIndex.entries[ i ].nextRecordHandle =
+            ( ( i + 1 ) < xPdrIndex.entryCount ) ? xPdrIndex.entries[ i + 1 ].recordHandle : 0;
+    }
+
+    iPdrIndexBuilt = 1;
+}
+
+/**
+ * @brief   Refresh the size and CRC of a single indexed record
+ */
+void vPdrIndexUpdateRecord( uint32_t recordHandle )
+{
+    PDR_IndexEntry *entry = NULL;
+
+    if( iPdrIndexBuilt )
+    {
+        entry = pxPdrIndexFind( recordHandle );
+        if( NULL != entry )
+        {
+            vPdrIndexRefreshEntry( entry );
+        }
+    }
+}
+
+/**
+ * @brief   Look up a record in the PDR index
+ */
+const PDR_IndexEntry *pxPdrIndexLookup( uint32_t recordHandle )
+{
+    if( !iPdrIndexBuilt )
+    {
+        vPdrIndexInit();
+    }
+
+    return pxPdrIndexFind( recordHandle );
+}
+
+/**
+ * @brief   Get the PDR index
+ */
+const PDR_Index *pxGetPdrIndex( void )
+{
+    return &xPdrIndex;
+}
+
+
+/******************************************************************************/
+/* Local function definitions                                                 */
+/******************************************************************************/
+
+/**
+ * @brief   Find a record in the PDR index
+ */
+static PDR_IndexEntry *pxPdrIndexFind( uint32_t recordHandle )
+{
+    PDR_IndexEntry *entry = NULL;
+    uint32_t       low    = 0;
+    uint32_t       high   = xPdrIndex.entryCount;
+
+    xPdrIndex.lookups++;
+
+    /* Handles are allocated sequentially, so the handle is normally the position */
+    if( recordHandle < xPdrIndex.entryCount )
+    {
+        xPdrIndex.probes++;
+        if( xPdrIndex.entries[ recordHandle ].recordHandle == recordHandle )
+        {
+            entry = &xPdrIndex.entries[ recordHandle ];
+        }
+    }
+
+    while( ( NULL == entry ) && ( low < high ) )
+    {
+        uint32_t mid = low + ( ( high - low ) / 2 );
+
+        xPdrIndex.probes++;
+        if( xPdrIndex.entries[ mid ].recordHandle == recordHandle )
+        {
+            entry = &xPdrIndex.entries[ mid ];
+        }
+        else if( xPdrIndex.entries[ mid ].recordHandle < recordHandle )
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return entry;
+}
+
+/**
+ * @brief   Recalculate the size and CRC of an indexed record
+ */
+static void vPdrIndexRefreshEntry( PDR_IndexEntry *entry )
+{
+    const CommonPDRFormat *header = ( const CommonPDRFormat * )entry->record;
+
+    entry->recordSize = header->dataLength + sizeof( CommonPDRFormat );
+    entry->crc8       = ucCRC_Crc8( entry->record, entry->recordSize );
+}
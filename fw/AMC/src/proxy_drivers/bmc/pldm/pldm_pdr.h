@@ -234,6 +234,33 @@ typedef struct PDR_RespositoryInfo
 
 }PDR_RepositoryInfo;
 
+/**
+ * @struct  PDR_IndexEntry
+ * @brief   Location, size and CRC of a single record in the PDR repository
+ */
+typedef struct PDR_IndexEntry
+{
+    uint32_t      recordHandle;
+    uint32_t      nextRecordHandle;                                        /* 0 for the last record */
+    const uint8_t *record;
+    uint16_t      recordSize;                                              /* including the common header */
+    uint8_t       crc8;                                                    /* CRC of the whole record */
+
+} PDR_IndexEntry;
+
+/**
+ * @struct  PDR_Index
+ * @brief   Record handle index of the PDR repository, sorted by handle
+ */
+typedef struct PDR_Index
+{
+    uint32_t       entryCount;
+    uint32_t       lookups;                                                /* lookups performed */
+    uint32_t       probes;                                                 /* entries examined by all lookups */
+    PDR_IndexEntry entries[ TOTAL_PDR_COUNT ];
+
+} PDR_Index;
+
 /**
  * @struct  CommonPDRFormat
  * @brief   Structure to hold common PDR format
@@ -300,6 +327,42 @@ void update_tid( uint8_t tid );
  */
 const PDR_RepositoryInfo *getPDRRepository( void );
 
+/**
+ * @brief   Build the record handle index of the PDR repository
+ *
+ * @note    Precomputes the size and CRC of every record so GetPDR does not
+ *          search the repository or recalculate the CRC on each request.
+ *          Records changed after this must be refreshed with
+ *          vPdrIndexUpdateRecord.
+ */
+void vPdrIndexInit( void );
+
+/**
+ * @brief   Refresh the size and CRC of a single indexed record
+ *
+ * @param   recordHandle    Handle of the record that has changed
+ */
+void vPdrIndexUpdateRecord( uint32_t recordHandle );
+
+/**
+ * @brief   Look up a record in the PDR index
+ *
+ * @param   recordHandle    Handle of the record
+ *
+ * @return  The index entry, or NULL if there is no record with this handle
+ *
+ * @note    Handles are allocated sequentially so a lookup is a single probe;
+ *          a binary search is used if that ever stops being the case.
+ */
+const PDR_IndexEntry *pxPdrIndexLookup( uint32_t recordHandle );
+
+/**
+ * @brief   Get the PDR index
+ *
+ * @return  The location of the PDR index
+ */
+const PDR_Index *pxGetPdrIndex( void );
+
 /**
  * @brief   Update the timestamp
  *
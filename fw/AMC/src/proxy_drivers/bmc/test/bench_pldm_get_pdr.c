@@ -0,0 +1,470 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains a loopback benchmark for the BMC proxy driver. A model
+ * BMC dumps the whole PDR repository with chained GetPDR requests over a
+ * stubbed SMBus, through the MCTP receive ring and packetised responses, and
+ * the round trip time of a full dump is reported.
+ *
+ * @file bench_pldm_get_pdr.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bmc_proxy_driver.h"
+#include "pldm_response.h"
+#include "osal.h"
+#include "pll.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define BENCH_PROXY_ID              ( 5 )
+#define BENCH_UUID_SIZE             ( 16 )                                     /* HAL_UUID_SIZE */
+#define BENCH_DUMPS                 ( 2000 )
+#define BENCH_NS_PER_S              ( 1000000000ULL )
+
+#define BENCH_NUM_TEMPERATURE       ( 32 )
+#define BENCH_NUM_VOLTAGE           ( 32 )
+#define BENCH_NUM_CURRENT           ( 32 )
+#define BENCH_NUM_POWER             ( 8 )
+#define BENCH_NUM_NAMES             ( 32 )
+
+#define BENCH_MAX_MESSAGE_SIZE      ( 512 )
+#define BENCH_REQUEST_COUNT         ( 0xFFFF )                                 /* let the terminus pick the part size */
+
+/* PLDM GetPDR request, as sent by the BMC: MCTP header, PLDM header, then the command */
+#define BENCH_REQ_SIZE              ( 22 )
+#define BENCH_REQ_RECORD_HANDLE     ( 9 )
+#define BENCH_REQ_XFER_HANDLE       ( 13 )
+#define BENCH_REQ_OP_FLAG           ( 17 )
+#define BENCH_REQ_COUNT             ( 18 )
+#define BENCH_REQ_CHANGE_NUMBER     ( 20 )
+
+/* Offsets into a transmitted packet, which starts at the source address */
+#define BENCH_PKT_FLAGS             ( 4 )
+#define BENCH_PKT_PAYLOAD           ( 5 )
+#define BENCH_PKT_SOM               ( 0x80 )
+#define BENCH_PKT_EOM               ( 0x40 )
+
+/* Offsets into a reassembled GetPDR response, which starts at the message type */
+#define BENCH_RESP_CC               ( 4 )
+#define BENCH_RESP_NEXT_RECORD      ( 5 )
+#define BENCH_RESP_NEXT_XFER        ( 9 )
+#define BENCH_RESP_XFER_FLAG        ( 13 )
+#define BENCH_RESP_DATA             ( 16 )
+#define BENCH_RECORD_CHANGE_NUMBER  ( 6 )                                      /* in the common PDR header */
+
+#define BENCH_OP_GET_NEXT_PART      ( 0x0 )
+#define BENCH_OP_GET_FIRST_PART     ( 0x1 )
+#define BENCH_XFER_START            ( 0x0 )
+#define BENCH_XFER_MIDDLE           ( 0x1 )
+
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * @struct  BENCH_BMC
+ * @brief   State of the model BMC walking the repository
+ */
+typedef struct BENCH_BMC
+{
+    uint8_t  pucRequest[ BENCH_REQ_SIZE ];
+    int      iRequestPending;
+    int      iDone;
+    int      iFailed;
+
+    uint8_t  pucMessage[ BENCH_MAX_MESSAGE_SIZE ];
+    uint32_t ulMessageSize;
+
+    uint32_t ulRecordHandle;
+    uint16_t usChangeNumber;
+
+    uint32_t ulRecords;
+    uint32_t ulRequests;
+    uint32_t ulPackets;
+    uint32_t ulBytes;
+
+} BENCH_BMC;
+
+
+/*****************************************************************************/
+/* External functions                                                        */
+/*****************************************************************************/
+
+extern void vEmulateReceivedMessage( uint8_t *pucData, uint16_t usDatasize );
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static PLDM_NUMERIC_SENSOR_PDR      pxTemperature[ BENCH_NUM_TEMPERATURE ] = { 0 };
+static PLDM_NUMERIC_SENSOR_PDR      pxVoltage[ BENCH_NUM_VOLTAGE ]         = { 0 };
+static PLDM_NUMERIC_SENSOR_PDR      pxCurrent[ BENCH_NUM_CURRENT ]         = { 0 };
+static PLDM_NUMERIC_SENSOR_PDR      pxPower[ BENCH_NUM_POWER ]             = { 0 };
+static PLDM_NUMERIC_SENSOR_NAME_PDR pxNames[ BENCH_NUM_NAMES ]             = { 0 };
+static uint8_t                      pucUuid[ BENCH_UUID_SIZE ]             = { 0 };
+
+static FW_IF_CFG xFwIf = { 0 };
+
+static void     ( *pxTaskFunc )( void *pvTaskParam ) = NULL;
+static jmp_buf  xTaskExit;
+
+/* Advances on every read, so packet pacing is in task loops rather than real time */
+static uint32_t ulUptimeMs = 0;
+
+static BENCH_BMC xBmc = { { 0 } };
+
+
+/*****************************************************************************/
+/* Stubs                                                                     */
+/*****************************************************************************/
+
+void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+{
+}
+
+uint32_t ulOSAL_GetUptimeMs( void )
+{
+    return ulUptimeMs;
+}
+
+int iOSAL_Task_SleepMs( uint32_t ulSleepMs )
+{
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Create( void **ppvMutexHandle, const char *pcMutexName )
+{
+    *ppvMutexHandle = ( void * )1;
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Take( void *pvMutexHandle, uint32_t ulTimeoutMs )
+{
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Release( void *pvMutexHandle )
+{
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Semaphore_Create( void **ppvSemHandle, uint32_t ullCount, uint32_t ullBucket, const char *pcSemName )
+{
+    *ppvSemHandle = ( void * )1;
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Task_Create( void **ppvTaskHandle,
+                       void ( *pvTaskFunction )( void *pvTaskParam ),
+                       uint16_t usTaskStackSize,
+                       void *pvTaskParam,
+                       uint32_t ulTaskPriority,
+                       const char *pcTaskName )
+{
+    pxTaskFunc     = pvTaskFunction;
+    *ppvTaskHandle = ( void * )1;
+
+    return OSAL_ERRORS_NONE;
+}
+
+void *pvOSAL_MemAlloc( uint16_t xSize )
+{
+    return malloc( xSize );
+}
+
+void *pvOSAL_MemSet( void *pvDestination, int iValue, uint16_t usSize )
+{
+    return memset( pvDestination, iValue, usSize );
+}
+
+void *pvOSAL_MemCpy( void *pvDestination, const void *pvSource, uint16_t usSize )
+{
+    return memcpy( pvDestination, pvSource, usSize );
+}
+
+void vOSAL_MemMove( void *pvDestination, void *pvSource, uint16_t usPayload_size )
+{
+    memmove( pvDestination, pvSource, usPayload_size );
+}
+
+int iEVL_CreateRecord( EVL_RECORD **ppxRecord )
+{
+    *ppxRecord = ( EVL_RECORD * )1;
+
+    return OK;
+}
+
+int iEVL_BindCallback( EVL_RECORD *pxRecord, EVL_CALLBACK *pxNewCallback )
+{
+    return OK;
+}
+
+int iEVL_RaiseEvent( EVL_RECORD *pxRecord, EVL_SIGNAL *pxSignal )
+{
+    return OK;
+}
+
+static uint32_t ulFwIfOpen( void *pvFwIf )
+{
+    return FW_IF_ERRORS_NONE;
+}
+
+/* The BMC side of the bus - hands over the next request, once the dump is done stop the task */
+static uint32_t ulFwIfRead( void *pvFwIf, uint64_t ullSrcPort, uint8_t *pucData, uint32_t *pulSize, uint32_t ulTimeoutMs )
+{
+    ulUptimeMs++;
+
+    if( ( TRUE == xBmc.iDone ) || ( TRUE == xBmc.iFailed ) )
+    {
+        longjmp( xTaskExit, 1 );
+    }
+
+    if( TRUE == xBmc.iRequestPending )
+    {
+        memcpy( pucData, xBmc.pucRequest, BENCH_REQ_SIZE );
+        *pulSize             = BENCH_REQ_SIZE;
+        xBmc.iRequestPending = FALSE;
+        xBmc.ulRequests++;
+    }
+    else
+    {
+        *pulSize = 0;
+    }
+
+    return FW_IF_ERRORS_NONE;
+}
+
+static void vPutLe32( uint8_t *pucData, uint32_t ulValue )
+{
+    pucData[ 0 ] = ( uint8_t )( ulValue );
+    pucData[ 1 ] = ( uint8_t )( ulValue >> 8 );
+    pucData[ 2 ] = ( uint8_t )( ulValue >> 16 );
+    pucData[ 3 ] = ( uint8_t )( ulValue >> 24 );
+}
+
+static uint32_t ulGetLe32( const uint8_t *pucData )
+{
+    return ( uint32_t )pucData[ 0 ] |
+           ( ( uint32_t )pucData[ 1 ] << 8 ) |
+           ( ( uint32_t )pucData[ 2 ] << 16 ) |
+           ( ( uint32_t )pucData[ 3 ] << 24 );
+}
+
+static void vQueueGetPdr( uint32_t ulRecordHandle, uint32_t ulXferHandle, uint8_t ucOpFlag )
+{
+    static const uint8_t pucHeader[ BENCH_REQ_RECORD_HANDLE ] =
+    {
+        0x21, 0x01, 0x00, 0x09, 0xc8, 0x01, 0x9e, 0x02, 0x51
+    };
+
+    memcpy( xBmc.pucRequest, pucHeader, sizeof( pucHeader ) );
+    vPutLe32( &xBmc.pucRequest[ BENCH_REQ_RECORD_HANDLE ], ulRecordHandle );
+    vPutLe32( &xBmc.pucRequest[ BENCH_REQ_XFER_HANDLE ], ulXferHandle );
+    xBmc.pucRequest[ BENCH_REQ_OP_FLAG ]              = ucOpFlag;
+    xBmc.pucRequest[ BENCH_REQ_COUNT ]                = ( uint8_t )( BENCH_REQUEST_COUNT );
+    xBmc.pucRequest[ BENCH_REQ_COUNT + 1 ]            = ( uint8_t )( BENCH_REQUEST_COUNT >> 8 );
+    xBmc.pucRequest[ BENCH_REQ_CHANGE_NUMBER ]        = ( uint8_t )( xBmc.usChangeNumber );
+    xBmc.pucRequest[ BENCH_REQ_CHANGE_NUMBER + 1 ]    = ( uint8_t )( xBmc.usChangeNumber >> 8 );
+
+    xBmc.ulRecordHandle  = ulRecordHandle;
+    xBmc.iRequestPending = TRUE;
+}
+
+/* A complete GetPDR response - ask for the next part or the next record */
+static void vHandleResponse( void )
+{
+    uint8_t  *pucMsg        = xBmc.pucMessage;
+    uint32_t ulNextRecord   = 0;
+    uint32_t ulNextXfer     = 0;
+    uint8_t  ucXferFlag     = 0;
+
+    if( ( BENCH_RESP_DATA > xBmc.ulMessageSize ) || ( RESP_PLDM_SUCCESS != pucMsg[ BENCH_RESP_CC ] ) )
+    {
+        xBmc.iFailed = TRUE;
+        return;
+    }
+
+    ulNextRecord = ulGetLe32( &pucMsg[ BENCH_RESP_NEXT_RECORD ] );
+    ulNextXfer   = ulGetLe32( &pucMsg[ BENCH_RESP_NEXT_XFER ] );
+    ucXferFlag   = pucMsg[ BENCH_RESP_XFER_FLAG ];
+
+    if( BENCH_XFER_START == ucXferFlag )
+    {
+        xBmc.usChangeNumber = ( uint16_t )( pucMsg[ BENCH_RESP_DATA + BENCH_RECORD_CHANGE_NUMBER ] |
+                                            ( pucMsg[ BENCH_RESP_DATA + BENCH_RECORD_CHANGE_NUMBER + 1 ] << 8 ) );
+    }
+
+    if( ( BENCH_XFER_START == ucXferFlag ) || ( BENCH_XFER_MIDDLE == ucXferFlag ) )
+    {
+        vQueueGetPdr( xBmc.ulRecordHandle, ulNextXfer, BENCH_OP_GET_NEXT_PART );
+    }
+    else
+    {
+        xBmc.ulRecords++;
+
+        if( 0 == ulNextRecord )
+        {
+            xBmc.iDone = TRUE;
+        }
+        else
+        {
+            vQueueGetPdr( ulNextRecord, 0, BENCH_OP_GET_FIRST_PART );
+        }
+    }
+}
+
+/* The BMC side of the bus - reassembles the response packets */
+static uint32_t ulFwIfWrite( void *pvFwIf, uint64_t ullDstPort, uint8_t *pucData, uint32_t ulSize, uint32_t ulTimeoutMs )
+{
+    uint32_t ulPayload = ulSize - BENCH_PKT_PAYLOAD;
+
+    xBmc.ulPackets++;
+    xBmc.ulBytes += ulSize;
+
+    if( 0 != ( pucData[ BENCH_PKT_FLAGS ] & BENCH_PKT_SOM ) )
+    {
+        xBmc.ulMessageSize = 0;
+    }
+
+    if( ( xBmc.ulMessageSize + ulPayload ) > BENCH_MAX_MESSAGE_SIZE )
+    {
+        xBmc.iFailed = TRUE;
+    }
+    else
+    {
+        memcpy( &xBmc.pucMessage[ xBmc.ulMessageSize ], &pucData[ BENCH_PKT_PAYLOAD ], ulPayload );
+        xBmc.ulMessageSize += ulPayload;
+
+        if( 0 != ( pucData[ BENCH_PKT_FLAGS ] & BENCH_PKT_EOM ) )
+        {
+            vHandleResponse();
+        }
+    }
+
+    return FW_IF_ERRORS_NONE;
+}
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static uint64_t ullNowNs( void )
+{
+    struct timespec xTs = { 0 };
+
+    clock_gettime( CLOCK_MONOTONIC, &xTs );
+
+    return ( ( uint64_t )xTs.tv_sec * BENCH_NS_PER_S ) + xTs.tv_nsec;
+}
+
+static void vFillPdr( PLDM_NUMERIC_SENSOR_PDR *pxPdr, int iCount, uint16_t usBaseId )
+{
+    int i = 0;
+
+    for( i = 0; i < iCount; i++ )
+    {
+        pxPdr[ i ].usSensorId = usBaseId + i;
+    }
+}
+
+/**
+ * @brief   Run the proxy task until the model BMC has walked the whole repository
+ *
+ * @return  0 if every GetPDR completed
+ */
+static int iRunDump( void )
+{
+    memset( &xBmc, 0, sizeof( xBmc ) );
+    vQueueGetPdr( 0, 0, BENCH_OP_GET_FIRST_PART );
+
+    if( 0 == setjmp( xTaskExit ) )
+    {
+        pxTaskFunc( NULL );
+    }
+
+    return ( TRUE == xBmc.iDone ) ? 0 : -1;
+}
+
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+int main( void )
+{
+    uint64_t ullStart     = 0;
+    uint64_t ullNs        = 0;
+    uint32_t ulStartLoops = 0;
+    uint32_t i            = 0;
+
+    xFwIf.open  = ulFwIfOpen;
+    xFwIf.read  = ulFwIfRead;
+    xFwIf.write = ulFwIfWrite;
+
+    vFillPdr( pxTemperature, BENCH_NUM_TEMPERATURE, 0x000 );
+    vFillPdr( pxVoltage, BENCH_NUM_VOLTAGE, 0x100 );
+    vFillPdr( pxCurrent, BENCH_NUM_CURRENT, 0x200 );
+    vFillPdr( pxPower, BENCH_NUM_POWER, 0x300 );
+
+    if( ( OK != iBMC_Initialise( BENCH_PROXY_ID, &xFwIf, 0, 0, 0,
+                                 pxTemperature, BENCH_NUM_TEMPERATURE,
+                                 pxVoltage, BENCH_NUM_VOLTAGE,
+                                 pxCurrent, BENCH_NUM_CURRENT,
+                                 pxPower, BENCH_NUM_POWER,
+                                 pxNames, BENCH_NUM_NAMES,
+                                 pucUuid ) ) ||
+        ( NULL == pxTaskFunc ) )
+    {
+        printf( "BMC proxy initialisation failed\n" );
+        return 1;
+    }
+
+    /* Warm up, and check the dump completes */
+    if( 0 != iRunDump() )
+    {
+        printf( "GetPDR dump failed after %u records\n", xBmc.ulRecords );
+        return 1;
+    }
+
+    ulStartLoops = ulUptimeMs;
+    ullStart     = ullNowNs();
+    for( i = 0; i < BENCH_DUMPS; i++ )
+    {
+        ( void )iRunDump();
+    }
+    ullNs = ullNowNs() - ullStart;
+
+    printf( "%8s %8s %8s %8s %12s %12s %14s\n",
+            "records", "requests", "packets", "bytes", "dump_us", "request_us", "task_loops" );
+    printf( "%8u %8u %8u %8u %12.2f %12.3f %14.1f\n",
+            xBmc.ulRecords,
+            xBmc.ulRequests,
+            xBmc.ulPackets,
+            xBmc.ulBytes,
+            ( double )ullNs / ( BENCH_DUMPS * 1000.0 ),
+            ( double )ullNs / ( ( double )BENCH_DUMPS * xBmc.ulRequests * 1000.0 ),
+            ( double )( ulUptimeMs - ulStartLoops ) / BENCH_DUMPS );
+
+    return 0;
+}
@@ -0,0 +1,488 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains tests for the BMC proxy driver sensor snapshot. PLDM
+ * GetSensorReading requests are fed through vEmulateReceivedMessage and the
+ * proxy task, and the number of events raised per request is checked.
+ *
+ * @file test_bmc_sensor_snapshot.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "bmc_proxy_driver.h"
+#include "pldm_response.h"
+#include "osal.h"
+#include "pll.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_PROXY_ID               ( 5 )
+#define TEST_MAX_TX_SIZE            ( 256 )
+#define TEST_INVALID_SENSOR_ID      ( 0x55 )
+#define TEST_FALLBACK_READING       ( -7 )
+#define TEST_PASSES                 ( 3 )
+#define TEST_UUID_SIZE              ( 16 )                                     /* HAL_UUID_SIZE */
+
+/* Mutexes are handed out in creation order - the snapshot mutex is the second */
+#define TEST_MAX_MUTEXES            ( 4 )
+#define TEST_SNAPSHOT_MUTEX         ( ( void * )2 )
+
+/* Offsets into the transmitted GetSensorReading response */
+#define TEST_RESP_CC_OFFSET         ( 9 )
+#define TEST_RESP_READING_OFFSET    ( 16 )
+
+/* PLDM GetSensorReading request, as sent by the BMC debug commands */
+#define TEST_REQ_SIZE               ( 12 )
+#define TEST_REQ_SENSOR_ID_LO       ( 9 )
+#define TEST_REQ_SENSOR_ID_HI       ( 10 )
+
+
+/*****************************************************************************/
+/* External functions                                                        */
+/*****************************************************************************/
+
+extern void vEmulateReceivedMessage( uint8_t *pucData, uint16_t usDatasize );
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static const uint16_t pusSensorIds[ ] =
+{
+    0x001, 0x002, 0x003,                                                       /* temperature */
+    0x101, 0x102,                                                              /* voltage */
+    0x201,                                                                     /* current */
+    0x301                                                                      /* power */
+};
+#define TEST_NUM_SENSORS ( sizeof( pusSensorIds ) / sizeof( pusSensorIds[ 0 ] ) )
+
+static PLDM_NUMERIC_SENSOR_PDR      pxTemperature[ 3 ] = { 0 };
+static PLDM_NUMERIC_SENSOR_PDR      pxVoltage[ 2 ]     = { 0 };
+static PLDM_NUMERIC_SENSOR_PDR      pxCurrent[ 1 ]     = { 0 };
+static PLDM_NUMERIC_SENSOR_PDR      pxPower[ 1 ]       = { 0 };
+static PLDM_NUMERIC_SENSOR_NAME_PDR pxNames[ 1 ]       = { 0 };
+static uint8_t                      pucUuid[ TEST_UUID_SIZE ] = { 0 };
+
+static FW_IF_CFG xFwIf = { 0 };
+
+static void     ( *pxTaskFunc )( void *pvTaskParam ) = NULL;
+static jmp_buf  xTaskExit;
+static int      iReadCalls = 0;
+
+static uint8_t  pucTxData[ TEST_MAX_TX_SIZE ] = { 0 };
+static uint32_t ulTxSize                      = 0;
+
+static uint32_t ulUptimeMs = 1000;
+
+static EVL_CALLBACK *pxBoundCallback = NULL;
+static int          piEventCount[ MAX_BMC_PROXY_DRIVER_EVENTS ] = { 0 };
+
+static uint16_t     usFailSensorId = 0;
+
+static uintptr_t    ulNumMutexes                         = 0;
+static int          piMutexHeld[ TEST_MAX_MUTEXES + 1 ] = { 0 };
+static void         *pvFailMutex                         = NULL;
+
+
+/*****************************************************************************/
+/* Stubs                                                                     */
+/*****************************************************************************/
+
+void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+{
+}
+
+uint32_t ulOSAL_GetUptimeMs( void )
+{
+    return ulUptimeMs;
+}
+
+int iOSAL_Task_SleepMs( uint32_t ulSleepMs )
+{
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Create( void **ppvMutexHandle, const char *pcMutexName )
+{
+    assert_true( TEST_MAX_MUTEXES > ulNumMutexes );
+    *ppvMutexHandle = ( void * )++ulNumMutexes;
+
+    return OSAL_ERRORS_NONE;
+}
+
+/* Mutexes are not recursive - taking one that is already held would deadlock */
+int iOSAL_Mutex_Take( void *pvMutexHandle, uint32_t ulTimeoutMs )
+{
+    uintptr_t ulHandle = ( uintptr_t )pvMutexHandle;
+
+    assert_true( ( 0 < ulHandle ) && ( ulNumMutexes >= ulHandle ) );
+
+    if( pvMutexHandle == pvFailMutex )
+    {
+        return OSAL_ERRORS_OS_IMPLEMENTATION;
+    }
+
+    assert_false( piMutexHeld[ ulHandle ] );
+    piMutexHeld[ ulHandle ] = TRUE;
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Mutex_Release( void *pvMutexHandle )
+{
+    uintptr_t ulHandle = ( uintptr_t )pvMutexHandle;
+
+    assert_true( ( 0 < ulHandle ) && ( ulNumMutexes >= ulHandle ) );
+    assert_true( piMutexHeld[ ulHandle ] );
+    piMutexHeld[ ulHandle ] = FALSE;
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Semaphore_Create( void **ppvSemHandle, uint32_t ullCount, uint32_t ullBucket, const char *pcSemName )
+{
+    *ppvSemHandle = ( void * )1;
+
+    return OSAL_ERRORS_NONE;
+}
+
+int iOSAL_Task_Create( void **ppvTaskHandle,
+                       void ( *pvTaskFunction )( void *pvTaskParam ),
+                       uint16_t usTaskStackSize,
+                       void *pvTaskParam,
+                       uint32_t ulTaskPriority,
+                       const char *pcTaskName )
+{
+    pxTaskFunc     = pvTaskFunction;
+    *ppvTaskHandle = ( void * )1;
+
+    return OSAL_ERRORS_NONE;
+}
+
+void *pvOSAL_MemAlloc( uint16_t xSize )
+{
+    return malloc( xSize );
+}
+
+void *pvOSAL_MemSet( void *pvDestination, int iValue, uint16_t usSize )
+{
+    return memset( pvDestination, iValue, usSize );
+}
+
+void *pvOSAL_MemCpy( void *pvDestination, const void *pvSource, uint16_t usSize )
+{
+    return memcpy( pvDestination, pvSource, usSize );
+}
+
+void vOSAL_MemMove( void *pvDestination, void *pvSource, uint16_t usPayload_size )
+{
+    memmove( pvDestination, pvSource, usPayload_size );
+}
+
+/* Single record, single binding - counts every event raised */
+int iEVL_CreateRecord( EVL_RECORD **ppxRecord )
+{
+    *ppxRecord = ( EVL_RECORD * )1;
+
+    return OK;
+}
+
+int iEVL_BindCallback( EVL_RECORD *pxRecord, EVL_CALLBACK *pxNewCallback )
+{
+    pxBoundCallback = pxNewCallback;
+
+    return OK;
+}
+
+int iEVL_RaiseEvent( EVL_RECORD *pxRecord, EVL_SIGNAL *pxSignal )
+{
+    piEventCount[ pxSignal->ucEventType ]++;
+
+    return ( NULL != pxBoundCallback ) ? pxBoundCallback( pxSignal ) : OK;
+}
+
+static uint32_t ulFwIfOpen( void *pvFwIf )
+{
+    return FW_IF_ERRORS_NONE;
+}
+
+/* Message arrives through vEmulateReceivedMessage, so the first read leaves the buffer alone */
+static uint32_t ulFwIfRead( void *pvFwIf, uint64_t ullSrcPort, uint8_t *pucData, uint32_t *pulSize, uint32_t ulTimeoutMs )
+{
+    if( 0 != iReadCalls++ )
+    {
+        longjmp( xTaskExit, 1 );
+    }
+
+    return FW_IF_ERRORS_NONE;
+}
+
+static uint32_t ulFwIfWrite( void *pvFwIf, uint64_t ullDstPort, uint8_t *pucData, uint32_t ulSize, uint32_t ulTimeoutMs )
+{
+    ulTxSize = ( ulSize < TEST_MAX_TX_SIZE ) ? ulSize : TEST_MAX_TX_SIZE;
+    memcpy( pucTxData, pucData, ulTxSize );
+
+    return FW_IF_ERRORS_NONE;
+}
+
+/* Stands in for the out of band application */
+static int iTestBmcCallback( EVL_SIGNAL *pxSignal )
+{
+    if( BMC_PROXY_DRIVER_E_GET_SENSOR_INFO == pxSignal->ucEventType )
+    {
+        int16_t ssSensorId = 0;
+        uint8_t ucState    = 0;
+
+        assert_int_equal( OK, iBMC_GetSensorIdRequest( pxSignal, &ssSensorId, &ucState ) );
+        iBMC_SendResponseForGetSensor( pxSignal, ssSensorId, TEST_FALLBACK_READING, 0, BMC_GET_SENSOR_RESP_OK );
+    }
+
+    return OK;
+}
+
+static int iTestReadSensor( uint16_t usSensorId,
+                            int16_t *pssReading,
+                            uint8_t *pucSensorState,
+                            BMC_GET_SENSOR_RESPONSE *pxResponse )
+{
+    int iStatus = OK;
+
+    if( usSensorId == usFailSensorId )
+    {
+        iStatus = ERROR;
+    }
+    else
+    {
+        *pssReading     = ( int16_t )( usSensorId * 3 );
+        *pucSensorState = 0;
+        *pxResponse     = BMC_GET_SENSOR_RESP_OK;
+    }
+
+    return iStatus;
+}
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static void vFillPdr( PLDM_NUMERIC_SENSOR_PDR *pxPdr, int iCount, const uint16_t *pusIds )
+{
+    int i = 0;
+
+    for( i = 0; i < iCount; i++ )
+    {
+        pxPdr[ i ].usSensorId = pusIds[ i ];
+    }
+}
+
+/* Send one GetSensorReading and run the proxy task until it polls again */
+static void vRequestReading( uint16_t usSensorId, uint8_t *pucCompletionCode, int16_t *pssReading )
+{
+    uint8_t pucRequest[ TEST_REQ_SIZE ] =
+    {
+        0x21, 0x01, 0x00, 0x09, 0xc8, 0x01, 0x9e, 0x02, 0x11, 0x00, 0x00, 0x00
+    };
+
+    pucRequest[ TEST_REQ_SENSOR_ID_LO ] = ( uint8_t )( usSensorId & 0xFF );
+    pucRequest[ TEST_REQ_SENSOR_ID_HI ] = ( uint8_t )( usSensorId >> 8 );
+
+    ulTxSize   = 0;
+    iReadCalls = 0;
+    vEmulateReceivedMessage( pucRequest, sizeof( pucRequest ) );
+
+    if( 0 == setjmp( xTaskExit ) )
+    {
+        pxTaskFunc( NULL );
+    }
+
+    /* The task is left mid-loop, holding the mutex around its next read */
+    memset( piMutexHeld, 0, sizeof( piMutexHeld ) );
+
+    assert_true( ulTxSize > TEST_RESP_CC_OFFSET );
+    *pucCompletionCode = pucTxData[ TEST_RESP_CC_OFFSET ];
+
+    if( RESP_PLDM_SUCCESS == *pucCompletionCode )
+    {
+        assert_true( ulTxSize > TEST_RESP_READING_OFFSET + 1 );
+        *pssReading = ( int16_t )( pucTxData[ TEST_RESP_READING_OFFSET ] |
+                                   ( pucTxData[ TEST_RESP_READING_OFFSET + 1 ] << 8 ) );
+    }
+}
+
+static int iSetup( void **state )
+{
+    xFwIf.open  = ulFwIfOpen;
+    xFwIf.read  = ulFwIfRead;
+    xFwIf.write = ulFwIfWrite;
+
+    vFillPdr( pxTemperature, 3, &pusSensorIds[ 0 ] );
+    vFillPdr( pxVoltage, 2, &pusSensorIds[ 3 ] );
+    vFillPdr( pxCurrent, 1, &pusSensorIds[ 5 ] );
+    vFillPdr( pxPower, 1, &pusSensorIds[ 6 ] );
+
+    assert_int_equal( OK, iBMC_Initialise( TEST_PROXY_ID, &xFwIf, 0, 0, 0,
+                                           pxTemperature, 3,
+                                           pxVoltage, 2,
+                                           pxCurrent, 1,
+                                           pxPower, 1,
+                                           pxNames, 1,
+                                           pucUuid ) );
+    assert_int_equal( OK, iBMC_BindCallback( &iTestBmcCallback ) );
+    assert_non_null( pxTaskFunc );
+
+    return 0;
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_unrefreshed_falls_back( void **state )
+{
+    uint8_t ucCompletionCode = 0;
+    int16_t ssReading        = 0;
+
+    /* No sweep yet - the request goes to the out of band application */
+    memset( piEventCount, 0, sizeof( piEventCount ) );
+    vRequestReading( pusSensorIds[ 0 ], &ucCompletionCode, &ssReading );
+
+    assert_int_equal( RESP_PLDM_SUCCESS, ucCompletionCode );
+    assert_int_equal( TEST_FALLBACK_READING, ssReading );
+    assert_int_equal( 1, piEventCount[ BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ] );
+}
+
+static void test_snapshot_serves_requests( void **state )
+{
+    uint8_t  ucCompletionCode = 0;
+    int16_t  ssReading        = 0;
+    uint32_t ulPass           = 0;
+    uint32_t i                = 0;
+
+    assert_int_equal( OK, iBMC_RefreshSensorSnapshot( &iTestReadSensor ) );
+
+    memset( piEventCount, 0, sizeof( piEventCount ) );
+    for( ulPass = 0; ulPass < TEST_PASSES; ulPass++ )
+    {
+        for( i = 0; i < TEST_NUM_SENSORS; i++ )
+        {
+            vRequestReading( pusSensorIds[ i ], &ucCompletionCode, &ssReading );
+
+            assert_int_equal( RESP_PLDM_SUCCESS, ucCompletionCode );
+            assert_int_equal( ( int16_t )( pusSensorIds[ i ] * 3 ), ssReading );
+        }
+    }
+
+    /* Only the arrival notification, no per-request sensor round trip */
+    assert_int_equal( 0, piEventCount[ BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ] );
+    assert_int_equal( TEST_PASSES * TEST_NUM_SENSORS, piEventCount[ BMC_PROXY_DRIVER_E_MSG_ARRIVAL ] );
+}
+
+static void test_invalid_sensor_id( void **state )
+{
+    uint8_t ucCompletionCode = 0;
+    int16_t ssReading        = 0;
+
+    memset( piEventCount, 0, sizeof( piEventCount ) );
+    vRequestReading( TEST_INVALID_SENSOR_ID, &ucCompletionCode, &ssReading );
+
+    assert_int_equal( RESP_INVALID_SENSOR_ID, ucCompletionCode );
+    assert_int_equal( 0, piEventCount[ BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ] );
+}
+
+static void test_failed_read_falls_back( void **state )
+{
+    uint8_t ucCompletionCode = 0;
+    int16_t ssReading        = 0;
+
+    usFailSensorId = pusSensorIds[ 1 ];
+    assert_int_equal( ERROR, iBMC_RefreshSensorSnapshot( &iTestReadSensor ) );
+    usFailSensorId = 0;
+
+    memset( piEventCount, 0, sizeof( piEventCount ) );
+    vRequestReading( pusSensorIds[ 1 ], &ucCompletionCode, &ssReading );
+    assert_int_equal( RESP_PLDM_SUCCESS, ucCompletionCode );
+    assert_int_equal( TEST_FALLBACK_READING, ssReading );
+    assert_int_equal( 1, piEventCount[ BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ] );
+
+    /* The rest of the sweep is still served from the snapshot */
+    vRequestReading( pusSensorIds[ 2 ], &ucCompletionCode, &ssReading );
+    assert_int_equal( RESP_PLDM_SUCCESS, ucCompletionCode );
+    assert_int_equal( ( int16_t )( pusSensorIds[ 2 ] * 3 ), ssReading );
+    assert_int_equal( 1, piEventCount[ BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ] );
+}
+
+static void test_stale_snapshot_falls_back( void **state )
+{
+    uint8_t ucCompletionCode = 0;
+    int16_t ssReading        = 0;
+
+    assert_int_equal( OK, iBMC_RefreshSensorSnapshot( &iTestReadSensor ) );
+
+    /* Sweeps have stopped */
+    ulUptimeMs += BMC_SNAPSHOT_MAX_AGE_MS + 1;
+
+    memset( piEventCount, 0, sizeof( piEventCount ) );
+    vRequestReading( pusSensorIds[ 3 ], &ucCompletionCode, &ssReading );
+
+    assert_int_equal( RESP_PLDM_SUCCESS, ucCompletionCode );
+    assert_int_equal( TEST_FALLBACK_READING, ssReading );
+    assert_int_equal( 1, piEventCount[ BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ] );
+}
+
+static void test_snapshot_read_under_lock( void **state )
+{
+    uint8_t ucCompletionCode = 0;
+    int16_t ssReading        = 0;
+
+    assert_int_equal( OK, iBMC_RefreshSensorSnapshot( &iTestReadSensor ) );
+
+    /* The entry is only read under the snapshot mutex - without it, fall back */
+    pvFailMutex = TEST_SNAPSHOT_MUTEX;
+    memset( piEventCount, 0, sizeof( piEventCount ) );
+    vRequestReading( pusSensorIds[ 4 ], &ucCompletionCode, &ssReading );
+    pvFailMutex = NULL;
+
+    assert_int_equal( RESP_PLDM_SUCCESS, ucCompletionCode );
+    assert_int_equal( TEST_FALLBACK_READING, ssReading );
+    assert_int_equal( 1, piEventCount[ BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ] );
+
+    /* Once the mutex is available again the snapshot answers */
+    vRequestReading( pusSensorIds[ 4 ], &ucCompletionCode, &ssReading );
+    assert_int_equal( RESP_PLDM_SUCCESS, ucCompletionCode );
+    assert_int_equal( ( int16_t )( pusSensorIds[ 4 ] * 3 ), ssReading );
+    assert_int_equal( 1, piEventCount[ BMC_PROXY_DRIVER_E_GET_SENSOR_INFO ] );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test( test_unrefreshed_falls_back ),
+        cmocka_unit_test( test_snapshot_serves_requests ),
+        cmocka_unit_test( test_invalid_sensor_id ),
+        cmocka_unit_test( test_failed_read_falls_back ),
+        cmocka_unit_test( test_stale_snapshot_falls_back ),
+        cmocka_unit_test( test_snapshot_read_under_lock ),
+    };
+
+    return cmocka_run_group_tests( tests, iSetup, NULL );
+}
@@ -0,0 +1,414 @@
+/**
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * This file contains tests for the PLDM GetPDR command. A synthetic PDR
+ * repository is enumerated with chained multipart GetPDR requests, and the
+ * record handle index is checked to resolve every request with one probe.
+ *
+ * @file test_pldm_get_pdr.c
+ *
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cmocka.h"
+
+#include "pldm.h"
+#include "pldm_pdr.h"
+#include "pldm_processor.h"
+#include "pldm_response.h"
+#include "pll.h"
+#include "crc.h"
+
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_RECORD_BUFFER_SIZE ( TOTAL_PDR_COUNT * 256 )
+#define TEST_RESPONSE_SIZE      ( 256 )
+#define TEST_PART_SIZE          ( 16 )                                         /* forces most records into several parts */
+#define TEST_WHOLE_RECORD       ( 0xFFFF )
+#define TEST_PENDING_XFERS      ( 4 )                                          /* PDR_PENDING_XFER_SLOTS */
+
+#define TEST_GET_NEXT_PART      ( 0x0 )
+#define TEST_GET_FIRST_PART     ( 0x1 )
+
+#define TEST_XFER_START         ( 0x0 )
+#define TEST_XFER_MIDDLE        ( 0x1 )
+#define TEST_XFER_END           ( 0x4 )
+#define TEST_XFER_START_AND_END ( 0x5 )
+
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+typedef struct __attribute__ ( ( __packed__ ) ) TEST_GET_PDR_REQ
+{
+    uint32_t recordHandle;
+    uint32_t dataTransferHandle;
+    uint8_t  OperationFlag;
+    uint16_t requestCount;
+    uint16_t recordChangeNumber;
+
+} TEST_GET_PDR_REQ;
+
+typedef struct __attribute__ ( ( __packed__ ) ) TEST_GET_PDR_RES
+{
+    uint8_t  CompletionCode;
+    uint32_t nextRecordHandle;
+    uint32_t nextDataTransferHandle;
+    uint8_t  transferFlag;
+    uint16_t responseCount;
+    uint8_t  recordData[ 0 ];
+
+} TEST_GET_PDR_RES;
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+extern PDR_RepositoryInfo MSP432_PDR_Repository;
+
+static uint8_t  pucRecordBuffer[ TEST_RECORD_BUFFER_SIZE ] = { 0 };
+static uint16_t pusRecordSize[ TOTAL_PDR_COUNT ]           = { 0 };
+
+
+/*****************************************************************************/
+/* Stubs                                                                     */
+/*****************************************************************************/
+
+/* Synthetic repository: the terminus locator then records of varying sizes */
+void vPdrRepoInit( void )
+{
+    static int         iIsRepoInitialized = 0;
+    PDR_RepositoryInfo *pxRepo            = &MSP432_PDR_Repository;
+    uint8_t            *pucRecord         = pucRecordBuffer;
+    uint32_t           i                  = 0;
+    uint32_t           j                  = 0;
+
+    if( iIsRepoInitialized )
+    {
+        return;
+    }
+
+    iIsRepoInitialized = 1;
+
+    memset( pxRepo, 0, sizeof( *pxRepo ) );
+    pxRepo->repositoryState = ERepoStateAvailable;
+
+    for( i = 0; i < TOTAL_PDR_COUNT; i++ )
+    {
+        CommonPDRFormat *pxHeader = ( CommonPDRFormat * )pucRecord;
+        uint16_t        usSize    = ( 0 == i ) ? sizeof( TerminusPDRFormat_UID ) :
+                                    ( uint16_t )( sizeof( CommonPDRFormat ) + 20 + ( ( i * 37 ) % 180 ) );
+
+        for( j = sizeof( CommonPDRFormat ); j < usSize; j++ )
+        {
+            pucRecord[ j ] = ( uint8_t )( ( i * 31 ) + j );
+        }
+
+        pxHeader->recordHandle       = i;
+        pxHeader->PDRHeaderVersion   = 1;
+        pxHeader->PDRType            = 2;
+        pxHeader->recordChangeNumber = 0;
+        pxHeader->dataLength         = usSize - sizeof( CommonPDRFormat );
+
+        pxRepo->PDRRecords[ i ] = pxHeader;
+        pxRepo->recordCount++;
+        pxRepo->repositorySize   += usSize;
+        pxRepo->largestRecordSize = MAX( pxRepo->largestRecordSize, usSize );
+        pusRecordSize[ i ]        = usSize;
+        pucRecord                += usSize;
+    }
+}
+
+int iGetNumericSensorReading( uint16_t usSensorId,
+                              uint8_t *pucCompletionCode,
+                              uint8_t *pucSensorOperationalState,
+                              int16_t *pssReading )
+{
+    return ERROR;
+}
+
+int iSetNumericSensorEnable( uint16_t usSensorId,
+                             uint8_t ucRequestedSensorOperationalState,
+                             uint8_t *pucResponseMessage,
+                             int *piResponseSize )
+{
+    return ERROR;
+}
+
+void vPLL_Output( PLL_OUTPUT_LEVEL xOutputLevel, const char *pcFormat, ... )
+{
+}
+
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static int iGetPdr( uint32_t ulRecordHandle,
+                    uint32_t ulTransferHandle,
+                    uint8_t ucOperation,
+                    uint16_t usRequestCount,
+                    uint8_t *pucResponse )
+{
+    TEST_GET_PDR_REQ xReq = { 0 };
+
+    xReq.recordHandle       = ulRecordHandle;
+    xReq.dataTransferHandle = ulTransferHandle;
+    xReq.OperationFlag      = ucOperation;
+    xReq.requestCount       = usRequestCount;
+    xReq.recordChangeNumber = ( ( const CommonPDRFormat * )MSP432_PDR_Repository.PDRRecords[ ulRecordHandle %
+                                                                                             TOTAL_PDR_COUNT ] )->recordChangeNumber;
+
+    memset( pucResponse, 0, TEST_RESPONSE_SIZE );
+
+    return pldm_cmd_GetPDR( &xReq, pucResponse );
+}
+
+/* Read a whole record with chained GetPDR requests, returns the next record handle */
+static uint32_t ulReadRecord( uint32_t ulRecordHandle, uint16_t usPartSize, uint8_t *pucRecord, uint16_t *pusSize )
+{
+    uint8_t          pucResponse[ TEST_RESPONSE_SIZE ] = { 0 };
+    TEST_GET_PDR_RES *pxRes                            = ( TEST_GET_PDR_RES * )pucResponse;
+    uint32_t         ulTransferHandle                  = 0;
+    uint32_t         ulNextRecordHandle                = 0;
+    uint8_t          ucOperation                       = TEST_GET_FIRST_PART;
+    uint16_t         usOffset                          = 0;
+    int              iParts                            = 0;
+    int              iSize                             = 0;
+
+    do
+    {
+        iSize = iGetPdr( ulRecordHandle, ulTransferHandle, ucOperation, usPartSize, pucResponse );
+
+        assert_int_equal( RESP_PLDM_SUCCESS, pxRes->CompletionCode );
+        assert_true( pxRes->responseCount <= usPartSize );
+
+        if( 0 == iParts )
+        {
+            assert_true( ( TEST_XFER_START == pxRes->transferFlag ) ||
+                         ( TEST_XFER_START_AND_END == pxRes->transferFlag ) );
+        }
+        else if( 0 != pxRes->nextDataTransferHandle )
+        {
+            assert_int_equal( TEST_XFER_MIDDLE, pxRes->transferFlag );
+            assert_int_equal( ulTransferHandle, pxRes->nextDataTransferHandle );
+        }
+        else
+        {
+            assert_int_equal( TEST_XFER_END, pxRes->transferFlag );
+        }
+
+        memcpy( pucRecord + usOffset, pxRes->recordData, pxRes->responseCount );
+        usOffset += pxRes->responseCount;
+
+        if( TEST_XFER_END == pxRes->transferFlag )
+        {
+            /* The CRC of the whole record follows the last part */
+            assert_int_equal( sizeof( *pxRes ) + pxRes->responseCount + 1, iSize );
+            assert_int_equal( ucCRC_Crc8( pucRecord, usOffset ), pxRes->recordData[ pxRes->responseCount ] );
+        }
+        else
+        {
+            assert_int_equal( sizeof( *pxRes ) + pxRes->responseCount, iSize );
+        }
+
+        ulNextRecordHandle = pxRes->nextRecordHandle;
+        ulTransferHandle   = pxRes->nextDataTransferHandle;
+        ucOperation        = TEST_GET_NEXT_PART;
+        iParts++;
+
+    } while( 0 != ulTransferHandle );
+
+    *pusSize = usOffset;
+
+    return ulNextRecordHandle;
+}
+
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+static void test_enumerate_repository_in_parts( void **state )
+{
+    const PDR_Index *pxIndex        = pxGetPdrIndex();
+    uint8_t         pucRecord[ 512 ] = { 0 };
+    uint32_t        ulRecordHandle  = 0;
+    uint32_t        ulRecords       = 0;
+    uint32_t        ulLookups       = pxIndex->lookups;
+    uint32_t        ulProbes        = pxIndex->probes;
+    uint16_t        usSize          = 0;
+
+    do
+    {
+        uint32_t ulNext = ulReadRecord( ulRecordHandle, TEST_PART_SIZE, pucRecord, &usSize );
+
+        assert_int_equal( pusRecordSize[ ulRecordHandle ], usSize );
+        assert_memory_equal( MSP432_PDR_Repository.PDRRecords[ ulRecordHandle ], pucRecord, usSize );
+
+        ulRecordHandle = ulNext;
+        ulRecords++;
+        assert_true( ulRecords <= TOTAL_PDR_COUNT );
+
+    } while( 0 != ulRecordHandle );
+
+    assert_int_equal( TOTAL_PDR_COUNT, ulRecords );
+
+    ulLookups = pxIndex->lookups - ulLookups;
+    ulProbes  = pxIndex->probes - ulProbes;
+    print_message( "%u GetPDR requests, %u index probes\n", ulLookups, ulProbes );
+    assert_int_equal( ulLookups, ulProbes );
+}
+
+static void test_enumerate_repository_whole_records( void **state )
+{
+    uint8_t  pucRecord[ 512 ] = { 0 };
+    uint32_t ulRecordHandle   = 0;
+    uint32_t ulRecords        = 0;
+    uint16_t usSize           = 0;
+
+    do
+    {
+        uint32_t ulNext = ulReadRecord( ulRecordHandle, TEST_WHOLE_RECORD, pucRecord, &usSize );
+
+        assert_int_equal( pusRecordSize[ ulRecordHandle ], usSize );
+        assert_memory_equal( MSP432_PDR_Repository.PDRRecords[ ulRecordHandle ], pucRecord, usSize );
+
+        ulRecordHandle = ulNext;
+        ulRecords++;
+
+    } while( 0 != ulRecordHandle );
+
+    assert_int_equal( TOTAL_PDR_COUNT, ulRecords );
+}
+
+static void test_interleaved_transfers( void **state )
+{
+    uint8_t          pucResA[ TEST_RESPONSE_SIZE ] = { 0 };
+    uint8_t          pucResB[ TEST_RESPONSE_SIZE ] = { 0 };
+    TEST_GET_PDR_RES *pxResA                       = ( TEST_GET_PDR_RES * )pucResA;
+    TEST_GET_PDR_RES *pxResB                       = ( TEST_GET_PDR_RES * )pucResB;
+    uint32_t         ulHandleA                     = 0;
+    uint32_t         ulHandleB                     = 0;
+
+    iGetPdr( 1, 0, TEST_GET_FIRST_PART, TEST_PART_SIZE, pucResA );
+    iGetPdr( 2, 0, TEST_GET_FIRST_PART, TEST_PART_SIZE, pucResB );
+    ulHandleA = pxResA->nextDataTransferHandle;
+    ulHandleB = pxResB->nextDataTransferHandle;
+    assert_int_not_equal( 0, ulHandleA );
+    assert_int_not_equal( 0, ulHandleB );
+    assert_int_not_equal( ulHandleA, ulHandleB );
+
+    /* Each transfer continues from its own offset */
+    iGetPdr( 1, ulHandleA, TEST_GET_NEXT_PART, TEST_PART_SIZE, pucResA );
+    assert_int_equal( RESP_PLDM_SUCCESS, pxResA->CompletionCode );
+    assert_memory_equal( ( uint8_t * )MSP432_PDR_Repository.PDRRecords[ 1 ] + TEST_PART_SIZE,
+                         pxResA->recordData, pxResA->responseCount );
+
+    iGetPdr( 2, ulHandleB, TEST_GET_NEXT_PART, TEST_PART_SIZE, pucResB );
+    assert_int_equal( RESP_PLDM_SUCCESS, pxResB->CompletionCode );
+    assert_memory_equal( ( uint8_t * )MSP432_PDR_Repository.PDRRecords[ 2 ] + TEST_PART_SIZE,
+                         pxResB->recordData, pxResB->responseCount );
+
+    /* A transfer handle only continues the record it was issued for */
+    iGetPdr( 2, ulHandleA, TEST_GET_NEXT_PART, TEST_PART_SIZE, pucResB );
+    assert_int_equal( RESP_INVALID_DATA_XFER_HANDLE, pxResB->CompletionCode );
+}
+
+static void test_oldest_transfer_is_discarded( void **state )
+{
+    uint8_t          pucResponse[ TEST_RESPONSE_SIZE ] = { 0 };
+    TEST_GET_PDR_RES *pxRes                            = ( TEST_GET_PDR_RES * )pucResponse;
+    uint32_t         pulHandles[ TEST_PENDING_XFERS + 1 ];
+    uint32_t         i                                 = 0;
+
+    for( i = 0; i < ( TEST_PENDING_XFERS + 1 ); i++ )
+    {
+        iGetPdr( 10 + i, 0, TEST_GET_FIRST_PART, TEST_PART_SIZE, pucResponse );
+        pulHandles[ i ] = pxRes->nextDataTransferHandle;
+        assert_int_not_equal( 0, pulHandles[ i ] );
+    }
+
+    iGetPdr( 10, pulHandles[ 0 ], TEST_GET_NEXT_PART, TEST_PART_SIZE, pucResponse );
+    assert_int_equal( RESP_INVALID_DATA_XFER_HANDLE, pxRes->CompletionCode );
+
+    for( i = 1; i < ( TEST_PENDING_XFERS + 1 ); i++ )
+    {
+        iGetPdr( 10 + i, pulHandles[ i ], TEST_GET_NEXT_PART, TEST_PART_SIZE, pucResponse );
+        assert_int_equal( RESP_PLDM_SUCCESS, pxRes->CompletionCode );
+    }
+}
+
+static void test_invalid_record_handle( void **state )
+{
+    uint8_t          pucResponse[ TEST_RESPONSE_SIZE ] = { 0 };
+    TEST_GET_PDR_RES *pxRes                            = ( TEST_GET_PDR_RES * )pucResponse;
+
+    assert_int_equal( 1, iGetPdr( TOTAL_PDR_COUNT, 0, TEST_GET_FIRST_PART, TEST_PART_SIZE, pucResponse ) );
+    assert_int_equal( RESP_INVALID_RECORD_HANDLE, pxRes->CompletionCode );
+
+    assert_int_equal( 1, iGetPdr( 0xFFFFFFFF, 0, TEST_GET_FIRST_PART, TEST_PART_SIZE, pucResponse ) );
+    assert_int_equal( RESP_INVALID_RECORD_HANDLE, pxRes->CompletionCode );
+
+    assert_null( pxPdrIndexLookup( TOTAL_PDR_COUNT ) );
+}
+
+static void test_invalid_transfer( void **state )
+{
+    uint8_t          pucResponse[ TEST_RESPONSE_SIZE ] = { 0 };
+    TEST_GET_PDR_RES *pxRes                            = ( TEST_GET_PDR_RES * )pucResponse;
+
+    assert_int_equal( 1, iGetPdr( 3, 0, TEST_GET_NEXT_PART, TEST_PART_SIZE, pucResponse ) );
+    assert_int_equal( RESP_INVALID_DATA_XFER_HANDLE, pxRes->CompletionCode );
+
+    assert_int_equal( 1, iGetPdr( 3, 0x12345678, TEST_GET_NEXT_PART, TEST_PART_SIZE, pucResponse ) );
+    assert_int_equal( RESP_INVALID_DATA_XFER_HANDLE, pxRes->CompletionCode );
+
+    assert_int_equal( 1, iGetPdr( 3, 0, 0x7, TEST_PART_SIZE, pucResponse ) );
+    assert_int_equal( RESP_INVALID_XFER_OPERATION_FLAG, pxRes->CompletionCode );
+}
+
+static void test_update_tid_refreshes_index( void **state )
+{
+    const PDR_IndexEntry *pxEntry = NULL;
+
+    update_tid( 0x5A );
+
+    pxEntry = pxPdrIndexLookup( PLDM_TERMINUS_HANDLE );
+    assert_non_null( pxEntry );
+    assert_int_equal( 0x5A, ( ( const TerminusPDRFormat_UID * )pxEntry->record )->TID );
+    assert_int_equal( ucCRC_Crc8( pxEntry->record, pxEntry->recordSize ), pxEntry->crc8 );
+}
+
+int main( void )
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test( test_enumerate_repository_in_parts ),
+        cmocka_unit_test( test_enumerate_repository_whole_records ),
+        cmocka_unit_test( test_interleaved_transfers ),
+        cmocka_unit_test( test_oldest_transfer_is_discarded ),
+        cmocka_unit_test( test_invalid_record_handle ),
+        cmocka_unit_test( test_invalid_transfer ),
+        cmocka_unit_test( test_update_tid_refreshes_index ),
+    };
+
+    pldm_command_init();
+
+    return cmocka_run_group_tests( tests, NULL, NULL );
+}
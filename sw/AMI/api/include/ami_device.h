@@ -187,6 +187,9 @@ int ami_dev_request_access(ami_device *dev);
  * do not have any open device handles pointing to the same device - this
  * could lead to stability issues!
  *
+ * The AMI driver finishes starting a device after it has been probed; this
+ * function waits for the device to leave the INIT state before returning.
+ *
  * This function requires sudo/root permissions.
  *
  * Return: AMI_STATUS_OK or AMI_STATUS_ERROR
@@ -202,6 +205,9 @@ int ami_dev_pci_reload(ami_device **dev, const char *bdf);
  * do not have any other open device handles pointing to the same device - this
  * could lead to stability issues!
  *
+ * As with `ami_dev_pci_reload`, this waits for the device to leave the INIT
+ * state before re-initialising the handle.
+ *
  * This function requires sudo/root permissions.
  *
  * Return: AMI_STATUS_OK or AMI_STATUS_ERROR
@@ -48,6 +48,33 @@ int ami_eeprom_read(ami_device *dev, uint8_t offset, uint8_t num, uint8_t *val);
  */
 int ami_eeprom_write(ami_device *dev, uint8_t offset, uint8_t num, uint8_t *val);
 
+/**
+ * ami_eeprom_read_bulk() - Read an arbitrary range of bytes from the EEPROM.
+ * @dev: Device handle.
+ * @offset: 16-bit offset into the EEPROM from base.
+ * @num: Number of bytes to read.
+ * @val: Buffer to store the values read.
+ *
+ * The whole range is read with a single request to the device.
+ *
+ * Return: AMI_STATUS_OK or AMI_STATUS_ERROR.
+ */
+int ami_eeprom_read_bulk(ami_device *dev, uint16_t offset, uint32_t num, uint8_t *val);
+
+/**
+ * ami_eeprom_write_bulk() - Write an arbitrary range of bytes to the EEPROM.
+ * @dev: Device handle.
+ * @offset: 16-bit offset into the EEPROM from base.
+ * @num: Number of bytes to write.
+ * @val: Values to write.
+ *
+ * The whole range is written with a single request to the device which
+ * splits it on EEPROM page boundaries.
+ *
+ * Return: AMI_STATUS_OK or AMI_STATUS_ERROR.
+ */
+int ami_eeprom_write_bulk(ami_device *dev, uint16_t offset, uint32_t num, uint8_t *val);
+
 #ifdef __cplusplus
 }
 #endif
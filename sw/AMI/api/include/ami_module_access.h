@@ -22,6 +22,36 @@ extern "C" {
 /* Public API includes */
 #include "ami_device.h"
 
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+/* Maximum number of entries in a single scatter-gather read. */
+#define AMI_MODULE_SG_MAX_ENTRIES	(64)
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * struct ami_module_sg_entry - One read of a module scatter-gather request
+ * @device_id: Module ID.
+ * @page: Page number to access.
+ * @offset: Byte offset within page.
+ * @num: Number of values to read.
+ * @val: Buffer to store the values read (at least `num` bytes).
+ * @status: Set to AMI_STATUS_OK if this entry was read successfully,
+ *     AMI_STATUS_ERROR otherwise.
+ */
+struct ami_module_sg_entry {
+	uint8_t  device_id;
+	uint8_t  page;
+	uint8_t  offset;
+	uint8_t  num;
+	uint8_t *val;
+	int      status;
+};
+
 /*****************************************************************************/
 /* Function Declarations                                                     */
 /*****************************************************************************/
@@ -54,6 +84,21 @@ int ami_module_read(ami_device *dev, uint8_t device_id, uint8_t page,
 int ami_module_write(ami_device *dev, uint8_t device_id, uint8_t page,
 	uint8_t offset, uint8_t num, uint8_t *val);
 
+/**
+ * ami_module_read_sg() - Read from one or more QSFP modules in a single request.
+ * @dev: Device handle.
+ * @entries: List of reads to perform.
+ * @num_entries: Number of entries (at most AMI_MODULE_SG_MAX_ENTRIES).
+ *
+ * All reads are serviced by one request to the AMC rather than one request
+ * per read. A failure to read one entry does not fail the others; check the
+ * `status` field of each entry.
+ *
+ * Return: AMI_STATUS_OK if the request completed or AMI_STATUS_ERROR.
+ */
+int ami_module_read_sg(ami_device *dev, struct ami_module_sg_entry *entries,
+	uint16_t num_entries);
+
 #ifdef __cplusplus
 }
 #endif
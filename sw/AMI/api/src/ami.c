@@ -43,8 +43,9 @@
 #define MAX_ERROR_CTXT_STR	(256)
 #define MAX_ERROR_STR		(MAX_ERROR_DEFAULT_STR + MAX_ERROR_CTXT_STR)
 
-#define EVENT_POLL_FDS		(1)
-#define EVENT_POLL_TIMEOUT_MS	(1000)
+#define EVENT_POLL_FD_EVENT	(0)
+#define EVENT_POLL_FD_STOP	(1)
+#define EVENT_POLL_FDS		(2)
 
 #define MSEC_TO_SEC(msec)	(msec / 1000)
 #define MSEC_TO_NSEC(msec)	((msec % 1000) * 1000000)
@@ -85,56 +86,94 @@ static int kernel_version_cmp(const char *v) {
     return cpat - vpat;
 }
 
+/**
+ * event_progress() - Account for an eventfd counter value.
+ * @d: Event data.
+ * @efd_ctr: Value read from the eventfd.
+ *
+ * The counter read from the eventfd holds every signal since the previous read,
+ * so several chunks may be reported at once. A running total is kept and the
+ * difference from the last reported total is returned.
+ *
+ * Return: Number of bytes written since the previous event.
+ */
+static uint64_t event_progress(struct ami_event_data *d, uint64_t efd_ctr)
+{
+	uint64_t total = 0;
+	uint64_t delta = 0;
+
+	if (d->efd_counts_chunks) {
+		d->chunks += efd_ctr;
+		total = d->chunks * PDI_CHUNK_SIZE * PDI_CHUNK_MULTIPLIER;
+	} else {
+		total = d->bytes_reported + efd_ctr;
+	}
+
+	if (d->bytes_total && (total > d->bytes_total))
+		total = d->bytes_total;
+
+	if (total > d->bytes_reported) {
+		delta = total - d->bytes_reported;
+		d->bytes_reported = total;
+	}
+
+	return delta;
+}
+
 /**
  * ami_event_thread() - Internal event watcher thread.
  * @data: Pointer to `struct ami_event_data`
  *
+ * The thread sleeps in poll() until the driver signals the eventfd, the stop
+ * eventfd is written or the (optional) idle timeout expires.
+ *
  * Return: None.
  */
 static void *ami_event_thread(void *data)
 {
 	struct ami_event_data *d = NULL;
-	struct ami_pdi_progress *p = NULL;
-	struct pollfd mypoll = { 0 };
+	struct pollfd fds[EVENT_POLL_FDS] = { 0 };
 	uint64_t efd_ctr = 0;
-	uint64_t chunk_size = PDI_CHUNK_SIZE * PDI_CHUNK_MULTIPLIER;
-	enum ami_event_status status = AMI_EVENT_STATUS_TIMEOUT;
+	bool stop = false;
+	int ret = 0;
 
 	if (!data)
 		return NULL;
 
 	d = (struct ami_event_data*)data;
-	p = d->callback_data;
 
 	/* callback is necessary */
 	if (!(d->callback))
 		return NULL;
 
-	mypoll.fd = d->efd;
-	mypoll.events = POLLIN;
-
-	while (!d->quit) {
-		if (poll(&mypoll, EVENT_POLL_FDS, EVENT_POLL_TIMEOUT_MS)) {
-			if (read(d->efd, &efd_ctr, sizeof(uint64_t)) == sizeof(uint64_t))
-				status = AMI_EVENT_STATUS_OK;
-			else
-				status = AMI_EVENT_STATUS_READ_ERROR;
-		} else {
-			status = AMI_EVENT_STATUS_TIMEOUT;
-		}
-
-		if (kernel_version_cmp("6.8.0") >= 0) {
-			d->callback(
-				status,
-				p->bytes_to_write > chunk_size ? chunk_size : p->bytes_to_write,
-				d->callback_data
-			);
-		} else {
-			d->callback(
-				status,
-				efd_ctr,
-				d->callback_data
-			);
+	fds[EVENT_POLL_FD_EVENT].fd = d->efd;
+	fds[EVENT_POLL_FD_EVENT].events = POLLIN;
+	fds[EVENT_POLL_FD_STOP].fd = d->stop_efd;
+	fds[EVENT_POLL_FD_STOP].events = POLLIN;
+
+	while (!stop) {
+		ret = poll(fds, EVENT_POLL_FDS, d->idle_timeout_ms);
+
+		if (ret > 0) {
+			/* Report outstanding progress before honouring a stop request */
+			if (fds[EVENT_POLL_FD_EVENT].revents & POLLIN) {
+				if (read(d->efd, &efd_ctr, sizeof(uint64_t)) == sizeof(uint64_t))
+					d->callback(
+						AMI_EVENT_STATUS_OK,
+						event_progress(d, efd_ctr),
+						d->callback_data
+					);
+				else
+					d->callback(AMI_EVENT_STATUS_READ_ERROR, 0, d->callback_data);
+			}
+
+			if (fds[EVENT_POLL_FD_STOP].revents & POLLIN)
+				stop = true;
+		} else if (ret == 0) {
+			d->callback(AMI_EVENT_STATUS_TIMEOUT, 0, d->callback_data);
+		} else if (errno != EINTR) {
+			d->callback(AMI_EVENT_STATUS_READ_ERROR, 0, d->callback_data);
+			stop = true;
 		}
 	}
 
@@ -289,6 +328,15 @@ int ami_set_last_error(enum ami_error err, const char *ctxt, ...)
 		);
 		break;
 
+	case AMI_ERROR_ETIMEDOUT:
+		snprintf(
+			last_error_str,
+			MAX_ERROR_STR,
+			"ETIMEDOUT: Operation timed out [%s].\r\n",
+			error_ctxt
+		);
+		break;
+
 	default:
 		sprintf(
 			last_error_str,
@@ -406,24 +454,40 @@ uint16_t ami_parse_bdf(const char *bdf)
  * Start the event watcher thread.
  */
 int ami_watch_driver_events(struct ami_event_data *event_data,
-	ami_event_handler callback, void *data)
+	ami_event_handler callback, void *data, uint64_t bytes_total,
+	int idle_timeout_ms)
 {
 	int ret = AMI_LINUX_STATUS_ERROR;
-	int efd = AMI_INVALID_FD;
 
-	/* callback must be given */
-	if (!event_data || !callback)
+	if (!event_data)
 		return AMI_API_ERROR(AMI_ERROR_EINVAL);
 
-	/* Setup eventfd */
-	if ((efd = eventfd(0, 0)) == AMI_INVALID_FD)
-		return AMI_API_ERROR(EBADF);
+	/* Initialise thread data - safe to stop even if this call fails */
+	memset(event_data, 0, sizeof(struct ami_event_data));
+	event_data->efd = AMI_INVALID_FD;
+	event_data->stop_efd = AMI_INVALID_FD;
+
+	/* callback must be given */
+	if (!callback || (idle_timeout_ms < AMI_EVENT_NO_IDLE_TIMEOUT))
+		return AMI_API_ERROR(AMI_ERROR_EINVAL);
 
-	/* Initialise thread data */
-	event_data->quit = false;
 	event_data->callback = callback;
 	event_data->callback_data = data;
-	event_data->efd = efd;
+	event_data->idle_timeout_ms = idle_timeout_ms;
+	event_data->bytes_total = bytes_total;
+
+	/* Resolved once here rather than on every event */
+	event_data->efd_counts_chunks = (kernel_version_cmp("6.8.0") >= 0);
+
+	/* Setup eventfds */
+	if ((event_data->efd = eventfd(0, 0)) == AMI_INVALID_FD)
+		return AMI_API_ERROR(AMI_ERROR_EBADF);
+
+	if ((event_data->stop_efd = eventfd(0, 0)) == AMI_INVALID_FD) {
+		close(event_data->efd);
+		event_data->efd = AMI_INVALID_FD;
+		return AMI_API_ERROR(AMI_ERROR_EBADF);
+	}
 
 	/* Create thread */
 	ret = pthread_create(
@@ -433,8 +497,13 @@ int ami_watch_driver_events(struct ami_event_data *event_data,
 		(void*)event_data
 	);
 
-	if (ret)
+	if (ret) {
+		close(event_data->stop_efd);
+		close(event_data->efd);
+		event_data->stop_efd = AMI_INVALID_FD;
+		event_data->efd = AMI_INVALID_FD;
 		return AMI_API_ERROR(AMI_ERROR_ERET);
+	}
 
 	event_data->thread_created = true;
 	return AMI_STATUS_OK;
@@ -449,12 +518,24 @@ int ami_stop_watching_events(struct ami_event_data *event_data)
 		return AMI_API_ERROR(AMI_ERROR_EINVAL);
 
 	if (event_data->thread_created) {
-		event_data->quit = true;
+		uint64_t stop = 1;
+
+		if (write(event_data->stop_efd, &stop, sizeof(uint64_t)) != sizeof(uint64_t))
+			pthread_cancel(event_data->event_thread);
+
 		pthread_join(event_data->event_thread, NULL);
+		event_data->thread_created = false;
 	}
 
-	if (event_data->efd != AMI_INVALID_FD)
+	if (event_data->stop_efd != AMI_INVALID_FD) {
+		close(event_data->stop_efd);
+		event_data->stop_efd = AMI_INVALID_FD;
+	}
+
+	if (event_data->efd != AMI_INVALID_FD) {
 		close(event_data->efd);
+		event_data->efd = AMI_INVALID_FD;
+	}
 
 	return AMI_STATUS_OK;
 }
@@ -70,6 +70,14 @@
 #define HOT_RESET_RESCAN_DELAY_MS	(5000)
 #define HOT_RESET_GPIO_SET_DELAY_MS	(1)
 
+/*
+ * The driver starts the AMC dependent services (GCQ, sensors, hwmon) after
+ * the probe has returned; the device stays in the INIT state until then.
+ */
+#define DEV_STATE_INIT			"INIT"
+#define DEV_INIT_POLL_MS		(100)
+#define DEV_INIT_TIMEOUT_MS		(60000)
+
 #define PCI_DEV_DIR			"/sys/bus/pci/devices/0000:%02x:%02x.%1x"
 #define PCI_BRIDGE_CONTROL		(0x3e)
 #define PCI_BRIDGE_CTL_BUS_RESET	(0x40)
@@ -108,6 +116,18 @@ static int open_sysfs(ami_device *dev, const char *attr, int mode);
  */
 static int get_new_device_handle(ami_device **new_dev, uint16_t bdf, bool with_sensors);
 
+/**
+ * wait_for_dev_init() - Wait for the driver to finish starting a device.
+ * @bdf: Numeric BDF of the device.
+ *
+ * Polls the device state until it leaves INIT. A device which is not
+ * attached to the AMI driver has no state and is not waited for.
+ *
+ * Return: AMI_STATUS_OK or AMI_STATUS_ERROR if the device is still
+ *   initialising after DEV_INIT_TIMEOUT_MS.
+ */
+static int wait_for_dev_init(uint16_t bdf);
+
 /**
  * pci_remove() - Remove a device from the PCI tree.
  * @bdf: Numeric BDF of the device to remove.
@@ -129,7 +149,9 @@ static int pci_remove(uint16_t bdf);
  * pci_rescan() - Rescan the PCI tree.
  *
  * Sudo/root permissions are required. This function will not return
- * until any new devices have been fully initialized/probed.
+ * until any new devices have been probed. Note that the AMI driver finishes
+ * starting a device after its probe - use `wait_for_dev_init` before using
+ * the device.
  *
  * Return: AMI_STATUS_OK or AMI_STATUS_ERROR.
  */
@@ -183,6 +205,10 @@ static int get_new_device_handle(ami_device **new_dev, uint16_t bdf, bool with_s
 	if (!new_dev || (*new_dev))
 		return AMI_API_ERROR(AMI_ERROR_EINVAL);
 
+	/* Sensor discovery needs the hwmon device, which is created last. */
+	if (wait_for_dev_init(bdf) != AMI_STATUS_OK)
+		return AMI_STATUS_ERROR;
+
 	ret =  ami_dev_find_next(
 		&dev,
 		AMI_PCI_BUS(bdf),
@@ -195,11 +221,54 @@ static int get_new_device_handle(ami_device **new_dev, uint16_t bdf, bool with_s
 		/* Check if we need to setup sensors. */
 		if (!with_sensors || ((ret = ami_sensor_discover(dev)) == AMI_STATUS_OK))
 			*new_dev = dev;
+		else
+			ami_dev_delete(&dev);
 	}
 
 	return ret;
 }
 
+/*
+ * Wait for the driver to finish starting a device.
+ */
+static int wait_for_dev_init(uint16_t bdf)
+{
+	ami_device dev = { 0 };
+	char state[AMI_DEV_STATE_SIZE] = { 0 };
+	int file = AMI_INVALID_FD;
+	ssize_t len = 0;
+	int waited = 0;
+
+	dev.bdf = bdf;
+
+	/* No state - the device is not attached to the AMI driver. */
+	while ((file = open_sysfs(&dev, SYSFS_DEV_STATE, O_RDONLY)) != AMI_INVALID_FD) {
+		len = read(file, state, AMI_DEV_STATE_SIZE - 1);
+		close(file);
+
+		if (len == AMI_LINUX_STATUS_ERROR)
+			break;
+
+		state[len] = '\0';
+		state[strcspn(state, "\r\n")] = '\0';
+
+		if (strcmp(state, DEV_STATE_INIT) != 0)
+			break;
+
+		if (waited >= DEV_INIT_TIMEOUT_MS)
+			return AMI_API_ERROR_M(
+				AMI_ERROR_ETIMEDOUT,
+				"device still initialising after %d ms",
+				waited
+			);
+
+		ami_msleep(DEV_INIT_POLL_MS);
+		waited += DEV_INIT_POLL_MS;
+	}
+
+	return AMI_STATUS_OK;
+}
+
 /*
  * Remove a device from the PCI tree.
  */
@@ -602,6 +671,8 @@ int ami_dev_pci_reload(ami_device **dev, const char *bdf)
 					bdf_num,
 					has_sensors
 				);
+			else
+				ret = wait_for_dev_init(bdf_num);
 		}
 	}
 
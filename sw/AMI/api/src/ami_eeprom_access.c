@@ -91,3 +91,67 @@ int ami_eeprom_write(ami_device *dev, uint8_t offset, uint8_t num, uint8_t *val)
 
 	return ret;
 }
+
+/*
+ * ami_eeprom_read_bulk() - Read an arbitrary range of bytes from the EEPROM.
+ */
+int ami_eeprom_read_bulk(ami_device *dev, uint16_t offset, uint32_t num, uint8_t *val)
+{
+	int ret = AMI_STATUS_ERROR;
+	struct ami_ioc_eeprom_bulk_payload data = { 0 };
+
+	if (!dev || !val || (num == 0))
+		return AMI_API_ERROR(AMI_ERROR_EINVAL);
+
+	if (ami_open_cdev(dev) != AMI_STATUS_OK)
+		return AMI_STATUS_ERROR; /* last error is set by ami_open_cdev */
+
+	data.addr = (unsigned long)val;
+	data.len = num;
+	data.offset = offset;
+
+	if (ioctl(dev->cdev, AMI_IOC_READ_EEPROM_BULK, &data) == AMI_LINUX_STATUS_ERROR) {
+		ret = AMI_API_ERROR_M(
+			AMI_ERROR_EIO,
+			"errno %d (%s)",
+			errno,
+			strerror(errno)
+		);
+	} else {
+		ret = AMI_STATUS_OK;
+	}
+
+	return ret;
+}
+
+/*
+ * ami_eeprom_write_bulk() - Write an arbitrary range of bytes to the EEPROM.
+ */
+int ami_eeprom_write_bulk(ami_device *dev, uint16_t offset, uint32_t num, uint8_t *val)
+{
+	int ret = AMI_STATUS_ERROR;
+	struct ami_ioc_eeprom_bulk_payload data = { 0 };
+
+	if (!dev || !val || (num == 0))
+		return AMI_API_ERROR(AMI_ERROR_EINVAL);
+
+	if (ami_open_cdev(dev) != AMI_STATUS_OK)
+		return AMI_STATUS_ERROR; /* last error is set by ami_open_cdev */
+
+	data.addr = (unsigned long)val;
+	data.len = num;
+	data.offset = offset;
+
+	if (ioctl(dev->cdev, AMI_IOC_WRITE_EEPROM_BULK, &data) == AMI_LINUX_STATUS_ERROR) {
+		ret = AMI_API_ERROR_M(
+			AMI_ERROR_EIO,
+			"errno %d (%s)",
+			errno,
+			strerror(errno)
+		);
+	} else {
+		ret = AMI_STATUS_OK;
+	}
+
+	return ret;
+}
@@ -14,6 +14,7 @@
 
 /* Standard includes */
 #include <pthread.h>
+#include <stdint.h>
 
 /* Public API includes */
 #include "ami.h"  /* Used by other internal headers. */
@@ -24,6 +25,10 @@
 
 #define AMI_BASE_10 (10)
 
+/* Idle timeouts for `ami_watch_driver_events` */
+#define AMI_EVENT_IDLE_TIMEOUT_MS	(1000)
+#define AMI_EVENT_NO_IDLE_TIMEOUT	(-1)
+
 /*
  * Utility macro to set the last error and return AMI_STATUS_ERROR.
  * We ignore the return value of `ami_set_last_error` and ALWAYS return
@@ -52,6 +57,7 @@
  * @AMI_ERROR_ERET: error return code from function call
  * @AMI_ERROR_ENODEV: no such device
  * @AMI_ERROR_EVER: version mismatch
+ * @AMI_ERROR_ETIMEDOUT: operation timed out
  */
 enum ami_error {
 	AMI_ERROR_NONE = 0,
@@ -63,24 +69,37 @@ enum ami_error {
 	AMI_ERROR_ERET,
 	AMI_ERROR_ENODEV,
 	AMI_ERROR_EVER,
+	AMI_ERROR_ETIMEDOUT,
 };
 
 /**
  * struct ami_event_data - internal data for event handlers
  * @efd: event file descriptor to watch
- * @quit: boolean indicating if the thread should stop
+ * @stop_efd: event file descriptor used to wake the thread when stopping
  * @thread_created: boolean indicating if the thread has been created
  * @event_thread: the thread reference
  * @callback_data: data to be passed into the user-provided callback
  * @callback: user-provided event callback
+ * @idle_timeout_ms: how long to wait for an event before calling the
+ *     callback with a timeout status, or AMI_EVENT_NO_IDLE_TIMEOUT
+ * @efd_counts_chunks: true if the driver signals one count per chunk rather
+ *     than the number of bytes written (resolved once from the kernel version)
+ * @bytes_total: total number of bytes the operation will report (0 if unknown)
+ * @bytes_reported: cumulative number of bytes reported to the callback
+ * @chunks: cumulative number of chunks signalled by the driver
  */
 struct ami_event_data {
 	int                  efd;
-	bool                 quit;
+	int                  stop_efd;
 	bool                 thread_created;
 	pthread_t            event_thread;
 	void                *callback_data;
 	ami_event_handler    callback;
+	int                  idle_timeout_ms;
+	bool                 efd_counts_chunks;
+	uint64_t             bytes_total;
+	uint64_t             bytes_reported;
+	uint64_t             chunks;
 };
 
 /*****************************************************************************/
@@ -133,23 +152,31 @@ int ami_set_last_error(enum ami_error err, const char *ctxt, ...);
  * @event_data: Internal event data struct.
  * @callback: The actual handler to be called when an event is received
  * @data: Data to be passed into the callback - may be NULL
+ * @bytes_total: Total number of bytes the operation will write - may be 0
+ * @idle_timeout_ms: Call the handler with a timeout status after this many
+ *     milliseconds without an event, or AMI_EVENT_NO_IDLE_TIMEOUT
  *
  * Note: This function creates a new thread but does not wait for it to finish.
  * Several fields inside the `event_data` struct are updated. Namely, on success,
  * the `efd` field is set to the event file descriptor - this must be given
  * to the driver so the communication channel can be initialised.
  *
+ * The handler's `ctr` is the number of bytes written since the previous event,
+ * taken from a running total of the eventfd counter and capped at `bytes_total`.
+ *
  * Return: AMI_STATUS_OK or AMI_STATUS_ERROR
  */
 int ami_watch_driver_events(struct ami_event_data *event_data,
-	ami_event_handler callback, void *data);
+	ami_event_handler callback, void *data, uint64_t bytes_total,
+	int idle_timeout_ms);
 
 /**
  * ami_stop_watching_events() - Stop watching driver events
  * @event_data: The same data struct pointer that was given to `ami_watch_driver_events`
  *
- * This function indicates to the underlying thread that it should exit and
- * waits for it to finish. It also cleans up the eventfd interface.
+ * This function wakes the underlying thread, which reports any outstanding
+ * events before exiting, and waits for it to finish. It also cleans up the
+ * eventfd interface.
  *
  * Return: AMI_STATUS_OK or AMI_STATUS_ERROR
  */
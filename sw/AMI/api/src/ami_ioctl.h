@@ -172,6 +172,18 @@ struct ami_ioc_eeprom_payload {
 	uint8_t        offset;
 };
 
+/**
+ * struct ami_ioc_eeprom_bulk_payload - payload struct for bulk ioctl eeprom data
+ * @addr: Location of data buffer in userspace memory.
+ * @len: The number of bytes to read/write.
+ * @offset: 16-bit offset from the EEPROM base address.
+ */
+struct ami_ioc_eeprom_bulk_payload {
+	unsigned long addr;
+	uint32_t      len;
+	uint16_t      offset;
+};
+
 /**
  * struct ami_ioc_module_payload - payload struct for dynamically sized ioctl qsfp data
  * @addr: Location of data buffer in userspace memory.
@@ -188,6 +200,41 @@ struct ami_ioc_module_payload {
 	uint8_t       offset;
 };
 
+/**
+ * struct ami_ioc_module_sg_entry - one descriptor of a module scatter-gather read
+ * @device_id: Module device ID.
+ * @page: Page number to access.
+ * @offset: Offset within page.
+ * @result: Result code written back by the AMC (0 on success).
+ * @len: Number of bytes to read.
+ * @resvd: Reserved, must be zero.
+ *
+ * The layout matches the descriptor list the AMC reads from shared memory.
+ */
+struct ami_ioc_module_sg_entry {
+	uint8_t       device_id;
+	uint8_t       page;
+	uint8_t       offset;
+	uint8_t       result;
+	uint16_t      len;
+	uint16_t      resvd;
+};
+
+/**
+ * struct ami_ioc_module_sg_payload - payload struct for a module scatter-gather read
+ * @addr: Location of data buffer in userspace memory.
+ * @len: Total size of the data buffer.
+ * @num_entries: Number of descriptors at the start of the buffer.
+ *
+ * The buffer holds `num_entries` descriptors followed by space for the data
+ * of each entry, packed in descriptor order.
+ */
+struct ami_ioc_module_sg_payload {
+	unsigned long addr;
+	uint32_t      len;
+	uint16_t      num_entries;
+};
+
 /**
  * enum ami_ioc_app_setup - accepted values for the AMI_IOC_APP_SETUP IOCTL
  * @IOC_APP_SETUP_REGISTER: Register a process with a device.
@@ -214,7 +261,10 @@ enum ami_ioc_app_setup {
 #define AMI_IOC_READ_MODULE		_IOW(AMI_IOC_MAGIC, 12, struct ami_ioc_module_payload*)
 #define AMI_IOC_WRITE_MODULE		_IOW(AMI_IOC_MAGIC, 13, struct ami_ioc_module_payload*)
 #define AMI_IOC_DEBUG_VERBOSITY		_IOW(AMI_IOC_MAGIC, 14, uint8_t)
-#define AMI_IOC_MAX			(15)
+#define AMI_IOC_READ_EEPROM_BULK	_IOWR(AMI_IOC_MAGIC, 15, struct ami_ioc_eeprom_bulk_payload*)
+#define AMI_IOC_WRITE_EEPROM_BULK	_IOW(AMI_IOC_MAGIC, 16, struct ami_ioc_eeprom_bulk_payload*)
+#define AMI_IOC_READ_MODULE_SG		_IOWR(AMI_IOC_MAGIC, 17, struct ami_ioc_module_sg_payload*)
+#define AMI_IOC_MAX			(18)
 
 
 #endif  /* AMI_IOCTL_H */
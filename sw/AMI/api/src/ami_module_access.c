@@ -14,6 +14,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include <string.h>
+#include <stdlib.h>
 #include <sys/ioctl.h>
 
 /* Public API includes */
@@ -115,3 +116,77 @@ int ami_module_write(ami_device *dev, uint8_t device_id, uint8_t page,
 		val
 	);
 }
+
+/*
+ * Read from one or more QSFP modules in a single request.
+ */
+int ami_module_read_sg(ami_device *dev, struct ami_module_sg_entry *entries,
+	uint16_t num_entries)
+{
+	int ret = AMI_STATUS_ERROR;
+	struct ami_ioc_module_sg_payload data = { 0 };
+	struct ami_ioc_module_sg_entry *desc = NULL;
+	uint8_t *buf = NULL;
+	uint32_t len = 0;
+	uint32_t pos = 0;
+	int i = 0;
+
+	if (!dev || !entries || (num_entries == 0) ||
+			(num_entries > AMI_MODULE_SG_MAX_ENTRIES))
+		return AMI_API_ERROR(AMI_ERROR_EINVAL);
+
+	/* Descriptor list followed by the packed data of every entry. */
+	len = num_entries * sizeof(struct ami_ioc_module_sg_entry);
+	for (i = 0; i < num_entries; i++) {
+		if (!entries[i].val || (entries[i].num == 0))
+			return AMI_API_ERROR(AMI_ERROR_EINVAL);
+
+		len += entries[i].num;
+	}
+
+	if (ami_open_cdev(dev) != AMI_STATUS_OK)
+		return AMI_STATUS_ERROR; /* last error is set by ami_open_cdev */
+
+	buf = (uint8_t*)calloc(len, sizeof(uint8_t));
+	if (!buf)
+		return AMI_API_ERROR(AMI_ERROR_ENOMEM);
+
+	desc = (struct ami_ioc_module_sg_entry*)buf;
+	for (i = 0; i < num_entries; i++) {
+		desc[i].device_id = entries[i].device_id;
+		desc[i].page = entries[i].page;
+		desc[i].offset = entries[i].offset;
+		desc[i].len = entries[i].num;
+	}
+
+	data.addr = (unsigned long)buf;
+	data.len = len;
+	data.num_entries = num_entries;
+
+	if (ioctl(dev->cdev, AMI_IOC_READ_MODULE_SG, &data) == AMI_LINUX_STATUS_ERROR) {
+		ret = AMI_API_ERROR_M(
+			AMI_ERROR_EIO,
+			"errno %d (%s)",
+			errno,
+			strerror(errno)
+		);
+	} else {
+		pos = num_entries * sizeof(struct ami_ioc_module_sg_entry);
+
+		for (i = 0; i < num_entries; i++) {
+			if (desc[i].result == 0) {
+				memcpy(entries[i].val, &buf[pos], entries[i].num);
+				entries[i].status = AMI_STATUS_OK;
+			} else {
+				entries[i].status = AMI_STATUS_ERROR;
+			}
+
+			pos += entries[i].num;
+		}
+
+		ret = AMI_STATUS_OK;
+	}
+
+	free(buf);
+	return ret;
+}
@@ -140,7 +140,8 @@ static int do_image_download(ami_device *dev, const char *path, uint8_t boot_dev
 		if (progress_handler) {
 			progress.bytes_to_write = img_size;
 
-			if (ami_watch_driver_events(&evt_data, progress_handler, (void*)&progress) == AMI_STATUS_OK)
+			if (ami_watch_driver_events(&evt_data, progress_handler, (void*)&progress,
+					img_size, AMI_EVENT_NO_IDLE_TIMEOUT) == AMI_STATUS_OK)
 				payload.efd = evt_data.efd;
 		}
 
@@ -258,12 +259,17 @@ int ami_prog_copy_partition(ami_device *dev, uint32_t src_device, uint32_t src_p
 	payload.dest_device = dest_device;
 	payload.dest_part = dest_part;
 
-	/* NOTE: Progress tracking is currently not implemented driver side. */
+	/*
+	 * NOTE: Progress tracking is currently not implemented driver side, so
+	 * the handler is driven by idle timeouts.
+	 */
 	if (progress_handler)
 		ami_watch_driver_events(
 			&evt_data,
 			progress_handler,
-			NULL
+			NULL,
+			0,
+			AMI_EVENT_IDLE_TIMEOUT_MS
 		);
 	
 	if (ioctl(dev->cdev, AMI_IOC_COPY_PARTITION, &payload) == AMI_LINUX_STATUS_ERROR)
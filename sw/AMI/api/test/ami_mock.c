@@ -0,0 +1,451 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * ami_mock.c - Fake sysfs/hwmon tree and IOCTL shim for running libami
+ * without a card.
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Link against the libami sources with `-Wl,--wrap=` for open, close, read,
+ * stat, glob, fopen and ioctl. Paths under /sys and /dev/ami are redirected
+ * into the generated tree and IOCTLs are answered here.
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+#define _GNU_SOURCE  /* nftw, mkdtemp */
+
+/* Standard includes */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <glob.h>
+#include <ftw.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+/* AMI API includes */
+#include "ami.h"
+#include "ami_version.h"
+#include "ami_ioctl.h"
+
+/* Mock includes */
+#include "ami_mock.h"
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define MOCK_ROOT_TEMPLATE	"/tmp/ami_mock.XXXXXX"
+#define MOCK_SENSOR_STATUS	"Sensor Present and Valid"
+#define MOCK_DEV_READY		"READY"
+
+/* Driver and PCI core nodes used when reloading a device */
+#define MOCK_DEV_STATE		"/sys/bus/pci/drivers/ami/0000:%02x:%02x.%1x/dev_state"
+#define MOCK_PCI_REMOVE		"/sys/bus/pci/devices/0000:%02x:%02x.%1x/remove"
+#define MOCK_PCI_RESCAN		"/sys/bus/pci/rescan"
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static char mock_root[PATH_MAX] = { 0 };
+static size_t mock_root_len = 0;
+static struct ami_mock_counters counters = { 0 };
+
+/* hwmon file prefix of each sensor type, in the order they are handed out */
+static const char * const sensor_prefix[] = { "temp", "in", "curr", "power" };
+
+static const enum ami_sensor_type sensor_types[] = {
+	AMI_SENSOR_TYPE_TEMP,
+	AMI_SENSOR_TYPE_VOLTAGE,
+	AMI_SENSOR_TYPE_CURRENT,
+	AMI_SENSOR_TYPE_POWER,
+};
+
+/*****************************************************************************/
+/* Real functions                                                            */
+/*****************************************************************************/
+
+extern int __real_open(const char *pathname, int flags, int mode);
+extern int __real_close(int fd);
+extern ssize_t __real_read(int fd, void *buf, size_t count);
+extern int __real_stat(const char *path, struct stat *buf);
+extern int __real_glob(const char *restrict pattern, int flags,
+	int (*errfunc)(const char *epath, int eerrno), glob_t *restrict pglob);
+extern FILE *__real_fopen(const char *restrict pathname, const char *restrict mode);
+
+/*****************************************************************************/
+/* Local function definitions                                                */
+/*****************************************************************************/
+
+/*
+ * Redirect a driver path into the fake tree.
+ */
+static const char *mock_path(const char *path, char *buf)
+{
+	if (!mock_root_len || !path)
+		return path;
+
+	if ((strncmp(path, "/sys/", strlen("/sys/")) != 0) &&
+			(strncmp(path, "/dev/ami", strlen("/dev/ami")) != 0))
+		return path;
+
+	snprintf(buf, PATH_MAX, "%s%s", mock_root, path);
+	return buf;
+}
+
+/*
+ * Create a file (and any missing directories) under the fake tree.
+ */
+static int write_mock_file(const char *contents, const char *fmt, ...)
+{
+	int ret = AMI_STATUS_ERROR;
+	char path[PATH_MAX] = { 0 };
+	char *sep = NULL;
+	FILE *file = NULL;
+	va_list args;
+	int len = 0;
+
+	len = snprintf(path, PATH_MAX, "%s", mock_root);
+
+	va_start(args, fmt);
+	vsnprintf(path + len, PATH_MAX - len, fmt, args);
+	va_end(args);
+
+	/* mkdir -p */
+	for (sep = strchr(path + len + 1, '/'); sep; sep = strchr(sep + 1, '/')) {
+		*sep = '\0';
+		if ((mkdir(path, 0755) != 0) && (errno != EEXIST)) {
+			*sep = '/';
+			return ret;
+		}
+		*sep = '/';
+	}
+
+	file = __real_fopen(path, "w");
+
+	if (file) {
+		if (fputs(contents, file) >= 0)
+			ret = AMI_STATUS_OK;
+
+		fclose(file);
+	}
+
+	return ret;
+}
+
+/*
+ * Create the hwmon files of a single sensor.
+ */
+static int write_mock_sensor(int hwmon, int n)
+{
+	int ret = AMI_STATUS_OK;
+	int type = n % (sizeof(sensor_prefix) / sizeof(sensor_prefix[0]));
+	/* Voltage channels count from 0, everything else from 1. */
+	int channel = (n / 4) + ((sensor_types[type] == AMI_SENSOR_TYPE_VOLTAGE) ? 0 : 1);
+	char label[AMI_SENSOR_MAX_STR] = { 0 };
+	char value[32] = { 0 };
+	size_t i = 0;
+
+	const char * const attrs[] = {
+		"label", "input", "status", "average", "highest", "max", "crit", "lcrit"
+	};
+
+	snprintf(label, sizeof(label), AMI_MOCK_SENSOR_NAME "\n", n);
+	snprintf(value, sizeof(value), "%d\n", 1000 + n);
+
+	for (i = 0; (i < sizeof(attrs) / sizeof(attrs[0])) && (ret == AMI_STATUS_OK); i++) {
+		const char *contents = value;
+
+		if (strcmp(attrs[i], "label") == 0)
+			contents = label;
+		else if (strcmp(attrs[i], "status") == 0)
+			contents = MOCK_SENSOR_STATUS "\n";
+
+		ret = write_mock_file(
+			contents,
+			"/sys/class/hwmon/hwmon%d/%s%d_%s",
+			hwmon,
+			sensor_prefix[type],
+			channel,
+			attrs[i]
+		);
+	}
+
+	return ret;
+}
+
+/*
+ * Write the driver state of a device.
+ */
+static int write_dev_state(int dev, const char *state)
+{
+	char contents[64] = { 0 };
+
+	snprintf(contents, sizeof(contents), "%s\n", state);
+
+	return write_mock_file(
+		contents,
+		MOCK_DEV_STATE,
+		AMI_MOCK_DEV_BUS(dev),
+		AMI_MOCK_DEV_DEV(dev),
+		AMI_MOCK_DEV_FUNC(dev)
+	);
+}
+
+/*
+ * nftw callback to remove the fake tree.
+ */
+static int remove_mock_file(const char *path, const struct stat *sb,
+	int flag, struct FTW *ftwbuf)
+{
+	return remove(path);
+}
+
+/*****************************************************************************/
+/* Redefinitions/Wrapping                                                    */
+/*****************************************************************************/
+
+int __wrap_open(const char *pathname, int flags, int mode)
+{
+	char path[PATH_MAX];  /* only written if redirected */
+
+	counters.open++;
+	return __real_open(mock_path(pathname, path), flags, mode);
+}
+
+int __wrap_close(int fd)
+{
+	counters.close++;
+	return __real_close(fd);
+}
+
+ssize_t __wrap_read(int fd, void *buf, size_t count)
+{
+	counters.read++;
+	return __real_read(fd, buf, count);
+}
+
+int __wrap_stat(const char *path, struct stat *buf)
+{
+	char mocked[PATH_MAX];  /* only written if redirected */
+
+	counters.stat++;
+	return __real_stat(mock_path(path, mocked), buf);
+}
+
+FILE *__wrap_fopen(const char *restrict pathname, const char *restrict mode)
+{
+	char path[PATH_MAX];  /* only written if redirected */
+
+	counters.open++;
+	return __real_fopen(mock_path(pathname, path), mode);
+}
+
+int __wrap_glob(const char *restrict pattern, int flags,
+	int (*errfunc)(const char *epath, int eerrno), glob_t *restrict pglob)
+{
+	char path[PATH_MAX];  /* only written if redirected */
+	const char *mocked = mock_path(pattern, path);
+	int ret = 0;
+	size_t i = 0;
+
+	counters.glob++;
+	ret = __real_glob(mocked, flags, errfunc, pglob);
+
+	/* Hand back the paths the caller asked for, not the redirected ones. */
+	if ((ret == 0) && (mocked != pattern)) {
+		for (i = 0; i < pglob->gl_pathc; i++) {
+			char *p = pglob->gl_pathv[pglob->gl_offs + i];
+
+			memmove(p, p + mock_root_len, strlen(p + mock_root_len) + 1);
+		}
+	}
+
+	return ret;
+}
+
+int __wrap_ioctl(int fd, unsigned long request, ...)
+{
+	int ret = 0;
+	void *data = NULL;
+	va_list args;
+
+	va_start(args, request);
+	data = va_arg(args, void*);
+	va_end(args);
+
+	counters.ioctl++;
+
+	switch (request) {
+	case AMI_IOC_APP_SETUP:
+	case AMI_IOC_SET_SENSOR_REFRESH:
+	case AMI_IOC_WRITE_BAR:
+		break;
+
+	case AMI_IOC_GET_SENSOR_VALUE:
+	{
+		struct ami_ioc_sensor_value *val = (struct ami_ioc_sensor_value*)data;
+
+		val->val = 1000 + val->hwmon_channel;
+		strncpy(val->status, MOCK_SENSOR_STATUS, AMI_IOC_SENSOR_STATUS_LEN);
+		val->fresh = true;
+		break;
+	}
+
+	case AMI_IOC_READ_BAR:
+	{
+		struct ami_ioc_bar_data *bar = (struct ami_ioc_bar_data*)data;
+		uint32_t *regs = (uint32_t*)bar->addr;
+		uint32_t i = 0;
+
+		for (i = 0; i < bar->num; i++)
+			regs[i] = (uint32_t)(bar->offset + (i * sizeof(uint32_t)));
+		break;
+	}
+
+	default:
+		errno = ENOTTY;
+		ret = -1;
+		break;
+	}
+
+	return ret;
+}
+
+/*****************************************************************************/
+/* Public function definitions                                               */
+/*****************************************************************************/
+
+/*
+ * Build a fake driver tree.
+ */
+int ami_mock_create(int num_devices, int num_sensors)
+{
+	int ret = AMI_STATUS_OK;
+	char buf[64] = { 0 };
+	char *devices = NULL;
+	size_t devices_len = 0;
+	int dev = 0;
+	int n = 0;
+
+	if ((num_devices <= 0) || (num_devices > AMI_MOCK_MAX_DEVICES) ||
+			(num_sensors < 0) || mock_root_len)
+		return AMI_STATUS_ERROR;
+
+	strcpy(mock_root, MOCK_ROOT_TEMPLATE);
+	if (!mkdtemp(mock_root))
+		return AMI_STATUS_ERROR;
+
+	/* Must match VERSION_ATTR_FMT in ami.c */
+	snprintf(buf, sizeof(buf), "%d.%d.%d +0 *0\n",
+		GIT_TAG_VER_MAJOR, GIT_TAG_VER_MINOR, GIT_TAG_VER_PATCH);
+	ret = write_mock_file(buf, "%s", AMI_DRIVER_VERSION);
+
+	/*
+	 * First line is the device count, then "<bdf> <cdev> <hwmon>". The driver
+	 * itself owns cdev 0 so devices start at 1.
+	 */
+	devices_len = (size_t)(num_devices + 1) * sizeof(buf);
+	devices = (char*)calloc(1, devices_len);
+	if (!devices)
+		ret = AMI_STATUS_ERROR;
+
+	if (ret == AMI_STATUS_OK) {
+		size_t len = snprintf(devices, devices_len, "%d\n", num_devices);
+
+		for (dev = 0; dev < num_devices; dev++)
+			len += snprintf(devices + len, devices_len - len,
+				"%02x:%02x.%1x %d %d\n",
+				AMI_MOCK_DEV_BUS(dev),
+				AMI_MOCK_DEV_DEV(dev),
+				AMI_MOCK_DEV_FUNC(dev),
+				dev + 1,
+				dev);
+
+		ret = write_mock_file(devices, "%s", AMI_DEVICES_MAP);
+	}
+
+	free(devices);
+
+	if (ret == AMI_STATUS_OK)
+		ret = write_mock_file("", MOCK_PCI_RESCAN);
+
+	for (dev = 0; (dev < num_devices) && (ret == AMI_STATUS_OK); dev++) {
+		ret = write_mock_file("", AMI_DEV, dev + 1);
+
+		if (ret == AMI_STATUS_OK)
+			ret = write_mock_file("", MOCK_PCI_REMOVE,
+				AMI_MOCK_DEV_BUS(dev), AMI_MOCK_DEV_DEV(dev), AMI_MOCK_DEV_FUNC(dev));
+
+		if (ret == AMI_STATUS_OK)
+			ret = write_dev_state(dev, MOCK_DEV_READY);
+
+		for (n = 0; (n < num_sensors) && (ret == AMI_STATUS_OK); n++)
+			ret = write_mock_sensor(dev, n);
+	}
+
+	/* Start redirecting */
+	mock_root_len = strlen(mock_root);
+
+	if (ret != AMI_STATUS_OK)
+		ami_mock_destroy();
+
+	return ret;
+}
+
+/*
+ * Remove the fake driver tree.
+ */
+void ami_mock_destroy(void)
+{
+	if (mock_root[0] != '\0')
+		nftw(mock_root, remove_mock_file, 64, FTW_DEPTH | FTW_PHYS);
+
+	mock_root[0] = '\0';
+	mock_root_len = 0;
+}
+
+/*
+ * Set the driver state of a fake device.
+ */
+int ami_mock_set_dev_state(int n, const char *state)
+{
+	if (!mock_root_len || !state || (n < 0) || (n >= AMI_MOCK_MAX_DEVICES))
+		return AMI_STATUS_ERROR;
+
+	return write_dev_state(n, state);
+}
+
+/*
+ * Get the type of a fake sensor.
+ */
+enum ami_sensor_type ami_mock_sensor_type(int n)
+{
+	return sensor_types[n % (sizeof(sensor_types) / sizeof(sensor_types[0]))];
+}
+
+/*
+ * Zero the call counters.
+ */
+void ami_mock_reset_counters(void)
+{
+	memset(&counters, 0, sizeof(counters));
+}
+
+/*
+ * Get the call counters.
+ */
+void ami_mock_get_counters(struct ami_mock_counters *c)
+{
+	if (c)
+		*c = counters;
+}
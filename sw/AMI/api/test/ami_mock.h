@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * ami_mock.h - Fake sysfs/hwmon tree and IOCTL shim for running libami
+ * without a card.
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+#ifndef AMI_MOCK_H
+#define AMI_MOCK_H
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdint.h>
+
+/* Public API includes */
+#include "ami_sensor.h"
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+/* Label of sensor N in the fake hwmon tree. */
+#define AMI_MOCK_SENSOR_NAME	"sensor_%d"
+
+/* BDF components of device N. */
+#define AMI_MOCK_DEV_BUS(n)	(0x10 + ((n) / 32))
+#define AMI_MOCK_DEV_DEV(n)	((n) % 32)
+#define AMI_MOCK_DEV_FUNC(n)	(0)
+
+#define AMI_MOCK_MAX_DEVICES	(1024)
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * struct ami_mock_counters - Calls made by libami since the last reset.
+ * @open: open() and fopen() calls.
+ * @close: close() calls.
+ * @read: read() calls.
+ * @ioctl: ioctl() calls.
+ * @stat: stat() calls.
+ * @glob: glob() calls.
+ *
+ * These are the calls that reach the kernel on real hardware; in the mock
+ * IOCTLs are answered in user space and never leave the process.
+ */
+struct ami_mock_counters {
+	unsigned long open;
+	unsigned long close;
+	unsigned long read;
+	unsigned long ioctl;
+	unsigned long stat;
+	unsigned long glob;
+};
+
+/*****************************************************************************/
+/* Function declarations                                                     */
+/*****************************************************************************/
+
+/**
+ * ami_mock_create() - Build a fake driver tree.
+ * @num_devices: Number of devices to expose (at most AMI_MOCK_MAX_DEVICES).
+ * @num_sensors: Number of hwmon sensors per device.
+ *
+ * The tree is created under a fresh directory in /tmp. Once created, every
+ * path libami opens under /sys or /dev/ami is redirected into it. Device N
+ * uses /dev/ami(N+1) and hwmonN and starts in the READY state; sensor N is
+ * labelled AMI_MOCK_SENSOR_NAME and its type is given by `ami_mock_sensor_type`.
+ * The PCI remove and rescan nodes accept writes but have no effect.
+ *
+ * Return: AMI_STATUS_OK or AMI_STATUS_ERROR
+ */
+int ami_mock_create(int num_devices, int num_sensors);
+
+/**
+ * ami_mock_destroy() - Remove the fake driver tree.
+ *
+ * Paths are no longer redirected once this returns.
+ */
+void ami_mock_destroy(void);
+
+/**
+ * ami_mock_set_dev_state() - Set the driver state of a fake device.
+ * @n: Device number.
+ * @state: State name as shown in sysfs (e.g. "INIT").
+ *
+ * Return: AMI_STATUS_OK or AMI_STATUS_ERROR
+ */
+int ami_mock_set_dev_state(int n, const char *state);
+
+/**
+ * ami_mock_sensor_type() - Get the type of a fake sensor.
+ * @n: Sensor number.
+ *
+ * Return: The sensor type - the types are used round robin.
+ */
+enum ami_sensor_type ami_mock_sensor_type(int n);
+
+/**
+ * ami_mock_reset_counters() - Zero the call counters.
+ */
+void ami_mock_reset_counters(void);
+
+/**
+ * ami_mock_get_counters() - Get the call counters.
+ * @counters: Output struct.
+ */
+void ami_mock_get_counters(struct ami_mock_counters *counters);
+
+#endif  /* AMI_MOCK_H */
@@ -0,0 +1,418 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * bench_ami.c - Host-side libami benchmarks against the mock driver tree
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Each row is one benchmark at one scale `n` (sensors, devices or BAR
+ * registers) with the mean time and the mean number of calls that would
+ * reach the kernel per operation. IOCTLs are answered by the mock, so their
+ * driver-side cost is not included.
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+/* AMI API includes */
+#include "ami.h"
+#include "ami_device.h"
+#include "ami_sensor.h"
+#include "ami_mem_access.h"
+
+/* Mock includes */
+#include "ami_mock.h"
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define NS_PER_S		(1000000000ULL)
+
+/* Total work per row is roughly constant - fewer iterations at larger n */
+#define BENCH_DISCOVER_BUDGET	(20000)
+#define BENCH_FIND_BUDGET	(20000)
+#define BENCH_GET_ITERATIONS	(20000)
+#define BENCH_BAR_ITERATIONS	(100000)
+#define BENCH_MIN_ITERATIONS	(5)
+
+#define BENCH_ITERATIONS(budget, n) \
+	((((budget) / (n)) > BENCH_MIN_ITERATIONS) ? ((budget) / (n)) : BENCH_MIN_ITERATIONS)
+
+/*****************************************************************************/
+/* Typedefs                                                                  */
+/*****************************************************************************/
+
+typedef int (*sensor_get_value_fn)(ami_device *dev, const char *sensor_name,
+	long *val, enum ami_sensor_status *sensor_status);
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * struct bench_sample - Accumulated cost of the timed calls.
+ * @ns: Total time.
+ * @calls: Total kernel calls.
+ */
+struct bench_sample {
+	uint64_t ns;
+	struct ami_mock_counters calls;
+};
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static const int scales[] = { 10, 100, 1000 };
+
+/*****************************************************************************/
+/* Local function definitions                                                */
+/*****************************************************************************/
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts = { 0 };
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec * NS_PER_S) + ts.tv_nsec;
+}
+
+/*
+ * Start timing a call.
+ */
+static uint64_t sample_start(void)
+{
+	ami_mock_reset_counters();
+	return now_ns();
+}
+
+/*
+ * Add the time and calls since `sample_start` to a sample.
+ */
+static void sample_end(struct bench_sample *s, uint64_t start)
+{
+	uint64_t end = now_ns();
+	struct ami_mock_counters c = { 0 };
+
+	ami_mock_get_counters(&c);
+
+	s->ns += end - start;
+	s->calls.open += c.open;
+	s->calls.close += c.close;
+	s->calls.read += c.read;
+	s->calls.ioctl += c.ioctl;
+	s->calls.stat += c.stat;
+	s->calls.glob += c.glob;
+}
+
+static void print_header(void)
+{
+	printf("%-28s %6s %10s %14s %8s %8s %8s %8s %8s %8s\n",
+		"benchmark", "n", "iterations", "ns_per_op",
+		"open", "close", "read", "ioctl", "stat", "glob");
+}
+
+static void print_row(const char *name, int n, int iterations, const struct bench_sample *s)
+{
+	double it = (double)iterations;
+
+	printf("%-28s %6d %10d %14.1f %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f\n",
+		name, n, iterations, (double)s->ns / it,
+		s->calls.open / it, s->calls.close / it, s->calls.read / it,
+		s->calls.ioctl / it, s->calls.stat / it, s->calls.glob / it);
+}
+
+static void print_failed(const char *name, int n)
+{
+	printf("%-28s %6d %10s %14s\n", name, n, "-", "FAILED");
+}
+
+/*
+ * Get a handle on the first mock device.
+ */
+static ami_device *first_device(void)
+{
+	ami_device *dev = NULL;
+
+	if (ami_dev_find_next(&dev, AMI_ANY_DEV, AMI_ANY_DEV, AMI_ANY_DEV, NULL) != AMI_STATUS_OK)
+		return NULL;
+
+	return dev;
+}
+
+static sensor_get_value_fn getter(enum ami_sensor_type type)
+{
+	switch (type) {
+	case AMI_SENSOR_TYPE_TEMP:
+		return ami_sensor_get_temp_value;
+
+	case AMI_SENSOR_TYPE_VOLTAGE:
+		return ami_sensor_get_voltage_value;
+
+	case AMI_SENSOR_TYPE_CURRENT:
+		return ami_sensor_get_current_value;
+
+	case AMI_SENSOR_TYPE_POWER:
+	default:
+		return ami_sensor_get_power_value;
+	}
+}
+
+/*
+ * `ami_sensor_discover` on a device with `n` sensors.
+ */
+static int bench_sensor_discover(int n)
+{
+	struct bench_sample s = { 0 };
+	int iterations = BENCH_ITERATIONS(BENCH_DISCOVER_BUDGET, n);
+	int i = 0;
+
+	for (i = 0; i < iterations; i++) {
+		ami_device *dev = first_device();
+		uint64_t start = 0;
+		int ret = AMI_STATUS_ERROR;
+
+		if (!dev)
+			break;
+
+		start = sample_start();
+		ret = ami_sensor_discover(dev);
+		sample_end(&s, start);
+
+		ami_dev_delete(&dev);
+
+		if (ret != AMI_STATUS_OK)
+			break;
+	}
+
+	if (i != iterations) {
+		print_failed("sensor_discover", n);
+		return AMI_STATUS_ERROR;
+	}
+
+	print_row("sensor_discover", n, iterations, &s);
+	return AMI_STATUS_OK;
+}
+
+/*
+ * `ami_sensor_get_*_value` round robin over `n` sensors, read from hwmon
+ * or (with `status`) over IOCTL.
+ */
+static int bench_sensor_get_value(int n, bool status)
+{
+	const char *name = status ? "sensor_get_value_status" : "sensor_get_value";
+	struct bench_sample s = { 0 };
+	ami_device *dev = first_device();
+	char (*names)[AMI_SENSOR_MAX_STR] = NULL;
+	uint64_t start = 0;
+	int ret = AMI_STATUS_ERROR;
+	int i = 0;
+
+	names = calloc(n, sizeof(*names));
+
+	if (dev && names && (ami_sensor_discover(dev) == AMI_STATUS_OK)) {
+		for (i = 0; i < n; i++)
+			snprintf(names[i], AMI_SENSOR_MAX_STR, AMI_MOCK_SENSOR_NAME, i);
+
+		ret = AMI_STATUS_OK;
+		start = sample_start();
+
+		for (i = 0; (i < BENCH_GET_ITERATIONS) && (ret == AMI_STATUS_OK); i++) {
+			enum ami_sensor_status st = AMI_SENSOR_STATUS_INVALID;
+			long val = 0;
+			int idx = i % n;
+
+			ret = getter(ami_mock_sensor_type(idx))(
+				dev,
+				names[idx],
+				&val,
+				status ? &st : NULL
+			);
+		}
+
+		sample_end(&s, start);
+	}
+
+	if (ret == AMI_STATUS_OK)
+		print_row(name, n, BENCH_GET_ITERATIONS, &s);
+	else
+		print_failed(name, n);
+
+	free(names);
+	ami_dev_delete(&dev);
+	return ret;
+}
+
+/*
+ * Enumerate all `n` devices the way amiapp does.
+ */
+static int bench_dev_find_next_all(int n)
+{
+	struct bench_sample s = { 0 };
+	int iterations = BENCH_ITERATIONS(BENCH_FIND_BUDGET, n);
+	int found = 0;
+	int i = 0;
+
+	for (i = 0; i < iterations; i++) {
+		ami_device *dev = NULL;
+		ami_device *prev = NULL;
+		uint64_t start = sample_start();
+
+		found = 0;
+		while (ami_dev_find_next(&dev, AMI_ANY_DEV, AMI_ANY_DEV, AMI_ANY_DEV, prev) == AMI_STATUS_OK) {
+			ami_dev_delete(&prev);
+			prev = dev;
+			dev = NULL;
+			found++;
+		}
+		ami_dev_delete(&prev);
+
+		sample_end(&s, start);
+
+		if (found != n)
+			break;
+	}
+
+	if (found != n) {
+		print_failed("dev_find_next_all", n);
+		return AMI_STATUS_ERROR;
+	}
+
+	print_row("dev_find_next_all", n, iterations, &s);
+	return AMI_STATUS_OK;
+}
+
+/*
+ * Find the last of `n` devices by BDF.
+ */
+static int bench_dev_find_next_last(int n)
+{
+	struct bench_sample s = { 0 };
+	int iterations = BENCH_ITERATIONS(BENCH_FIND_BUDGET, n) * 10;
+	int ret = AMI_STATUS_OK;
+	int i = 0;
+
+	for (i = 0; (i < iterations) && (ret == AMI_STATUS_OK); i++) {
+		ami_device *dev = NULL;
+		uint64_t start = sample_start();
+
+		ret = ami_dev_find_next(
+			&dev,
+			AMI_MOCK_DEV_BUS(n - 1),
+			AMI_MOCK_DEV_DEV(n - 1),
+			AMI_MOCK_DEV_FUNC(n - 1),
+			NULL
+		);
+		ami_dev_delete(&dev);
+
+		sample_end(&s, start);
+	}
+
+	if (ret != AMI_STATUS_OK) {
+		print_failed("dev_find_next_last", n);
+		return ret;
+	}
+
+	print_row("dev_find_next_last", n, iterations, &s);
+	return AMI_STATUS_OK;
+}
+
+/*
+ * `ami_mem_bar_read_range` of `n` registers.
+ */
+static int bench_mem_bar_read_range(ami_device *dev, int n)
+{
+	struct bench_sample s = { 0 };
+	uint32_t *regs = calloc(n, sizeof(uint32_t));
+	uint64_t start = 0;
+	int ret = AMI_STATUS_ERROR;
+	int i = 0;
+
+	if (regs) {
+		ret = AMI_STATUS_OK;
+		start = sample_start();
+
+		for (i = 0; (i < BENCH_BAR_ITERATIONS) && (ret == AMI_STATUS_OK); i++)
+			ret = ami_mem_bar_read_range(dev, 0, 0, n, regs);
+
+		sample_end(&s, start);
+	}
+
+	if (ret == AMI_STATUS_OK)
+		print_row("mem_bar_read_range", n, BENCH_BAR_ITERATIONS, &s);
+	else
+		print_failed("mem_bar_read_range", n);
+
+	free(regs);
+	return ret;
+}
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+int main(void)
+{
+	int ret = AMI_STATUS_OK;
+	ami_device *dev = NULL;
+	int i = 0;
+
+	print_header();
+
+	/* One device with n sensors */
+	for (i = 0; i < sizeof(scales) / sizeof(scales[0]); i++) {
+		if (ami_mock_create(1, scales[i]) != AMI_STATUS_OK) {
+			fprintf(stderr, "could not create mock tree\n");
+			return EXIT_FAILURE;
+		}
+
+		ret |= bench_sensor_discover(scales[i]);
+		ret |= bench_sensor_get_value(scales[i], false);
+		ret |= bench_sensor_get_value(scales[i], true);
+
+		ami_mock_destroy();
+	}
+
+	/* n devices, no sensors */
+	for (i = 0; i < sizeof(scales) / sizeof(scales[0]); i++) {
+		if (ami_mock_create(scales[i], 0) != AMI_STATUS_OK) {
+			fprintf(stderr, "could not create mock tree\n");
+			return EXIT_FAILURE;
+		}
+
+		ret |= bench_dev_find_next_all(scales[i]);
+		ret |= bench_dev_find_next_last(scales[i]);
+
+		ami_mock_destroy();
+	}
+
+	/* n BAR registers */
+	if (ami_mock_create(1, 0) != AMI_STATUS_OK) {
+		fprintf(stderr, "could not create mock tree\n");
+		return EXIT_FAILURE;
+	}
+
+	dev = first_device();
+
+	for (i = 0; i < sizeof(scales) / sizeof(scales[0]); i++) {
+		if (dev)
+			ret |= bench_mem_bar_read_range(dev, scales[i]);
+		else
+			print_failed("mem_bar_read_range", scales[i]);
+	}
+
+	ami_dev_delete(&dev);
+	ami_mock_destroy();
+
+	return ((ret == AMI_STATUS_OK) && dev == NULL) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
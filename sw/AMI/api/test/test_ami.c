@@ -15,6 +15,10 @@
 #include <setjmp.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/utsname.h>
 
 /* Test includes */
 #include "test_harness.h"
@@ -24,13 +28,35 @@
 
 /* AMI API includes */
 #include "ami_internal.h"
+#include "ami_program.h"
 
 /*****************************************************************************/
 /* Defines                                                                   */
 /*****************************************************************************/
 
 /* Update this when more error codes are added. */
-#define MAX_AMI_ERROR (AMI_ERROR_EVER + 1)
+#define MAX_AMI_ERROR (AMI_ERROR_ETIMEDOUT + 1)
+
+#define TEST_CHUNK_BYTES	(PDI_CHUNK_SIZE * PDI_CHUNK_MULTIPLIER)
+#define TEST_EVENT_WAIT_MS	(1000)
+#define TEST_IDLE_TIMEOUT_MS	(10)
+#define TEST_IDLE_PERIOD_MS	(100)
+
+/**
+ * struct event_counts - what the event handler has seen
+ * @ok: number of AMI_EVENT_STATUS_OK events
+ * @timeout: number of AMI_EVENT_STATUS_TIMEOUT events
+ * @error: number of AMI_EVENT_STATUS_READ_ERROR events
+ * @bytes: sum of `ctr` over all OK events
+ * @last: `ctr` of the last OK event
+ */
+struct event_counts {
+	volatile int ok;
+	volatile int timeout;
+	volatile int error;
+	volatile uint64_t bytes;
+	volatile uint64_t last;
+};
 
 /*****************************************************************************/
 /* Global variables                                                          */
@@ -39,6 +65,10 @@
 static struct wrapper w_close  = { REAL, REAL, 0, 0 };
 static struct wrapper w_open   = { REAL, REAL, 0, 0 };
 static struct wrapper w_read   = { REAL, REAL, 0, 0 };
+static struct wrapper w_uname  = { REAL, REAL, 0, 0 };
+static struct wrapper w_eventfd = { REAL, REAL, 0, 0 };
+
+static int uname_calls = 0;
 
 /*****************************************************************************/
 /* Redefinitions/Wrapping                                                    */
@@ -118,6 +148,97 @@ ssize_t __wrap_read(int fildes, void *buf, size_t nbyte)
 	return ret;
 }
 
+extern int __real_uname(struct utsname *buf);
+
+int __wrap_uname(struct utsname *buf)
+{
+	int ret = AMI_LINUX_STATUS_ERROR;
+
+	uname_calls++;
+
+	switch (w_uname.current) {
+	case OK:
+	{
+		/* Must use `will_return` if behaviour is set to `OK` */
+		char *release = mock_ptr_type(char*);
+		memset(buf, 0, sizeof(struct utsname));
+		strncpy(buf->release, release, sizeof(buf->release) - 1);
+		ret = AMI_LINUX_STATUS_OK;
+		break;
+	}
+
+	case REAL:
+		ret = __real_uname(buf);
+		break;
+
+	default:
+		break;
+	}
+
+	WRAPPER_DONE(uname);
+	return ret;
+}
+
+extern int __real_eventfd(unsigned int initval, int flags);
+
+int __wrap_eventfd(unsigned int initval, int flags)
+{
+	int ret = AMI_LINUX_STATUS_ERROR;
+
+	switch (w_eventfd.current) {
+	case REAL:
+		ret = __real_eventfd(initval, flags);
+		break;
+
+	default:
+		break;
+	}
+
+	WRAPPER_DONE(eventfd);
+	return ret;
+}
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+/* Runs in the event thread */
+static void count_events(enum ami_event_status status, uint64_t ctr, void *data)
+{
+	struct event_counts *counts = (struct event_counts*)data;
+
+	switch (status) {
+	case AMI_EVENT_STATUS_OK:
+		counts->bytes += ctr;
+		counts->last = ctr;
+		counts->ok++;
+		break;
+
+	case AMI_EVENT_STATUS_TIMEOUT:
+		counts->timeout++;
+		break;
+
+	default:
+		counts->error++;
+		break;
+	}
+}
+
+/* Signal the eventfd as the driver would and wait for the handler to run */
+static void signal_and_wait(struct ami_event_data *evt, struct event_counts *counts,
+	uint64_t value)
+{
+	int expected = counts->ok + 1;
+	int waited = 0;
+
+	assert_int_equal(write(evt->efd, &value, sizeof(uint64_t)), sizeof(uint64_t));
+
+	while ((counts->ok < expected) && (waited++ < TEST_EVENT_WAIT_MS))
+		ami_msleep(1);
+
+	assert_int_equal(counts->ok, expected);
+}
+
 /*****************************************************************************/
 /* Tests                                                                     */
 /*****************************************************************************/
@@ -337,6 +458,145 @@ void test_fail_ami_parse_bdf(void **state)
 	);
 }
 
+void test_happy_watch_driver_events_chunks(void **state)
+{
+	struct ami_event_data evt = { 0 };
+	struct event_counts counts = { 0 };
+	uint64_t total = (TEST_CHUNK_BYTES * 2) + (TEST_CHUNK_BYTES / 2);
+
+	/* Happy path - one count per chunk, kernel version checked once */
+	uname_calls = 0;
+	WRAPPER_ACTION(OK, uname);
+	will_return(__wrap_uname, "6.8.0-generic");
+	assert_int_equal(
+		ami_watch_driver_events(&evt, count_events, &counts, total,
+			AMI_EVENT_NO_IDLE_TIMEOUT),
+		AMI_STATUS_OK
+	);
+	assert_true(evt.efd_counts_chunks);
+
+	signal_and_wait(&evt, &counts, 1);
+	assert_int_equal(counts.last, TEST_CHUNK_BYTES);
+	signal_and_wait(&evt, &counts, 1);
+	assert_int_equal(counts.last, TEST_CHUNK_BYTES);
+
+	/* Final chunk is short - capped at the total */
+	signal_and_wait(&evt, &counts, 1);
+	assert_int_equal(counts.last, TEST_CHUNK_BYTES / 2);
+
+	/* No idle callbacks while nothing happens */
+	ami_msleep(TEST_IDLE_PERIOD_MS);
+
+	assert_int_equal(ami_stop_watching_events(&evt), AMI_STATUS_OK);
+	assert_int_equal(counts.ok, 3);
+	assert_int_equal(counts.timeout, 0);
+	assert_int_equal(counts.error, 0);
+	assert_int_equal(counts.bytes, total);
+	assert_int_equal(uname_calls, 1);
+	assert_int_equal(evt.efd, AMI_INVALID_FD);
+	assert_int_equal(evt.stop_efd, AMI_INVALID_FD);
+}
+
+void test_happy_watch_driver_events_bytes(void **state)
+{
+	struct ami_event_data evt = { 0 };
+	struct event_counts counts = { 0 };
+	uint64_t value = 0;
+
+	/* Happy path - counter holds bytes written */
+	WRAPPER_ACTION(OK, uname);
+	will_return(__wrap_uname, "5.15.0");
+	assert_int_equal(
+		ami_watch_driver_events(&evt, count_events, &counts, 0,
+			AMI_EVENT_NO_IDLE_TIMEOUT),
+		AMI_STATUS_OK
+	);
+	assert_false(evt.efd_counts_chunks);
+
+	signal_and_wait(&evt, &counts, 100);
+	assert_int_equal(counts.last, 100);
+
+	/* Signals racing the stop request are still reported */
+	value = 200;
+	assert_int_equal(write(evt.efd, &value, sizeof(uint64_t)), sizeof(uint64_t));
+	value = 300;
+	assert_int_equal(write(evt.efd, &value, sizeof(uint64_t)), sizeof(uint64_t));
+
+	assert_int_equal(ami_stop_watching_events(&evt), AMI_STATUS_OK);
+	assert_in_range(counts.ok, 2, 3);
+	assert_int_equal(counts.timeout, 0);
+	assert_int_equal(counts.bytes, 600);
+}
+
+void test_happy_watch_driver_events_idle(void **state)
+{
+	struct ami_event_data evt = { 0 };
+	struct event_counts counts = { 0 };
+
+	/* Happy path - idle timeouts reported when requested */
+	WRAPPER_ACTION(OK, uname);
+	will_return(__wrap_uname, "6.8.0");
+	assert_int_equal(
+		ami_watch_driver_events(&evt, count_events, &counts, 0,
+			TEST_IDLE_TIMEOUT_MS),
+		AMI_STATUS_OK
+	);
+
+	ami_msleep(TEST_IDLE_PERIOD_MS);
+
+	assert_int_equal(ami_stop_watching_events(&evt), AMI_STATUS_OK);
+	assert_int_equal(counts.ok, 0);
+	assert_true(counts.timeout > 0);
+	assert_true(counts.timeout <= (TEST_IDLE_PERIOD_MS / TEST_IDLE_TIMEOUT_MS) + 1);
+}
+
+void test_fail_watch_driver_events(void **state)
+{
+	struct ami_event_data evt = { 0 };
+	struct event_counts counts = { 0 };
+
+	/* Failure path - invalid `event_data` argument */
+	assert_int_equal(
+		ami_watch_driver_events(NULL, count_events, &counts, 0,
+			AMI_EVENT_NO_IDLE_TIMEOUT),
+		AMI_STATUS_ERROR
+	);
+	assert_int_equal(ami_last_error, AMI_ERROR_EINVAL);
+
+	/* Failure path - invalid `callback` argument */
+	assert_int_equal(
+		ami_watch_driver_events(&evt, NULL, &counts, 0,
+			AMI_EVENT_NO_IDLE_TIMEOUT),
+		AMI_STATUS_ERROR
+	);
+	assert_int_equal(ami_last_error, AMI_ERROR_EINVAL);
+	assert_int_equal(evt.efd, AMI_INVALID_FD);
+
+	/* Failure path - invalid `idle_timeout_ms` argument */
+	assert_int_equal(
+		ami_watch_driver_events(&evt, count_events, &counts, 0, -2),
+		AMI_STATUS_ERROR
+	);
+	assert_int_equal(ami_last_error, AMI_ERROR_EINVAL);
+
+	/* Failure path - eventfd fails */
+	WRAPPER_ACTION(OK, uname);
+	WRAPPER_ACTION(FAIL, eventfd);
+	will_return(__wrap_uname, "6.8.0");
+	assert_int_equal(
+		ami_watch_driver_events(&evt, count_events, &counts, 0,
+			AMI_EVENT_NO_IDLE_TIMEOUT),
+		AMI_STATUS_ERROR
+	);
+	assert_int_equal(ami_last_error, AMI_ERROR_EBADF);
+	assert_int_equal(evt.efd, AMI_INVALID_FD);
+	assert_false(evt.thread_created);
+
+	/* Stopping after a failed start is harmless */
+	assert_int_equal(ami_stop_watching_events(&evt), AMI_STATUS_OK);
+	assert_int_equal(counts.ok + counts.timeout + counts.error, 0);
+}
+
 /*****************************************************************************/
 
 int main(void)
@@ -352,6 +612,10 @@ int main(void)
 		cmocka_unit_test(test_happy_ami_get_last_error),
 		cmocka_unit_test(test_happy_ami_parse_bdf),
 		cmocka_unit_test(test_fail_ami_parse_bdf),
+		cmocka_unit_test(test_happy_watch_driver_events_chunks),
+		cmocka_unit_test(test_happy_watch_driver_events_bytes),
+		cmocka_unit_test(test_happy_watch_driver_events_idle),
+		cmocka_unit_test(test_fail_watch_driver_events),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
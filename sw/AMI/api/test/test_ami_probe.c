@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * test_ami_probe.c - Probe timing tests for ami_device.c
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * The driver starts the AMC dependent services of a device after its probe
+ * has returned. These tests reload a device in the mock driver tree while it
+ * is still in the INIT state and check that libami waits for it. With several
+ * cards, each one finishes starting on its own, so waiting for all of them
+ * should take as long as the slowest card rather than the sum of all cards.
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* External includes */
+#include "cmocka.h"
+
+/* AMI API includes */
+#include "ami.h"
+#include "ami_device.h"
+#include "ami_sensor.h"
+
+/* Mock includes */
+#include "ami_mock.h"
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define TEST_NUM_SENSORS	(8)
+#define TEST_DEV_BDF		"10:00.0"
+#define TEST_NUM_CARDS		(4)
+
+/* Must match DEV_INIT_TIMEOUT_MS / DEV_INIT_POLL_MS in ami_device.c */
+#define TEST_MAX_POLLS		(600)
+
+/* Never finish initialising. */
+#define TEST_NEVER_READY	(-1)
+
+/*****************************************************************************/
+/* Global variables                                                          */
+/*****************************************************************************/
+
+/* Number of polls libami has made while waiting. */
+static int n_sleeps = 0;
+
+/* Number of devices in the mock driver tree. */
+static int num_cards = 0;
+
+/* Poll on which the driver finishes starting each device. */
+static int ready_after[TEST_NUM_CARDS] = { 0 };
+
+/*****************************************************************************/
+/* Redefinitions/Wrapping                                                    */
+/*****************************************************************************/
+
+/*
+ * Stands in for the driver's init work - device N becomes ready after
+ * `ready_after[N]` polls, without actually sleeping. All devices share the
+ * same clock, as the init work of every card runs in parallel.
+ */
+int __wrap_ami_msleep(long msec)
+{
+	int i = 0;
+
+	n_sleeps++;
+
+	for (i = 0; i < num_cards; i++) {
+		if (n_sleeps == ready_after[i])
+			ami_mock_set_dev_state(i, "READY");
+	}
+
+	return AMI_STATUS_OK;
+}
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+/*
+ * Get the BDF string of device N in the mock driver tree.
+ */
+static void card_bdf(int n, char bdf[AMI_BDF_STR_LEN])
+{
+	snprintf(bdf, AMI_BDF_STR_LEN, "%02x:%02x.%1x",
+		AMI_MOCK_DEV_BUS(n), AMI_MOCK_DEV_DEV(n), AMI_MOCK_DEV_FUNC(n));
+}
+
+/*
+ * Put every card in the INIT state, as right after they have all been probed.
+ */
+static void probe_all_cards(const int *ready)
+{
+	int i = 0;
+
+	for (i = 0; i < num_cards; i++) {
+		assert_int_equal(ami_mock_set_dev_state(i, "INIT"), AMI_STATUS_OK);
+		ready_after[i] = ready[i];
+	}
+}
+
+/*****************************************************************************/
+/* Setup/teardown                                                            */
+/*****************************************************************************/
+
+static int setup_n(int n)
+{
+	int i = 0;
+
+	n_sleeps = 0;
+	num_cards = n;
+
+	for (i = 0; i < TEST_NUM_CARDS; i++)
+		ready_after[i] = TEST_NEVER_READY;
+
+	return ami_mock_create(n, TEST_NUM_SENSORS);
+}
+
+static int setup(void **state)
+{
+	return setup_n(1);
+}
+
+static int setup_cards(void **state)
+{
+	return setup_n(TEST_NUM_CARDS);
+}
+
+static int teardown(void **state)
+{
+	ami_mock_destroy();
+	return 0;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+void test_happy_probe_ready(void **state)
+{
+	ami_device *dev = NULL;
+
+	assert_int_equal(ami_dev_find(TEST_DEV_BDF, &dev), AMI_STATUS_OK);
+
+	/* Happy path - device already started, no waiting */
+	assert_int_equal(ami_dev_pci_reload(&dev, NULL), AMI_STATUS_OK);
+	assert_non_null(dev);
+	assert_int_equal(n_sleeps, 0);
+
+	ami_dev_delete(&dev);
+}
+
+void test_happy_probe_wait_handle(void **state)
+{
+	ami_device *dev = NULL;
+	int num = 0;
+
+	assert_int_equal(ami_dev_find(TEST_DEV_BDF, &dev), AMI_STATUS_OK);
+	assert_int_equal(ami_sensor_discover(dev), AMI_STATUS_OK);
+
+	/* Happy path - probe returns before the sensors are up */
+	assert_int_equal(ami_mock_set_dev_state(0, "INIT"), AMI_STATUS_OK);
+	ready_after[0] = 3;
+
+	assert_int_equal(ami_dev_pci_reload(&dev, NULL), AMI_STATUS_OK);
+	assert_int_equal(n_sleeps, ready_after[0]);
+	assert_non_null(dev);
+
+	/* Sensors are discovered on the new handle */
+	assert_int_equal(ami_sensor_get_num_total(dev, &num), AMI_STATUS_OK);
+	assert_int_equal(num, TEST_NUM_SENSORS);
+
+	ami_dev_delete(&dev);
+}
+
+void test_happy_probe_wait_bdf(void **state)
+{
+	/* Happy path - no handle, but the reload still waits */
+	assert_int_equal(ami_mock_set_dev_state(0, "INIT"), AMI_STATUS_OK);
+	ready_after[0] = 5;
+
+	assert_int_equal(ami_dev_pci_reload(NULL, TEST_DEV_BDF), AMI_STATUS_OK);
+	assert_int_equal(n_sleeps, ready_after[0]);
+}
+
+void test_fail_probe_timeout(void **state)
+{
+	ami_device *dev = NULL;
+
+	assert_int_equal(ami_dev_find(TEST_DEV_BDF, &dev), AMI_STATUS_OK);
+
+	/* Failure path - device never leaves INIT */
+	assert_int_equal(ami_mock_set_dev_state(0, "INIT"), AMI_STATUS_OK);
+
+	assert_int_equal(ami_dev_pci_reload(&dev, NULL), AMI_STATUS_ERROR);
+	assert_int_equal(n_sleeps, TEST_MAX_POLLS);
+	assert_null(dev);
+}
+
+void test_happy_probe_cards_parallel(void **state)
+{
+	const int ready[TEST_NUM_CARDS] = { 4, 9, 2, 7 };
+	char bdf[AMI_BDF_STR_LEN] = { 0 };
+	int i = 0;
+
+	/* Happy path - all cards probed at once, each finishes in its own time */
+	probe_all_cards(ready);
+
+	card_bdf(0, bdf);
+	assert_int_equal(ami_dev_pci_reload(NULL, bdf), AMI_STATUS_OK);
+	assert_int_equal(n_sleeps, 4);
+
+	/* The others kept starting while we waited for the first card */
+	card_bdf(1, bdf);
+	assert_int_equal(ami_dev_pci_reload(NULL, bdf), AMI_STATUS_OK);
+	assert_int_equal(n_sleeps, 9);
+
+	for (i = 2; i < TEST_NUM_CARDS; i++) {
+		card_bdf(i, bdf);
+		assert_int_equal(ami_dev_pci_reload(NULL, bdf), AMI_STATUS_OK);
+	}
+
+	/* Total wait is the slowest card, not the sum of all cards */
+	assert_int_equal(n_sleeps, 9);
+}
+
+void test_happy_probe_cards_handles(void **state)
+{
+	const int ready[TEST_NUM_CARDS] = { 3, 3, 6, 1 };
+	ami_device *devs[TEST_NUM_CARDS] = { NULL };
+	char bdf[AMI_BDF_STR_LEN] = { 0 };
+	int num = 0;
+	int i = 0;
+
+	for (i = 0; i < TEST_NUM_CARDS; i++) {
+		card_bdf(i, bdf);
+		assert_int_equal(ami_dev_find(bdf, &devs[i]), AMI_STATUS_OK);
+		assert_int_equal(ami_sensor_discover(devs[i]), AMI_STATUS_OK);
+	}
+
+	/* Happy path - every handle is re-created once its own card is ready */
+	probe_all_cards(ready);
+
+	for (i = 0; i < TEST_NUM_CARDS; i++) {
+		assert_int_equal(ami_dev_pci_reload(&devs[i], NULL), AMI_STATUS_OK);
+		assert_non_null(devs[i]);
+		assert_int_equal(ami_sensor_get_num_total(devs[i], &num), AMI_STATUS_OK);
+		assert_int_equal(num, TEST_NUM_SENSORS);
+	}
+
+	assert_int_equal(n_sleeps, 6);
+
+	for (i = 0; i < TEST_NUM_CARDS; i++)
+		ami_dev_delete(&devs[i]);
+}
+
+void test_fail_probe_one_card_stuck(void **state)
+{
+	const int ready[TEST_NUM_CARDS] = { 3, TEST_NEVER_READY, 2, 5 };
+	char bdf[AMI_BDF_STR_LEN] = { 0 };
+
+	/* Failure path - one card never leaves INIT */
+	probe_all_cards(ready);
+
+	card_bdf(0, bdf);
+	assert_int_equal(ami_dev_pci_reload(NULL, bdf), AMI_STATUS_OK);
+	assert_int_equal(n_sleeps, 3);
+
+	card_bdf(1, bdf);
+	assert_int_equal(ami_dev_pci_reload(NULL, bdf), AMI_STATUS_ERROR);
+	assert_int_equal(n_sleeps, 3 + TEST_MAX_POLLS);
+
+	/* The stuck card does not hold up the cards that are ready */
+	card_bdf(2, bdf);
+	assert_int_equal(ami_dev_pci_reload(NULL, bdf), AMI_STATUS_OK);
+	card_bdf(3, bdf);
+	assert_int_equal(ami_dev_pci_reload(NULL, bdf), AMI_STATUS_OK);
+	assert_int_equal(n_sleeps, 3 + TEST_MAX_POLLS);
+}
+
+/*****************************************************************************/
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(test_happy_probe_ready, setup, teardown),
+		cmocka_unit_test_setup_teardown(test_happy_probe_wait_handle, setup, teardown),
+		cmocka_unit_test_setup_teardown(test_happy_probe_wait_bdf, setup, teardown),
+		cmocka_unit_test_setup_teardown(test_fail_probe_timeout, setup, teardown),
+		cmocka_unit_test_setup_teardown(test_happy_probe_cards_parallel, setup_cards, teardown),
+		cmocka_unit_test_setup_teardown(test_happy_probe_cards_handles, setup_cards, teardown),
+		cmocka_unit_test_setup_teardown(test_fail_probe_one_card_stuck, setup_cards, teardown),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
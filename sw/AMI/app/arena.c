@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * arena.c - This file contains a simple arena (bump) allocator
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdlib.h>
+#include <stdint.h>
+
+/* App includes */
+#include "arena.h"
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+/* Chunk data starts after the (aligned) header. */
+#define CHUNK_HEADER_SIZE	ARENA_ALIGN_SIZE(sizeof(struct arena_chunk))
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * struct arena_chunk - A single underlying allocation.
+ * @next: Previously allocated chunk.
+ * @size: Usable size in bytes.
+ * @used: Bytes handed out so far.
+ */
+struct arena_chunk {
+	struct arena_chunk *next;
+	size_t              size;
+	size_t              used;
+};
+
+/*****************************************************************************/
+/* Public function definitions                                               */
+/*****************************************************************************/
+
+/*
+ * Initialise an empty arena.
+ */
+void arena_init(struct arena *arena, size_t chunk_size)
+{
+	if (!arena)
+		return;
+
+	arena->head = NULL;
+	arena->chunk_size = chunk_size;
+}
+
+/*
+ * Allocate zeroed memory from an arena.
+ */
+void *arena_alloc(struct arena *arena, size_t size)
+{
+	struct arena_chunk *chunk = NULL;
+	size_t chunk_size = 0;
+
+	if (!arena)
+		return NULL;
+
+	/* Overflow */
+	if (size > (SIZE_MAX - CHUNK_HEADER_SIZE - ARENA_ALIGN))
+		return NULL;
+
+	size = ARENA_ALIGN_SIZE(size);
+
+	chunk = arena->head;
+
+	if (!chunk || ((chunk->size - chunk->used) < size)) {
+		/* Oversized requests get a chunk of their own. */
+		chunk_size = (size > arena->chunk_size) ? (size) : (arena->chunk_size);
+		chunk = (struct arena_chunk*)calloc(1, CHUNK_HEADER_SIZE + chunk_size);
+
+		if (!chunk)
+			return NULL;
+
+		chunk->size = chunk_size;
+		chunk->next = arena->head;
+		arena->head = chunk;
+	}
+
+	chunk->used += size;
+	return (char*)chunk + CHUNK_HEADER_SIZE + chunk->used - size;
+}
+
+/*
+ * Free all memory allocated from an arena.
+ */
+void arena_destroy(struct arena *arena)
+{
+	struct arena_chunk *chunk = NULL;
+
+	if (!arena)
+		return;
+
+	while (arena->head) {
+		chunk = arena->head;
+		arena->head = chunk->next;
+		free(chunk);
+	}
+}
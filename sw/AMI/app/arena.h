@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * arena.h - This file contains a simple arena (bump) allocator
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+#ifndef AMI_APP_ARENA_H
+#define AMI_APP_ARENA_H
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stddef.h>
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+/* Alignment of every allocation. */
+#define ARENA_ALIGN		(16)
+
+/* Space taken up in an arena by an allocation of `x` bytes. */
+#define ARENA_ALIGN_SIZE(x)	(((x) + (ARENA_ALIGN - 1)) & ~((size_t)ARENA_ALIGN - 1))
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+struct arena_chunk;
+
+/**
+ * struct arena - Memory which is released all at once.
+ * @head: Most recently allocated chunk (the one being carved up).
+ * @chunk_size: Minimum size of a new chunk.
+ *
+ * Do not access the fields directly, use the `arena_*` functions.
+ */
+struct arena {
+	struct arena_chunk *head;
+	size_t              chunk_size;
+};
+
+/*****************************************************************************/
+/* Public function declarations                                              */
+/*****************************************************************************/
+
+/**
+ * arena_init() - Initialise an empty arena.
+ * @arena: Arena to initialise.
+ * @chunk_size: Minimum size of each underlying allocation.
+ *
+ * Nothing is allocated until the first call to `arena_alloc`. Size
+ * `chunk_size` to fit the expected total where possible, so that the arena
+ * is backed by a single allocation.
+ *
+ * Return: None.
+ */
+void arena_init(struct arena *arena, size_t chunk_size);
+
+/**
+ * arena_alloc() - Allocate zeroed memory from an arena.
+ * @arena: Arena to allocate from.
+ * @size: Number of bytes.
+ *
+ * The memory is valid until `arena_destroy` and must not be freed on its own.
+ *
+ * Return: Pointer to the memory or NULL on failure.
+ */
+void *arena_alloc(struct arena *arena, size_t size);
+
+/**
+ * arena_destroy() - Free all memory allocated from an arena.
+ * @arena: Arena to destroy.
+ *
+ * The arena is left empty and may be used again.
+ *
+ * Return: None.
+ */
+void arena_destroy(struct arena *arena);
+
+#endif  /* AMI_APP_ARENA_H */
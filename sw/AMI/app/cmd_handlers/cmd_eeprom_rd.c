@@ -92,8 +92,8 @@ static int do_cmd_eeprom_rd(struct app_option *options, int num_args, char **arg
 	uint16_t bdf = 0;
 
 	/* Positional arguments */
-	uint8_t offset = 0;
-	uint8_t num = 1;  /* Default to a single register */
+	uint16_t offset = 0;
+	uint32_t num = 1;  /* Default to a single register */
 
 	uint8_t *buf = NULL;
 
@@ -123,12 +123,12 @@ static int do_cmd_eeprom_rd(struct app_option *options, int num_args, char **arg
 		APP_USER_ERROR("Offset not specified", help_msg);
 		return EXIT_FAILURE;
 	} else {
-		offset = (uint8_t)strtoul(opt->arg, NULL, 0);
+		offset = (uint16_t)strtoul(opt->arg, NULL, 0);
 	}
 
 	/* Size */
 	if ((opt = find_app_option('l', options)) != NULL) {
-		num = (uint8_t)strtoul(opt->arg, NULL, 0);
+		num = (uint32_t)strtoul(opt->arg, NULL, 0);
 	}
 
 	/* Find device */
@@ -141,14 +141,18 @@ static int do_cmd_eeprom_rd(struct app_option *options, int num_args, char **arg
 
 	printf(
 		"Reading %d byte(s) from device %02x:%02x.%01x"
-		" at offset 0x%02x\r\n\r\n",
+		" at offset 0x%04x\r\n\r\n",
 		num, AMI_PCI_BUS(bdf), AMI_PCI_DEV(bdf), AMI_PCI_FUNC(bdf), offset
 	);
 
 	buf = (uint8_t*)calloc(num, sizeof(uint8_t));
 
 	if (buf) {
-		ret = ami_eeprom_read(dev, offset, num, buf);
+		/* The legacy request is limited to an 8-bit offset and length */
+		if ((offset > UINT8_MAX) || (num > UINT8_MAX) || ((offset + num) > (UINT8_MAX + 1)))
+			ret = ami_eeprom_read_bulk(dev, offset, num, buf);
+		else
+			ret = ami_eeprom_read(dev, (uint8_t)offset, (uint8_t)num, buf);
 
 		if (ret == AMI_STATUS_OK) {
 			ret = EXIT_SUCCESS;
@@ -92,8 +92,8 @@ static int do_cmd_eeprom_wr(struct app_option *options, int num_args, char **arg
 	uint16_t bdf = 0;
 
 	/* Positional arguments */
-	uint8_t offset = 0;
-	uint8_t num = 0;
+	uint16_t offset = 0;
+	uint32_t num = 0;
 
 	uint8_t *buf = NULL;
 
@@ -121,7 +121,7 @@ static int do_cmd_eeprom_wr(struct app_option *options, int num_args, char **arg
 		APP_USER_ERROR("Offset not specified", help_msg);
 		goto done;
 	} else {
-		offset = (uint8_t)strtoul(opt->arg, NULL, 0);
+		offset = (uint16_t)strtoul(opt->arg, NULL, 0);
 	}
 
 	/* Input */
@@ -145,7 +145,7 @@ static int do_cmd_eeprom_wr(struct app_option *options, int num_args, char **arg
 				APP_ERROR("could not read input file");
 				goto done;
 			}
-			num = (uint8_t)n;  /* Restrict the write to a uint8 */
+			num = n;
 		} else {
 			APP_USER_ERROR("no input data", help_msg);
 			goto done;
@@ -154,14 +154,18 @@ static int do_cmd_eeprom_wr(struct app_option *options, int num_args, char **arg
 
 	printf(
 		"Writing the following data to device %02x:%02x.%01x"
-		" at offset 0x%02x\r\n\r\n",
+		" at offset 0x%04x\r\n\r\n",
 		AMI_PCI_BUS(bdf), AMI_PCI_DEV(bdf), AMI_PCI_FUNC(bdf), offset
 	);
 	print_hexdump(offset, buf, num, APP_HEXDUMP_GROUPS_8, sizeof(uint8_t));
 	printf("\r\n");
 
 	if ((NULL != find_app_option('F', options)) || confirm_action(APP_CONFIRM_PROMPT, 'Y', 3)) {
-		ret = ami_eeprom_write(dev, offset, num, buf);
+		/* The legacy request is limited to an 8-bit offset and length */
+		if ((offset > UINT8_MAX) || (num > UINT8_MAX) || ((offset + num) > (UINT8_MAX + 1)))
+			ret = ami_eeprom_write_bulk(dev, offset, num, buf);
+		else
+			ret = ami_eeprom_write(dev, (uint8_t)offset, (uint8_t)num, buf);
 
 		if (ret == AMI_STATUS_OK) {
 			ret = EXIT_SUCCESS;
@@ -17,6 +17,7 @@
 #include <getopt.h>
 #include <unistd.h>
 #include <inttypes.h>
+#include <string.h>
 
 /* API include */
 #include "ami_module_access.h"
@@ -27,6 +28,12 @@
 #include "amiapp.h"
 #include "printer.h"
 
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define BATCH_LINE_MAX (128)
+
 /*****************************************************************************/
 /* Function declarations                                                     */
 /*****************************************************************************/
@@ -44,6 +51,18 @@
  */
 static int do_cmd_module_byte_rd(struct app_option *options, int num_args, char **args);
 
+/**
+ * do_batch_read() - Read every entry listed in a batch file in one request.
+ * @dev: Device handle.
+ * @fname: Path to the batch file.
+ *
+ * Each non-empty line of the file is `<cage> <page> <byte> [<len>]`; lines
+ * starting with '#' are ignored and `len` defaults to 1.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+static int do_batch_read(ami_device *dev, const char *fname);
+
 /*****************************************************************************/
 /* Global variables                                                          */
 /*****************************************************************************/
@@ -54,8 +73,9 @@ static int do_cmd_module_byte_rd(struct app_option *options, int num_args, char
  * c: Cage (module) ID
  * p: Page number
  * b: Byte offset
+ * I: Batch file
  */
-static const char short_options[] = "hd:c:p:b:";
+static const char short_options[] = "hd:c:p:b:I:";
 
 static const struct option long_options[] = {
 	{ "help", no_argument, NULL, 'h' },  /* help screen */
@@ -66,12 +86,15 @@ static const char help_msg[] = \
 	"module_byte_rd - Read from a QSFP module\r\n"
 	"\r\nUsage:\r\n"
 	"\t" APP_NAME " module_byte_rd -d <bdf> -c <n> -p <n> -b <n>\r\n"
+	"\t" APP_NAME " module_byte_rd -d <bdf> -I <path>\r\n"
 	"\r\nOptions:\r\n"
 	"\t-h --help          Show this screen\r\n"
 	"\t-d <b>:[d].[f]     Specify the device BDF\r\n"
 	"\t-c <cage>          Module ID to read from\r\n"
 	"\t-p <page>          Page number to read\r\n"
 	"\t-b <byte>          Specify the offset to read from\r\n"
+	"\t-I <path>          Batch file, one \"<cage> <page> <byte> [<len>]\" per line\r\n"
+	"\r\nAll entries in a batch file are read with a single request to the device.\r\n"
 ;
 
 struct app_cmd cmd_module_byte_rd = {
@@ -86,6 +109,86 @@ struct app_cmd cmd_module_byte_rd = {
 /* Function implementations                                                  */
 /*****************************************************************************/
 
+/*
+ * Read every entry listed in a batch file in one request.
+ */
+static int do_batch_read(ami_device *dev, const char *fname)
+{
+	int ret = EXIT_FAILURE;
+	FILE *fp = NULL;
+	char line[BATCH_LINE_MAX] = { 0 };
+	struct ami_module_sg_entry entries[AMI_MODULE_SG_MAX_ENTRIES] = { 0 };
+	uint8_t data[AMI_MODULE_SG_MAX_ENTRIES][UINT8_MAX] = { 0 };
+	uint16_t num_entries = 0;
+	int i = 0, j = 0;
+
+	if (!dev || !fname)
+		return EXIT_FAILURE;
+
+	if (!(fp = fopen(fname, "r"))) {
+		APP_ERROR("could not open batch file");
+		return EXIT_FAILURE;
+	}
+
+	while (fgets(line, sizeof(line), fp)) {
+		unsigned int cage = 0, page = 0, off = 0, len = 1;
+		int n = 0;
+
+		if ((line[0] == '#') || (strspn(line, " \t\r\n") == strlen(line)))
+			continue;
+
+		n = sscanf(line, "%i %i %i %i", &cage, &page, &off, &len);
+		if ((n < 3) || (cage > UINT8_MAX) || (page > UINT8_MAX) ||
+				(off > UINT8_MAX) || (len == 0) || (len > UINT8_MAX)) {
+			APP_ERROR("invalid batch file entry");
+			goto done;
+		}
+
+		if (num_entries == AMI_MODULE_SG_MAX_ENTRIES) {
+			APP_ERROR("too many batch file entries");
+			goto done;
+		}
+
+		entries[num_entries].device_id = (uint8_t)cage;
+		entries[num_entries].page = (uint8_t)page;
+		entries[num_entries].offset = (uint8_t)off;
+		entries[num_entries].num = (uint8_t)len;
+		entries[num_entries].val = data[num_entries];
+		num_entries++;
+	}
+
+	if (num_entries == 0) {
+		APP_ERROR("batch file is empty");
+		goto done;
+	}
+
+	if (ami_module_read_sg(dev, entries, num_entries) != AMI_STATUS_OK) {
+		APP_API_ERROR("could not read data");
+		goto done;
+	}
+
+	ret = EXIT_SUCCESS;
+	for (i = 0; i < num_entries; i++) {
+		printf(
+			"Cage %d page %d byte 0x%02x:",
+			entries[i].device_id, entries[i].page, entries[i].offset
+		);
+
+		if (entries[i].status == AMI_STATUS_OK) {
+			for (j = 0; j < entries[i].num; j++)
+				printf(" 0x%02x", entries[i].val[j]);
+			printf("\r\n");
+		} else {
+			printf(" read failed\r\n");
+			ret = EXIT_FAILURE;
+		}
+	}
+
+done:
+	fclose(fp);
+	return ret;
+}
+
 /*
  * "module_byte_rd" command callback.
  */
@@ -116,6 +219,24 @@ static int do_cmd_module_byte_rd(struct app_option *options, int num_args, char
 		return EXIT_FAILURE;
 	}
 
+	/* Batch mode */
+	if ((opt = find_app_option('I', options))) {
+		if (find_app_option('c', options) || find_app_option('p', options) ||
+				find_app_option('b', options)) {
+			APP_USER_ERROR("Cannot specify -I with -c, -p or -b", help_msg);
+			return EXIT_FAILURE;
+		}
+
+		if (ami_dev_find(device->arg, &dev) != AMI_STATUS_OK) {
+			APP_API_ERROR("could not find the requested device");
+			return EXIT_FAILURE;
+		}
+
+		ret = do_batch_read(dev, opt->arg);
+		ami_dev_delete(&dev);
+		return ret;
+	}
+
 	/* Cage */
 	if (!(opt = find_app_option('c', options))) {
 		APP_USER_ERROR("cage not specified", help_msg);
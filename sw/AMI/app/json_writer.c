@@ -0,0 +1,363 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * json_writer.c - This file contains a streaming JSON writer
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+/* External includes */
+#include "json.h"
+
+/* App includes */
+#include "json_writer.h"
+
+/*****************************************************************************/
+/* Local function definitions                                                */
+/*****************************************************************************/
+
+/**
+ * put_str() - Write a raw string to the output stream.
+ * @writer: JSON writer.
+ * @str: String to write.
+ *
+ * Return: None.
+ */
+static void put_str(struct json_writer *writer, const char *str)
+{
+	if (!writer->error && (fputs(str, writer->stream) == EOF))
+		writer->error = true;
+}
+
+/**
+ * put_indent() - Write the indentation for the given nesting level.
+ * @writer: JSON writer.
+ * @level: Nesting level.
+ *
+ * Return: None.
+ */
+static void put_indent(struct json_writer *writer, int level)
+{
+	int i = 0;
+
+	for (i = 0; i < level; i++)
+		put_str(writer, writer->space);
+}
+
+/**
+ * put_string() - Write a quoted and escaped string.
+ * @writer: JSON writer.
+ * @str: String to write.
+ *
+ * Printable ASCII without quotes or backslashes (which covers every key and
+ * value the app produces) is written as is. Anything else goes through
+ * `json_encode_string` so the escaping matches the tree serialiser exactly.
+ *
+ * Return: None.
+ */
+static void put_string(struct json_writer *writer, const char *str)
+{
+	const char *s = NULL;
+
+	for (s = str; *s; s++) {
+		unsigned char c = (unsigned char)*s;
+
+		if ((c < ' ') || (c > '~') || (c == '"') || (c == '\\'))
+			break;
+	}
+
+	if (*s == '\0') {
+		put_str(writer, "\"");
+		put_str(writer, str);
+		put_str(writer, "\"");
+	} else {
+		char *encoded = json_encode_string(str);
+
+		put_str(writer, encoded);
+		free(encoded);
+	}
+}
+
+/**
+ * begin_value() - Write whatever must precede the next value.
+ * @writer: JSON writer.
+ *
+ * Return: true if a value may be written here, false otherwise.
+ */
+static bool begin_value(struct json_writer *writer)
+{
+	int d = 0;
+
+	if (!writer || writer->error)
+		return false;
+
+	if (writer->depth == 0) {
+		/* Only one top-level value. */
+		if (writer->done) {
+			writer->error = true;
+			return false;
+		}
+
+		return true;
+	}
+
+	d = writer->depth - 1;
+
+	if (writer->is_object[d]) {
+		/* Object members must have a key - the separator went out with it. */
+		if (!writer->key_pending) {
+			writer->error = true;
+			return false;
+		}
+
+		writer->key_pending = false;
+		return true;
+	}
+
+	/* Array element */
+	if (writer->space) {
+		put_str(writer, (writer->n_children[d] == 0) ? ("\n") : (",\n"));
+		put_indent(writer, writer->depth);
+	} else if (writer->n_children[d] != 0) {
+		put_str(writer, ",");
+	}
+
+	writer->n_children[d]++;
+	return true;
+}
+
+/**
+ * end_value() - Account a completed value.
+ * @writer: JSON writer.
+ *
+ * Return: None.
+ */
+static void end_value(struct json_writer *writer)
+{
+	if (writer->depth == 0)
+		writer->done = true;
+}
+
+/**
+ * begin_container() - Open an object or array.
+ * @writer: JSON writer.
+ * @is_object: Open an object (or an array).
+ *
+ * Return: None.
+ */
+static void begin_container(struct json_writer *writer, bool is_object)
+{
+	if (!begin_value(writer))
+		return;
+
+	if (writer->depth >= JSONW_MAX_DEPTH) {
+		writer->error = true;
+		return;
+	}
+
+	put_str(writer, (is_object) ? ("{") : ("["));
+
+	writer->is_object[writer->depth] = is_object;
+	writer->n_children[writer->depth] = 0;
+	writer->depth++;
+}
+
+/**
+ * end_container() - Close the innermost object or array.
+ * @writer: JSON writer.
+ * @is_object: Expect an object (or an array).
+ *
+ * Return: None.
+ */
+static void end_container(struct json_writer *writer, bool is_object)
+{
+	int d = 0;
+
+	if (!writer || writer->error)
+		return;
+
+	d = writer->depth - 1;
+
+	if ((d < 0) || (writer->is_object[d] != is_object) || writer->key_pending) {
+		writer->error = true;
+		return;
+	}
+
+	/* Empty containers stay on one line. */
+	if (writer->space && (writer->n_children[d] != 0)) {
+		put_str(writer, "\n");
+		put_indent(writer, d);
+	}
+
+	put_str(writer, (is_object) ? ("}") : ("]"));
+
+	writer->depth--;
+	end_value(writer);
+}
+
+/*****************************************************************************/
+/* Public function definitions                                               */
+/*****************************************************************************/
+
+/*
+ * Start a new JSON document.
+ */
+int jsonw_init(struct json_writer *writer, FILE *stream, const char *space)
+{
+	if (!writer || !stream)
+		return EXIT_FAILURE;
+
+	memset(writer, 0, sizeof(*writer));
+	writer->stream = stream;
+	writer->space = space;
+
+	return EXIT_SUCCESS;
+}
+
+/*
+ * Open an object.
+ */
+void jsonw_begin_object(struct json_writer *writer)
+{
+	begin_container(writer, true);
+}
+
+/*
+ * Close the innermost object.
+ */
+void jsonw_end_object(struct json_writer *writer)
+{
+	end_container(writer, true);
+}
+
+/*
+ * Open an array.
+ */
+void jsonw_begin_array(struct json_writer *writer)
+{
+	begin_container(writer, false);
+}
+
+/*
+ * Close the innermost array.
+ */
+void jsonw_end_array(struct json_writer *writer)
+{
+	end_container(writer, false);
+}
+
+/*
+ * Write the key of the next object member.
+ */
+void jsonw_key(struct json_writer *writer, const char *key)
+{
+	int d = 0;
+
+	if (!writer || writer->error)
+		return;
+
+	d = writer->depth - 1;
+
+	if (!key || (d < 0) || !writer->is_object[d] || writer->key_pending) {
+		writer->error = true;
+		return;
+	}
+
+	if (writer->space) {
+		put_str(writer, (writer->n_children[d] == 0) ? ("\n") : (",\n"));
+		put_indent(writer, writer->depth);
+	} else if (writer->n_children[d] != 0) {
+		put_str(writer, ",");
+	}
+
+	put_string(writer, key);
+	put_str(writer, (writer->space) ? (": ") : (":"));
+
+	writer->n_children[d]++;
+	writer->key_pending = true;
+}
+
+/*
+ * Write a string value.
+ */
+void jsonw_string(struct json_writer *writer, const char *str)
+{
+	if (!str) {
+		if (writer)
+			writer->error = true;
+		return;
+	}
+
+	if (!begin_value(writer))
+		return;
+
+	put_string(writer, str);
+	end_value(writer);
+}
+
+/*
+ * Write a number value.
+ */
+void jsonw_number(struct json_writer *writer, double num)
+{
+	if (!begin_value(writer))
+		return;
+
+	/* Same format as the tree serialiser. */
+	if (isfinite(num)) {
+		if (!writer->error && (fprintf(writer->stream, "%.16g", num) < 0))
+			writer->error = true;
+	} else {
+		put_str(writer, "null");
+	}
+
+	end_value(writer);
+}
+
+/*
+ * Write a boolean value.
+ */
+void jsonw_bool(struct json_writer *writer, bool b)
+{
+	if (!begin_value(writer))
+		return;
+
+	put_str(writer, (b) ? ("true") : ("false"));
+	end_value(writer);
+}
+
+/*
+ * Write a null value.
+ */
+void jsonw_null(struct json_writer *writer)
+{
+	if (!begin_value(writer))
+		return;
+
+	put_str(writer, "null");
+	end_value(writer);
+}
+
+/*
+ * Check that a document is complete.
+ */
+int jsonw_finish(struct json_writer *writer)
+{
+	if (!writer || writer->error || !writer->done)
+		return EXIT_FAILURE;
+
+	if (ferror(writer->stream))
+		return EXIT_FAILURE;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * json_writer.h - This file contains a streaming JSON writer
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+#ifndef AMI_APP_JSON_WRITER_H
+#define AMI_APP_JSON_WRITER_H
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdbool.h>
+#include <stdio.h>
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+/* Maximum nesting of objects and arrays. */
+#define JSONW_MAX_DEPTH		(16)
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * struct json_writer - State of a streaming JSON document.
+ * @stream: Output stream.
+ * @space: Indentation string, or NULL for compact output.
+ * @depth: Number of open objects/arrays.
+ * @is_object: Whether each open container is an object (or an array).
+ * @n_children: Number of values written to each open container so far.
+ * @key_pending: A key has been written and is waiting for its value.
+ * @done: The top-level value is complete.
+ * @error: A write failed or the API was misused - sticky.
+ *
+ * Do not access the fields directly, use the `jsonw_*` functions.
+ */
+struct json_writer {
+	FILE       *stream;
+	const char *space;
+	int         depth;
+	bool        is_object[JSONW_MAX_DEPTH];
+	int         n_children[JSONW_MAX_DEPTH];
+	bool        key_pending;
+	bool        done;
+	bool        error;
+};
+
+/*****************************************************************************/
+/* Public function declarations                                              */
+/*****************************************************************************/
+
+/**
+ * jsonw_init() - Start a new JSON document.
+ * @writer: Writer to initialise.
+ * @stream: Output stream.
+ * @space: Indentation string, or NULL for compact output.
+ *
+ * Values are written to `stream` as soon as they are passed in, so memory use
+ * does not depend on the size of the document. The output is identical to
+ * `json_stringify` (or `json_encode` if `space` is NULL) on the equivalent
+ * tree of `JsonNode` objects.
+ *
+ * The `jsonw_*` functions below do not return a status; the first failure is
+ * recorded and reported by `jsonw_finish`. Nothing is written after a failure.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE.
+ */
+int jsonw_init(struct json_writer *writer, FILE *stream, const char *space);
+
+/**
+ * jsonw_begin_object() - Open an object.
+ * @writer: JSON writer.
+ *
+ * Return: None.
+ */
+void jsonw_begin_object(struct json_writer *writer);
+
+/**
+ * jsonw_end_object() - Close the innermost object.
+ * @writer: JSON writer.
+ *
+ * Return: None.
+ */
+void jsonw_end_object(struct json_writer *writer);
+
+/**
+ * jsonw_begin_array() - Open an array.
+ * @writer: JSON writer.
+ *
+ * Return: None.
+ */
+void jsonw_begin_array(struct json_writer *writer);
+
+/**
+ * jsonw_end_array() - Close the innermost array.
+ * @writer: JSON writer.
+ *
+ * Return: None.
+ */
+void jsonw_end_array(struct json_writer *writer);
+
+/**
+ * jsonw_key() - Write the key of the next object member.
+ * @writer: JSON writer.
+ * @key: Member name (must be valid UTF-8).
+ *
+ * Must be followed by exactly one value (or object/array).
+ *
+ * Return: None.
+ */
+void jsonw_key(struct json_writer *writer, const char *key);
+
+/**
+ * jsonw_string() - Write a string value.
+ * @writer: JSON writer.
+ * @str: String (must be valid UTF-8).
+ *
+ * Return: None.
+ */
+void jsonw_string(struct json_writer *writer, const char *str);
+
+/**
+ * jsonw_number() - Write a number value.
+ * @writer: JSON writer.
+ * @num: Number - written as null if not finite.
+ *
+ * Return: None.
+ */
+void jsonw_number(struct json_writer *writer, double num);
+
+/**
+ * jsonw_bool() - Write a boolean value.
+ * @writer: JSON writer.
+ * @b: Value.
+ *
+ * Return: None.
+ */
+void jsonw_bool(struct json_writer *writer, bool b);
+
+/**
+ * jsonw_null() - Write a null value.
+ * @writer: JSON writer.
+ *
+ * Return: None.
+ */
+void jsonw_null(struct json_writer *writer);
+
+/**
+ * jsonw_finish() - Check that a document is complete.
+ * @writer: JSON writer.
+ *
+ * The stream is not flushed or closed.
+ *
+ * Return: EXIT_SUCCESS if a complete document was written without errors,
+ *   otherwise EXIT_FAILURE.
+ */
+int jsonw_finish(struct json_writer *writer);
+
+#endif  /* AMI_APP_JSON_WRITER_H */
@@ -26,6 +26,7 @@
 
 /* App includes */
 #include "meta.h"
+#include "json_writer.h"
 #include "printer.h"
 #include "apputils.h"
 
@@ -389,6 +390,8 @@ static int populate_version_header(ami_device *dev, char **header,
  * @fmt: Format of data structure. Used to determine type of `values`.
  * @data: Implementation data. Not used.
  * 
+ * For JSON, `values` is a `struct json_writer`.
+ * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE.
  */
 static int populate_version_values(ami_device *dev, void *values,
@@ -465,30 +468,43 @@ static int populate_version_values(ami_device *dev, void *values,
 
 	case APP_OUT_FORMAT_JSON:
 	{
-		JsonNode *parent = (JsonNode*)values;
-		JsonNode *api_ver = json_mkobject();
-		JsonNode *drv_ver = json_mkobject();
-
-		/* Construct API version */
-		json_append_member(api_ver, "major", json_mknumber(GIT_TAG_VER_MAJOR));
-		json_append_member(api_ver, "minor", json_mknumber(GIT_TAG_VER_MINOR));
-		json_append_member(api_ver, "patch", json_mknumber(GIT_TAG_VER_PATCH));
-		json_append_member(api_ver, "commits", json_mknumber(GIT_TAG_VER_DEV_COMMITS));
-		json_append_member(api_ver, "status", json_mknumber(GIT_STATUS));
-		json_append_member(api_ver, "branch", json_mkstring(GIT_BRANCH));
-		json_append_member(api_ver, "hash", json_mkstring(GIT_HASH));
-		json_append_member(api_ver, "date", json_mkstring(GIT_DATE));
-
-		/* Construct driver version*/
-		json_append_member(drv_ver, "major", json_mknumber(driver_ver.major));
-		json_append_member(drv_ver, "minor", json_mknumber(driver_ver.minor));
-		json_append_member(drv_ver, "patch", json_mknumber(driver_ver.patch));
-		json_append_member(drv_ver, "commits", json_mknumber(driver_ver.dev_commits));
-		json_append_member(drv_ver, "status", json_mknumber(driver_ver.status));
-		
-		/* Add to parent */
-		json_append_member(parent, "api", api_ver);
-		json_append_member(parent, "driver", drv_ver);
+		struct json_writer *writer = (struct json_writer*)values;
+
+		/* API version */
+		jsonw_key(writer, "api");
+		jsonw_begin_object(writer);
+		jsonw_key(writer, "major");
+		jsonw_number(writer, GIT_TAG_VER_MAJOR);
+		jsonw_key(writer, "minor");
+		jsonw_number(writer, GIT_TAG_VER_MINOR);
+		jsonw_key(writer, "patch");
+		jsonw_number(writer, GIT_TAG_VER_PATCH);
+		jsonw_key(writer, "commits");
+		jsonw_number(writer, GIT_TAG_VER_DEV_COMMITS);
+		jsonw_key(writer, "status");
+		jsonw_number(writer, GIT_STATUS);
+		jsonw_key(writer, "branch");
+		jsonw_string(writer, GIT_BRANCH);
+		jsonw_key(writer, "hash");
+		jsonw_string(writer, GIT_HASH);
+		jsonw_key(writer, "date");
+		jsonw_string(writer, GIT_DATE);
+		jsonw_end_object(writer);
+
+		/* Driver version */
+		jsonw_key(writer, "driver");
+		jsonw_begin_object(writer);
+		jsonw_key(writer, "major");
+		jsonw_number(writer, driver_ver.major);
+		jsonw_key(writer, "minor");
+		jsonw_number(writer, driver_ver.minor);
+		jsonw_key(writer, "patch");
+		jsonw_number(writer, driver_ver.patch);
+		jsonw_key(writer, "commits");
+		jsonw_number(writer, driver_ver.dev_commits);
+		jsonw_key(writer, "status");
+		jsonw_number(writer, driver_ver.status);
+		jsonw_end_object(writer);
 
 		break;
 	}
@@ -776,30 +792,31 @@ static int populate_overview_header(ami_device *dev, char **header,
 }
 
 /**
- * construct_overview_node() - Construct a single Json node with device information
+ * construct_overview_node() - Write a single Json node with device information
  * @dev: Device handle.
- * @parent: Parent JSON object.
+ * @writer: JSON writer, inside the parent object.
  * @n_fields: Number of expected elements in the JSON node.
  * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE
  */
-static int construct_overview_node(ami_device *dev, JsonNode *parent, int n_fields)
+static int construct_overview_node(ami_device *dev, struct json_writer *writer, int n_fields)
 {
 	int col = 0;
 	uint16_t bdf = 0;
 	char bdf_string[AMI_BDF_STR_LEN] = { 0 };
-	JsonNode *row = NULL;
-	JsonNode *uuid_node = NULL;
-	JsonNode *hwmon_node = NULL;
-	JsonNode *cdev_node = NULL;
-	JsonNode *state_node = NULL;
-	JsonNode *name_node = NULL;
-	JsonNode *amc_node = NULL;
-
-	if (!dev || !parent)
+
+	if (!dev || !writer)
 		return EXIT_FAILURE;
 	
-	row = json_mkobject();
+	ami_dev_get_pci_bdf(dev, &bdf);
+	sprintf(
+		bdf_string,
+		"%02x:%02x.%01x",
+		AMI_PCI_BUS(bdf), AMI_PCI_DEV(bdf), AMI_PCI_FUNC(bdf)
+	);
+
+	jsonw_key(writer, bdf_string);
+	jsonw_begin_object(writer);
 
 	for (col = 0; (col < n_fields) && (col < NUM_OVERVIEW_COLS_V); col++) {
 		switch (col) {
@@ -807,12 +824,13 @@ static int construct_overview_node(ami_device *dev, JsonNode *parent, int n_fiel
 		{
 			char uuid[AMI_LOGIC_UUID_SIZE] = { 0 };
 
+			jsonw_key(writer, "uuid");
+
 			if (ami_dev_read_uuid(dev, uuid) == AMI_STATUS_OK)
-				uuid_node = json_mkstring(uuid);
+				jsonw_string(writer, uuid);
 			else
-				uuid_node = json_mknull();
+				jsonw_null(writer);
 			
-			json_append_member(row, "uuid", uuid_node);
 			break;
 		}
 
@@ -820,12 +838,13 @@ static int construct_overview_node(ami_device *dev, JsonNode *parent, int n_fiel
 		{
 			int hwmon = 0;
 
+			jsonw_key(writer, "hwmon");
+
 			if (ami_dev_get_hwmon_num(dev, &hwmon) == AMI_STATUS_OK)
-				hwmon_node = json_mknumber(hwmon);
+				jsonw_number(writer, hwmon);
 			else
-				hwmon_node = json_mknull();
+				jsonw_null(writer);
 			
-			json_append_member(row, "hwmon", hwmon_node);
 			break;
 		}
 
@@ -833,12 +852,13 @@ static int construct_overview_node(ami_device *dev, JsonNode *parent, int n_fiel
 		{
 			int cdev = 0;
 
+			jsonw_key(writer, "cdev");
+
 			if (ami_dev_get_cdev_num(dev, &cdev) == AMI_STATUS_OK)
-				cdev_node = json_mknumber(cdev);
+				jsonw_number(writer, cdev);
 			else
-				cdev_node = json_mknull();
+				jsonw_null(writer);
 			
-			json_append_member(row, "cdev", cdev_node);
 			break;
 		}
 
@@ -846,12 +866,13 @@ static int construct_overview_node(ami_device *dev, JsonNode *parent, int n_fiel
 		{
 			char state[AMI_DEV_STATE_SIZE] = { 0 };
 
+			jsonw_key(writer, "state");
+
 			if (ami_dev_get_state(dev, state) == AMI_STATUS_OK)
-				state_node = json_mkstring(state);
+				jsonw_string(writer, state);
 			else
-				state_node = json_mknull();
+				jsonw_null(writer);
 			
-			json_append_member(row, "state", state_node);
 			break;
 		}
 
@@ -859,12 +880,13 @@ static int construct_overview_node(ami_device *dev, JsonNode *parent, int n_fiel
 		{
 			char name[AMI_DEV_NAME_SIZE] = { 0 };
 
+			jsonw_key(writer, "name");
+
 			if (ami_dev_get_name(dev, name) == AMI_STATUS_OK)
-				name_node = json_mkstring(name);
+				jsonw_string(writer, name);
 			else
-				name_node = json_mknull();
+				jsonw_null(writer);
 			
-			json_append_member(row, "name", name_node);
 			break;
 		}
 	
@@ -872,18 +894,25 @@ static int construct_overview_node(ami_device *dev, JsonNode *parent, int n_fiel
 		{
 			struct amc_version ver = { 0 };
 
+			jsonw_key(writer, "amc");
+
 			if (ami_dev_get_amc_version(dev, &ver) == AMI_STATUS_OK) {
-				amc_node = json_mkobject();
-				json_append_member(amc_node, "major", json_mknumber(ver.major));
-				json_append_member(amc_node, "minor", json_mknumber(ver.minor));
-				json_append_member(amc_node, "patch", json_mknumber(ver.patch));
-				json_append_member(amc_node, "commits", json_mknumber(ver.dev_commits));
-				json_append_member(amc_node, "local_changes", json_mknumber(ver.local_changes));
+				jsonw_begin_object(writer);
+				jsonw_key(writer, "major");
+				jsonw_number(writer, ver.major);
+				jsonw_key(writer, "minor");
+				jsonw_number(writer, ver.minor);
+				jsonw_key(writer, "patch");
+				jsonw_number(writer, ver.patch);
+				jsonw_key(writer, "commits");
+				jsonw_number(writer, ver.dev_commits);
+				jsonw_key(writer, "local_changes");
+				jsonw_number(writer, ver.local_changes);
+				jsonw_end_object(writer);
 			} else {
-				amc_node = json_mknull();
+				jsonw_null(writer);
 			}
 			
-			json_append_member(row, "amc", amc_node);
 			break;
 		}
 
@@ -892,14 +921,7 @@ static int construct_overview_node(ami_device *dev, JsonNode *parent, int n_fiel
 		}
 	}
 
-	ami_dev_get_pci_bdf(dev, &bdf);
-	sprintf(
-		bdf_string,
-		"%02x:%02x.%01x",
-		AMI_PCI_BUS(bdf), AMI_PCI_DEV(bdf), AMI_PCI_FUNC(bdf)
-	);
-	json_append_member(parent, bdf_string, row);
-
+	jsonw_end_object(writer);
 	return EXIT_SUCCESS;
 }
 
@@ -1040,6 +1062,9 @@ static int construct_overview_row(ami_device *dev, char **row, int n_fields)
  * @fmt: Format of data structure. Used to determine type of `values`.
  * @data: Implementation data. Not used.
  * 
+ * For JSON, `values` is a `struct json_writer` and each device is written
+ * as soon as it has been read.
+ * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE.
  */
 static int populate_overview_values(ami_device *dev, void *values,
@@ -1069,9 +1094,10 @@ static int populate_overview_values(ami_device *dev, void *values,
 		case APP_OUT_FORMAT_JSON:
 			construct_overview_node(
 				device,
-				(JsonNode*)values,
+				(struct json_writer*)values,
 				*n_fields
 			);
+			break;
 
 		default:
 			break;
@@ -1752,40 +1778,37 @@ int print_overview(struct app_option *options)
 		switch (format) {
 		case APP_OUT_FORMAT_JSON:
 		{
-			JsonNode *v = NULL;
-			JsonNode *o = NULL;	
+			struct json_writer writer = { 0 };
 
-			ret = gen_json_data(
-				NULL,
-				NUM_VERSION_COLS,
-				NUM_VERSION_ROWS,
-				&populate_version_values,
-				NULL,
-				&v
-			);
+			ret = print_json_begin(&writer, stream);
 
 			if (ret == EXIT_SUCCESS) {
-				ret = gen_json_data(
+				jsonw_key(&writer, "version");
+				ret = write_json_data(
+					NULL,
+					NUM_VERSION_COLS,
+					NUM_VERSION_ROWS,
+					&writer,
+					&populate_version_values,
+					NULL
+				);
+			}
+
+			if (ret == EXIT_SUCCESS) {
+				jsonw_key(&writer, "physical_functions");
+				ret = write_json_data(
 					NULL,
 					((verbose) ? (NUM_OVERVIEW_COLS_V) : (NUM_OVERVIEW_COLS)),
 					num_devices,
+					&writer,
 					&populate_overview_values,
-					NULL,
-					&o
+					NULL
 				);
 			
-				if (ret == EXIT_SUCCESS) {
-					JsonNode *parent = NULL;
-
-					parent = json_mkobject();
-					json_append_member(parent, "version", v);
-					json_append_member(parent, "physical_functions", o);
-
-					print_json_obj(parent, stream);
-					json_delete(parent);
-				} else {
+				if (ret == EXIT_SUCCESS)
+					ret = print_json_end(&writer);
+				else
 					APP_ERROR("could not create overview json");
-				}
 			} else {
 				APP_ERROR("could not create version json");
 			}
@@ -18,6 +18,8 @@
 
 /* App includes */
 #include "json.h"
+#include "json_writer.h"
+#include "arena.h"
 #include "table.h"
 #include "printer.h"
 
@@ -66,6 +68,20 @@ void my_putc(const char c, FILE *stream)
 	}
 }
 
+/*
+ * Write a buffer to stdout and to a secondary stream.
+ */
+void my_write(FILE *stream, const char *buf, size_t len)
+{
+	/* Write to stdout. */
+	fwrite(buf, 1, len, stdout);
+
+	/* Write to output stream. */
+	if (stream && (stream != stdout)) {
+		fwrite(buf, 1, len, stream);
+	}
+}
+
 /*
  * Print a divider.
  */
@@ -132,78 +148,80 @@ int print_table_data(ami_device *dev, int n_fields, int n_rows, FILE *stream,
 {
 	int i = 0, j = 0;
 	int ret = EXIT_SUCCESS;
+	struct arena arena = { 0 };
 	char **header = NULL;
+	char *header_cells = NULL;
 	char ***rows = NULL;
+	char **row_cols = NULL;
+	char *cells = NULL;
+	size_t n_cells = 0;
 	int n_fields_table = n_fields;
 	int n_rows_table = n_rows;
 
 
 	/* Note that `dev`, `stream`, and `data` may be NULL */
 
-	/* Construct table header. */
-	header = (char**)calloc(n_fields, sizeof(char*));
-
-	if (!header)
+	if ((n_fields < 0) || (n_rows < 0))
 		return EXIT_FAILURE;
 
-	for (i = 0; i < n_fields; i++) {
-		header[i] = (char*)calloc(TABLE_HEADING_MAX, sizeof(char));
-
-		if (!header[i]) {
-			ret = EXIT_FAILURE;
-			goto delete_header;
-		}
-	}
-
 	/*
-	 * Insert data into header.
-	 * The rows must be populated in the same order.
+	 * All of the table lives in one arena, sized so that it is backed by a
+	 * single allocation instead of one per cell.
 	 */
-	ret = populate_header(dev, header, n_fields, data);
+	n_cells = (size_t)n_rows * n_fields;
+	arena_init(
+		&arena,
+		ARENA_ALIGN_SIZE(n_fields * sizeof(char*)) +
+		ARENA_ALIGN_SIZE(n_fields * TABLE_HEADING_MAX) +
+		ARENA_ALIGN_SIZE(n_rows * sizeof(char**)) +
+		ARENA_ALIGN_SIZE(n_cells * sizeof(char*)) +
+		ARENA_ALIGN_SIZE(n_cells * TABLE_FIELD_MAX)
+	);
 
-	if (ret != EXIT_SUCCESS)
-		goto delete_header;
+	/* Construct table header. */
+	header = (char**)arena_alloc(&arena, n_fields * sizeof(char*));
+	header_cells = (char*)arena_alloc(&arena, n_fields * TABLE_HEADING_MAX);
 
-	/* Construct rows. */
-	/* Array of pointers to each row. */
-	rows = (char***)calloc(n_rows, sizeof(char**));
+	/* Construct rows - array of pointers to each row and each column. */
+	rows = (char***)arena_alloc(&arena, n_rows * sizeof(char**));
+	row_cols = (char**)arena_alloc(&arena, n_cells * sizeof(char*));
+	cells = (char*)arena_alloc(&arena, n_cells * TABLE_FIELD_MAX);
 
-	if (!rows) {
+	if (!header || !header_cells || !rows || !row_cols || !cells) {
 		ret = EXIT_FAILURE;
-		goto delete_header;
+		goto delete_table;
 	}
-	
-	/* Row of pointers to each column. */
-	for (i = 0; i < n_rows; i++) {
-		rows[i] = (char**)calloc(n_fields, sizeof(char*));
 
-		if (!rows[i]) {
-			ret = EXIT_FAILURE;
-			goto delete_rows;
-		}
+	for (i = 0; i < n_fields; i++)
+		header[i] = &header_cells[i * TABLE_HEADING_MAX];
 
-		for (j = 0; j < n_fields; j++) {
-			/* Column. */
-			rows[i][j] = (char*)calloc(1, TABLE_FIELD_MAX * sizeof(char));
+	for (i = 0; i < n_rows; i++) {
+		rows[i] = &row_cols[(size_t)i * n_fields];
 
-			if (!rows[i][j]) {
-				ret = EXIT_FAILURE;
-				goto delete_rows;
-			}
-		}
+		for (j = 0; j < n_fields; j++)
+			rows[i][j] = &cells[(((size_t)i * n_fields) + j) * TABLE_FIELD_MAX];
 	}
 
+	/*
+	 * Insert data into header.
+	 * The rows must be populated in the same order.
+	 */
+	ret = populate_header(dev, header, n_fields, data);
+
+	if (ret != EXIT_SUCCESS)
+		goto delete_table;
+
 	ret = populate_values(dev, rows, &n_rows_table, &n_fields_table, APP_OUT_FORMAT_TABLE, data);
 
 	/* Ensure new values are not bigger than the original */
 	if ((n_rows < n_rows_table) || (n_fields < n_fields_table)) {
 		ret = EXIT_FAILURE;
-		goto delete_rows;
+		goto delete_table;
 	}
 
 	/* Output table. */
 	if (ret == EXIT_SUCCESS) {
-		print_table(
+		ret = print_table(
 			header,
 			rows,
 			n_fields_table,
@@ -214,33 +232,8 @@ int print_table_data(ami_device *dev, int n_fields, int n_rows, FILE *stream,
 		);
 	}
 
-delete_rows:
-	if (rows) {
-		for (i = 0; i < n_rows; i++) {
-			if (!rows[i])
-				continue;
-
-			for (j = 0; j < 3; j++) {
-				if (rows[i][j])
-					free(rows[i][j]);
-			}
-
-			free(rows[i]);
-		}
-
-		free(rows);
-	}
-
-delete_header:
-	if (header) {
-		for (i = 0; i < n_fields; i++) {
-			if (header[i])
-				free(header[i]);
-		}
-
-		free(header);
-	}
-	
+delete_table:
+	arena_destroy(&arena);
 	return ret;
 }
 
@@ -319,6 +312,85 @@ int print_json_data(ami_device *dev, int n_fields, int n_rows, FILE *stream,
 	return ret;
 }
 
+/*
+ * Stream a JSON data object.
+ */
+int write_json_data(ami_device *dev, int n_fields, int n_rows,
+	struct json_writer *writer, app_value_builder populate_values, void *data)
+{
+	int ret = EXIT_FAILURE;
+
+	if (!writer)
+		return EXIT_FAILURE;
+
+	/* Note that `dev`, and `data` may be NULL */
+
+	jsonw_begin_object(writer);
+	ret = populate_values(dev, writer, &n_rows, &n_fields,
+		APP_OUT_FORMAT_JSON, data);
+	jsonw_end_object(writer);
+
+	return ret;
+}
+
+/*
+ * Start streaming a JSON document.
+ */
+int print_json_begin(struct json_writer *writer, FILE *stream)
+{
+	if (!writer || !stream)
+		return EXIT_FAILURE;
+
+	if (jsonw_init(writer, stream, "\t") != EXIT_SUCCESS)
+		return EXIT_FAILURE;
+
+	/* Same framing as `print_json_obj`. */
+	fprintf(stream, "\r\n");
+	jsonw_begin_object(writer);
+
+	return EXIT_SUCCESS;
+}
+
+/*
+ * Finish streaming a JSON document.
+ */
+int print_json_end(struct json_writer *writer)
+{
+	if (!writer)
+		return EXIT_FAILURE;
+
+	jsonw_end_object(writer);
+
+	if (jsonw_finish(writer) != EXIT_SUCCESS)
+		return EXIT_FAILURE;
+
+	fprintf(writer->stream, "\r\n");
+	return EXIT_SUCCESS;
+}
+
+/*
+ * Stream data in JSON format.
+ */
+int print_json_stream_data(ami_device *dev, int n_fields, int n_rows, FILE *stream,
+	app_value_builder populate_values, void *data)
+{
+	int ret = EXIT_FAILURE;
+	struct json_writer writer = { 0 };
+
+	/* Note that `dev`, and `data` may be NULL */
+
+	if (print_json_begin(&writer, stream) != EXIT_SUCCESS)
+		return EXIT_FAILURE;
+
+	ret = populate_values(dev, &writer, &n_rows, &n_fields,
+		APP_OUT_FORMAT_JSON, data);
+
+	if (print_json_end(&writer) != EXIT_SUCCESS)
+		ret = EXIT_FAILURE;
+
+	return ret;
+}
+
 /*
  * Print a progress bar.
  */
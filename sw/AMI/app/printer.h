@@ -21,6 +21,9 @@
 /* External Includes */
 #include "json.h"
 
+/* App Includes */
+#include "json_writer.h"
+
 /* API Includes */
 #include "ami_device.h"
 #include "table.h"
@@ -114,6 +117,19 @@ void my_fprintf(FILE *stream, const char *format, ...);
  */
 void my_putc(const char c, FILE *stream);
 
+/**
+ * my_write() - Wrapper around `fwrite` which will print to stdout and
+ *              write to the given file if not NULL.
+ * @stream: Output stream (should not be stdout).
+ * @buf: Data to write.
+ * @len: Number of bytes in `buf`.
+ *
+ * Same as `my_fprintf` for output which has already been formatted.
+ * 
+ * Return: None.
+ */
+void my_write(FILE *stream, const char *buf, size_t len);
+
 /**
  * print_divider() - Utility function to print a divider of variable length.
  * @c: Character to use.
@@ -178,6 +194,64 @@ int print_json_obj(JsonNode *obj, FILE *stream);
 int print_json_data(ami_device *dev, int n_fields, int n_rows, FILE *stream,
 	app_value_builder populate_values, void *data);
 
+/**
+ * write_json_data() - Stream arbitrary data as a JSON object.
+ * @dev: Device handle (optional).
+ * @n_fields: Number of fields in each row (object).
+ * @n_rows: Number of rows (objects).
+ * @writer: JSON writer.
+ * @populate_values: Implementation specific function to write JSON values.
+ * @data: Implementation specific data (optional).
+ *
+ * Streaming counterpart of `gen_json_data`. The object is written as the
+ * next value of `writer`, so inside an object the caller must write its key
+ * first. `populate_values` is passed the `struct json_writer` instead of a
+ * `JsonNode` and must write the members of the object.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE.
+ */
+int write_json_data(ami_device *dev, int n_fields, int n_rows,
+	struct json_writer *writer, app_value_builder populate_values, void *data);
+
+/**
+ * print_json_begin() - Start streaming a JSON document.
+ * @writer: JSON writer to initialise.
+ * @stream: Output stream.
+ *
+ * Opens the top level object. The output is framed and indented exactly as
+ * by `print_json_obj`.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE.
+ */
+int print_json_begin(struct json_writer *writer, FILE *stream);
+
+/**
+ * print_json_end() - Finish streaming a JSON document.
+ * @writer: JSON writer.
+ *
+ * Closes the top level object opened by `print_json_begin`.
+ *
+ * Return: EXIT_SUCCESS, or EXIT_FAILURE if the document is incomplete or
+ *   could not be written.
+ */
+int print_json_end(struct json_writer *writer);
+
+/**
+ * print_json_stream_data() - Stream arbitrary data as a JSON string.
+ * @dev: Device handle (optional).
+ * @n_fields: Number of fields in each row (object).
+ * @n_rows: Number of rows (objects).
+ * @stream: Output stream.
+ * @populate_values: Implementation specific function to write JSON values.
+ * @data: Implementation specific data (optional).
+ *
+ * Streaming counterpart of `print_json_data` - see `write_json_data`.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE.
+ */
+int print_json_stream_data(ami_device *dev, int n_fields, int n_rows, FILE *stream,
+	app_value_builder populate_values, void *data);
+
 /**
  * print_table_data() - Format arbitrary data into a table.
  * @dev: Device handle..
@@ -22,7 +22,7 @@
 #include "ami_device.h"
 
 /* App includes */
-#include "json.h"
+#include "json_writer.h"
 #include "printer.h"
 #include "sensors.h"
 #include "apputils.h"
@@ -612,155 +612,133 @@ static int construct_sensor_table(ami_device *dev, char ***rows,
 }
 
 /**
- * mk_sensor_node() - Construct a single Json node for a sensor.
+ * mk_sensor_number() - Write a sensor attribute which may be unavailable.
+ * @writer: JSON writer.
+ * @key: Attribute name.
+ * @value: Attribute value.
+ * @r: Return status of the call that fetched `value`.
+ *
+ * Return: None.
+ */
+static void mk_sensor_number(struct json_writer *writer, const char *key,
+	double value, int r)
+{
+	jsonw_key(writer, key);
+
+	if (r == AMI_STATUS_OK)
+		jsonw_number(writer, value);
+	else
+		jsonw_null(writer);
+}
+
+/**
+ * mk_sensor_node() - Write a single Json node for a sensor.
  * @dev: Device handle.
  * @sensor: Sensor name.
  * @sensor_type: Sensor type (relevant bits MUST be extracted).
  * @extra_fields: Extra fields bitflag.
- * @parent: Parent node.
+ * @writer: JSON writer, inside the sensor group object.
  * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE.
  */
 static int mk_sensor_node(ami_device *dev, const char *sensor,
-	int sensor_type, int extra_fields, JsonNode *parent)
+	int sensor_type, int extra_fields, struct json_writer *writer)
 {
-	int ret = EXIT_SUCCESS;
 	struct sensor_values values = { 0 };
-	
-	JsonNode *row = NULL;  /* sensor object belonging to the group */
-	/* Object attributes */
-	JsonNode *unit_node = NULL;
-	JsonNode *value_node = NULL;
-	JsonNode *status_node = NULL;
-	JsonNode *max_node = NULL;
-	JsonNode *avg_node = NULL;
-	JsonNode *limits_node = NULL;
-
-	if (!dev || !sensor || !parent)
-		return EXIT_FAILURE;
-	
-	get_all_sensor_values(
-		dev, sensor, sensor_type, extra_fields, &values, false
-	);
-	
-	row = json_mkobject();
+	const char *key = NULL;
 
-	/* All objects have value, status, and unit. */
-	value_node = json_mknumber(values.value);
-	unit_node = json_mknumber(values.mod);
-	status_node = json_mknumber(values.status);
-
-	json_append_member(row, "unit_mod", unit_node);
-	json_append_member(row, "value", value_node);
-	json_append_member(row, "status", status_node);
-	
-	/* Extra attributes. */
-	if (extra_fields & EXTRA_FIELDS_MAX) {
-		if (values.max_r == AMI_STATUS_OK)
-			max_node = json_mknumber(values.max);
-		else
-			max_node = json_mknull();
-		
-		json_append_member(row, "max", max_node);
-	}
+	if (!dev || !sensor || !writer)
+		return EXIT_FAILURE;
 	
-	if (extra_fields & EXTRA_FIELDS_AVG) {
-		if (values.avg_r == AMI_STATUS_OK)
-			avg_node = json_mknumber(values.avg);
-		else
-			avg_node = json_mknull();
-		
-		json_append_member(row, "average", avg_node);
-	}
-
-	if (extra_fields & EXTRA_FIELDS_LIMITS) {
-		JsonNode *limit_w = NULL;
-		JsonNode *limit_c = NULL;
-		JsonNode *limit_f = NULL;
-
-		/* Warning */
-		if (values.limit_w_r == AMI_STATUS_OK)
-			limit_w = json_mknumber(values.limit_w);
-		else
-			limit_w = json_mknull();
-
-		/* Critical */
-		if (values.limit_c_r == AMI_STATUS_OK)
-			limit_c = json_mknumber(values.limit_c);
-		else
-			limit_c = json_mknull();
-
-		/* Fatal */
-		if (values.limit_f_r == AMI_STATUS_OK)
-			limit_f = json_mknumber(values.limit_f);
-		else
-			limit_f = json_mknull();
-
-		limits_node = json_mkobject();
-		json_append_member(limits_node, "warning", limit_w);
-		json_append_member(limits_node, "critical", limit_c);
-		json_append_member(limits_node, "fatal", limit_f);
-		json_append_member(row, "limits", limits_node);
-	}
-
 	switch (sensor_type) {
 	case AMI_SENSOR_TYPE_TEMP:
-		json_append_member(parent, "temp", row);
+		key = "temp";
 		break;
 	
 	case AMI_SENSOR_TYPE_CURRENT:
-		json_append_member(parent, "current", row);
+		key = "current";
 		break;
 	
 	case AMI_SENSOR_TYPE_VOLTAGE:
-		json_append_member(parent, "voltage", row);
+		key = "voltage";
 		break;
 	
 	case AMI_SENSOR_TYPE_POWER:
-		json_append_member(parent, "power", row);
+		key = "power";
 		break;
 	
 	default:
-		ret = EXIT_FAILURE;
-		break;
+		return EXIT_FAILURE;
 	}
 
-	return ret;
+	get_all_sensor_values(
+		dev, sensor, sensor_type, extra_fields, &values, false
+	);
+	
+	jsonw_key(writer, key);
+	jsonw_begin_object(writer);
+
+	/* All objects have value, status, and unit. */
+	jsonw_key(writer, "unit_mod");
+	jsonw_number(writer, values.mod);
+	jsonw_key(writer, "value");
+	jsonw_number(writer, values.value);
+	jsonw_key(writer, "status");
+	jsonw_number(writer, values.status);
+	
+	/* Extra attributes. */
+	if (extra_fields & EXTRA_FIELDS_MAX)
+		mk_sensor_number(writer, "max", values.max, values.max_r);
+	
+	if (extra_fields & EXTRA_FIELDS_AVG)
+		mk_sensor_number(writer, "average", values.avg, values.avg_r);
+
+	if (extra_fields & EXTRA_FIELDS_LIMITS) {
+		jsonw_key(writer, "limits");
+		jsonw_begin_object(writer);
+		mk_sensor_number(writer, "warning", values.limit_w, values.limit_w_r);
+		mk_sensor_number(writer, "critical", values.limit_c, values.limit_c_r);
+		mk_sensor_number(writer, "fatal", values.limit_f, values.limit_f_r);
+		jsonw_end_object(writer);
+	}
+
+	jsonw_end_object(writer);
+	return EXIT_SUCCESS;
 }
 
 /**
  * construct_sensor_json() - Callback for the `populate_sensor_values` function.
  * @dev: Device handle.
- * @parent: Pre-allocated pointer to topmost JSON object.
+ * @writer: JSON writer, inside the topmost JSON object.
  * @sensor: Populate data for this sensor.
  * @extra_fields: Extra fields bitflag.
  * @j: Current row (a row is a single sensor object like `"voltage": {...}`)
  *
- * This function creates a variable number of JSON nodes and appends them to
- * the parent in a predefined format, and for each object, it increments `j`.
+ * This function writes a variable number of JSON nodes in a predefined
+ * format, and for each object, it increments `j`.
  * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE
  */
-static int construct_sensor_json(ami_device *dev, JsonNode *parent,
+static int construct_sensor_json(ami_device *dev, struct json_writer *writer,
 	const char *sensor, int extra_fields, int *j)
 {
 	int i = 0;
 	int ret = EXIT_SUCCESS;
-	JsonNode *current_group = NULL;
 	uint32_t sensor_type = 0;
 
-	if (!j || !parent || !dev || !sensor)
+	if (!j || !writer || !dev || !sensor)
 		return EXIT_FAILURE;
 	
 	if (ami_sensor_get_type(dev, sensor, &sensor_type) != AMI_STATUS_OK)
 		return EXIT_FAILURE;
 	
-	current_group = json_mkobject();
+	jsonw_key(writer, sensor);
+	jsonw_begin_object(writer);
 
 	for (i = 0; i < AMI_SENSOR_TYPE_MAX; i++) {
 		if ((1U << i) & sensor_type) {
 			if (mk_sensor_node(dev, sensor, (1U << i),
-					extra_fields, current_group) == EXIT_FAILURE) {
+					extra_fields, writer) == EXIT_FAILURE) {
 				ret = EXIT_FAILURE;
 				break;
 			}
@@ -769,7 +747,7 @@ static int construct_sensor_json(ami_device *dev, JsonNode *parent,
 		}
 	}
 
-	json_append_member(parent, sensor, current_group);
+	jsonw_end_object(writer);
 	return ret;
 }
 
@@ -784,7 +762,8 @@ static int construct_sensor_json(ami_device *dev, JsonNode *parent,
  * @data: Pointer to `struct app_sensor_data`.
  * 
  * Note that this function is used for any generic data structure
- * (JSON and tables, in this case).
+ * (JSON and tables, in this case). For JSON, `values` is a
+ * `struct json_writer` and the sensors are streamed as they are read.
  * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE.
  */
@@ -824,7 +803,7 @@ static int populate_sensor_values(ami_device *dev, void *values,
 		case APP_OUT_FORMAT_JSON:
 			ret = construct_sensor_json(
 				dev,
-				(JsonNode*)values,
+				(struct json_writer*)values,
 				current_sensor->name,
 				sensor_data->extra_fields,
 				&j
@@ -866,13 +845,13 @@ static int populate_sensor_values(ami_device *dev, void *values,
  * @sensor: Print out data for this sensor only (NULL for all sensors).
  * @stream: Optional output stream (defaults to stdout).
  * @fmt: Output format.
- * @json_out: Optional variable to store generated JSON data instead of printing.
+ * @writer: Optional JSON writer to stream the data to instead of `stream`.
  * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE.
  */
 static int print_sensor_data(ami_device *dev, int extra_fields,
 	const char *sensor, FILE *stream, enum app_out_format fmt,
-	JsonNode **json_out)
+	struct json_writer *writer)
 {
 	int i = 0;
 	int ret = EXIT_FAILURE;
@@ -954,8 +933,8 @@ static int print_sensor_data(ami_device *dev, int extra_fields,
 	if (stream && (ret != EXIT_FAILURE) && (fmt != APP_OUT_FORMAT_TABLE)) {
 		switch (fmt) {
 		case APP_OUT_FORMAT_JSON:
-			if (!json_out)
-				ret = print_json_data(
+			if (!writer)
+				ret = print_json_stream_data(
 					dev,
 					n_fields,
 					n_rows,
@@ -964,13 +943,13 @@ static int print_sensor_data(ami_device *dev, int extra_fields,
 					&data
 				);
 			else
-				ret = gen_json_data(
+				ret = write_json_data(
 					dev,
 					n_fields,
 					n_rows,
+					writer,
 					&populate_sensor_values,
-					&data,
-					json_out
+					&data
 				);
 			
 			break;
@@ -1051,17 +1030,20 @@ int report_sensors(struct app_option *options)
 	} else {
 		ami_device *dev = NULL;
 		ami_device *prev = NULL;
-		JsonNode *parent = NULL;
+		struct json_writer json = { 0 };
+		struct json_writer *writer = NULL;
 
-		if (fmt_given && output_given && (format == APP_OUT_FORMAT_JSON))
-			parent = json_mkobject();
+		/* Each device is written to the file as soon as it has been read. */
+		if (fmt_given && output_given && (format == APP_OUT_FORMAT_JSON)) {
+			if (print_json_begin(&json, stream) == EXIT_SUCCESS)
+				writer = &json;
+		}
 
 		APP_WARN("enumerating all devices");
 
 		while (ami_dev_find_next(&dev, AMI_ANY_DEV, AMI_ANY_DEV, 0, prev) == AMI_STATUS_OK) {
 			uint16_t bdf = 0;
 			char bdf_str[AMI_BDF_STR_LEN] = { 0 };
-			JsonNode *child = NULL;
 
 			if (ami_dev_get_pci_bdf(dev, &bdf) == AMI_STATUS_OK) {
 				snprintf(
@@ -1096,13 +1078,16 @@ int report_sensors(struct app_option *options)
 				break;
 			}
 
+			if (writer != NULL)
+				jsonw_key(writer, bdf_str);
+
 			ret = print_sensor_data(
 				dev,
 				extra_fields,
 				sensor_filter,
 				stream,
 				format,
-				(parent == NULL) ? (NULL) : (&child)
+				writer
 			);
 
 			if (ret != EXIT_SUCCESS) {
@@ -1111,24 +1096,17 @@ int report_sensors(struct app_option *options)
 				break;
 			}
 
-			if ((parent != NULL) && (child != NULL))
-				json_append_member(parent, bdf_str, child);
-
 			/* Move to next device. */
 			ami_dev_delete(&prev);
 			prev = dev;
 			dev = NULL;
 		}
 
-		if ((ret == EXIT_SUCCESS) && (parent != NULL))
-			print_json_obj(parent, stream);
+		if ((ret == EXIT_SUCCESS) && (writer != NULL))
+			ret = print_json_end(writer);
 
 		/* Delete final device. */
 		ami_dev_delete(&prev);
-
-		/* Delete JSON */
-		if (parent != NULL)
-			json_delete(parent);
 	}
 
 	if (stream)
@@ -14,6 +14,7 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "arena.h"
 #include "table.h"
 #include "printer.h"
 
@@ -23,6 +24,166 @@
 
 #define COLUMN_PADDING (2)
 
+/* Small tables fit in a single chunk. */
+#define TABLE_ARENA_CHUNK	(64 * 1024)
+
+#define TABLE_NEWLINE		"\r\n"
+#define TABLE_NEWLINE_LEN	(sizeof(TABLE_NEWLINE) - 1)
+#define TABLE_SEPARATOR		" | "
+#define TABLE_SEPARATOR_LEN	(sizeof(TABLE_SEPARATOR) - 1)
+
+/*****************************************************************************/
+/* Local function definitions                                                */
+/*****************************************************************************/
+
+/**
+ * field_width() - Get the printed width of a cell.
+ * @len: Length of the cell contents.
+ * @col_width: Column width.
+ * @col_padding: Column padding.
+ *
+ * Same as the field width of `%*s` - contents are never truncated.
+ *
+ * Return: Width in characters.
+ */
+static size_t field_width(int len, int col_width, int col_padding)
+{
+	return (len > (col_width + col_padding)) ? (len) : (col_width + col_padding);
+}
+
+/**
+ * get_lengths() - Compute the length of each cell in a row.
+ * @num_cols: Number of columns.
+ * @values: Row values (NULL values are treated as empty).
+ * @lens: Output array of `num_cols` lengths.
+ *
+ * Return: None.
+ */
+static void get_lengths(int num_cols, char *values[], int *lens)
+{
+	int i = 0;
+
+	for (i = 0; i < num_cols; i++)
+		lens[i] = (values[i]) ? (strlen(values[i])) : (0);
+}
+
+/**
+ * row_size() - Get the number of bytes `render_row` will write.
+ * @num_cols: Number of columns.
+ * @lens: Cached cell lengths.
+ * @col_widths: Column widths.
+ * @col_padding: Column padding.
+ * @table_width: Total table width.
+ * @divider: Should a row separator be printed.
+ *
+ * Return: Size in bytes.
+ */
+static size_t row_size(int num_cols, const int *lens, const int *col_widths,
+	int col_padding, int table_width, bool divider)
+{
+	size_t size = TABLE_NEWLINE_LEN;
+	int i = 0;
+
+	if (divider)
+		size += ((table_width > 0) ? (table_width) : (0)) + TABLE_NEWLINE_LEN;
+
+	for (i = 0; i < num_cols; i++) {
+		/* Empty cells are skipped, except in the first column. */
+		if ((i != 0) && (lens[i] == 0))
+			continue;
+
+		if (i != 0)
+			size += TABLE_SEPARATOR_LEN;
+
+		size += field_width(lens[i], col_widths[i], col_padding);
+	}
+
+	return size;
+}
+
+/**
+ * render_row() - Format a single table row into a buffer.
+ * @out: Output buffer - must have room for `row_size` bytes.
+ * @num_cols: Number of columns.
+ * @values: Row values.
+ * @lens: Cached cell lengths.
+ * @col_widths: Column widths.
+ * @col_padding: Column padding.
+ * @table_width: Total table width.
+ * @divider: Should a row separator be printed.
+ * @col_align: Optional alignment of columns (defaults to left).
+ *
+ * Return: Pointer to the end of the formatted row.
+ */
+static char *render_row(char *out, int num_cols, char *values[],
+	const int *lens, const int *col_widths, int col_padding, int table_width,
+	bool divider, const int *col_align)
+{
+	int i = 0;
+
+	if (divider) {
+		if (table_width > 0) {
+			memset(out, '-', table_width);
+			out += table_width;
+		}
+
+		memcpy(out, TABLE_NEWLINE, TABLE_NEWLINE_LEN);
+		out += TABLE_NEWLINE_LEN;
+	}
+
+	for (i = 0; i < num_cols; i++) {
+		size_t pad = 0;
+
+		if (i != 0) {
+			if (lens[i] == 0)
+				continue;
+
+			memcpy(out, TABLE_SEPARATOR, TABLE_SEPARATOR_LEN);
+			out += TABLE_SEPARATOR_LEN;
+		}
+
+		pad = field_width(lens[i], col_widths[i], col_padding) - lens[i];
+
+		if (col_align && (col_align[i] == TABLE_ALIGN_RIGHT)) {
+			memset(out, ' ', pad);
+			memcpy(out + pad, values[i], lens[i]);
+		} else {
+			memcpy(out, values[i], lens[i]);
+			memset(out + lens[i], ' ', pad);
+		}
+
+		out += pad + lens[i];
+	}
+
+	memcpy(out, TABLE_NEWLINE, TABLE_NEWLINE_LEN);
+	return out + TABLE_NEWLINE_LEN;
+}
+
+/**
+ * row_divider() - Check if a row divider should be printed.
+ * @divider_fmt: Row divider printing rule.
+ * @row: Row index.
+ * @first_len: Length of the first cell in the row.
+ *
+ * Return: true if a divider should be printed before the row.
+ */
+static bool row_divider(enum table_divider_format divider_fmt, int row, int first_len)
+{
+	switch (divider_fmt) {
+	case TABLE_DIVIDER_HEADER_ONLY:
+		return (row == 0);
+
+	case TABLE_DIVIDER_ALL:
+		return true;
+
+	case TABLE_DIVIDER_GROUPS:
+		return ((row == 0) || (first_len != 0));
+
+	default:
+		return false;
+	}
+}
+
 /*****************************************************************************/
 /* Public function declarations                                              */
 /*****************************************************************************/
@@ -34,55 +195,46 @@ int print_table_row(int num_cols, char* values[],
 	int *col_widths, int col_padding, int table_width, bool divider,
 	FILE *stream, int *col_align)
 {
-	int i = 0;
+	struct arena arena = { 0 };
+	int *lens = NULL;
+	char *buf = NULL;
+	char *end = NULL;
 
 	/* col_align is optional */
 
-	if (!col_widths || !values)
+	if (!col_widths || !values || (num_cols < 0))
 		return EXIT_FAILURE;
 
-	/* Print divider first. */
-	if (divider)
-		print_divider('-', table_width, stream);
+	arena_init(&arena, TABLE_ARENA_CHUNK);
+	lens = (int*)arena_alloc(&arena, num_cols * sizeof(int));
 
-	/* Print columns. */
-	for (i = 0; i < num_cols; i++) {
-		if (i == 0) {
-			if (col_align && (col_align[i] == TABLE_ALIGN_RIGHT))
-				my_fprintf(
-					stream,
-					"%*s",
-					col_widths[i] + col_padding,
-					values[i]
-				);
-			else
-				my_fprintf(
-					stream,
-					"%-*s",
-					col_widths[i] + col_padding,
-					values[i]
-				);
-		} else {
-			if (values[i] && (values[i][0] != '\0')) {
-				if (col_align && (col_align[i] == TABLE_ALIGN_RIGHT))
-					my_fprintf(
-						stream,
-						" | %*s",
-						col_widths[i] + col_padding,
-						values[i]
-					);
-				else
-					my_fprintf(
-						stream,
-						" | %-*s",
-						col_widths[i] + col_padding,
-						values[i]
-					);
-			}
-		}
+	if (lens) {
+		get_lengths(num_cols, values, lens);
+		buf = (char*)arena_alloc(
+			&arena,
+			row_size(num_cols, lens, col_widths, col_padding, table_width, divider)
+		);
 	}
-	my_fprintf(stream, "\r\n");
 
+	if (!buf) {
+		arena_destroy(&arena);
+		return EXIT_FAILURE;
+	}
+
+	end = render_row(
+		buf,
+		num_cols,
+		values,
+		lens,
+		col_widths,
+		col_padding,
+		table_width,
+		divider,
+		col_align
+	);
+	my_write(stream, buf, end - buf);
+
+	arena_destroy(&arena);
 	return EXIT_SUCCESS;
 }
 
@@ -95,31 +247,36 @@ int print_table(char* header[], char** values[], int num_cols, int num_rows,
 	int i = 0, j = 0;
 	int table_width = 0;
 	int *column_widths = NULL;
-	bool print_divider = false;
+	int *lens = NULL;  /* (num_rows + 1) x num_cols, header first */
+	struct arena arena = { 0 };
+	size_t size = 0;
+	char *buf = NULL;
+	char *out = NULL;
 
-	if (!header || !values)
+	if (!header || !values || (num_cols < 0) || (num_rows < 0))
 		return EXIT_FAILURE;
 
-	column_widths = (int*)calloc(num_cols, sizeof(int));
+	arena_init(&arena, TABLE_ARENA_CHUNK);
+	column_widths = (int*)arena_alloc(&arena, num_cols * sizeof(int));
+	lens = (int*)arena_alloc(&arena, ((size_t)num_rows + 1) * num_cols * sizeof(int));
 
-	if (!column_widths)
+	if (!column_widths || !lens) {
+		arena_destroy(&arena);
 		return EXIT_FAILURE;
+	}
 
-	/* Need to figure out max width of each column. */
-	for (i = 0; i < num_cols; i++) {
-		/* Start with the header size */
-		int col_width = strlen(header[i]);
-		int max_col = col_width;
+	/* Measure every cell once. */
+	get_lengths(num_cols, header, lens);
 
-		/* Check if any item is longer. */
-		for (j = 0; j < num_rows; j++) {
-			col_width = strlen(values[j][i]);
+	for (j = 0; j < num_rows; j++)
+		get_lengths(num_cols, values[j], &lens[(j + 1) * num_cols]);
 
-			if (col_width > max_col)
-				max_col = col_width;
+	/* Need to figure out max width of each column. */
+	for (j = 0; j <= num_rows; j++) {
+		for (i = 0; i < num_cols; i++) {
+			if (lens[(j * num_cols) + i] > column_widths[i])
+				column_widths[i] = lens[(j * num_cols) + i];
 		}
-
-		column_widths[i] = max_col;
 	}
 
 	/* Calculate total table width */
@@ -128,75 +285,77 @@ int print_table(char* header[], char** values[], int num_cols, int num_rows,
 
 		/* Account for column separator */
 		if (i > 0)
-			table_width += 3;
+			table_width += TABLE_SEPARATOR_LEN;
 	}
 
-	my_fprintf(stream, "\r\n");  /* whitespace padding */
+	/* Size the output: whitespace padding, header, rows, whitespace padding. */
+	size = (2 * TABLE_NEWLINE_LEN) + row_size(
+		num_cols,
+		lens,
+		column_widths,
+		COLUMN_PADDING,
+		table_width,
+		false
+	);
 
-	switch (divider_fmt) {
-	case TABLE_DIVIDER_HEADER_ONLY:
-	case TABLE_DIVIDER_ALL:
-	case TABLE_DIVIDER_GROUPS:
-		print_divider = true;
-		break;
-	
-	default:
-		break;
+	for (j = 0; j < num_rows; j++) {
+		int *row_lens = &lens[(j + 1) * num_cols];
+
+		size += row_size(
+			num_cols,
+			row_lens,
+			column_widths,
+			COLUMN_PADDING,
+			table_width,
+			row_divider(divider_fmt, j, (num_cols > 0) ? (row_lens[0]) : (0))
+		);
 	}
 
-	/* Print header */
-	print_table_row(
+	buf = (char*)arena_alloc(&arena, size);
+
+	if (!buf) {
+		arena_destroy(&arena);
+		return EXIT_FAILURE;
+	}
+
+	/* Format the whole table. */
+	memcpy(buf, TABLE_NEWLINE, TABLE_NEWLINE_LEN);  /* whitespace padding */
+	out = buf + TABLE_NEWLINE_LEN;
+
+	out = render_row(
+		out,
 		num_cols,
 		header,
+		lens,
 		column_widths,
 		COLUMN_PADDING,
 		table_width,
 		false,
-		stream,
 		col_align
 	);
 
-	/* Print rows */
 	for (j = 0; j < num_rows; j++) {
-		switch (divider_fmt) {
-		case TABLE_DIVIDER_HEADER_ONLY:
-			if (j == 0)
-				print_divider = true;
-			else
-				print_divider = false;
-			break;
-
-		case TABLE_DIVIDER_ALL:
-			print_divider = true;
-			break;
-
-		case TABLE_DIVIDER_GROUPS:
-			if ((j != 0) && (strlen(values[j][0]) == 0))
-				print_divider = false;
-			else
-				print_divider = true;
-			break;
-		
-		default:
-			print_divider = false;
-			break;
-		}
+		int *row_lens = &lens[(j + 1) * num_cols];
 
-		print_table_row(
+		out = render_row(
+			out,
 			num_cols,
 			values[j],
+			row_lens,
 			column_widths,
 			COLUMN_PADDING,
 			table_width,
-			print_divider,
-			stream,
+			row_divider(divider_fmt, j, (num_cols > 0) ? (row_lens[0]) : (0)),
 			col_align
 		);
 	}
 
-	my_fprintf(stream, "\r\n");  /* whitespace padding */
+	memcpy(out, TABLE_NEWLINE, TABLE_NEWLINE_LEN);  /* whitespace padding */
+	out += TABLE_NEWLINE_LEN;
+
+	my_write(stream, buf, out - buf);
 
 	/* Cleanup. */
-	free(column_widths);
+	arena_destroy(&arena);
 	return EXIT_SUCCESS;
 }
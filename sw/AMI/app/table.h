@@ -59,6 +59,8 @@ enum table_align {
  * @stream: Output stream (defaults to stdout)
  * @col_align: Optional alignment of columns (defaults to left).
  * 
+ * The row (and divider) is formatted into a buffer and written out in one go.
+ * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE.
  */
 int print_table_row(int num_cols, char* values[],
@@ -75,6 +77,10 @@ int print_table_row(int num_cols, char* values[],
  * @stream: Output stream
  * @col_align: Optional alignment of columns (defaults to left).
  * 
+ * The length of each cell is computed once and the whole table is formatted
+ * into a single buffer, which is written with one call to `my_write`. All
+ * temporary memory comes from one arena.
+ * 
  * Return: EXIT_SUCCESS or EXIT_FAILURE.
  */
 int print_table(char* header[], char** values[], int num_cols, int num_rows,
@@ -0,0 +1,285 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * bench_table.c - Benchmark for rendering sensor tables
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Renders the tables `ami_tool sensors -v` would print for 16 cards with 150
+ * sensors each, and reports the time, the number of heap allocations and the
+ * number of output writes per run. The table output itself goes to /dev/null.
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* App includes */
+#include "printer.h"
+#include "table.h"
+
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define NS_PER_S		(1000000000ULL)
+
+#define BENCH_CARDS		(16)
+#define BENCH_SENSORS		(150)
+#define BENCH_FIELDS		(6)
+#define BENCH_ITERATIONS	(50)
+
+/* Size of each table cell - TABLE_FIELD_MAX in printer.c */
+#define BENCH_FIELD_MAX		(64)
+
+/* Every third sensor has a second row (e.g. a current and a voltage reading). */
+#define BENCH_GROUP_SIZE	(3)
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * struct bench_counters - Calls made while rendering.
+ * @allocs: malloc/calloc/realloc calls.
+ * @alloc_bytes: Total bytes requested.
+ * @writes: Calls into stdio to write the table.
+ */
+struct bench_counters {
+	uint64_t allocs;
+	uint64_t alloc_bytes;
+	uint64_t writes;
+};
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static struct bench_counters counters = { 0 };
+static bool counting = false;
+
+static const char * const header_names[BENCH_FIELDS] = {
+	"Name", "Value", "Status", "Max", "Average", "Limits (Warn, Crit, Fatal)"
+};
+
+/* Same alignment as the sensors command */
+static int col_align[BENCH_FIELDS] = {
+	TABLE_ALIGN_LEFT,
+	TABLE_ALIGN_RIGHT,
+	TABLE_ALIGN_LEFT,
+	TABLE_ALIGN_RIGHT,
+	TABLE_ALIGN_RIGHT,
+	TABLE_ALIGN_RIGHT,
+};
+
+/*****************************************************************************/
+/* Redefinitions/Wrapping                                                    */
+/*****************************************************************************/
+
+extern void *__real_malloc(size_t size);
+extern void *__real_calloc(size_t num, size_t size);
+extern void *__real_realloc(void *ptr, size_t size);
+extern size_t __real_fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream);
+extern int __real_vfprintf(FILE *stream, const char *format, va_list arg);
+extern int __real_putc(int c, FILE *stream);
+
+void *__wrap_malloc(size_t size)
+{
+	if (counting) {
+		counters.allocs++;
+		counters.alloc_bytes += size;
+	}
+
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t num, size_t size)
+{
+	if (counting) {
+		counters.allocs++;
+		counters.alloc_bytes += num * size;
+	}
+
+	return __real_calloc(num, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+	if (counting) {
+		counters.allocs++;
+		counters.alloc_bytes += size;
+	}
+
+	return __real_realloc(ptr, size);
+}
+
+size_t __wrap_fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
+{
+	if (counting)
+		counters.writes++;
+
+	return __real_fwrite(ptr, size, nmemb, stream);
+}
+
+int __wrap_vfprintf(FILE *stream, const char *format, va_list arg)
+{
+	if (counting)
+		counters.writes++;
+
+	return __real_vfprintf(stream, format, arg);
+}
+
+int __wrap_putc(int c, FILE *stream)
+{
+	if (counting)
+		counters.writes++;
+
+	return __real_putc(c, stream);
+}
+
+/*****************************************************************************/
+/* Local function definitions                                                */
+/*****************************************************************************/
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts = { 0 };
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec * NS_PER_S) + ts.tv_nsec;
+}
+
+/*
+ * `app_header_builder` for the sensors table.
+ */
+static int populate_header(ami_device *dev, char **header, int n_fields, void *data)
+{
+	int i = 0;
+
+	for (i = 0; i < n_fields; i++)
+		strcpy(header[i], header_names[i]);
+
+	return EXIT_SUCCESS;
+}
+
+/*
+ * `app_value_builder` for the sensors table - `data` points at the card index.
+ */
+static int populate_values(ami_device *dev, void *values,
+	int *n_rows, int *n_fields, enum app_out_format fmt, void *data)
+{
+	char ***rows = (char***)values;
+	int card = *(int*)data;
+	int sensor = 0;
+	int j = 0;
+
+	for (sensor = 0; (sensor < BENCH_SENSORS) && (j < *n_rows); sensor++) {
+		int val = 1000 + (card * BENCH_SENSORS) + sensor;
+		bool second = ((sensor % BENCH_GROUP_SIZE) == 0);
+
+		snprintf(rows[j][0], BENCH_FIELD_MAX, "sensor_%d", sensor);
+		snprintf(rows[j][1], BENCH_FIELD_MAX, "%d.%03d C", val / 1000, val % 1000);
+		snprintf(rows[j][2], BENCH_FIELD_MAX, "%s", "valid");
+		snprintf(rows[j][3], BENCH_FIELD_MAX, "%d.%03d C", (val + 7) / 1000, (val + 7) % 1000);
+		snprintf(rows[j][4], BENCH_FIELD_MAX, "%d.%03d C", (val + 3) / 1000, (val + 3) % 1000);
+		snprintf(rows[j][5], BENCH_FIELD_MAX, "%d.%03d, %d.%03d, %d.%03d",
+			85, sensor % 1000, 95, sensor % 1000, 105, sensor % 1000);
+		j++;
+
+		/* Continuation row - no name, so no divider */
+		if (second && (j < *n_rows)) {
+			rows[j][0][0] = '\0';
+			snprintf(rows[j][1], BENCH_FIELD_MAX, "%d.%03d V", val / 1000, val % 1000);
+			snprintf(rows[j][2], BENCH_FIELD_MAX, "%s", "valid");
+			snprintf(rows[j][3], BENCH_FIELD_MAX, "%d.%03d V", (val + 7) / 1000, (val + 7) % 1000);
+			snprintf(rows[j][4], BENCH_FIELD_MAX, "%d.%03d V", (val + 3) / 1000, (val + 3) % 1000);
+			rows[j][5][0] = '\0';
+			j++;
+		}
+	}
+
+	*n_rows = j;
+	return EXIT_SUCCESS;
+}
+
+/*
+ * Render one table per card, like `ami_tool sensors` does.
+ */
+static int render_cards(int rows_per_card)
+{
+	int card = 0;
+
+	for (card = 0; card < BENCH_CARDS; card++) {
+		if (print_table_data(NULL, BENCH_FIELDS, rows_per_card, NULL,
+				TABLE_DIVIDER_GROUPS, populate_values, populate_header,
+				&card, col_align) != EXIT_SUCCESS)
+			return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+int main(void)
+{
+	/* The sensors command sizes each table for the worst case. */
+	int rows_per_card = BENCH_SENSORS + (BENCH_SENSORS / BENCH_GROUP_SIZE) + 1;
+	FILE *results = NULL;
+	uint64_t start = 0;
+	uint64_t ns = 0;
+	int ret = EXIT_SUCCESS;
+	int i = 0;
+
+	/* Results go to the original stdout, tables to /dev/null */
+	results = fdopen(dup(STDOUT_FILENO), "w");
+
+	if (!results || !freopen("/dev/null", "w", stdout)) {
+		fprintf(stderr, "could not redirect stdout\n");
+		return EXIT_FAILURE;
+	}
+
+	/* Warm up */
+	ret = render_cards(rows_per_card);
+
+	counting = true;
+	start = now_ns();
+
+	for (i = 0; (i < BENCH_ITERATIONS) && (ret == EXIT_SUCCESS); i++)
+		ret = render_cards(rows_per_card);
+
+	ns = now_ns() - start;
+	counting = false;
+
+	fprintf(results, "%-28s %10s %14s %12s %14s %10s\n",
+		"benchmark", "iterations", "ns_per_op", "allocs", "alloc_bytes", "writes");
+
+	if (ret != EXIT_SUCCESS) {
+		fprintf(results, "%-28s %10s %14s\n", "sensors_table_16x150", "-", "FAILED");
+	} else {
+		double it = (double)BENCH_ITERATIONS;
+
+		fprintf(results, "%-28s %10d %14.1f %12.1f %14.1f %10.1f\n",
+			"sensors_table_16x150",
+			BENCH_ITERATIONS,
+			(double)ns / it,
+			counters.allocs / it,
+			counters.alloc_bytes / it,
+			counters.writes / it);
+	}
+
+	fclose(results);
+	return ret;
+}
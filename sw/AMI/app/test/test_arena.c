@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * test_arena.c - Unit test file for arena.c
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* External includes */
+#include "cmocka.h"
+
+/* Shared test code */
+#include "test_harness.h"
+
+/* App includes */
+#include "arena.h"
+
+/*****************************************************************************/
+/* Global variables                                                          */
+/*****************************************************************************/
+
+static struct wrapper w_calloc = { REAL, REAL, 0, 0 };
+static int n_calloc = 0;
+
+/*****************************************************************************/
+/* Redefinitions/Wrapping                                                    */
+/*****************************************************************************/
+
+extern void *__real_calloc(size_t num, size_t size);
+
+void *__wrap_calloc(size_t num, size_t size)
+{
+	void *ret = NULL;
+
+	switch (w_calloc.current) {
+	/* case OK not implemented */
+
+	case REAL:
+		ret = __real_calloc(num, size);
+		n_calloc++;
+		break;
+
+	default:
+		break;
+	}
+
+	WRAPPER_DONE(calloc);
+	return ret;
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+void test_happy_arena_alloc(void **state)
+{
+	struct arena arena = { 0 };
+	char *a = NULL;
+	char *b = NULL;
+	char *big = NULL;
+	size_t i = 0;
+
+	n_calloc = 0;
+	arena_init(&arena, 256);
+
+	/* Happy path - allocations are zeroed, aligned and share a chunk */
+	a = (char*)arena_alloc(&arena, 3);
+	b = (char*)arena_alloc(&arena, 100);
+	assert_non_null(a);
+	assert_non_null(b);
+	assert_int_equal((uintptr_t)a % ARENA_ALIGN, 0);
+	assert_int_equal((uintptr_t)b % ARENA_ALIGN, 0);
+	assert_int_equal(b - a, ARENA_ALIGN_SIZE(3));
+	for (i = 0; i < 100; i++)
+		assert_int_equal(b[i], 0);
+	assert_int_equal(n_calloc, 1);
+
+	/* Happy path - full chunk, a new one is allocated */
+	assert_non_null(arena_alloc(&arena, 200));
+	assert_int_equal(n_calloc, 2);
+
+	/* Happy path - oversized request gets a chunk of its own */
+	big = (char*)arena_alloc(&arena, 4096);
+	assert_non_null(big);
+	memset(big, 0xff, 4096);
+	assert_int_equal(n_calloc, 3);
+
+	arena_destroy(&arena);
+
+	/* Happy path - arena can be reused after destroy */
+	assert_non_null(arena_alloc(&arena, 1));
+	arena_destroy(&arena);
+	arena_destroy(&arena);
+}
+
+void test_fail_arena_alloc(void **state)
+{
+	struct arena arena = { 0 };
+
+	/* Failure path - invalid `arena` argument */
+	assert_null(arena_alloc(NULL, 1));
+
+	/* Failure path - size overflows */
+	arena_init(&arena, 0);
+	assert_null(arena_alloc(&arena, SIZE_MAX));
+
+	/* Failure path - calloc fails */
+	WRAPPER_ACTION(FAIL, calloc);
+	assert_null(arena_alloc(&arena, 1));
+
+	arena_destroy(&arena);
+}
+
+/*****************************************************************************/
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_happy_arena_alloc),
+		cmocka_unit_test(test_fail_arena_alloc),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
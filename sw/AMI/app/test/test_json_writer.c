@@ -0,0 +1,392 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * test_json_writer.c - Unit test file for json_writer.c
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Every document is built twice - once as a `JsonNode` tree and once with
+ * the streaming writer - and the two outputs must match byte for byte.
+ */
+
+/*****************************************************************************/
+/* Includes                                                                  */
+/*****************************************************************************/
+
+/* Standard includes */
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+/* External includes */
+#include "cmocka.h"
+#include "json.h"
+
+/* App includes */
+#include "json_writer.h"
+
+/*****************************************************************************/
+/* Typedefs                                                                  */
+/*****************************************************************************/
+
+/**
+ * typedef doc_builder - Build the same document as a tree and as a stream.
+ * @writer: Writer to stream to, or NULL to build a tree.
+ *
+ * Return: The tree, or NULL when streaming.
+ */
+typedef JsonNode *(*doc_builder)(struct json_writer *writer);
+
+/*****************************************************************************/
+/* Local functions                                                           */
+/*****************************************************************************/
+
+/*
+ * Helpers which either append to `parent` or stream to `writer`.
+ */
+
+static void add_number(struct json_writer *writer, JsonNode *parent,
+	const char *key, double num)
+{
+	if (writer) {
+		jsonw_key(writer, key);
+		jsonw_number(writer, num);
+	} else {
+		json_append_member(parent, key, json_mknumber(num));
+	}
+}
+
+static void add_string(struct json_writer *writer, JsonNode *parent,
+	const char *key, const char *str)
+{
+	if (writer) {
+		jsonw_key(writer, key);
+		jsonw_string(writer, str);
+	} else {
+		json_append_member(parent, key, json_mkstring(str));
+	}
+}
+
+static void add_null(struct json_writer *writer, JsonNode *parent, const char *key)
+{
+	if (writer) {
+		jsonw_key(writer, key);
+		jsonw_null(writer);
+	} else {
+		json_append_member(parent, key, json_mknull());
+	}
+}
+
+static JsonNode *begin_member(struct json_writer *writer, const char *key)
+{
+	if (writer) {
+		jsonw_key(writer, key);
+		jsonw_begin_object(writer);
+		return NULL;
+	}
+
+	return json_mkobject();
+}
+
+static void end_member(struct json_writer *writer, JsonNode *parent,
+	const char *key, JsonNode *obj)
+{
+	if (writer)
+		jsonw_end_object(writer);
+	else
+		json_append_member(parent, key, obj);
+}
+
+/*
+ * Output of the "sensors" command for two devices.
+ */
+static JsonNode *build_sensors(struct json_writer *writer)
+{
+	static const char * const bdfs[] = { "21:00.0", "e2:00.0" };
+	static const char * const types[] = { "temp", "current", "voltage", "power" };
+	JsonNode *root = NULL;
+	int d = 0, s = 0;
+
+	if (writer)
+		jsonw_begin_object(writer);
+	else
+		root = json_mkobject();
+
+	for (d = 0; d < 2; d++) {
+		JsonNode *dev = begin_member(writer, bdfs[d]);
+
+		for (s = 0; s < 6; s++) {
+			char name[32] = { 0 };
+			JsonNode *group = NULL;
+			JsonNode *sensor = NULL;
+			JsonNode *limits = NULL;
+
+			snprintf(name, sizeof(name), "sensor_%d", s);
+			group = begin_member(writer, name);
+			sensor = begin_member(writer, types[s % 4]);
+
+			add_number(writer, sensor, "unit_mod", -3);
+			add_number(writer, sensor, "value", 12000 + (s * 37));
+			add_number(writer, sensor, "status", 1);
+
+			if (s % 3)
+				add_number(writer, sensor, "max", 15000.5);
+			else
+				add_null(writer, sensor, "max");
+
+			add_number(writer, sensor, "average", 0.1 * s);
+
+			limits = begin_member(writer, "limits");
+			add_number(writer, limits, "warning", 85000);
+			add_null(writer, limits, "critical");
+			add_number(writer, limits, "fatal", -1.25e-7);
+			end_member(writer, sensor, "limits", limits);
+
+			end_member(writer, group, types[s % 4], sensor);
+			end_member(writer, dev, name, group);
+		}
+
+		end_member(writer, root, bdfs[d], dev);
+	}
+
+	if (writer)
+		jsonw_end_object(writer);
+
+	return root;
+}
+
+/*
+ * Output of the "overview" command.
+ */
+static JsonNode *build_overview(struct json_writer *writer)
+{
+	JsonNode *root = NULL;
+	JsonNode *version = NULL;
+	JsonNode *api = NULL;
+	JsonNode *pfs = NULL;
+	JsonNode *pf = NULL;
+	JsonNode *amc = NULL;
+
+	if (writer)
+		jsonw_begin_object(writer);
+	else
+		root = json_mkobject();
+
+	version = begin_member(writer, "version");
+	api = begin_member(writer, "api");
+	add_number(writer, api, "major", 2);
+	add_number(writer, api, "minor", 4);
+	add_string(writer, api, "branch", "");
+	add_string(writer, api, "hash", "246d06ac794b1fb90d27b42379be8bcc14f85f06");
+	end_member(writer, version, "api", api);
+	end_member(writer, root, "version", version);
+
+	pfs = begin_member(writer, "physical_functions");
+	pf = begin_member(writer, "21:00.0");
+	add_string(writer, pf, "name", "ALVEO V80 PQ");
+	add_string(writer, pf, "uuid", "9a4e4a4bc0e7ee81a2bc3f2d8e1b2e09");
+	add_number(writer, pf, "hwmon", 3);
+	add_string(writer, pf, "state", "READY");
+	amc = begin_member(writer, "amc");
+	add_number(writer, amc, "major", 1);
+	add_number(writer, amc, "local_changes", 0);
+	end_member(writer, pf, "amc", amc);
+	end_member(writer, pfs, "21:00.0", pf);
+
+	pf = begin_member(writer, "e2:00.0");
+	add_null(writer, pf, "name");
+	add_null(writer, pf, "amc");
+	end_member(writer, pfs, "e2:00.0", pf);
+	end_member(writer, root, "physical_functions", pfs);
+
+	if (writer)
+		jsonw_end_object(writer);
+
+	return root;
+}
+
+/*
+ * Empty containers, arrays and values the app does not produce today.
+ */
+static JsonNode *build_edge_cases(struct json_writer *writer)
+{
+	JsonNode *root = NULL;
+	JsonNode *empty = NULL;
+	JsonNode *arr = NULL;
+
+	if (writer)
+		jsonw_begin_object(writer);
+	else
+		root = json_mkobject();
+
+	empty = begin_member(writer, "empty");
+	end_member(writer, root, "empty", empty);
+
+	add_string(writer, root, "escapes", "\"quoted\" \\ \b\f\n\r\t \x01\x1e\x1f\x7f");
+	add_string(writer, root, "utf8", "caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80");
+	add_string(writer, root, "key \"with\" escapes", "");
+	add_number(writer, root, "nan", NAN);
+	add_number(writer, root, "inf", -INFINITY);
+	add_number(writer, root, "big", 1e300);
+	add_number(writer, root, "neg_zero", -0.0);
+	add_number(writer, root, "precise", 123456789.123456789);
+
+	if (writer) {
+		jsonw_key(writer, "flags");
+		jsonw_begin_array(writer);
+		jsonw_bool(writer, true);
+		jsonw_bool(writer, false);
+		jsonw_null(writer);
+		jsonw_begin_array(writer);
+		jsonw_end_array(writer);
+		jsonw_begin_object(writer);
+		jsonw_key(writer, "a");
+		jsonw_number(writer, 1);
+		jsonw_end_object(writer);
+		jsonw_end_array(writer);
+	} else {
+		JsonNode *obj = json_mkobject();
+
+		arr = json_mkarray();
+		json_append_element(arr, json_mkbool(true));
+		json_append_element(arr, json_mkbool(false));
+		json_append_element(arr, json_mknull());
+		json_append_element(arr, json_mkarray());
+		json_append_member(obj, "a", json_mknumber(1));
+		json_append_element(arr, obj);
+		json_append_member(root, "flags", arr);
+	}
+
+	if (writer)
+		jsonw_end_object(writer);
+
+	return root;
+}
+
+/*
+ * Build a document both ways and check the output is identical.
+ */
+static void check_identical(doc_builder build, const char *space)
+{
+	struct json_writer writer = { 0 };
+	JsonNode *tree = build(NULL);
+	char *expected = json_stringify(tree, space);
+	char *actual = NULL;
+	size_t len = 0;
+	FILE *stream = open_memstream(&actual, &len);
+
+	assert_non_null(stream);
+	assert_int_equal(jsonw_init(&writer, stream, space), EXIT_SUCCESS);
+	assert_null(build(&writer));
+	assert_int_equal(jsonw_finish(&writer), EXIT_SUCCESS);
+	assert_int_equal(fclose(stream), 0);
+
+	assert_int_equal(len, strlen(expected));
+	assert_string_equal(actual, expected);
+
+	free(actual);
+	free(expected);
+	json_delete(tree);
+}
+
+/*****************************************************************************/
+/* Tests                                                                     */
+/*****************************************************************************/
+
+void test_happy_sensors_identical(void **state)
+{
+	check_identical(build_sensors, "\t");
+	check_identical(build_sensors, NULL);
+}
+
+void test_happy_overview_identical(void **state)
+{
+	check_identical(build_overview, "\t");
+	check_identical(build_overview, NULL);
+}
+
+void test_happy_edge_cases_identical(void **state)
+{
+	check_identical(build_edge_cases, "\t");
+	check_identical(build_edge_cases, "  ");
+	check_identical(build_edge_cases, NULL);
+}
+
+void test_fail_jsonw_misuse(void **state)
+{
+	struct json_writer writer = { 0 };
+	char buf[64] = { 0 };
+	FILE *stream = fmemopen(buf, sizeof(buf), "w");
+	int i = 0;
+
+	assert_non_null(stream);
+
+	/* Failure path - invalid arguments */
+	assert_int_equal(jsonw_init(NULL, stream, NULL), EXIT_FAILURE);
+	assert_int_equal(jsonw_init(&writer, NULL, NULL), EXIT_FAILURE);
+	assert_int_equal(jsonw_finish(NULL), EXIT_FAILURE);
+
+	/* Failure path - value without a key */
+	jsonw_init(&writer, stream, NULL);
+	jsonw_begin_object(&writer);
+	jsonw_number(&writer, 1);
+	jsonw_end_object(&writer);
+	assert_int_equal(jsonw_finish(&writer), EXIT_FAILURE);
+
+	/* Failure path - key inside an array */
+	jsonw_init(&writer, stream, NULL);
+	jsonw_begin_array(&writer);
+	jsonw_key(&writer, "a");
+	assert_int_equal(jsonw_finish(&writer), EXIT_FAILURE);
+
+	/* Failure path - mismatched end */
+	jsonw_init(&writer, stream, NULL);
+	jsonw_begin_object(&writer);
+	jsonw_end_array(&writer);
+	assert_int_equal(jsonw_finish(&writer), EXIT_FAILURE);
+
+	/* Failure path - key without a value */
+	jsonw_init(&writer, stream, NULL);
+	jsonw_begin_object(&writer);
+	jsonw_key(&writer, "a");
+	jsonw_end_object(&writer);
+	assert_int_equal(jsonw_finish(&writer), EXIT_FAILURE);
+
+	/* Failure path - unclosed object */
+	jsonw_init(&writer, stream, NULL);
+	jsonw_begin_object(&writer);
+	assert_int_equal(jsonw_finish(&writer), EXIT_FAILURE);
+
+	/* Failure path - two top-level values */
+	jsonw_init(&writer, stream, NULL);
+	jsonw_null(&writer);
+	jsonw_null(&writer);
+	assert_int_equal(jsonw_finish(&writer), EXIT_FAILURE);
+
+	/* Failure path - too deep */
+	jsonw_init(&writer, stream, NULL);
+	for (i = 0; i <= JSONW_MAX_DEPTH; i++)
+		jsonw_begin_array(&writer);
+	assert_int_equal(jsonw_finish(&writer), EXIT_FAILURE);
+
+	fclose(stream);
+}
+
+/*****************************************************************************/
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_happy_sensors_identical),
+		cmocka_unit_test(test_happy_overview_identical),
+		cmocka_unit_test(test_happy_edge_cases_identical),
+		cmocka_unit_test(test_fail_jsonw_misuse),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
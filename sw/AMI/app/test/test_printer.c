@@ -73,10 +73,32 @@ JsonNode *__wrap_json_mkobject(void)
 	return (JsonNode*)mock();
 }
 
+int __wrap_jsonw_init(struct json_writer *writer, FILE *stream, const char *space)
+{
+	writer->stream = stream;
+	return (int)mock();
+}
+
+void __wrap_jsonw_begin_object(struct json_writer *writer)
+{
+	function_called();
+}
+
+void __wrap_jsonw_end_object(struct json_writer *writer)
+{
+	function_called();
+}
+
+int __wrap_jsonw_finish(struct json_writer *writer)
+{
+	return (int)mock();
+}
+
 int __wrap_print_table(char* header[], char** values[], int num_cols, int num_rows,
 	enum table_divider_format divider_fmt, FILE *stream, int *col_align)
 {
 	function_called();
+	return EXIT_SUCCESS;
 }
 
 int __wrap_vfprintf(FILE *stream, const char *format, va_list arg)
@@ -126,6 +148,12 @@ int __wrap_fprintf(FILE *stream, const char *format, ...)
 	function_called();
 }
 
+size_t __wrap_fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
+{
+	function_called();
+	return nmemb;
+}
+
 /*****************************************************************************/
 /* Tests                                                                     */
 /*****************************************************************************/
@@ -164,6 +192,23 @@ void test_happy_my_putc(void **state)
 	my_putc('a', stdout);
 }
 
+void test_happy_my_write(void **state)
+{
+	FILE f = { 0 };
+
+	/* Happy path - print to stdout only */
+	expect_function_call(__wrap_fwrite);
+	my_write(NULL, "a", 1);
+
+	/* Happy path - print to a secondary stream */
+	expect_function_calls(__wrap_fwrite, 2);
+	my_write(&f, "a", 1);
+
+	/* Happy path - print to a single stream (stdout specified as secondary) */
+	expect_function_call(__wrap_fwrite);
+	my_write(stdout, "a", 1);
+}
+
 void test_happy_print_divider(void **state)
 {
 	FILE f = { 0 };
@@ -240,7 +285,7 @@ void test_happy_print_table_data(void **state)
 
 void test_fail_print_table_data(void **state)
 {
-	/* Failure path - calloc for `header` fails */
+	/* Failure path - calloc for the table arena fails */
 	WRAPPER_ACTION(FAIL, calloc);
 	assert_int_equal(
 		print_table_data(
@@ -257,15 +302,12 @@ void test_fail_print_table_data(void **state)
 		EXIT_FAILURE
 	);
 
-	/* Failure path - calloc for `header[0]` fails */
-	WRAPPER_ACTION_C(CMOCKA, calloc, 2);
-	will_return(__wrap_calloc, REAL);
-	will_return(__wrap_calloc, FAIL);
+	/* Failure path - invalid `n_rows` argument */
 	assert_int_equal(
 		print_table_data(
 			NULL,
 			3,
-			3,
+			-1,
 			NULL,
 			TABLE_DIVIDER_ALL,
 			populate_values,
@@ -293,70 +335,9 @@ void test_fail_print_table_data(void **state)
 		EXIT_FAILURE
 	);
 
-	/* Failure path - calloc for `rows` fails */
-	will_return(populate_header, EXIT_SUCCESS);
-	WRAPPER_ACTION_C(CMOCKA, calloc, 3);
-	will_return_count(__wrap_calloc, REAL, 2);
-	will_return(__wrap_calloc, FAIL);
-	assert_int_equal(
-		print_table_data(
-			NULL,
-			1,
-			3,
-			NULL,
-			TABLE_DIVIDER_ALL,
-			populate_values,
-			populate_header,
-			NULL,
-			NULL
-		),
-		EXIT_FAILURE
-	);
-
-	/* Failure path - calloc for `rows[0]` fails */
-	will_return(populate_header, EXIT_SUCCESS);
-	WRAPPER_ACTION_C(CMOCKA, calloc, 4);
-	will_return_count(__wrap_calloc, REAL, 3);
-	will_return(__wrap_calloc, FAIL);
-	assert_int_equal(
-		print_table_data(
-			NULL,
-			1,
-			3,
-			NULL,
-			TABLE_DIVIDER_ALL,
-			populate_values,
-			populate_header,
-			NULL,
-			NULL
-		),
-		EXIT_FAILURE
-	);
-
-	/* Failure path - calloc for `rows[0][0]` fails */
-	will_return(populate_header, EXIT_SUCCESS);
-	WRAPPER_ACTION_C(CMOCKA, calloc, 5);
-	will_return_count(__wrap_calloc, REAL, 4);
-	will_return(__wrap_calloc, FAIL);
-	assert_int_equal(
-		print_table_data(
-			NULL,
-			1,
-			3,
-			NULL,
-			TABLE_DIVIDER_ALL,
-			populate_values,
-			populate_header,
-			NULL,
-			NULL
-		),
-		EXIT_FAILURE
-	);
-
 	/* Failure path - `populate_values` fails */
 	will_return(populate_header, EXIT_SUCCESS);
 	will_return(populate_values, EXIT_FAILURE);
-	WRAPPER_ACTION_C(REAL, calloc, 6);
 	assert_int_equal(
 		print_table_data(
 			NULL,
@@ -498,6 +479,113 @@ void test_fail_print_json_data(void **state)
 	);
 }
 
+void test_happy_write_json_data(void **state)
+{
+	struct json_writer writer = { 0 };
+
+	/* Happy path - object opened and closed around the values */
+	expect_function_call(__wrap_jsonw_begin_object);
+	will_return(populate_values, EXIT_SUCCESS);
+	expect_function_call(__wrap_jsonw_end_object);
+	assert_int_equal(
+		write_json_data(
+			NULL, 0, 0, &writer, populate_values, NULL
+		),
+		EXIT_SUCCESS
+	);
+}
+
+void test_fail_write_json_data(void **state)
+{
+	struct json_writer writer = { 0 };
+
+	/* Failure path - invalid `writer` argument */
+	assert_int_equal(
+		write_json_data(
+			NULL, 0, 0, NULL, populate_values, NULL
+		),
+		EXIT_FAILURE
+	);
+
+	/* Failure path - populate_values fails */
+	expect_function_call(__wrap_jsonw_begin_object);
+	will_return(populate_values, EXIT_FAILURE);
+	expect_function_call(__wrap_jsonw_end_object);
+	assert_int_equal(
+		write_json_data(
+			NULL, 0, 0, &writer, populate_values, NULL
+		),
+		EXIT_FAILURE
+	);
+}
+
+void test_happy_print_json_stream_data(void **state)
+{
+	/* Happy path - `print_json_begin` and `print_json_end` both called */
+	will_return(__wrap_jsonw_init, EXIT_SUCCESS);
+	expect_function_call(__wrap_fprintf);
+	expect_function_call(__wrap_jsonw_begin_object);
+	will_return(populate_values, EXIT_SUCCESS);
+	expect_function_call(__wrap_jsonw_end_object);
+	will_return(__wrap_jsonw_finish, EXIT_SUCCESS);
+	expect_function_call(__wrap_fprintf);
+	assert_int_equal(
+		print_json_stream_data(
+			NULL, 0, 0, stdout, populate_values, NULL
+		),
+		EXIT_SUCCESS
+	);
+}
+
+void test_fail_print_json_stream_data(void **state)
+{
+	/* Failure path - invalid `stream` argument */
+	assert_int_equal(
+		print_json_stream_data(
+			NULL, 0, 0, NULL, populate_values, NULL
+		),
+		EXIT_FAILURE
+	);
+
+	/* Failure path - jsonw_init fails */
+	will_return(__wrap_jsonw_init, EXIT_FAILURE);
+	assert_int_equal(
+		print_json_stream_data(
+			NULL, 0, 0, stdout, populate_values, NULL
+		),
+		EXIT_FAILURE
+	);
+
+	/* Failure path - populate_values fails */
+	will_return(__wrap_jsonw_init, EXIT_SUCCESS);
+	expect_function_call(__wrap_fprintf);
+	expect_function_call(__wrap_jsonw_begin_object);
+	will_return(populate_values, EXIT_FAILURE);
+	expect_function_call(__wrap_jsonw_end_object);
+	will_return(__wrap_jsonw_finish, EXIT_SUCCESS);
+	expect_function_call(__wrap_fprintf);
+	assert_int_equal(
+		print_json_stream_data(
+			NULL, 0, 0, stdout, populate_values, NULL
+		),
+		EXIT_FAILURE
+	);
+
+	/* Failure path - document incomplete */
+	will_return(__wrap_jsonw_init, EXIT_SUCCESS);
+	expect_function_call(__wrap_fprintf);
+	expect_function_call(__wrap_jsonw_begin_object);
+	will_return(populate_values, EXIT_SUCCESS);
+	expect_function_call(__wrap_jsonw_end_object);
+	will_return(__wrap_jsonw_finish, EXIT_FAILURE);
+	assert_int_equal(
+		print_json_stream_data(
+			NULL, 0, 0, stdout, populate_values, NULL
+		),
+		EXIT_FAILURE
+	);
+}
+
 /*****************************************************************************/
 
 int main(void)
@@ -505,6 +593,7 @@ int main(void)
 	const struct CMUnitTest tests[] = {
 		cmocka_unit_test(test_happy_my_fprintf),
 		cmocka_unit_test(test_happy_my_putc),
+		cmocka_unit_test(test_happy_my_write),
 		cmocka_unit_test(test_happy_print_divider),
 		cmocka_unit_test(test_happy_print_hexdump),
 		cmocka_unit_test(test_fail_print_hexdump),
@@ -516,6 +605,10 @@ int main(void)
 		cmocka_unit_test(test_fail_print_json_obj),
 		cmocka_unit_test(test_happy_print_json_data),
 		cmocka_unit_test(test_fail_print_json_data),
+		cmocka_unit_test(test_happy_write_json_data),
+		cmocka_unit_test(test_fail_write_json_data),
+		cmocka_unit_test(test_happy_print_json_stream_data),
+		cmocka_unit_test(test_fail_print_json_stream_data),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
@@ -335,30 +335,29 @@ int __wrap_ami_sensor_get_num_total(ami_device *dev, int *num)
 	return (int)mock();
 }
 
-/* Json lib */
+/* Json writer */
 
-JsonNode *__wrap_json_mknull(void)
+void __wrap_jsonw_begin_object(struct json_writer *writer)
 {
 
 }
 
-JsonNode *__wrap_json_mknumber(double n)
+void __wrap_jsonw_end_object(struct json_writer *writer)
 {
 
 }
 
-JsonNode *__wrap_json_mkobject(void)
+void __wrap_jsonw_key(struct json_writer *writer, const char *key)
 {
-	static JsonNode node = { 0 };
-	return &node;
+
 }
 
-void __wrap_json_append_member(JsonNode *object, const char *key, JsonNode *value)
+void __wrap_jsonw_number(struct json_writer *writer, double num)
 {
 
 }
 
-void __wrap_json_delete(JsonNode *node)
+void __wrap_jsonw_null(struct json_writer *writer)
 {
 
 }
@@ -372,22 +371,25 @@ int __wrap_print_table_data(ami_device *dev, int n_fields, int n_rows, FILE *str
 	return (int)mock();
 }
 
-int __wrap_print_json_data(ami_device *dev, int n_fields, int n_rows, FILE *stream,
+int __wrap_print_json_stream_data(ami_device *dev, int n_fields, int n_rows, FILE *stream,
 	app_value_builder populate_values, void *data)
 {
 	return 0;
 }
 
-int __wrap_print_json_obj(JsonNode *obj, FILE *stream)
+int __wrap_print_json_begin(struct json_writer *writer, FILE *stream)
+{
+	return 0;
+}
+
+int __wrap_print_json_end(struct json_writer *writer)
 {
 	return 0;
 }
 
-int __wrap_gen_json_data(ami_device *dev, int n_fields, int n_rows,
-	app_value_builder populate_values, void *data, JsonNode **out)
+int __wrap_write_json_data(ami_device *dev, int n_fields, int n_rows,
+	struct json_writer *writer, app_value_builder populate_values, void *data)
 {
-	static JsonNode node = { 0 };
-	*out = &node;
 	return 0;
 }
 
@@ -791,7 +793,7 @@ void test_fail_print_sensor_data(void **state)
 void test_fail_static_print_sensor_data(void **state)
 {
 	ami_device *dev = (ami_device*)1;
-	JsonNode **out = (JsonNode**)1;
+	struct json_writer *out = (struct json_writer*)1;
 
 	/* Failure path - invalid `dev` argument */
 	assert_int_equal(
@@ -1405,7 +1407,7 @@ void test_fail_static_construct_sensor_table(void **state)
 void test_fail_static_mk_sensor_node(void **state)
 {
 	ami_device *dev = (ami_device*)1;
-	JsonNode node = { 0 };
+	struct json_writer node = { 0 };
 
 	/* Failure path - invalid `dev` argument */
 	assert_int_equal(
@@ -1431,7 +1433,7 @@ void test_fail_static_mk_sensor_node(void **state)
 		EXIT_FAILURE
 	);
 
-	/* Failure path - invalid `parent` argument */
+	/* Failure path - invalid `writer` argument */
 	assert_int_equal(
 		mk_sensor_node(
 			dev,
@@ -1460,7 +1462,7 @@ void test_fail_static_construct_sensor_json(void **state)
 {
 	ami_device *dev = (ami_device*)1;
 	int j = 0;
-	JsonNode node = { 0 };
+	struct json_writer node = { 0 };
 
 	/* Failure path - invalid `j` argument */
 	assert_int_equal(
@@ -1474,7 +1476,7 @@ void test_fail_static_construct_sensor_json(void **state)
 		EXIT_FAILURE
 	);
 
-	/* Failure path - invalid `parent` argument */
+	/* Failure path - invalid `writer` argument */
 	assert_int_equal(
 		construct_sensor_json(
 			dev,
@@ -1535,7 +1537,7 @@ void test_happy_static_populate_sensor_values(void **state)
 	char *row[5] = { 0 };
 	char ***values = NULL;
 	/* JSON data */
-	JsonNode node = { 0 };
+	struct json_writer node = { 0 };
 
 	for (i = 0; i < 5; i++) {
 		row[i] = calloc(10, sizeof(char));
@@ -28,24 +28,35 @@
 /* App includes */
 #include "table.h"
 
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define OUTPUT_MAX	(1024)
+
 /*****************************************************************************/
 /* Global variables                                                          */
 /*****************************************************************************/
 
 static struct wrapper w_calloc = { REAL, REAL, 0, 0 };
 
+/* Everything passed to `my_write` since the last `reset_output` */
+static char output[OUTPUT_MAX] = { 0 };
+static size_t output_len = 0;
+
 /*****************************************************************************/
 /* Redefinitions/Wrapping                                                    */
 /*****************************************************************************/
 
-void __wrap_print_divider(const char c, uint8_t len, FILE *stream)
+void __wrap_my_write(FILE *stream, const char *buf, size_t len)
 {
 	function_called();
-}
 
-void __wrap_my_fprintf(FILE *stream, const char *format, ...)
-{
-	function_called();
+	if ((output_len + len) < OUTPUT_MAX) {
+		memcpy(&output[output_len], buf, len);
+		output_len += len;
+		output[output_len] = '\0';
+	}
 }
 
 extern void *__real_calloc(size_t num, size_t size);
@@ -69,6 +80,16 @@ void *__wrap_calloc(size_t num, size_t size)
 	return ret;
 }
 
+/*****************************************************************************/
+/* Local functions                                                           */
+/*****************************************************************************/
+
+static void reset_output(void)
+{
+	output[0] = '\0';
+	output_len = 0;
+}
+
 /*****************************************************************************/
 /* Tests                                                                     */
 /*****************************************************************************/
@@ -76,38 +97,65 @@ void *__wrap_calloc(size_t num, size_t size)
 void test_happy_print_table_row(void **state)
 {
 	char *values[] = { "a", "b" };
-	int col_widths[] = { 2 };
+	char *sparse[] = { "a", "" };
+	char *wide[] = { "abcd" };
+	int col_widths[] = { 2, 2 };
 	int right_align[] = { TABLE_ALIGN_RIGHT, TABLE_ALIGN_RIGHT };
 	int left_align[] = { TABLE_ALIGN_LEFT, TABLE_ALIGN_LEFT };
 
 	/* Happy path - no divider, no alignment specified */
-	expect_function_calls(__wrap_my_fprintf, 3);  /* 2 columns + newline */
+	reset_output();
+	expect_function_call(__wrap_my_write);
 	assert_int_equal(
 		print_table_row(2, values, col_widths, 0, 0, false, NULL, NULL),
 		EXIT_SUCCESS
 	);
+	assert_string_equal(output, "a  | b \r\n");
 
 	/* Happy path - with divider, no alignment specified */
-	expect_function_call(__wrap_print_divider);
-	expect_function_calls(__wrap_my_fprintf, 3);
+	reset_output();
+	expect_function_call(__wrap_my_write);
 	assert_int_equal(
-		print_table_row(2, values, col_widths, 0, 0, true, NULL, NULL),
+		print_table_row(2, values, col_widths, 0, 7, true, NULL, NULL),
 		EXIT_SUCCESS
 	);
+	assert_string_equal(output, "-------\r\na  | b \r\n");
 
 	/* Happy path - no divider, right aligned */
-	expect_function_calls(__wrap_my_fprintf, 3);
+	reset_output();
+	expect_function_call(__wrap_my_write);
 	assert_int_equal(
 		print_table_row(2, values, col_widths, 0, 0, false, NULL, right_align),
 		EXIT_SUCCESS
 	);
+	assert_string_equal(output, " a |  b\r\n");
 
 	/* Happy path - no divider, left aligned */
-	expect_function_calls(__wrap_my_fprintf, 3);
+	reset_output();
+	expect_function_call(__wrap_my_write);
 	assert_int_equal(
 		print_table_row(2, values, col_widths, 0, 0, false, NULL, left_align),
 		EXIT_SUCCESS
 	);
+	assert_string_equal(output, "a  | b \r\n");
+
+	/* Happy path - empty columns (other than the first) are skipped */
+	reset_output();
+	expect_function_call(__wrap_my_write);
+	assert_int_equal(
+		print_table_row(2, sparse, col_widths, 1, 0, false, NULL, NULL),
+		EXIT_SUCCESS
+	);
+	assert_string_equal(output, "a  \r\n");
+
+	/* Happy path - values wider than the column are not truncated */
+	reset_output();
+	expect_function_call(__wrap_my_write);
+	assert_int_equal(
+		print_table_row(1, wide, col_widths, 0, 0, false, NULL, NULL),
+		EXIT_SUCCESS
+	);
+	assert_string_equal(output, "abcd\r\n");
 }
 
 void test_fail_print_table_row(void **state)
@@ -126,86 +174,121 @@ void test_fail_print_table_row(void **state)
 		print_table_row(0, NULL, col_widths, 0, 0, false, NULL, NULL),
 		EXIT_FAILURE
 	);
+
+	/* Failure path - calloc fails */
+	WRAPPER_ACTION(FAIL, calloc);
+	assert_int_equal(
+		print_table_row(1, values, col_widths, 0, 0, false, NULL, NULL),
+		EXIT_FAILURE
+	);
 }
 
 void test_happy_print_table(void **state)
 {
-	int i = 0, j = 0;
 	char *header[] = { "a", "b" };
 	char* row1[] = { "a", "ab" };
 	char* row2[] = { "c", "cd" };
 	char* row3[] = { "", "ef" };
 	char** values[] = { row1, row2, row3 };
+	int right_align[] = { TABLE_ALIGN_LEFT, TABLE_ALIGN_RIGHT };
 
 	/*
-	 * Happy path - TABLE_DIVIDER_HEADER_ONLY
-	 *
-	 * Will print the following:
-	 * whitespace
-	 * header (2 columns)
+	 * Every table is written with a single call and looks like this:
 	 * whitespace
-	 * divider
+	 * header
 	 * then, for each row (3):
-	 *   each row element (2)
-	 *   whitespace
+	 *   divider (depending on the format)
+	 *   row
 	 * whitespace
 	 */
-	expect_function_calls(__wrap_my_fprintf, 4);
-	expect_function_call(__wrap_print_divider);
-	expect_function_calls(__wrap_my_fprintf, 10);
+
+	/* Happy path - TABLE_DIVIDER_HEADER_ONLY */
+	reset_output();
+	expect_function_call(__wrap_my_write);
 	assert_int_equal(
 		print_table(header, values, 2, 3, TABLE_DIVIDER_HEADER_ONLY, NULL, NULL),
 		EXIT_SUCCESS
 	);
+	assert_string_equal(
+		output,
+		"\r\n"
+		"a   | b   \r\n"
+		"----------\r\n"
+		"a   | ab  \r\n"
+		"c   | cd  \r\n"
+		"    | ef  \r\n"
+		"\r\n"
+	);
 
-	/*
-	 * Happy path - TABLE_DIVIDER_ALL
-	 *
-	 * Will print the following:
-	 * whitespace
-	 * header (2 columns)
-	 * whitespace
-	 * then, for each row (3):
-	 *   divider
-	 *   each row element (2)
-	 *   whitespace
-	 * whitespace
-	 */
-	expect_function_calls(__wrap_my_fprintf, 4);
-	for (i = 0; i < 3; i++) {
-		expect_function_call(__wrap_print_divider);
-		expect_function_calls(__wrap_my_fprintf, 3);
-	}
-	expect_function_call(__wrap_my_fprintf);
+	/* Happy path - TABLE_DIVIDER_ALL */
+	reset_output();
+	expect_function_call(__wrap_my_write);
 	assert_int_equal(
 		print_table(header, values, 2, 3, TABLE_DIVIDER_ALL, NULL, NULL),
 		EXIT_SUCCESS
 	);
+	assert_string_equal(
+		output,
+		"\r\n"
+		"a   | b   \r\n"
+		"----------\r\n"
+		"a   | ab  \r\n"
+		"----------\r\n"
+		"c   | cd  \r\n"
+		"----------\r\n"
+		"    | ef  \r\n"
+		"\r\n"
+	);
 
 	/*
-	 * Happy path - TABLE_DIVIDER_ALL
+	 * Happy path - TABLE_DIVIDER_GROUPS
 	 * Will print same as above but without the final divider.
 	 */
-	expect_function_calls(__wrap_my_fprintf, 4);
-	for (i = 0; i < 3; i++) {
-		if (i != 2)
-			expect_function_call(__wrap_print_divider);
-		expect_function_calls(__wrap_my_fprintf, 3);
-	}
-	expect_function_call(__wrap_my_fprintf);
+	reset_output();
+	expect_function_call(__wrap_my_write);
 	assert_int_equal(
 		print_table(header, values, 2, 3, TABLE_DIVIDER_GROUPS, NULL, NULL),
 		EXIT_SUCCESS
 	);
+	assert_string_equal(
+		output,
+		"\r\n"
+		"a   | b   \r\n"
+		"----------\r\n"
+		"a   | ab  \r\n"
+		"----------\r\n"
+		"c   | cd  \r\n"
+		"    | ef  \r\n"
+		"\r\n"
+	);
 
 	/* Happy path - unknown divider format (hit default branch)
 	 * Will print no dividers at all.
 	 */
-	expect_function_calls(__wrap_my_fprintf, 14);
+	reset_output();
+	expect_function_call(__wrap_my_write);
+	assert_int_equal(
+		print_table(header, values, 2, 3, 100, NULL, right_align),
+		EXIT_SUCCESS
+	);
+	assert_string_equal(
+		output,
+		"\r\n"
+		"a   |    b\r\n"
+		"a   |   ab\r\n"
+		"c   |   cd\r\n"
+		"    |   ef\r\n"
+		"\r\n"
+	);
+
+	/* Happy path - header only */
+	reset_output();
+	expect_function_call(__wrap_my_write);
 	assert_int_equal(
-		print_table(header, values, 2, 3, 100, NULL, NULL),
+		print_table(header, values, 2, 0, TABLE_DIVIDER_ALL, NULL, NULL),
 		EXIT_SUCCESS
 	);
+	assert_string_equal(output, "\r\na   | b  \r\n\r\n");
 }
 
 void test_fail_print_table(void **state)
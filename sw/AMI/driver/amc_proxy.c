@@ -12,6 +12,7 @@
 #include <linux/kthread.h>
 #include <linux/delay.h>
 #include <linux/slab.h>
+#include <linux/timekeeping.h>
 
 
 #include "amc_proxy.h"
@@ -43,6 +44,9 @@
  * @AMC_PROXY_CMD_OPCODE_EEPROM_READ_WRITE: eeprom read/write request
  * @AMC_PROXY_CMD_OPCODE_MODULE_READ_WRITE: module read/write request
  * @AMC_PROXY_CMD_OPCODE_DEBUG_VERBOSITY: debug verbosity set request
+ * @AMC_PROXY_CMD_OPCODE_EEPROM_BULK_READ_WRITE: eeprom bulk read/write request
+ * @AMC_PROXY_CMD_OPCODE_MODULE_SG_READ: module scatter-gather read request
+ * @AMC_PROXY_CMD_OPCODE_TASK_PROFILE: task profile request
  * @AMC_PROXY_CMD_OPCODE_PDI_DOWNLOAD: pdi download
  * @AMC_PROXY_CMD_OPCODE_SENSOR: sensor request
  * @AMC_PROXY_CMD_OPCODE_PARTITION_COPY: partition copy request
@@ -54,6 +58,9 @@ enum amc_proxy_cmd_opcode {
     AMC_PROXY_CMD_OPCODE_EEPROM_READ_WRITE = 0x3,
     AMC_PROXY_CMD_OPCODE_MODULE_READ_WRITE = 0x4,
     AMC_PROXY_CMD_OPCODE_DEBUG_VERBOSITY   = 0x5,
+    AMC_PROXY_CMD_OPCODE_EEPROM_BULK_READ_WRITE = 0x6,
+    AMC_PROXY_CMD_OPCODE_MODULE_SG_READ    = 0x7,
+    AMC_PROXY_CMD_OPCODE_TASK_PROFILE      = 0x8,
     AMC_PROXY_CMD_OPCODE_PDI_DOWNLOAD      = 0xA,
     AMC_PROXY_CMD_OPCODE_SENSOR            = 0xC,
     AMC_PROXY_CMD_OPCODE_PARTITION_COPY    = 0xD,
@@ -279,6 +286,23 @@ struct amc_proxy_cmd_eeprom_payload {
         uint32_t resvd:15;
 };
 
+/**
+ * struct amc_proxy_cmd_eeprom_bulk_payload: eeprom bulk request payload command
+ *
+ * @address: data that needs to be transferred
+ * @len: the number of bytes to read/write
+ * @offset: the 16-bit offset into the eeprom address space
+ * @req_type: the request type, read or write
+ * @resvd: reserved for future use
+ */
+struct amc_proxy_cmd_eeprom_bulk_payload {
+        uint64_t address;
+        uint32_t len;
+        uint32_t offset:16;
+        uint32_t req_type:1;
+        uint32_t resvd:15;
+};
+
 /**
  * struct amc_proxy_cmd_eeprom_payload: eeprom request payload command
  *
@@ -300,6 +324,32 @@ struct amc_proxy_cmd_module_payload {
         uint32_t resvd:31;
 };
 
+/**
+ * struct amc_proxy_cmd_module_sg_payload: module scatter-gather read payload command
+ *
+ * @address: address in shared memory of the descriptor list and data
+ * @len: total size of the shared memory region
+ * @num_entries: number of descriptors at the start of the region
+ * @resvd: reserved for future use
+ */
+struct amc_proxy_cmd_module_sg_payload {
+        uint64_t address;
+        uint32_t len;
+        uint32_t num_entries:16;
+        uint32_t resvd:16;
+};
+
+/**
+ * struct amc_proxy_cmd_task_profile_payload: task profile payload command
+ *
+ * @address: address in shared memory to write the task profiles to
+ * @len: size of the shared memory region
+ */
+struct amc_proxy_cmd_task_profile_payload {
+        uint64_t address;
+        uint32_t len;
+};
+
 /**
  * struct amc_proxy_cmd_heartbeat_payload: heartbeat request payload command
  *
@@ -317,7 +367,10 @@ struct amc_proxy_cmd_heartbeat_payload {
  * @pdi_payload: the pdi download payload (also used for boot select)
  * @heartbeat_payload: the heartbeat request payload
  * @eeprom_payload: the eeprom read/write request payload
+ * @eeprom_bulk_payload: the eeprom bulk read/write request payload
  * @module_payload: the module read/write request payload
+ * @module_sg_payload: the module scatter-gather read request payload
+ * @task_profile_payload: the task profile request payload
  * @debug_verbosity_payload: the debug verbosity request payload
  */
 struct amc_proxy_cmd_request {
@@ -327,7 +380,10 @@ struct amc_proxy_cmd_request {
                 struct amc_proxy_cmd_data_payload pdi_payload;
                 struct amc_proxy_cmd_heartbeat_payload heartbeat_payload;
                 struct amc_proxy_cmd_eeprom_payload eeprom_payload;
+                struct amc_proxy_cmd_eeprom_bulk_payload eeprom_bulk_payload;
                 struct amc_proxy_cmd_module_payload module_payload;
+                struct amc_proxy_cmd_module_sg_payload module_sg_payload;
+                struct amc_proxy_cmd_task_profile_payload task_profile_payload;
                 uint8_t debug_verbosity_payload;
 	};
 };
@@ -398,6 +454,17 @@ struct amc_proxy_cmd_resp_heartbeat_payload {
         uint32_t resvd;
 };
 
+/**
+ * struct amc_proxy_cmd_resp_task_profile_payload: task profile response payload
+ *
+ * @num_tasks: the number of profiles written to shared memory
+ * @resvd: reserved
+ */
+struct amc_proxy_cmd_resp_task_profile_payload {
+        uint32_t num_tasks;
+        uint32_t resvd;
+};
+
 /**
  * struct amc_proxy_cmd_resp_eeprom_read_write_payload: eeprom read/write completion payload
  *
@@ -429,6 +496,7 @@ struct amc_proxy_cmd_resp_module_read_write_payload {
  * @sensor_payload: sensor completion payload
  * @pdi_payload: pdi download payload
  * @heartbeat_payload: heartbeat completion payload
+ * @task_profile_payload: task profile completion payload
  * @ret: response return code
  */
 struct amc_proxy_cmd_response {
@@ -439,6 +507,7 @@ struct amc_proxy_cmd_response {
                 struct amc_proxy_cmd_resp_sensor_payload sensor_payload;
                 struct amc_proxy_cmd_resp_data_payload pdi_payload;
                 struct amc_proxy_cmd_resp_heartbeat_payload heartbeat_payload;
+                struct amc_proxy_cmd_resp_task_profile_payload task_profile_payload;
 	};
         uint32_t ret;
 };
@@ -531,12 +600,14 @@ static int amc_result_to_linux_errno(enum amc_proxy_result res)
  * amc_proxy_cmd_complete() - handle the completion command response
  * @ccmd: the completion command
  * @inst: the proxy instance
+ * @idle_ns: time the response queue was last found empty
  *
  * Find the matching cmd from submitted_cmd list using the cid
  * remove it and then invoke registered dcallback
  *
  */
-static void amc_proxy_cmd_complete(struct amc_proxy_instance *inst, struct com_queue_entry *ccmd)
+static void amc_proxy_cmd_complete(struct amc_proxy_instance *inst, struct com_queue_entry *ccmd,
+                                   uint64_t idle_ns)
 {
 	struct amc_proxy_cmd_struct *cmd = NULL;
 	struct list_head *pos = NULL, *next = NULL;
@@ -559,6 +630,8 @@ static void amc_proxy_cmd_complete(struct amc_proxy_instance *inst, struct com_q
 		                sizeof(cmd_resp->default_payload));
                         
                         cmd->cmd_response_code = cmd_resp->ret;
+                        cmd->cmd_poll_ns = idle_ns;
+                        cmd->cmd_complete_ns = ktime_get_ns();
 
                         /* Suppress hearbeat message so as not to flood dmesg */
                         if (cmd->cmd_suppress_dbg == false) {
@@ -734,6 +807,7 @@ static int complete_response_thread(void *data)
         uint32_t ccmd_size = sizeof(struct com_queue_entry);
         struct amc_proxy_instance *amc_proxy_inst = NULL;
         bool response_failed = false;
+        uint64_t idle_ns = 0;
 
         if (!data) {
                 PR_ERR("Response thread null data arg");
@@ -746,6 +820,8 @@ static int complete_response_thread(void *data)
 
                 if (response_failed == false) {
 
+                        uint64_t poll_ns = ktime_get_ns();
+
                         /* Perform the read from the FW_IF */
                         if (amc_proxy_inst->fw_if_handle->read(amc_proxy_inst->fw_if_handle, 0,
                                                         (uint8_t*)&ccmd,
@@ -754,7 +830,10 @@ static int complete_response_thread(void *data)
                                 * Get the entry from submitted_cmds list,
                                 * remove and invoke callback
                                 */
-                                amc_proxy_cmd_complete(amc_proxy_inst, &ccmd);
+                                amc_proxy_cmd_complete(amc_proxy_inst, &ccmd, idle_ns);
+                        } else {
+                                /* A response arriving after this was waiting on the poll loop */
+                                idle_ns = poll_ns;
                         }
 
                         /* Check for any commands that might have timed out & notify via callback */
@@ -1283,6 +1362,48 @@ int amc_proxy_request_eeprom_read_write(struct amc_proxy_cmd_struct *cmd,
         return ret;
 }
 
+/*
+ * Generate eeprom bulk read/write request
+ */
+int amc_proxy_request_eeprom_bulk_read_write(struct amc_proxy_cmd_struct *cmd,
+                                             struct amc_proxy_eeprom_rw_request *eeprom_rw)
+{
+        struct amc_proxy_list_entry *amc_ctxt = NULL;
+        int ret = -EPERM;
+
+        if (!cmd || !eeprom_rw)
+                return -EINVAL;
+
+        amc_ctxt = amc_proxy_find_matching_proxy_instance(cmd->cmd_fw_if_gcq);
+        if (amc_ctxt && amc_ctxt->inst.initialised) {
+
+                struct amc_proxy_cmd_request request_cmd_entry = {{{{0}}}};
+                struct amc_proxy_cmd_request_hdr *request_hdr = NULL;
+                request_hdr = &(request_cmd_entry.hdr);
+                request_hdr->state = AMC_PROXY_REQUEST_CMD_NEW;
+                request_hdr->opcode = AMC_PROXY_CMD_OPCODE_EEPROM_BULK_READ_WRITE;
+                request_hdr->count = sizeof(request_cmd_entry.eeprom_bulk_payload);
+                request_hdr->cid = cmd->cmd_cid;
+                request_cmd_entry.eeprom_bulk_payload.req_type = eeprom_rw->type;
+                request_cmd_entry.eeprom_bulk_payload.address = eeprom_rw->address;
+                request_cmd_entry.eeprom_bulk_payload.len = eeprom_rw->length;
+                request_cmd_entry.eeprom_bulk_payload.offset = eeprom_rw->offset;
+                ret = amc_ctxt->inst.fw_if_handle->write(amc_ctxt->inst.fw_if_handle, 0,
+                                                         (uint8_t*)&(request_cmd_entry),
+                                                         sizeof(request_cmd_entry), 0);
+                if (ret == FW_IF_ERRORS_NONE) {
+                        mutex_lock(&(amc_ctxt->inst.lock));
+                        list_add_tail(&(cmd->cmd_list), &(amc_ctxt->inst.submitted_cmds));
+                        mutex_unlock(&(amc_ctxt->inst.lock));
+                } else {
+                        PR_ERR("FW_IF write request failed; %d", ret);
+                        ret = -EIO;
+                }
+        }
+
+        return ret;
+}
+
 /*
  * Generate a module read/write request
  */
@@ -1327,6 +1448,87 @@ int amc_proxy_request_module_read_write(struct amc_proxy_cmd_struct *cmd,
         return ret;
 }
 
+/*
+ * Generate a module scatter-gather read request
+ */
+int amc_proxy_request_module_sg_read(struct amc_proxy_cmd_struct *cmd,
+                                     struct amc_proxy_module_sg_request *module_sg)
+{
+        struct amc_proxy_list_entry *amc_ctxt = NULL;
+        int ret = -EPERM;
+
+        if (!cmd || !module_sg)
+                return -EINVAL;
+
+        amc_ctxt = amc_proxy_find_matching_proxy_instance(cmd->cmd_fw_if_gcq);
+        if (amc_ctxt && amc_ctxt->inst.initialised) {
+
+                struct amc_proxy_cmd_request request_cmd_entry = {{{{0}}}};
+                struct amc_proxy_cmd_request_hdr *request_hdr = NULL;
+                request_hdr = &(request_cmd_entry.hdr);
+                request_hdr->state = AMC_PROXY_REQUEST_CMD_NEW;
+                request_hdr->opcode = AMC_PROXY_CMD_OPCODE_MODULE_SG_READ;
+                request_hdr->count = sizeof(request_cmd_entry.module_sg_payload);
+                request_hdr->cid = cmd->cmd_cid;
+                request_cmd_entry.module_sg_payload.address = module_sg->address;
+                request_cmd_entry.module_sg_payload.len = module_sg->length;
+                request_cmd_entry.module_sg_payload.num_entries = module_sg->num_entries;
+                ret = amc_ctxt->inst.fw_if_handle->write(amc_ctxt->inst.fw_if_handle, 0,
+                                                         (uint8_t*)&(request_cmd_entry),
+                                                         sizeof(request_cmd_entry), 0);
+                if (ret == FW_IF_ERRORS_NONE) {
+                        mutex_lock(&(amc_ctxt->inst.lock));
+                        list_add_tail(&(cmd->cmd_list), &(amc_ctxt->inst.submitted_cmds));
+                        mutex_unlock(&(amc_ctxt->inst.lock));
+                } else {
+                        PR_ERR("FW_IF write request failed; %d", ret);
+                        ret = -EIO;
+                }
+        }
+
+        return ret;
+}
+
+/*
+ * Generate a task profile request
+ */
+int amc_proxy_request_task_profile(struct amc_proxy_cmd_struct *cmd,
+                                   struct amc_proxy_task_profile_request *task_profile)
+{
+        struct amc_proxy_list_entry *amc_ctxt = NULL;
+        int ret = -EPERM;
+
+        if (!cmd || !task_profile)
+                return -EINVAL;
+
+        amc_ctxt = amc_proxy_find_matching_proxy_instance(cmd->cmd_fw_if_gcq);
+        if (amc_ctxt && amc_ctxt->inst.initialised) {
+
+                struct amc_proxy_cmd_request request_cmd_entry = {{{{0}}}};
+                struct amc_proxy_cmd_request_hdr *request_hdr = NULL;
+                request_hdr = &(request_cmd_entry.hdr);
+                request_hdr->state = AMC_PROXY_REQUEST_CMD_NEW;
+                request_hdr->opcode = AMC_PROXY_CMD_OPCODE_TASK_PROFILE;
+                request_hdr->count = sizeof(request_cmd_entry.task_profile_payload);
+                request_hdr->cid = cmd->cmd_cid;
+                request_cmd_entry.task_profile_payload.address = task_profile->address;
+                request_cmd_entry.task_profile_payload.len = task_profile->length;
+                ret = amc_ctxt->inst.fw_if_handle->write(amc_ctxt->inst.fw_if_handle, 0,
+                                                         (uint8_t*)&(request_cmd_entry),
+                                                         sizeof(request_cmd_entry), 0);
+                if (ret == FW_IF_ERRORS_NONE) {
+                        mutex_lock(&(amc_ctxt->inst.lock));
+                        list_add_tail(&(cmd->cmd_list), &(amc_ctxt->inst.submitted_cmds));
+                        mutex_unlock(&(amc_ctxt->inst.lock));
+                } else {
+                        PR_ERR("FW_IF write request failed; %d", ret);
+                        ret = -EIO;
+                }
+        }
+
+        return ret;
+}
+
 /*
  * Generate a debug verbosity request
  */
@@ -1516,6 +1718,30 @@ int amc_proxy_get_response_heartbeat(struct amc_proxy_cmd_struct *cmd,
         return ret;
 }
 
+/*
+ * Read back the task profile response
+ */
+int amc_proxy_get_response_task_profile(struct amc_proxy_cmd_struct *cmd,
+                                        struct amc_proxy_task_profile_response *task_profile)
+{
+        struct amc_proxy_list_entry *amc_ctxt = NULL;
+        int ret = -EPERM;
+
+        if (!cmd || !task_profile)
+                return -EINVAL;
+
+        amc_ctxt = amc_proxy_find_matching_proxy_instance(cmd->cmd_fw_if_gcq);
+        if (amc_ctxt && amc_ctxt->inst.initialised) {
+                struct amc_proxy_cmd_resp_task_profile_payload *task_profile_payload =
+                        (struct amc_proxy_cmd_resp_task_profile_payload *)&cmd->cmd_response;
+
+                task_profile->num_tasks = task_profile_payload->num_tasks;
+                ret = amc_result_to_linux_errno(cmd->cmd_response_code);
+        }
+
+        return ret;
+}
+
 /*
  * Read back the eeprom read/write response
  */
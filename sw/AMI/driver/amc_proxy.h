@@ -197,12 +197,15 @@ struct amc_proxy_hearbeat_request {
  * @address: the address of memory to be populated with data to be written or read
  * @length: the length of the read/write
  * @offset: offset into the eeprom address space
+ *
+ * The legacy request only carries an 8-bit length and offset; the bulk
+ * request uses the full width of both fields.
  */
 struct amc_proxy_eeprom_rw_request {
     enum amc_proxy_cmd_rw_request type;
     uint64_t address;
-    uint8_t length;
-    uint8_t offset;
+    uint32_t length;
+    uint16_t offset;
 };
 
 /**
@@ -224,6 +227,30 @@ struct amc_proxy_module_rw_request {
         uint8_t length;
 };
 
+/**
+ * struct amc_proxy_module_sg_request: the module scatter-gather read request data
+ *
+ * @address: the address of memory holding the descriptor list followed by the data
+ * @length: total size of the memory region
+ * @num_entries: number of descriptors at the start of the region
+ */
+struct amc_proxy_module_sg_request {
+        uint64_t address;
+        uint32_t length;
+        uint16_t num_entries;
+};
+
+/**
+ * struct amc_proxy_task_profile_request: the task profile request data
+ *
+ * @address: the address of memory to write the task profiles to
+ * @length: size of the memory region
+ */
+struct amc_proxy_task_profile_request {
+        uint64_t address;
+        uint32_t length;
+};
+
 /**
  * struct amc_proxy_identify_response: AMC/GCQ version data
  *
@@ -254,6 +281,15 @@ struct amc_proxy_heartbeat_response {
         uint8_t request_id;
 };
 
+/**
+ * struct amc_proxy_task_profile_response: the task profile response data
+ *
+ * @num_tasks: the number of profiles written to memory
+ */
+struct amc_proxy_task_profile_response {
+        uint32_t num_tasks;
+};
+
 /**
  * struct amc_proxy_cmd_struct: dynamically allocated per command request/response
  *
@@ -270,6 +306,13 @@ struct amc_proxy_heartbeat_response {
  * @cmd_suppress_dbg: flag to indicate debug suppressed for command
  * @cmd_opcode: opcode associated with the command
  * @timed_out: boolean indicating if this command timed out
+ * @cmd_submit_ns: time the caller started building the request
+ * @cmd_dispatch_ns: time the caller acquired the GCQ and wrote the request
+ * @cmd_poll_ns: time the response thread last found the queue empty
+ * @cmd_complete_ns: time the response thread consumed the response
+ *
+ * The timestamps are ktime_get_ns() values, or 0 if the stage was not
+ * reached; they are only used for latency accounting.
  */
 struct amc_proxy_cmd_struct{
 	struct list_head        cmd_list;
@@ -285,6 +328,10 @@ struct amc_proxy_cmd_struct{
         bool                    cmd_suppress_dbg;
         uint32_t                cmd_opcode;
         bool                    timed_out;
+        uint64_t                cmd_submit_ns;
+        uint64_t                cmd_dispatch_ns;
+        uint64_t                cmd_poll_ns;
+        uint64_t                cmd_complete_ns;
 };
 
 
@@ -408,6 +455,19 @@ int amc_proxy_request_heartbeat(struct amc_proxy_cmd_struct *cmd,
 int amc_proxy_request_eeprom_read_write(struct amc_proxy_cmd_struct *cmd,
                                         struct amc_proxy_eeprom_rw_request *eeprom_rw);
 
+/**
+ * amc_proxy_request_eeprom_bulk_read_write() - eeprom bulk read/write request
+ * @cmd: the proxy command structure
+ * @eeprom_rw: a structure populated with the eeprom read/write request
+ *
+ * Unlike amc_proxy_request_eeprom_read_write() the offset is 16 bits and the
+ * length 32 bits; the AMC coalesces the transfer into page-sized writes.
+ * The response is read back with amc_proxy_get_response_eeprom_read_write().
+ * Return: The errno return code
+ */
+int amc_proxy_request_eeprom_bulk_read_write(struct amc_proxy_cmd_struct *cmd,
+                                             struct amc_proxy_eeprom_rw_request *eeprom_rw);
+
 /**
  * amc_proxy_request_module_read_write() - module read/write request
  *
@@ -419,6 +479,30 @@ int amc_proxy_request_eeprom_read_write(struct amc_proxy_cmd_struct *cmd,
 int amc_proxy_request_module_read_write(struct amc_proxy_cmd_struct *cmd,
                                         struct amc_proxy_module_rw_request *module_rw);
 
+/**
+ * amc_proxy_request_module_sg_read() - module scatter-gather read request
+ * @cmd: the proxy command structure
+ * @module_sg: a structure populated with the module scatter-gather request
+ *
+ * The AMC reads every descriptor in the list and packs the data after the
+ * list, writing a per-entry result into each descriptor. The response is read
+ * back with amc_proxy_get_response_module_read_write().
+ * Return: The errno return code
+ */
+int amc_proxy_request_module_sg_read(struct amc_proxy_cmd_struct *cmd,
+                                     struct amc_proxy_module_sg_request *module_sg);
+
+/**
+ * amc_proxy_request_task_profile() - task profile request
+ * @cmd: the proxy command structure
+ * @task_profile: a structure populated with the task profile request
+ *
+ * The AMC writes one profile per task to the memory region.
+ * Return: The errno return code
+ */
+int amc_proxy_request_task_profile(struct amc_proxy_cmd_struct *cmd,
+                                   struct amc_proxy_task_profile_request *task_profile);
+
 /**
  * amc_proxy_request_debug_verbosity() - debug verbosity request
  *
@@ -512,6 +596,17 @@ int amc_proxy_get_response_eeprom_read_write(struct amc_proxy_cmd_struct *cmd);
  */
 int amc_proxy_get_response_module_read_write(struct amc_proxy_cmd_struct *cmd);
 
+/**
+ * amc_proxy_get_response_task_profile() - retrieve the task profile response
+ *
+ * @cmd: the proxy command structure
+ * @task_profile: the structure to be populated with the response
+ *
+ * Return: The errno return code
+ */
+int amc_proxy_get_response_task_profile(struct amc_proxy_cmd_struct *cmd,
+                                        struct amc_proxy_task_profile_response *task_profile);
+
 /**
  * amc_proxy_get_response_debug_verbosity() - retrieve debug verbosity response
  *
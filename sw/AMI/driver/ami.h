@@ -20,6 +20,13 @@
 /* Enables debug messages in dmesg */
 extern bool ami_debug_enabled;
 
+/* Enables forwarding of AMC log messages to dmesg */
+extern bool amc_log_dmesg_enabled;
+
+/* Top level debugfs directory - may be NULL if debugfs is unavailable */
+struct dentry;
+extern struct dentry *ami_debugfs_root;
+
 #undef pr_fmt
 #define pr_fmt(fmt) KBUILD_MODNAME ": " fmt
 
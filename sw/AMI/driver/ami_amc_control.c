@@ -7,6 +7,7 @@
 
 #include <linux/kthread.h>
 #include <linux/delay.h>
+#include <linux/ktime.h>
 #include <linux/device.h>
 #include <linux/types.h>
 
@@ -17,6 +18,7 @@
 #include "ami_program.h"
 #include "ami_eeprom.h"
 #include "ami_log.h"
+#include "ami_gcq_stats.h"
 #include "ami_module.h"
 #include "ami_driver_version.h"
 
@@ -33,8 +35,14 @@ static DEFINE_XARRAY_ALLOC(cid_xarray);
 
 #define MAX_COMMAND_IDS             (255)
 
-#define DEVICE_READY_SLEEP_INTERVAL (100)
-#define DEVICE_READY_RETRY_COUNT    (5)
+/*
+ * The AMC readiness poll starts at a few microseconds and backs off
+ * exponentially so a device that is already up is found almost immediately
+ * while a booting device is not polled more than necessary.
+ */
+#define DEVICE_READY_MIN_INTERVAL_US (10)
+#define DEVICE_READY_MAX_INTERVAL_US (20000)   /* 20 ms - upper limit for usleep_range */
+#define DEVICE_READY_TIMEOUT_MS      (500)
 #define REQUEST_MSQ_TIMEOUT         (msecs_to_jiffies(30000))       /* 30 seconds */
 /*
  * Timeout for the PDI download can be small as we are packetising the
@@ -44,7 +52,9 @@ static DEFINE_XARRAY_ALLOC(cid_xarray);
 #define REQUEST_COPY_TIMEOUT        (msecs_to_jiffies(3600000))     /* 60 minutes - based on example max parition size of 128MB */
 #define REQUEST_HEARTBEAT_TIMEOUT   (msecs_to_jiffies(500))         /* 0.5 seconds */
 #define HEARTBEAT_REQUEST_INTERVAL  (500)
+#define HEARTBEAT_SHMEM_INTERVAL    (200)   /* AMC updates the shared memory heartbeat every 100ms */
 #define LOGGING_SLEEP_INTERVAL      (500)
+#define LOGGING_FAST_SLEEP_INTERVAL (50)    /* Used while the log is being streamed */
 
 
 /* AMC Identify Command Version Major and Minor Numbers */
@@ -56,6 +66,12 @@ static DEFINE_XARRAY_ALLOC(cid_xarray);
 /* Number of permitted failures before raising a fatal event */
 #define HEARTBEAT_FAIL_THRESHOLD    (3)
 
+/* AMC status words - stored at the amc_status_off offset in shared memory */
+#define AMC_STATUS_WORD_HEARTBEAT   (1)
+#define AMC_STATUS_WORD_HEALTH      (2)
+#define AMC_STATUS_NUM_WORDS        (3)
+#define AMC_HEALTH_OK               (0x0)
+
 
 /*****************************************************************************/
 /* Private functions                                                         */
@@ -196,96 +212,147 @@ static int get_aid(int cmd_req, int flags)
 }
 
 /**
- * gcq_device_is_ready() - check that the GCQ is ready.
+ * gcq_dump_shared_mem() - print the AMC shared memory partition table.
  * @amc_ctrl_ctxt: AMC data struct instance.
  *
- * Wait for gcq service is fully ready after a reset.
- *
  * Return: None.
  */
-static bool gcq_device_is_ready(struct amc_control_ctxt *amc_ctrl_ctxt)
+static void gcq_dump_shared_mem(struct amc_control_ctxt *amc_ctrl_ctxt)
 {
-	int i = 0, retry = DEVICE_READY_RETRY_COUNT, interval = DEVICE_READY_SLEEP_INTERVAL;
-
 	if (!amc_ctrl_ctxt)
-		return -EINVAL;
+		return;
 
-	for (i = 0; i < retry; i++) {
-		msleep(interval);
-		memcpy_fromio(&(amc_ctrl_ctxt->amc_shared_mem),
-			      amc_ctrl_ctxt->gcq_payload_base_virt_addr,
-			      sizeof(amc_ctrl_ctxt->amc_shared_mem));
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "************ AMC Shared Memory ***************, virt_addr : %p",
+		 amc_ctrl_ctxt->gcq_payload_base_virt_addr);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "************ AMC Shared Memory ***************, virt_addr : %p",
-			 amc_ctrl_ctxt->gcq_payload_base_virt_addr);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Magic number                                   : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.amc_magic_no);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Magic number                                   : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.amc_magic_no);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Offset of gcq ring buffer inited by gcq server : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.ring_buffer.ring_buffer_off);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Offset of gcq ring buffer inited by gcq server : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.ring_buffer.ring_buffer_off);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Length of gcq ring buffer inited by gcq server : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.ring_buffer.ring_buffer_len);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Length of gcq ring buffer inited by gcq server : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.ring_buffer.ring_buffer_len);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Offset of amc device status                    : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.status.amc_status_off);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Offset of amc device status                    : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.status.amc_status_off);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Length of amc device status                    : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.status.amc_status_len);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Length of amc device status                    : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.status.amc_status_len);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Current index of ring buffer log               : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.log_msg.log_msg_index);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Current index of ring buffer log               : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.log_msg.log_msg_index);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Offset of dbg log                              : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.log_msg.log_msg_buf_off);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Offset of dbg log                              : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.log_msg.log_msg_buf_off);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Length of dbg log                              : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.log_msg.log_msg_buf_len);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Length of dbg log                              : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.log_msg.log_msg_buf_len);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Offset of data buffer started                  : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.data.amc_data_start);
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Offset of data buffer started                  : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.data.amc_data_start);
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "Offset of data buffer ended                    : 0x%x",
+		 amc_ctrl_ctxt->amc_shared_mem.data.amc_data_end);
+}
 
-		AMI_VDBG(amc_ctrl_ctxt,
-			 "Offset of data buffer ended                    : 0x%x",
-			 amc_ctrl_ctxt->amc_shared_mem.data.amc_data_end);
+/**
+ * gcq_device_is_ready() - check that the GCQ is ready.
+ * @amc_ctrl_ctxt: AMC data struct instance.
+ *
+ * Wait for gcq service is fully ready after a reset. Only the magic number
+ * and status words are polled; the full partition table is copied once the
+ * magic number is found. The poll interval doubles on every attempt from
+ * DEVICE_READY_MIN_INTERVAL_US up to DEVICE_READY_MAX_INTERVAL_US until
+ * DEVICE_READY_TIMEOUT_MS has elapsed.
+ *
+ * Return: true if the device is ready, false otherwise.
+ */
+static bool gcq_device_is_ready(struct amc_control_ctxt *amc_ctrl_ctxt)
+{
+	unsigned long interval = DEVICE_READY_MIN_INTERVAL_US;
+	ktime_t start = 0;
+	s64 elapsed_us = 0;
+	bool magic_found = false;
+
+	if (!amc_ctrl_ctxt)
+		return false;
+
+	start = ktime_get();
 
-		if (amc_ctrl_ctxt->amc_shared_mem.amc_magic_no == AMC_GCQ_MAGIC_NO) {
+	for (;;) {
+		if (ioread32(amc_ctrl_ctxt->gcq_payload_base_virt_addr) == AMC_GCQ_MAGIC_NO) {
 			uint32_t amc_status = 0;
 
-			AMI_VDBG(amc_ctrl_ctxt, "AMC Magic Number found");
+			if (!magic_found) {
+				magic_found = true;
+				memcpy_fromio(&(amc_ctrl_ctxt->amc_shared_mem),
+					      amc_ctrl_ctxt->gcq_payload_base_virt_addr,
+					      sizeof(amc_ctrl_ctxt->amc_shared_mem));
+				gcq_dump_shared_mem(amc_ctrl_ctxt);
+			}
 
 			/* Read the device status (amc_status_off from payload) */
 			amc_status = ioread32(amc_ctrl_ctxt->gcq_payload_base_virt_addr +
 					      amc_ctrl_ctxt->amc_shared_mem.status.amc_status_off);
 
-			AMI_VDBG(amc_ctrl_ctxt, "Device status value : %x", amc_status);
 			if (amc_status) {
+				/* Pick up anything the AMC updated after publishing the magic number */
+				memcpy_fromio(&(amc_ctrl_ctxt->amc_shared_mem),
+					      amc_ctrl_ctxt->gcq_payload_base_virt_addr,
+					      sizeof(amc_ctrl_ctxt->amc_shared_mem));
+				AMI_VDBG(amc_ctrl_ctxt, "Device status value : %x", amc_status);
 				AMI_VDBG(amc_ctrl_ctxt,
-					 "AMC GCQ service ready after %d ms",
-					 interval * i);
+					 "AMC GCQ service ready after %lld us",
+					 ktime_us_delta(ktime_get(), start));
 				return true;
 			}
 		}
+
+		elapsed_us = ktime_us_delta(ktime_get(), start);
+		if (elapsed_us >= (DEVICE_READY_TIMEOUT_MS * USEC_PER_MSEC))
+			break;
+
+		usleep_range(interval, interval + (interval / 2));
+		interval = min_t(unsigned long, interval * 2, DEVICE_READY_MAX_INTERVAL_US);
 	}
 
 	AMI_ERR(amc_ctrl_ctxt,
-		"AMC GCQ service not ready after %d ms",
-		interval * retry);
+		"AMC GCQ service not ready after %lld us (magic number %s)",
+		elapsed_us,
+		magic_found ? "found" : "not found");
 
 	return false;
 }
 
+/**
+ * read_amc_status_word() - read one of the AMC status words from shared memory.
+ * @amc_ctrl_ctxt: AMC data struct instance.
+ * @word: index of the status word.
+ *
+ * Return: the status word value.
+ */
+static uint32_t read_amc_status_word(struct amc_control_ctxt *amc_ctrl_ctxt, uint32_t word)
+{
+	if (!amc_ctrl_ctxt)
+		return 0;
+
+	return ioread32(amc_ctrl_ctxt->gcq_payload_base_virt_addr +
+			amc_ctrl_ctxt->amc_shared_mem.status.amc_status_off +
+			(word * sizeof(uint32_t)));
+}
+
 /**
  * start_gcq_services() - start the service running.
  * @amc_ctrl_ctxt: AMC data struct instance.
@@ -319,6 +386,19 @@ static int start_gcq_services(struct amc_control_ctxt *amc_ctrl_ctxt)
 		 "\t- GCQ ring buffer virtual addr   : 0x%p",
 		 amc_ctrl_ctxt->gcq_ring_buf_base_virt_addr);
 
+	/* Older AMC versions only publish the enable word */
+	if (amc_ctrl_ctxt->amc_shared_mem.status.amc_status_len >=
+	    (AMC_STATUS_NUM_WORDS * sizeof(uint32_t))) {
+		amc_ctrl_ctxt->shmem_heartbeat = true;
+		amc_ctrl_ctxt->last_heartbeat_count = read_amc_status_word(amc_ctrl_ctxt,
+									   AMC_STATUS_WORD_HEARTBEAT);
+		amc_ctrl_ctxt->amc_health = AMC_HEALTH_OK;
+	}
+
+	AMI_VDBG(amc_ctrl_ctxt,
+		 "\t- Shared memory heartbeat        : %s",
+		 amc_ctrl_ctxt->shmem_heartbeat ? "yes" : "no");
+
 	/* Start receiving incoming commands */
 	mutex_lock(&amc_ctrl_ctxt->lock);
 	amc_ctrl_ctxt->gcq_halted = false;
@@ -787,6 +867,10 @@ static enum amc_cmd_id get_cmd_command_id(enum gcq_submit_cmd_req cmd_req)
 		id = AMC_CMD_ID_EEPROM_READ_WRITE;
 		break;
 
+	case GCQ_SUBMIT_CMD_EEPROM_BULK_READ_WRITE:
+		id = AMC_CMD_ID_EEPROM_BULK_READ_WRITE;
+		break;
+
 	case GCQ_SUBMIT_CMD_MODULE_READ_WRITE:
 		id = AMC_CMD_ID_MODULE_READ_WRITE;
 		break;
@@ -795,6 +879,14 @@ static enum amc_cmd_id get_cmd_command_id(enum gcq_submit_cmd_req cmd_req)
 		id = AMC_CMD_ID_DEBUG_VERBOSITY;
 		break;
 
+	case GCQ_SUBMIT_CMD_MODULE_SG_READ:
+		id = AMC_CMD_ID_MODULE_SG_READ;
+		break;
+
+	case GCQ_SUBMIT_CMD_GET_TASK_PROFILE:
+		id = AMC_CMD_ID_TASK_PROFILE;
+		break;
+
 	default:
 		id = AMC_CMD_ID_UNKNOWN;
 		break;
@@ -932,17 +1024,102 @@ static void unmap_pci_io(struct pci_dev *dev, void __iomem **virt_addr)
 static void release_amc(struct amc_control_ctxt **amc_ctrl_ctxt)
 {
 	if (amc_ctrl_ctxt && *amc_ctrl_ctxt) {
+		destroy_amc_log_ring(*amc_ctrl_ctxt);
+		destroy_gcq_latency_stats(*amc_ctrl_ctxt);
 		kfree(*amc_ctrl_ctxt);
 		*amc_ctrl_ctxt = NULL;
 	}
 }
 
+/**
+ * check_shmem_heartbeat() - check the AMC shared memory heartbeat counter.
+ * @amc_ctxt: AMC data struct instance.
+ *
+ * The AMC increments the counter on every main task tick. A change in the
+ * health word is reported but does not count as a heartbeat failure.
+ *
+ * Return: true if the counter has advanced since the last check.
+ */
+static bool check_shmem_heartbeat(struct amc_control_ctxt *amc_ctxt)
+{
+	uint32_t count = 0;
+	uint32_t health = 0;
+
+	if (!amc_ctxt || !amc_ctxt->shmem_heartbeat)
+		return false;
+
+	count = read_amc_status_word(amc_ctxt, AMC_STATUS_WORD_HEARTBEAT);
+	if (count == amc_ctxt->last_heartbeat_count)
+		return false;
+
+	amc_ctxt->last_heartbeat_count = count;
+
+	health = read_amc_status_word(amc_ctxt, AMC_STATUS_WORD_HEALTH);
+	if (health != amc_ctxt->amc_health) {
+		if (health == AMC_HEALTH_OK)
+			AMI_VDBG(amc_ctxt, "AMC health status recovered");
+		else
+			AMI_ERR(amc_ctxt, "AMC health status changed: 0x%x", health);
+
+		amc_ctxt->amc_health = health;
+	}
+
+	return true;
+}
+
+/**
+ * check_gcq_heartbeat() - send a heartbeat request over the GCQ.
+ * @amc_ctxt: AMC data struct instance.
+ * @request_id: the heartbeat request ID - incremented on every call.
+ *
+ * Return: 0 if the AMC responded with the correct ID, errno otherwise.
+ */
+static int check_gcq_heartbeat(struct amc_control_ctxt *amc_ctxt, uint8_t *request_id)
+{
+	uint8_t response_id = 0;
+	int ret = 0;
+
+	if (!amc_ctxt || !request_id)
+		return -EINVAL;
+
+	ret = submit_gcq_command(amc_ctxt,
+				 GCQ_SUBMIT_CMD_GET_HEARTBEAT,
+				 *request_id,
+				 &response_id,
+				 sizeof(response_id));
+	if (ret) {
+		PR_ERR("Failed to get the heartbeat msg!");
+		if (amc_ctxt->event_cb) {
+			amc_ctxt->event_cb(
+				AMC_EVENT_ID_HEARTBEAT_EXPIRED,
+				amc_ctxt->event_cb_data
+			);
+		}
+	} else if (response_id != *request_id) {
+		PR_ERR("Heartbeat validation failed!");
+		if (amc_ctxt->event_cb) {
+			amc_ctxt->event_cb(
+				AMC_EVENT_ID_HEARTBEAT_VALIDATION,
+				amc_ctxt->event_cb_data
+			);
+		}
+		ret = -EIO;
+	}
+
+	/* Increment or rollover counter */
+	*request_id += 1;
+
+	return ret;
+}
+
 /**
  * heartbeat_health_thread() - the heartbeat health thread
  *
  * @data: the data pointer to the amc control context
  *
- * Periodically send out the heartbeat message
+ * Periodically checks that the AMC is alive. If the AMC publishes a heartbeat
+ * counter in shared memory this is read directly; a GCQ heartbeat request is
+ * only sent when the counter has stalled (or is not supported).
  *
  * Return: the errno return code if thread exits
  */
@@ -950,9 +1127,8 @@ static int heartbeat_health_thread(void *data)
 {
 	struct amc_control_ctxt *amc_ctxt = NULL;
 	uint8_t request_id = 0;
-	uint8_t response_id = 0;
-	int ret = 0;
 	int fail_count = 0;
+	int interval = HEARTBEAT_REQUEST_INTERVAL;
 	bool fatal_event_raised = false;
 
 	if (!data) {
@@ -964,43 +1140,31 @@ static int heartbeat_health_thread(void *data)
 		fail_count = HEARTBEAT_FAIL_THRESHOLD;
 	} else {
 		amc_ctxt = (struct amc_control_ctxt *)data;
+		if (amc_ctxt->shmem_heartbeat)
+			interval = HEARTBEAT_SHMEM_INTERVAL;
 	}
 
 	while (1) {
 		if (!fatal_event_raised && (fail_count < HEARTBEAT_FAIL_THRESHOLD)) {
-			ret = submit_gcq_command(amc_ctxt,
-						 GCQ_SUBMIT_CMD_GET_HEARTBEAT,
-						 request_id,
-						 &response_id,
-						 sizeof(response_id));
-			if (ret) {
-				PR_ERR("Failed to get the heartbeat msg!");
-				if (amc_ctxt->event_cb) {
-					amc_ctxt->event_cb(
-						AMC_EVENT_ID_HEARTBEAT_EXPIRED,
-						amc_ctxt->event_cb_data
-					);
-				}
-				fail_count++;
-			} else if (response_id != request_id) {
-				PR_ERR("Heartbeat validation failed!");
-				if (amc_ctxt->event_cb) {
-					amc_ctxt->event_cb(
-						AMC_EVENT_ID_HEARTBEAT_VALIDATION,
-						amc_ctxt->event_cb_data
-					);
-				}
-				fail_count++;
-			} else {
-				/* Reset fail count */
+			if (check_shmem_heartbeat(amc_ctxt)) {
 				fail_count = 0;
+				interval = HEARTBEAT_SHMEM_INTERVAL;
+			} else {
+				/* Counter stalled or not supported - fall back to the GCQ */
+				interval = HEARTBEAT_REQUEST_INTERVAL;
+				if (check_gcq_heartbeat(amc_ctxt, &request_id))
+					fail_count++;
+				else
+					fail_count = 0;
 			}
-
-			/* Increment or rollover counter */
-			request_id += 1;
 		} else {
 			if (!fatal_event_raised) {
 				PR_ERR("Heartbeat fail count above threshold! Raising fatal event...");
+				/*
+				 * Halt the GCQ here rather than in the callback - the
+				 * device may not have published this context yet.
+				 */
+				stop_gcq_services(amc_ctxt);
 				amc_ctxt->event_cb(
 					AMC_EVENT_ID_HEARTBEAT_FATAL,
 					amc_ctxt->event_cb_data
@@ -1009,7 +1173,7 @@ static int heartbeat_health_thread(void *data)
 			}
 		}
 
-		msleep(HEARTBEAT_REQUEST_INTERVAL);
+		msleep(interval);
 
 		/* only exit from the thread is within the unset_amc context */
 		if (kthread_should_stop())
@@ -1022,7 +1186,8 @@ static int heartbeat_health_thread(void *data)
  * logging_thread() - the AMC logging thread
  * @data: the data pointer to the amc control context
  *
- * Periodically checks for incoming AMC logs and prints them to dmesg
+ * Periodically collects incoming AMC logs into the host log ring - the
+ * interval is shortened while a debugfs reader is attached.
  *
  * Return: 0 if the thread exits
  */
@@ -1055,7 +1220,11 @@ static int logging_thread(void *data)
 	while (1) {
 		if (logging_failed == false)
 			dump_amc_log(amc_ctxt);
-		msleep(LOGGING_SLEEP_INTERVAL);
+
+		if (amc_log_has_readers(amc_ctxt))
+			msleep(LOGGING_FAST_SLEEP_INTERVAL);
+		else
+			msleep(LOGGING_SLEEP_INTERVAL);
 
 		/* only exit from the thread is within the unset_amc context */
 		if (kthread_should_stop())
@@ -1197,6 +1366,7 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 	uint64_t payload_address = 0;
 	uint16_t cid = 0;
 	struct completion *req_complete = NULL;
+	uint64_t submit_ns = ktime_get_ns();
 
 	/* data_buf is required only for some commands */
 	if (!amc_ctrl_ctxt)
@@ -1226,13 +1396,23 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 	case AMC_CMD_ID_SENSOR:
 	case AMC_CMD_ID_HEARTBEAT:
 	case AMC_CMD_ID_EEPROM_READ_WRITE:
+	case AMC_CMD_ID_EEPROM_BULK_READ_WRITE:
 	case AMC_CMD_ID_MODULE_READ_WRITE:
+	case AMC_CMD_ID_MODULE_SG_READ:
 		if (!data_buf) {
 			ret = -EINVAL;
 			goto done;
 		}
 		break;
 
+	/* data_buf required, must hold a struct amc_task_profile */
+	case AMC_CMD_ID_TASK_PROFILE:
+		if (!data_buf || (data_size < sizeof(struct amc_task_profile))) {
+			ret = -EINVAL;
+			goto done;
+		}
+		break;
+
 	/* data_buf not required, data_size required */
 	case AMC_CMD_ID_COPY_PARTITION:
 		if (!data_size) {
@@ -1378,7 +1558,9 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 	break;
 
 	case AMC_CMD_ID_EEPROM_READ_WRITE:
+	case AMC_CMD_ID_EEPROM_BULK_READ_WRITE:
 	case AMC_CMD_ID_MODULE_READ_WRITE:
+	case AMC_CMD_ID_MODULE_SG_READ:
 	{
 		int req_type = MAX_AMC_PROXY_CMD_RW_REQUEST;
 
@@ -1395,6 +1577,17 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 			 payload_size,
 			 length);
 		if (length < payload_size) {
+			/* A bulk transfer must not be silently truncated */
+			if ((cmd_id == AMC_CMD_ID_EEPROM_BULK_READ_WRITE) ||
+			    (cmd_id == AMC_CMD_ID_MODULE_SG_READ)) {
+				AMI_ERR(amc_ctrl_ctxt,
+					"Bulk request length %d exceeds data page length %d",
+					payload_size,
+					length);
+				ret = -EINVAL;
+				goto done;
+			}
+
 			AMI_WARN(amc_ctrl_ctxt,
 				 "Data request length is %d but allocated length is %d",
 				 payload_size,
@@ -1405,6 +1598,7 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 		/* Check if we need to copy the payload data */
 		switch (cmd_id) {
 		case AMC_CMD_ID_EEPROM_READ_WRITE:
+		case AMC_CMD_ID_EEPROM_BULK_READ_WRITE:
 			req_type = EEPROM_GET_TYPE(flags);
 			break;
 
@@ -1412,6 +1606,11 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 			req_type = MODULE_RW_TYPE(flags);
 			break;
 
+		case AMC_CMD_ID_MODULE_SG_READ:
+			/* The descriptor list must reach the device before the read */
+			req_type = AMC_PROXY_CMD_RW_REQUEST_WRITE;
+			break;
+
 		default:
 			break;
 		}
@@ -1422,6 +1621,19 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 	}
 	break;
 
+	case AMC_CMD_ID_TASK_PROFILE:
+	{
+		if (acquire_gcq_data(amc_ctrl_ctxt, (uint32_t *)&(payload_address), &length)) {
+			ret = -EIO;
+			goto done;
+		}
+
+		data_page_acquired = true;
+		payload_size = min_t(uint32_t, length,
+				     sizeof(((struct amc_task_profile *)0)->tasks));
+	}
+	break;
+
 	default:
 		break;
 	}
@@ -1448,10 +1660,14 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 	amc_proxy_cmd->cmd_rcode = 0;
 	amc_proxy_cmd->cmd_suppress_dbg = false;
 	amc_proxy_cmd->cmd_opcode = cmd_id;
+	amc_proxy_cmd->cmd_submit_ns = submit_ns;
 
 	/* Multiple thread now generating gcq command requests, protect concurrent access */
 	mutex_lock(&amc_ctrl_ctxt->gcq_cmd_lock);
 
+	/* Set before the write so the response thread can never see it unset */
+	amc_proxy_cmd->cmd_dispatch_ns = ktime_get_ns();
+
 	switch (cmd_id) {
 	case AMC_CMD_ID_IDENTIFY:
 		ret = amc_proxy_request_identity(amc_proxy_cmd);
@@ -1539,6 +1755,17 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 		break;
 	}
 
+	case AMC_CMD_ID_EEPROM_BULK_READ_WRITE:
+	{
+		struct amc_proxy_eeprom_rw_request eeprom_req = { 0 };
+		eeprom_req.address = payload_address;
+		eeprom_req.length = payload_size;
+		eeprom_req.type = EEPROM_GET_TYPE(flags);
+		eeprom_req.offset = EEPROM_BULK_GET_OFFSET(flags);
+		ret = amc_proxy_request_eeprom_bulk_read_write(amc_proxy_cmd, &eeprom_req);
+		break;
+	}
+
 	case AMC_CMD_ID_MODULE_READ_WRITE:
 	{
 		struct amc_proxy_module_rw_request module_req = { 0 };
@@ -1552,6 +1779,26 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 		break;
 	}
 
+	case AMC_CMD_ID_MODULE_SG_READ:
+	{
+		struct amc_proxy_module_sg_request module_sg_req = { 0 };
+		module_sg_req.address = payload_address;
+		module_sg_req.length = payload_size;
+		/* flags are the number of descriptors */
+		module_sg_req.num_entries = (uint16_t)flags;
+		ret = amc_proxy_request_module_sg_read(amc_proxy_cmd, &module_sg_req);
+		break;
+	}
+
+	case AMC_CMD_ID_TASK_PROFILE:
+	{
+		struct amc_proxy_task_profile_request task_profile_req = { 0 };
+		task_profile_req.address = payload_address;
+		task_profile_req.length = payload_size;
+		ret = amc_proxy_request_task_profile(amc_proxy_cmd, &task_profile_req);
+		break;
+	}
+
 	case AMC_CMD_ID_DEBUG_VERBOSITY:
 	{
 		/* flags are the verbosity */
@@ -1653,6 +1900,7 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 	}
 
 	case AMC_CMD_ID_EEPROM_READ_WRITE:
+	case AMC_CMD_ID_EEPROM_BULK_READ_WRITE:
 	{
 		ret = amc_proxy_get_response_eeprom_read_write(amc_proxy_cmd);
 		if (!ret)
@@ -1670,6 +1918,32 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 		break;
 	}
 
+	case AMC_CMD_ID_MODULE_SG_READ:
+	{
+		/* Descriptor results and packed data are both read back */
+		ret = amc_proxy_get_response_module_read_write(amc_proxy_cmd);
+		if (!ret)
+			memcpy_gcq_payload_from_device(amc_ctrl_ctxt, payload_address, data_buf, data_size);
+		break;
+	}
+
+	case AMC_CMD_ID_TASK_PROFILE:
+	{
+		struct amc_proxy_task_profile_response task_profile = { 0 };
+		struct amc_task_profile *profile = (struct amc_task_profile *)data_buf;
+
+		ret = amc_proxy_get_response_task_profile(amc_proxy_cmd, &task_profile);
+		if (!ret) {
+			/* Never trust the AMC to stay within the page it was given */
+			profile->num_tasks = min_t(uint32_t, task_profile.num_tasks,
+						   payload_size / sizeof(profile->tasks[0]));
+			memcpy_gcq_payload_from_device(amc_ctrl_ctxt, payload_address,
+						       (uint8_t *)profile->tasks,
+						       profile->num_tasks * sizeof(profile->tasks[0]));
+		}
+		break;
+	}
+
 	case AMC_CMD_ID_DEBUG_VERBOSITY:
 		ret = amc_proxy_get_response_debug_verbosity(amc_proxy_cmd);
 		break;
@@ -1681,8 +1955,10 @@ int submit_gcq_command(struct amc_control_ctxt	*amc_ctrl_ctxt,
 
 done:
 
-	if (amc_proxy_cmd)
+	if (amc_proxy_cmd) {
+		record_gcq_latency(amc_ctrl_ctxt, amc_proxy_cmd, ktime_get_ns());
 		remove_gcq_cid(amc_ctrl_ctxt, amc_proxy_cmd->cmd_cid);
+	}
 
 	if (log_page_acquired)
 		release_amc_log_page_sema(amc_ctrl_ctxt);
@@ -1795,6 +2071,18 @@ int setup_amc(struct pci_dev		*dev,
 		goto fail;
 	}
 
+	ret = create_amc_log_ring(*amc_ctrl_ctxt);
+	if (ret) {
+		DEV_ERR(dev, "Failed to allocate AMC log ring");
+		goto fail;
+	}
+
+	ret = create_gcq_latency_stats(*amc_ctrl_ctxt);
+	if (ret) {
+		DEV_ERR(dev, "Failed to allocate GCQ latency stats");
+		goto fail;
+	}
+
 	/* Spawn logging thread. */
 	(*amc_ctrl_ctxt)->logging_thread = kthread_create(
 		logging_thread,
@@ -34,6 +34,8 @@
 #define AMC_DATA_ADDR_OFF                        (AMC_LOG_PAGE_SIZE * AMC_LOG_PAGE_NUM)
 
 #define SENSOR_RSP_LEN                           (4096)
+#define AMC_TASK_NAME_LEN                        (16)
+#define AMC_TASK_PROFILE_MAX                     (16)
 
 /*
  * Response format:
@@ -129,8 +131,11 @@ enum gcq_submit_cmd_flags {
  * @GCQ_SUBMIT_CMD_GET_ALL_INST_POWER_SENSOR: Get all power data
  * @GCQ_SUBMIT_CMD_GET_HEARTBEAT: Heartbeat response
  * @GCQ_SUBMIT_CMD_EEPROM_READ_WRITE: Read/write EEPROM
+ * @GCQ_SUBMIT_CMD_EEPROM_BULK_READ_WRITE: Bulk read/write EEPROM (16-bit offset)
  * @GCQ_SUBMIT_CMD_MODULE_READ_WRITE: Read/write a QSFP module
  * @GCQ_SUBMIT_CMD_DEBUG_VERBOSITY: Debug verbosity
+ * @GCQ_SUBMIT_CMD_MODULE_SG_READ: Scatter-gather read from one or more QSFP modules
+ * @GCQ_SUBMIT_CMD_GET_TASK_PROFILE: Get the profile of every AMC task
  */
 enum gcq_submit_cmd_req {
 	GCQ_SUBMIT_CMD_RSVD                         = 0x00,
@@ -158,8 +163,11 @@ enum gcq_submit_cmd_req {
 	GCQ_SUBMIT_CMD_GET_ALL_INST_POWER_SENSOR    = 0x62,
 	GCQ_SUBMIT_CMD_GET_HEARTBEAT                = 0x70,
 	GCQ_SUBMIT_CMD_EEPROM_READ_WRITE            = 0x80,
+	GCQ_SUBMIT_CMD_EEPROM_BULK_READ_WRITE       = 0x81,
 	GCQ_SUBMIT_CMD_MODULE_READ_WRITE            = 0x90,
 	GCQ_SUBMIT_CMD_DEBUG_VERBOSITY              = 0x91,
+	GCQ_SUBMIT_CMD_MODULE_SG_READ               = 0x92,
+	GCQ_SUBMIT_CMD_GET_TASK_PROFILE             = 0xA0,
 };
 
 /**
@@ -347,6 +355,9 @@ enum sdr_buf_index {
  * @AMC_CMD_ID_EEPROM_READ_WRITE: eeprom read/write command
  * @AMC_CMD_ID_MODULE_READ_WRITE: module read/write command
  * @AMC_CMD_ID_DEBUG_VERBOSITY: debug verbosity command
+ * @AMC_CMD_ID_EEPROM_BULK_READ_WRITE: eeprom bulk read/write command
+ * @AMC_CMD_ID_MODULE_SG_READ: module scatter-gather read command
+ * @AMC_CMD_ID_TASK_PROFILE: task profile command
  */
 enum amc_cmd_id {
 	AMC_CMD_ID_UNKNOWN = -EINVAL,
@@ -359,6 +370,9 @@ enum amc_cmd_id {
 	AMC_CMD_ID_EEPROM_READ_WRITE,
 	AMC_CMD_ID_MODULE_READ_WRITE,
     AMC_CMD_ID_DEBUG_VERBOSITY,
+	AMC_CMD_ID_EEPROM_BULK_READ_WRITE,
+	AMC_CMD_ID_MODULE_SG_READ,
+	AMC_CMD_ID_TASK_PROFILE,
 
 	AMC_CMD_ID_MAX
 };
@@ -636,6 +650,36 @@ struct amc_version {
 	uint16_t dev_commits;
 };
 
+/**
+ * struct amc_task_profile_entry - Profile of a single AMC task.
+ * @name: Task name, NULL terminated.
+ * @run_time_us: CPU time spent running, 0 if the AMC does not measure it.
+ * @wakeups: Number of returns from a blocking sleep or pend.
+ * @max_loop_us: Longest time between a wakeup and the next blocking call.
+ * @stack_size: Stack size in bytes.
+ * @stack_hwm: Peak stack usage in bytes, 0 if not known.
+ *
+ * This is the layout the AMC writes to the data page.
+ */
+struct amc_task_profile_entry {
+	char     name[AMC_TASK_NAME_LEN];
+	uint64_t run_time_us;
+	uint32_t wakeups;
+	uint32_t max_loop_us;
+	uint32_t stack_size;
+	uint32_t stack_hwm;
+};
+
+/**
+ * struct amc_task_profile - Profiles of every AMC task.
+ * @num_tasks: Number of valid entries in @tasks.
+ * @tasks: One entry per task.
+ */
+struct amc_task_profile {
+	uint32_t                      num_tasks;
+	struct amc_task_profile_entry tasks[AMC_TASK_PROFILE_MAX];
+};
+
 /**
  * struct amc_control_ctxt - context for the AMC.
  * @pcie_dev: the physical function
@@ -658,9 +702,15 @@ struct amc_version {
  * @logging_thread: thead that handles AMC logs
  * @logging_thread_created: flag used to determine if thread has been created
  * @last_printed_msg_index: index of the last printed log message
+ * @log_ring: host copy of the AMC log (see ami_log.h)
+ * @gcq_latency: per-command GCQ latency histograms (see ami_gcq_stats.h)
  * @compat_mode: flag used to determine if this AMC instance is running in
  *   compatibility mode - this provides minimum functionality when an AMC
  *   version is deemed to be incompatible with the current AMI version
+ * @shmem_heartbeat: flag used to determine if the AMC publishes a heartbeat
+ *   counter and health word in shared memory
+ * @last_heartbeat_count: last shared memory heartbeat counter value read
+ * @amc_health: last shared memory health word value read
  */
 struct amc_control_ctxt {
 	struct pci_dev        *pcie_dev;
@@ -683,7 +733,12 @@ struct amc_control_ctxt {
 	struct task_struct    *logging_thread;
 	bool                  logging_thread_created;
 	int                   last_printed_msg_index;
+	struct amc_log_ring   *log_ring;
+	struct gcq_latency_stats *gcq_latency;
 	bool                  compat_mode;
+	bool                  shmem_heartbeat;
+	uint32_t              last_heartbeat_count;
+	uint32_t              amc_health;
 };
 
 
@@ -130,6 +130,9 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 		case PF_DEV_STATE_MISSING_INFO:
 			break;
 
+		case PF_DEV_STATE_INIT:
+			return -EAGAIN;
+
 		default:
 			return -EPERM;
 		}
@@ -141,6 +144,8 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 	case AMI_IOC_APP_SETUP:
 		switch (pf_dev->state) {
 		case PF_DEV_STATE_INIT:
+			return -EAGAIN;
+
 		case PF_DEV_STATE_SHUTDOWN:
 			return -EPERM;
 
@@ -157,14 +162,20 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 	case AMI_IOC_GET_FPT_PARTITION:
 	case AMI_IOC_READ_EEPROM:
 	case AMI_IOC_WRITE_EEPROM:
+	case AMI_IOC_READ_EEPROM_BULK:
+	case AMI_IOC_WRITE_EEPROM_BULK:
 	case AMI_IOC_READ_MODULE:
 	case AMI_IOC_WRITE_MODULE:
+	case AMI_IOC_READ_MODULE_SG:
 	case AMI_IOC_DEBUG_VERBOSITY:
 		switch (pf_dev->state) {
 		case PF_DEV_STATE_READY:
 		case PF_DEV_STATE_MISSING_INFO:
 			break;
 
+		case PF_DEV_STATE_INIT:
+			return -EAGAIN;
+
 		default:
 			return -EPERM;
 		}
@@ -251,7 +262,7 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 				);
 			else
 				ret = download_pdi(
-					pf_dev->amc_ctrl_ctxt,
+					pf_dev_amc_ctxt(pf_dev),
 					buf,
 					data.size,
 					data.boot_device,
@@ -548,7 +559,7 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 			goto done;
 		}
 
-	    ret = eeprom_read(pf_dev->amc_ctrl_ctxt, buf, data.len, data.offset);
+	    ret = eeprom_read(pf_dev_amc_ctxt(pf_dev), buf, data.len, data.offset);
 	    if (!ret) {
 	        ret = copy_to_user((uint8_t*)data.addr, buf,
 			data.len * sizeof(uint8_t));
@@ -583,7 +594,76 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 
 		/* Copy payload data. */
 		if (!copy_from_user(buf, (uint8_t*)data.addr, data.len * sizeof(uint8_t)))
-			ret = eeprom_write(pf_dev->amc_ctrl_ctxt, buf, data.len, data.offset);
+			ret = eeprom_write(pf_dev_amc_ctxt(pf_dev), buf, data.len, data.offset);
+        else
+			ret = -EFAULT;
+
+		vfree(buf);
+        break;
+    }
+
+    case AMI_IOC_READ_EEPROM_BULK:
+    {
+        struct ami_ioc_eeprom_bulk_payload data = { 0 };
+        uint8_t *buf = NULL;
+
+        /* Read data payload. */
+        if (copy_from_user(&data, (struct ami_ioc_eeprom_bulk_payload*)arg, sizeof(data))) {
+                ret = -EFAULT;
+                goto done;
+        }
+
+        if ((data.len == 0) || (data.addr == 0) ||
+            (data.len > (EEPROM_BULK_ADDR_SPACE - data.offset))) {
+			ret = -EINVAL;
+			goto done;
+		}
+
+	    /* Allocate memory for response buffer. */
+		buf = vzalloc(data.len * sizeof(uint8_t));
+
+		if (!buf) {
+			ret = -ENOMEM;
+			goto done;
+		}
+
+	    ret = eeprom_read_bulk(pf_dev_amc_ctxt(pf_dev), buf, data.len, data.offset);
+	    if (!ret) {
+	        ret = copy_to_user((uint8_t*)data.addr, buf,
+			data.len * sizeof(uint8_t));
+	    }
+	    vfree(buf);
+	    break;
+    }
+
+    case AMI_IOC_WRITE_EEPROM_BULK:
+    {
+        struct ami_ioc_eeprom_bulk_payload data = { 0 };
+		uint8_t *buf = NULL;
+
+		/* Read data payload. */
+		if (copy_from_user(&data, (struct ami_ioc_eeprom_bulk_payload*)arg, sizeof(data))) {
+			ret = -EFAULT;
+			goto done;
+		}
+
+		if ((data.len == 0) || (data.addr == 0) ||
+		    (data.len > (EEPROM_BULK_ADDR_SPACE - data.offset))) {
+			ret = -EINVAL;
+			goto done;
+		}
+
+		/* Allocate memory for payload buffer. */
+		buf = vzalloc(data.len * sizeof(uint8_t));
+
+		if (!buf) {
+			ret = -ENOMEM;
+			goto done;
+		}
+
+		/* Copy payload data. */
+		if (!copy_from_user(buf, (uint8_t*)data.addr, data.len * sizeof(uint8_t)))
+			ret = eeprom_write_bulk(pf_dev_amc_ctxt(pf_dev), buf, data.len, data.offset);
         else
 			ret = -EFAULT;
 
@@ -632,7 +712,7 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 		}
 
 		ret = module_read(
-			pf_dev->amc_ctrl_ctxt,
+			pf_dev_amc_ctxt(pf_dev),
 			data.device_id,
 			data.page,
 			data.offset,
@@ -675,7 +755,7 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 		/* Copy payload data. */
 		if (!copy_from_user(buf, (uint8_t*)data.addr, data.len * sizeof(uint8_t)))
 			ret = module_write(
-				pf_dev->amc_ctrl_ctxt,
+				pf_dev_amc_ctxt(pf_dev),
 				data.device_id,
 				data.page,
 				data.offset,
@@ -689,9 +769,62 @@ long dev_unlocked_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 		break;
 	}
 
+	case AMI_IOC_READ_MODULE_SG:
+	{
+		struct ami_ioc_module_sg_payload data = { 0 };
+		uint8_t *buf = NULL;
+
+		/* Read data payload. */
+		if (copy_from_user(&data, (struct ami_ioc_module_sg_payload*)arg, sizeof(data))) {
+			ret = -EFAULT;
+			goto done;
+		}
+
+		if ((data.len == 0) || (data.addr == 0) || (data.num_entries == 0) ||
+		    (data.num_entries > MODULE_SG_MAX_ENTRIES)) {
+			ret = -EINVAL;
+			goto done;
+		}
+
+		/* Bound the allocation before anything user supplied is parsed. */
+		if (data.len > (data.num_entries *
+				(sizeof(struct ami_ioc_module_sg_entry) + MODULE_PAGE_SIZE))) {
+			ret = -EINVAL;
+			goto done;
+		}
+
+		/* Allocate memory for descriptors and response data. */
+		buf = vzalloc(data.len * sizeof(uint8_t));
+
+		if (!buf) {
+			ret = -ENOMEM;
+			goto done;
+		}
+
+		/* The descriptor list is copied in, the results and data are copied out. */
+		if (!copy_from_user(buf, (uint8_t*)data.addr, data.len * sizeof(uint8_t))) {
+			ret = module_read_sg(
+				pf_dev_amc_ctxt(pf_dev),
+				data.num_entries,
+				buf,
+				data.len
+			);
+
+			if (!ret) {
+				ret = copy_to_user((uint8_t*)data.addr, buf,
+					data.len * sizeof(uint8_t));
+			}
+		} else {
+			ret = -EFAULT;
+		}
+
+		vfree(buf);
+		break;
+	}
+
 	case AMI_IOC_DEBUG_VERBOSITY:
 		ret = submit_gcq_command(
-			pf_dev->amc_ctrl_ctxt,
+			pf_dev_amc_ctxt(pf_dev),
 			GCQ_SUBMIT_CMD_DEBUG_VERBOSITY,
 			(uint8_t)arg,
 			NULL,
@@ -68,3 +68,59 @@ int eeprom_write(struct amc_control_ctxt *amc_ctrl_ctxt, uint8_t *buf, uint8_t b
 
 	return ret;
 }
+
+/*
+ * Read an arbitrary range from the EEPROM.
+ */
+int eeprom_read_bulk(struct amc_control_ctxt *amc_ctrl_ctxt, uint8_t *buf, uint32_t buf_len, uint16_t offset)
+{
+	int ret = SUCCESS;
+	uint32_t eeprom_req_data = 0;
+
+	if (!amc_ctrl_ctxt || !buf || (buf_len == 0))
+		return -EINVAL;
+
+	AMI_VDBG(
+		amc_ctrl_ctxt,
+		"Attempting bulk read of EEPROM at offset:%d len:%d",
+		offset, buf_len
+	);
+
+	eeprom_req_data = EEPROM_SET_TYPE(AMC_PROXY_CMD_RW_REQUEST_READ);
+	eeprom_req_data |= EEPROM_BULK_SET_OFFSET(offset);
+	ret = submit_gcq_command(amc_ctrl_ctxt, GCQ_SUBMIT_CMD_EEPROM_BULK_READ_WRITE, eeprom_req_data,
+							 buf, buf_len);
+
+	if (ret)
+		AMI_ERR(amc_ctrl_ctxt, "Failed bulk read of EEPROM");
+
+	return ret;
+}
+
+/*
+ * Write an arbitrary range to the EEPROM.
+ */
+int eeprom_write_bulk(struct amc_control_ctxt *amc_ctrl_ctxt, uint8_t *buf, uint32_t buf_len, uint16_t offset)
+{
+	int ret = SUCCESS;
+	uint32_t eeprom_req_data = 0;
+
+	if (!amc_ctrl_ctxt || !buf || (buf_len == 0))
+		return -EINVAL;
+
+	AMI_VDBG(
+		amc_ctrl_ctxt,
+		"Attempting bulk write of EEPROM at offset:%d len:%d",
+		offset, buf_len
+	);
+
+	eeprom_req_data = EEPROM_SET_TYPE(AMC_PROXY_CMD_RW_REQUEST_WRITE);
+	eeprom_req_data |= EEPROM_BULK_SET_OFFSET(offset);
+	ret = submit_gcq_command(amc_ctrl_ctxt, GCQ_SUBMIT_CMD_EEPROM_BULK_READ_WRITE, eeprom_req_data,
+							 buf, buf_len);
+
+	if (ret)
+		AMI_ERR(amc_ctrl_ctxt, "Failed bulk write of EEPROM");
+
+	return ret;
+}
@@ -16,6 +16,8 @@
 #define	EEPROM_TYPE_MASK			(0x01)
 #define	EEPROM_OFFSET_POS			(8)
 #define	EEPROM_OFFSET_MASK			(0xFF)
+#define	EEPROM_BULK_OFFSET_MASK			(0xFFFF)
+#define	EEPROM_BULK_ADDR_SPACE			(0x10000)
 
 #define EEPROM_GET_OFFSET(data)    		((data >> EEPROM_OFFSET_POS) & EEPROM_OFFSET_MASK)
 #define EEPROM_GET_TYPE(data)    		((data >> EEPROM_TYPE_POS) & EEPROM_TYPE_MASK)
@@ -23,6 +25,9 @@
 #define EEPROM_SET_OFFSET(data)     	        ((data & EEPROM_OFFSET_MASK) << EEPROM_OFFSET_POS)
 #define EEPROM_SET_TYPE(data)    		((data & EEPROM_TYPE_MASK) << EEPROM_TYPE_POS)
 
+#define EEPROM_BULK_GET_OFFSET(data)		((data >> EEPROM_OFFSET_POS) & EEPROM_BULK_OFFSET_MASK)
+#define EEPROM_BULK_SET_OFFSET(data)		((data & EEPROM_BULK_OFFSET_MASK) << EEPROM_OFFSET_POS)
+
 /**
  * eeprom_read() - Read one or more values from the EEPROM.
  * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
@@ -51,4 +56,37 @@ int eeprom_write(struct amc_control_ctxt *amc_ctrl_ctxt,
 		uint8_t buf_len,
 		uint8_t offset);
 
+/**
+ * eeprom_read_bulk() - Read an arbitrary range from the EEPROM.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ * @buf: Buffer to be populated with the bytes read.
+ * @buf_len: The number of bytes to be read.
+ * @offset: The 16-bit offset from the base address of the EEPROM.
+ * 
+ * The whole range is transferred with a single GCQ request.
+ * 
+ * Return: 0 or negative error code.
+ */
+int eeprom_read_bulk(struct amc_control_ctxt *amc_ctrl_ctxt,
+		uint8_t *buf,
+		uint32_t buf_len,
+		uint16_t offset);
+
+/**
+ * eeprom_write_bulk() - Write an arbitrary range to the EEPROM.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ * @buf: Buffer containing the bytes to write.
+ * @buf_len: The number of bytes to be written.
+ * @offset: The 16-bit offset from the base address of the EEPROM.
+ * 
+ * The whole range is transferred with a single GCQ request; the AMC splits
+ * it on EEPROM page boundaries.
+ * 
+ * Return: 0 or negative error code.
+ */
+int eeprom_write_bulk(struct amc_control_ctxt *amc_ctrl_ctxt,
+		uint8_t *buf,
+		uint32_t buf_len,
+		uint16_t offset);
+
 #endif  /* AMI_EEPROM_H */
@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * ami_gcq_stats.c - This file contains GCQ command latency accounting and
+ * the AMC task profile.
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+#include <linux/types.h>
+#include <linux/slab.h>
+#include <linux/fs.h>
+#include <linux/seq_file.h>
+#include <linux/bitops.h>
+#include <linux/math64.h>
+
+#include "ami_gcq_stats.h"
+#include "ami_amc_control.h"
+
+
+/*****************************************************************************/
+/* Local variables                                                           */
+/*****************************************************************************/
+
+static const char * const gcq_cmd_names[AMC_CMD_ID_MAX] = {
+	[AMC_CMD_ID_SENSOR]                 = "sensor",
+	[AMC_CMD_ID_IDENTIFY]               = "identify",
+	[AMC_CMD_ID_DOWNLOAD_PDI]           = "download_pdi",
+	[AMC_CMD_ID_DEVICE_BOOT]            = "device_boot",
+	[AMC_CMD_ID_COPY_PARTITION]         = "copy_partition",
+	[AMC_CMD_ID_HEARTBEAT]              = "heartbeat",
+	[AMC_CMD_ID_EEPROM_READ_WRITE]      = "eeprom_rw",
+	[AMC_CMD_ID_MODULE_READ_WRITE]      = "module_rw",
+	[AMC_CMD_ID_DEBUG_VERBOSITY]        = "debug_verbosity",
+	[AMC_CMD_ID_EEPROM_BULK_READ_WRITE] = "eeprom_bulk_rw",
+	[AMC_CMD_ID_MODULE_SG_READ]         = "module_sg_read",
+	[AMC_CMD_ID_TASK_PROFILE]           = "task_profile",
+};
+
+static const char * const gcq_stage_names[GCQ_LAT_STAGE_MAX] = {
+	[GCQ_LAT_QUEUE]   = "queue",
+	[GCQ_LAT_SERVICE] = "service",
+	[GCQ_LAT_POLL]    = "poll",
+	[GCQ_LAT_TOTAL]   = "total",
+};
+
+
+/*****************************************************************************/
+/* Private functions                                                         */
+/*****************************************************************************/
+
+/**
+ * add_sample() - Add one sample to a histogram.
+ * @hist: Histogram to update.
+ * @ns: Sample in nanoseconds.
+ *
+ * Must be called with the stats lock held.
+ */
+static void add_sample(struct gcq_lat_hist *hist, uint64_t ns)
+{
+	uint64_t us = div_u64(ns, NSEC_PER_USEC);
+	int bucket = us ? fls64(us) : 0;
+
+	if (bucket >= GCQ_LAT_BUCKETS)
+		bucket = GCQ_LAT_BUCKETS - 1;
+
+	hist->count++;
+	hist->sum_ns += ns;
+	if (ns > hist->max_ns)
+		hist->max_ns = ns;
+	hist->buckets[bucket]++;
+}
+
+/**
+ * gcq_latency_show() - Show callback for the `gcq_latency` debugfs file.
+ * @m: Seq file.
+ * @unused: Unused.
+ *
+ * Return: 0.
+ */
+static int gcq_latency_show(struct seq_file *m, void *unused)
+{
+	struct amc_control_ctxt *amc_ctrl_ctxt = m->private;
+	struct gcq_latency_stats *stats = amc_ctrl_ctxt->gcq_latency;
+	struct gcq_lat_hist hist = { 0 };
+	uint64_t failed = 0;
+	int id = 0, stage = 0, i = 0, last = 0;
+
+	seq_puts(m, "# bucket N: [2^(N-1), 2^N) us, bucket 0: < 1 us\n");
+
+	for (id = 0; id < AMC_CMD_ID_MAX; id++) {
+		bool header = false;
+
+		spin_lock(&stats->lock);
+		failed = stats->failed[id];
+		spin_unlock(&stats->lock);
+
+		for (stage = 0; stage < GCQ_LAT_STAGE_MAX; stage++) {
+			/* Take a copy so the lock is not held while printing */
+			spin_lock(&stats->lock);
+			hist = stats->hist[id][stage];
+			spin_unlock(&stats->lock);
+
+			if (!hist.count)
+				continue;
+
+			if (!header) {
+				seq_printf(m, "%s failed=%llu\n", gcq_cmd_names[id], failed);
+				header = true;
+			}
+
+			for (i = 0, last = 0; i < GCQ_LAT_BUCKETS; i++)
+				if (hist.buckets[i])
+					last = i;
+
+			seq_printf(m, "  %-8s count=%llu avg_us=%llu max_us=%llu buckets=",
+				   gcq_stage_names[stage],
+				   hist.count,
+				   div64_u64(hist.sum_ns, hist.count) / NSEC_PER_USEC,
+				   div_u64(hist.max_ns, NSEC_PER_USEC));
+
+			for (i = 0; i <= last; i++)
+				seq_printf(m, "%s%llu", i ? " " : "", hist.buckets[i]);
+			seq_putc(m, '\n');
+		}
+
+		if (!header && failed)
+			seq_printf(m, "%s failed=%llu\n", gcq_cmd_names[id], failed);
+	}
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(gcq_latency);
+
+/**
+ * gcq_latency_reset_write() - Write callback for `gcq_latency_reset`.
+ * @filp: File pointer.
+ * @buf: User buffer (contents ignored).
+ * @count: Number of bytes written.
+ * @ppos: File position.
+ *
+ * Return: @count.
+ */
+static ssize_t gcq_latency_reset_write(struct file *filp, const char __user *buf,
+				       size_t count, loff_t *ppos)
+{
+	struct amc_control_ctxt *amc_ctrl_ctxt = filp->private_data;
+	struct gcq_latency_stats *stats = amc_ctrl_ctxt->gcq_latency;
+
+	spin_lock(&stats->lock);
+	memset(stats->hist, 0, sizeof(stats->hist));
+	memset(stats->failed, 0, sizeof(stats->failed));
+	spin_unlock(&stats->lock);
+
+	return count;
+}
+
+static const struct file_operations gcq_latency_reset_fops = {
+	.owner = THIS_MODULE,
+	.open  = simple_open,
+	.write = gcq_latency_reset_write,
+};
+
+/**
+ * amc_task_profile_show() - Show callback for the `amc_task_profile` debugfs file.
+ * @m: Seq file.
+ * @unused: Unused.
+ *
+ * Every read queries the AMC, so the file doubles as a way of sampling the
+ * profile over time.
+ *
+ * Return: 0 or negative error code.
+ */
+static int amc_task_profile_show(struct seq_file *m, void *unused)
+{
+	struct amc_control_ctxt *amc_ctrl_ctxt = m->private;
+	struct amc_task_profile *profile = NULL;
+	int ret = 0, i = 0;
+
+	profile = kzalloc(sizeof(*profile), GFP_KERNEL);
+	if (!profile)
+		return -ENOMEM;
+
+	ret = submit_gcq_command(amc_ctrl_ctxt, GCQ_SUBMIT_CMD_GET_TASK_PROFILE, 0,
+				 (uint8_t *)profile, sizeof(*profile));
+	if (ret)
+		goto done;
+
+	seq_printf(m, "%-16s %14s %10s %12s %10s %10s\n",
+		   "task", "run_us", "wakeups", "max_loop_us", "stack", "stack_hwm");
+
+	for (i = 0; i < profile->num_tasks; i++) {
+		struct amc_task_profile_entry *task = &profile->tasks[i];
+
+		task->name[AMC_TASK_NAME_LEN - 1] = '\0';
+		seq_printf(m, "%-16s %14llu %10u %12u %10u %10u\n",
+			   task->name,
+			   task->run_time_us,
+			   task->wakeups,
+			   task->max_loop_us,
+			   task->stack_size,
+			   task->stack_hwm);
+	}
+
+done:
+	kfree(profile);
+	return ret;
+}
+DEFINE_SHOW_ATTRIBUTE(amc_task_profile);
+
+
+/*****************************************************************************/
+/* Public functions                                                          */
+/*****************************************************************************/
+
+/*
+ * Allocate the GCQ latency histograms.
+ */
+int create_gcq_latency_stats(struct amc_control_ctxt *amc_ctrl_ctxt)
+{
+	struct gcq_latency_stats *stats = NULL;
+
+	if (!amc_ctrl_ctxt)
+		return -EINVAL;
+
+	stats = kzalloc(sizeof(*stats), GFP_KERNEL);
+	if (!stats)
+		return -ENOMEM;
+
+	spin_lock_init(&stats->lock);
+
+	amc_ctrl_ctxt->gcq_latency = stats;
+	return 0;
+}
+
+/*
+ * Free the GCQ latency histograms.
+ */
+void destroy_gcq_latency_stats(struct amc_control_ctxt *amc_ctrl_ctxt)
+{
+	if (!amc_ctrl_ctxt || !amc_ctrl_ctxt->gcq_latency)
+		return;
+
+	kfree(amc_ctrl_ctxt->gcq_latency);
+	amc_ctrl_ctxt->gcq_latency = NULL;
+}
+
+/*
+ * Account a finished command.
+ */
+void record_gcq_latency(struct amc_control_ctxt *amc_ctrl_ctxt,
+			struct amc_proxy_cmd_struct *cmd, uint64_t done_ns)
+{
+	struct gcq_latency_stats *stats = NULL;
+	uint64_t poll_start = 0;
+
+	if (!amc_ctrl_ctxt || !amc_ctrl_ctxt->gcq_latency || !cmd)
+		return;
+
+	if (!cmd->cmd_dispatch_ns || cmd->cmd_opcode >= AMC_CMD_ID_MAX)
+		return;
+
+	stats = amc_ctrl_ctxt->gcq_latency;
+
+	spin_lock(&stats->lock);
+
+	if (!cmd->cmd_complete_ns || (cmd->cmd_complete_ns < cmd->cmd_dispatch_ns)) {
+		stats->failed[cmd->cmd_opcode]++;
+	} else {
+		struct gcq_lat_hist *hist = stats->hist[cmd->cmd_opcode];
+
+		/* The queue was last seen empty before this command went in */
+		poll_start = max(cmd->cmd_poll_ns, cmd->cmd_dispatch_ns);
+
+		add_sample(&hist[GCQ_LAT_QUEUE], cmd->cmd_dispatch_ns - cmd->cmd_submit_ns);
+		add_sample(&hist[GCQ_LAT_SERVICE], cmd->cmd_complete_ns - cmd->cmd_dispatch_ns);
+		add_sample(&hist[GCQ_LAT_POLL], cmd->cmd_complete_ns - poll_start);
+		add_sample(&hist[GCQ_LAT_TOTAL], done_ns - cmd->cmd_submit_ns);
+	}
+
+	spin_unlock(&stats->lock);
+}
+
+/*
+ * Create the latency debugfs files.
+ */
+void create_gcq_latency_debugfs(struct amc_control_ctxt *amc_ctrl_ctxt, struct dentry *parent)
+{
+	if (!amc_ctrl_ctxt || !amc_ctrl_ctxt->gcq_latency || IS_ERR_OR_NULL(parent))
+		return;
+
+	debugfs_create_file("gcq_latency", 0400, parent, amc_ctrl_ctxt, &gcq_latency_fops);
+	debugfs_create_file("gcq_latency_reset", 0200, parent, amc_ctrl_ctxt, &gcq_latency_reset_fops);
+}
+
+/*
+ * Create the task profile debugfs file.
+ */
+void create_amc_task_profile_debugfs(struct amc_control_ctxt *amc_ctrl_ctxt, struct dentry *parent)
+{
+	if (!amc_ctrl_ctxt || IS_ERR_OR_NULL(parent))
+		return;
+
+	debugfs_create_file("amc_task_profile", 0400, parent, amc_ctrl_ctxt, &amc_task_profile_fops);
+}
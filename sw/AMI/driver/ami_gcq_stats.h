@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * ami_gcq_stats.h - This file contains GCQ command latency accounting and
+ * the AMC task profile.
+ *
+ * Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ */
+
+#ifndef AMI_GCQ_STATS_H
+#define AMI_GCQ_STATS_H
+
+#include <linux/types.h>
+#include <linux/spinlock.h>
+#include <linux/debugfs.h>
+
+#include "ami_amc_control.h"
+#include "amc_proxy.h"
+
+/*
+ * Bucket N counts latencies in [2^(N-1), 2^N) microseconds, bucket 0 counts
+ * anything under 1us and the last bucket everything from ~4s upwards.
+ */
+#define GCQ_LAT_BUCKETS      (24)
+
+/**
+ * enum gcq_lat_stage - Portion of a command's lifetime being measured.
+ * @GCQ_LAT_QUEUE: Submit to dispatch - data page semaphores and `gcq_cmd_lock`.
+ * @GCQ_LAT_SERVICE: Dispatch to the response being consumed - AMC processing
+ *   plus the response thread's polling delay.
+ * @GCQ_LAT_POLL: Upper bound on the polling delay - time from the last empty
+ *   poll (or dispatch, if later) to the response being consumed.
+ * @GCQ_LAT_TOTAL: Submit to the caller returning, as seen by user space.
+ * @GCQ_LAT_STAGE_MAX: Number of stages.
+ */
+enum gcq_lat_stage {
+	GCQ_LAT_QUEUE = 0,
+	GCQ_LAT_SERVICE,
+	GCQ_LAT_POLL,
+	GCQ_LAT_TOTAL,
+
+	GCQ_LAT_STAGE_MAX
+};
+
+/**
+ * struct gcq_lat_hist - Latency histogram for one command stage.
+ * @count: Number of samples.
+ * @sum_ns: Sum of all samples.
+ * @max_ns: Largest sample.
+ * @buckets: log2 microsecond buckets (see GCQ_LAT_BUCKETS).
+ */
+struct gcq_lat_hist {
+	uint64_t count;
+	uint64_t sum_ns;
+	uint64_t max_ns;
+	uint64_t buckets[GCQ_LAT_BUCKETS];
+};
+
+/**
+ * struct gcq_latency_stats - Per-command GCQ latency histograms.
+ * @hist: Histograms indexed by command id and stage.
+ * @failed: Commands per id that were dispatched but got no response
+ *   (timed out or killed) - these are not in the histograms.
+ * @lock: Protects the fields above.
+ */
+struct gcq_latency_stats {
+	struct gcq_lat_hist hist[AMC_CMD_ID_MAX][GCQ_LAT_STAGE_MAX];
+	uint64_t            failed[AMC_CMD_ID_MAX];
+	spinlock_t          lock;
+};
+
+/**
+ * create_gcq_latency_stats() - Allocate the GCQ latency histograms.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ *
+ * Return: 0 or negative error code.
+ */
+int create_gcq_latency_stats(struct amc_control_ctxt *amc_ctrl_ctxt);
+
+/**
+ * destroy_gcq_latency_stats() - Free the GCQ latency histograms.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ *
+ * Must only be called once no commands can be submitted and the debugfs
+ * files are gone.
+ */
+void destroy_gcq_latency_stats(struct amc_control_ctxt *amc_ctrl_ctxt);
+
+/**
+ * record_gcq_latency() - Account a finished command.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ * @cmd: The command, with its timestamps filled in.
+ * @done_ns: Time the command was handed back to the caller.
+ *
+ * Commands that never reached the GCQ are ignored.
+ */
+void record_gcq_latency(struct amc_control_ctxt *amc_ctrl_ctxt,
+			struct amc_proxy_cmd_struct *cmd, uint64_t done_ns);
+
+/**
+ * create_gcq_latency_debugfs() - Create the `gcq_latency` files.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ * @parent: Per-device debugfs directory.
+ *
+ * `gcq_latency` prints the histograms of every command seen so far; writing
+ * anything to `gcq_latency_reset` clears them. The files are removed along
+ * with @parent.
+ */
+void create_gcq_latency_debugfs(struct amc_control_ctxt *amc_ctrl_ctxt, struct dentry *parent);
+
+/**
+ * create_amc_task_profile_debugfs() - Create the `amc_task_profile` file.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ * @parent: Per-device debugfs directory.
+ *
+ * Reading the file queries the AMC for the run time, wakeups, longest loop
+ * and stack usage of each of its tasks. The profile is cleared with the
+ * AMC `clear_task_profile` DAL command.
+ */
+void create_amc_task_profile_debugfs(struct amc_control_ctxt *amc_ctrl_ctxt, struct dentry *parent);
+
+#endif  /* AMI_GCQ_STATS_H */
@@ -6,25 +6,409 @@
  */
 
 #include <linux/types.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
+#include <linux/fs.h>
+#include <linux/poll.h>
+#include <linux/seq_file.h>
+#include <linux/uaccess.h>
 
 #include "ami_log.h"
 #include "ami_amc_control.h"
 
 
+/*****************************************************************************/
+/* Defines                                                                   */
+/*****************************************************************************/
+
+#define AMC_LOG_RING_MASK    (AMC_LOG_RING_RECS - 1)
+
+/* "<20 digit seq> <message>\n" */
+#define AMC_LOG_LINE_MAX     (AMC_LOG_ENTRY_SIZE + 24)
+
+
+/*****************************************************************************/
+/* Structs                                                                   */
+/*****************************************************************************/
+
+/**
+ * struct amc_log_reader - Per-file state of an `amc_log` reader.
+ * @ring: Host log ring (the reader holds a reference).
+ * @next_seq: Sequence number of the next record to read.
+ */
+struct amc_log_reader {
+	struct amc_log_ring *ring;
+	uint64_t             next_seq;
+};
+
+
+/*****************************************************************************/
+/* Private functions                                                         */
+/*****************************************************************************/
+
+/**
+ * free_amc_log_ring() - Free the host log ring once the last reference is gone.
+ * @ref: Reference count in the ring.
+ *
+ * Return: None.
+ */
+static void free_amc_log_ring(struct kref *ref)
+{
+	struct amc_log_ring *ring = container_of(ref, struct amc_log_ring, ref);
+
+	vfree(ring->recs);
+	kfree(ring);
+}
+
+/**
+ * push_log_record() - Append a message to the host ring.
+ * @ring: Host log ring.
+ * @msg: NULL terminated message.
+ *
+ * Return: None.
+ */
+static void push_log_record(struct amc_log_ring *ring, const struct amc_msg_payload *msg)
+{
+	struct amc_log_record *rec = NULL;
+	unsigned long flags = 0;
+
+	spin_lock_irqsave(&ring->lock, flags);
+	rec = &ring->recs[ring->head & AMC_LOG_RING_MASK];
+	rec->seq = ring->head;
+	strscpy(rec->buff, msg->buff, sizeof(rec->buff));
+	ring->head++;
+	spin_unlock_irqrestore(&ring->lock, flags);
+}
+
+/**
+ * amc_log_slot_addr() - Get the address of a shared memory log slot.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ * @idx: Slot index.
+ *
+ * Return: Slot address.
+ */
+static void *amc_log_slot_addr(struct amc_control_ctxt *amc_ctrl_ctxt, uint32_t idx)
+{
+	return (void *)((uintptr_t)amc_ctrl_ctxt->gcq_payload_base_virt_addr +
+		amc_ctrl_ctxt->amc_shared_mem.log_msg.log_msg_buf_off +
+		(idx * sizeof(struct amc_msg_payload)));
+}
+
+/**
+ * amc_log_lapped() - Check if the AMC lapped the driver since the last pass.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ *
+ * The shared memory is never written by the host. The write index alone
+ * cannot tell `n` new messages from `n + AMC_LOG_MAX_RECS`, but the slot
+ * just before the last index we consumed is only rewritten once the AMC
+ * has gone all the way round. If it no longer matches our copy, at least
+ * one lap was lost. Identical messages in that slot go unnoticed, so this
+ * is a lower bound.
+ *
+ * Return: true if a lap was detected.
+ */
+static bool amc_log_lapped(struct amc_control_ctxt *amc_ctrl_ctxt)
+{
+	struct amc_log_ring *ring = amc_ctrl_ctxt->log_ring;
+	struct amc_msg_payload slot = { 0 };
+	uint32_t idx = 0;
+
+	if (!ring->last_slot_valid)
+		return false;
+
+	idx = (amc_ctrl_ctxt->last_printed_msg_index + AMC_LOG_MAX_RECS - 1) % AMC_LOG_MAX_RECS;
+	memcpy_fromio(&slot, amc_log_slot_addr(amc_ctrl_ctxt, idx), sizeof(slot));
+
+	return memcmp(&slot, &ring->last_slot, sizeof(slot)) != 0;
+}
+
+/**
+ * amc_log_open() - Open callback for the `amc_log` debugfs file.
+ * @inode: Inode (private data is the AMC context).
+ * @filp: File pointer.
+ *
+ * Each reader starts at the oldest record still held in the ring and takes
+ * a reference to it, as the file may outlive the device.
+ *
+ * Return: 0 or negative error code.
+ */
+static int amc_log_open(struct inode *inode, struct file *filp)
+{
+	struct amc_control_ctxt *amc_ctrl_ctxt = inode->i_private;
+	struct amc_log_ring *ring = amc_ctrl_ctxt->log_ring;
+	struct amc_log_reader *reader = NULL;
+	unsigned long flags = 0;
+
+	if (READ_ONCE(ring->shutdown))
+		return -ENODEV;
+
+	reader = kzalloc(sizeof(*reader), GFP_KERNEL);
+	if (!reader)
+		return -ENOMEM;
+
+	spin_lock_irqsave(&ring->lock, flags);
+	if (ring->head > AMC_LOG_RING_RECS)
+		reader->next_seq = ring->head - AMC_LOG_RING_RECS;
+	spin_unlock_irqrestore(&ring->lock, flags);
+
+	kref_get(&ring->ref);
+	reader->ring = ring;
+	filp->private_data = reader;
+	atomic_inc(&ring->readers);
+	return nonseekable_open(inode, filp);
+}
+
+/**
+ * amc_log_release() - Release callback for the `amc_log` debugfs file.
+ * @inode: Inode (private data may already be freed).
+ * @filp: File pointer.
+ *
+ * debugfs calls this even after the file has been removed, so only the
+ * reader's own reference to the ring is used.
+ *
+ * Return: 0
+ */
+static int amc_log_release(struct inode *inode, struct file *filp)
+{
+	struct amc_log_reader *reader = filp->private_data;
+
+	atomic_dec(&reader->ring->readers);
+	kref_put(&reader->ring->ref, free_amc_log_ring);
+	kfree(reader);
+	return 0;
+}
+
+/**
+ * amc_log_read() - Read callback for the `amc_log` debugfs file.
+ * @filp: File pointer.
+ * @buf: User buffer.
+ * @count: Size of user buffer.
+ * @ppos: Unused (stream file).
+ *
+ * Copies out as many whole lines as fit in @buf. Blocks until a record is
+ * available unless the file was opened with O_NONBLOCK. Once the device is
+ * shutting down, reads return end of file.
+ *
+ * Return: Number of bytes read or negative error code.
+ */
+static ssize_t amc_log_read(struct file *filp, char __user *buf, size_t count, loff_t *ppos)
+{
+	struct amc_log_reader *reader = filp->private_data;
+	struct amc_log_ring *ring = reader->ring;
+	uint64_t *next_seq = &reader->next_seq;
+	char line[AMC_LOG_LINE_MAX] = { 0 };
+	unsigned long flags = 0;
+	ssize_t copied = 0;
+	int len = 0;
+	int ret = 0;
+
+	if (count < AMC_LOG_LINE_MAX)
+		return -EINVAL;
+
+	if (READ_ONCE(ring->head) == *next_seq) {
+		if (READ_ONCE(ring->shutdown))
+			return 0;
+
+		if (filp->f_flags & O_NONBLOCK)
+			return -EAGAIN;
+
+		ret = wait_event_interruptible(
+			ring->wq,
+			(READ_ONCE(ring->head) != *next_seq) || READ_ONCE(ring->shutdown)
+		);
+		if (ret)
+			return ret;
+
+		if (READ_ONCE(ring->shutdown))
+			return 0;
+	}
+
+	while (count - copied >= AMC_LOG_LINE_MAX) {
+		struct amc_log_record *rec = NULL;
+
+		spin_lock_irqsave(&ring->lock, flags);
+		if (*next_seq == ring->head) {
+			spin_unlock_irqrestore(&ring->lock, flags);
+			break;
+		}
+
+		/* Reader fell behind - skip to the oldest record still held */
+		if (ring->head - *next_seq > AMC_LOG_RING_RECS) {
+			ring->reader_dropped += ring->head - AMC_LOG_RING_RECS - *next_seq;
+			*next_seq = ring->head - AMC_LOG_RING_RECS;
+		}
+
+		rec = &ring->recs[*next_seq & AMC_LOG_RING_MASK];
+		len = scnprintf(line, sizeof(line), "%llu %s\n", rec->seq, rec->buff);
+		spin_unlock_irqrestore(&ring->lock, flags);
+
+		if (copy_to_user(buf + copied, line, len))
+			return copied ? copied : -EFAULT;
+
+		copied += len;
+		(*next_seq)++;
+	}
+
+	return copied;
+}
+
+/**
+ * amc_log_poll() - Poll callback for the `amc_log` debugfs file.
+ * @filp: File pointer.
+ * @wait: Poll table.
+ *
+ * Return: EPOLLIN when a record is available, EPOLLHUP on shutdown.
+ */
+static __poll_t amc_log_poll(struct file *filp, poll_table *wait)
+{
+	struct amc_log_reader *reader = filp->private_data;
+	struct amc_log_ring *ring = reader->ring;
+	uint64_t *next_seq = &reader->next_seq;
+
+	poll_wait(filp, &ring->wq, wait);
+
+	if (READ_ONCE(ring->shutdown))
+		return EPOLLHUP;
+
+	if (READ_ONCE(ring->head) != *next_seq)
+		return EPOLLIN | EPOLLRDNORM;
+
+	return 0;
+}
+
+static const struct file_operations amc_log_fops = {
+	.owner   = THIS_MODULE,
+	.open    = amc_log_open,
+	.release = amc_log_release,
+	.read    = amc_log_read,
+	.poll    = amc_log_poll,
+};
+
+/**
+ * amc_log_stats_show() - Show callback for the `amc_log_stats` debugfs file.
+ * @m: Seq file.
+ * @unused: Unused.
+ *
+ * Return: 0
+ */
+static int amc_log_stats_show(struct seq_file *m, void *unused)
+{
+	struct amc_control_ctxt *amc_ctrl_ctxt = m->private;
+	struct amc_log_ring *ring = amc_ctrl_ctxt->log_ring;
+	unsigned long flags = 0;
+	uint64_t head = 0;
+	uint64_t amc_dropped = 0;
+	uint64_t reader_dropped = 0;
+
+	spin_lock_irqsave(&ring->lock, flags);
+	head = ring->head;
+	amc_dropped = ring->amc_dropped;
+	reader_dropped = ring->reader_dropped;
+	spin_unlock_irqrestore(&ring->lock, flags);
+
+	seq_printf(m, "head_seq: %llu\n", head);
+	seq_printf(m, "ring_size: %u\n", AMC_LOG_RING_RECS);
+	seq_printf(m, "amc_dropped: %llu\n", amc_dropped);
+	seq_printf(m, "reader_dropped: %llu\n", reader_dropped);
+	seq_printf(m, "readers: %d\n", atomic_read(&ring->readers));
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(amc_log_stats);
+
+
 /*****************************************************************************/
 /* Public functions                                                          */
 /*****************************************************************************/
 
 /*
- * Handles and prints incoming AMC logs
+ * Allocate the host log ring.
+ */
+int create_amc_log_ring(struct amc_control_ctxt *amc_ctrl_ctxt)
+{
+	struct amc_log_ring *ring = NULL;
+
+	if (!amc_ctrl_ctxt)
+		return -EINVAL;
+
+	ring = kzalloc(sizeof(*ring), GFP_KERNEL);
+	if (!ring)
+		return -ENOMEM;
+
+	ring->recs = vzalloc(sizeof(struct amc_log_record) * AMC_LOG_RING_RECS);
+	if (!ring->recs) {
+		kfree(ring);
+		return -ENOMEM;
+	}
+
+	spin_lock_init(&ring->lock);
+	init_waitqueue_head(&ring->wq);
+	atomic_set(&ring->readers, 0);
+	kref_init(&ring->ref);
+
+	amc_ctrl_ctxt->log_ring = ring;
+	return 0;
+}
+
+/*
+ * Drop the AMC context's reference to the host log ring.
+ */
+void destroy_amc_log_ring(struct amc_control_ctxt *amc_ctrl_ctxt)
+{
+	if (!amc_ctrl_ctxt || !amc_ctrl_ctxt->log_ring)
+		return;
+
+	kref_put(&amc_ctrl_ctxt->log_ring->ref, free_amc_log_ring);
+	amc_ctrl_ctxt->log_ring = NULL;
+}
+
+/*
+ * Create the log debugfs files.
+ */
+void create_amc_log_debugfs(struct amc_control_ctxt *amc_ctrl_ctxt, struct dentry *parent)
+{
+	if (!amc_ctrl_ctxt || !amc_ctrl_ctxt->log_ring || IS_ERR_OR_NULL(parent))
+		return;
+
+	debugfs_create_file("amc_log", 0400, parent, amc_ctrl_ctxt, &amc_log_fops);
+	debugfs_create_file("amc_log_stats", 0400, parent, amc_ctrl_ctxt, &amc_log_stats_fops);
+}
+
+/*
+ * Wake up and stop all log readers.
+ */
+void shutdown_amc_log(struct amc_control_ctxt *amc_ctrl_ctxt)
+{
+	if (!amc_ctrl_ctxt || !amc_ctrl_ctxt->log_ring)
+		return;
+
+	WRITE_ONCE(amc_ctrl_ctxt->log_ring->shutdown, true);
+	wake_up_interruptible_all(&amc_ctrl_ctxt->log_ring->wq);
+}
+
+/*
+ * Check if any reader is streaming the log.
+ */
+bool amc_log_has_readers(struct amc_control_ctxt *amc_ctrl_ctxt)
+{
+	if (!amc_ctrl_ctxt || !amc_ctrl_ctxt->log_ring)
+		return false;
+
+	return atomic_read(&amc_ctrl_ctxt->log_ring->readers) > 0;
+}
+
+/*
+ * Handles incoming AMC logs
  */
 void dump_amc_log(struct amc_control_ctxt *amc_ctrl_ctxt)
 {
 	int i = 0;
 	uintptr_t msg_idx_addr = 0;
 	uint32_t current_log_idx = 0;
+	uint32_t dropped = 0;
+	bool collected = false;
+	unsigned long flags = 0;
 
-	if (!amc_ctrl_ctxt)
+	if (!amc_ctrl_ctxt || !amc_ctrl_ctxt->log_ring)
 		return;
 
 	msg_idx_addr = (uintptr_t)amc_ctrl_ctxt->gcq_payload_base_virt_addr +
@@ -45,24 +429,43 @@ void dump_amc_log(struct amc_control_ctxt *amc_ctrl_ctxt)
 		return;
 	}
 
+	/* Only trust the lap check if the AMC did not move while we looked */
+	if (amc_log_lapped(amc_ctrl_ctxt) &&
+	    (ioread32((void *)msg_idx_addr) == current_log_idx))
+		dropped = AMC_LOG_MAX_RECS;
+
 	i = amc_ctrl_ctxt->last_printed_msg_index;
 
 	while (i != current_log_idx) {
 		struct amc_msg_payload msg = { 0 };
 
-		/* Calculate the address of the log message for the current index */
-		uintptr_t log_msg_addr = (uintptr_t)amc_ctrl_ctxt->gcq_payload_base_virt_addr +
-			amc_ctrl_ctxt->amc_shared_mem.log_msg.log_msg_buf_off + (i * sizeof(struct amc_msg_payload));
+		memcpy_fromio(&msg, amc_log_slot_addr(amc_ctrl_ctxt, i), sizeof(struct amc_msg_payload));
 
-		memcpy_fromio(&msg, (void*)log_msg_addr, sizeof(struct amc_msg_payload));
+		if(strnchr(msg.buff, sizeof(struct amc_msg_payload), '\0') && strlen(msg.buff)) {
+			push_log_record(amc_ctrl_ctxt->log_ring, &msg);
+			collected = true;
 
-		if(strnchr(msg.buff, sizeof(struct amc_msg_payload), '\0') && strlen(msg.buff))
-			AMI_AMC_LOG(amc_ctrl_ctxt, "%s", msg.buff);
+			if (amc_log_dmesg_enabled)
+				AMI_AMC_LOG(amc_ctrl_ctxt, "%s", msg.buff);
+		}
+
+		/* Remember the raw slot for the next lap check */
+		amc_ctrl_ctxt->log_ring->last_slot = msg;
+		amc_ctrl_ctxt->log_ring->last_slot_valid = true;
 
 		i = (i + 1) % AMC_LOG_MAX_RECS;
 	}
 
 	amc_ctrl_ctxt->last_printed_msg_index = current_log_idx;
 
+	if (dropped) {
+		spin_lock_irqsave(&amc_ctrl_ctxt->log_ring->lock, flags);
+		amc_ctrl_ctxt->log_ring->amc_dropped += dropped;
+		spin_unlock_irqrestore(&amc_ctrl_ctxt->log_ring->lock, flags);
+	}
+
+	if (collected)
+		wake_up_interruptible(&amc_ctrl_ctxt->log_ring->wq);
+
 	return;
 }
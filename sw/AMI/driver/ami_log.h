@@ -1,18 +1,28 @@
 // SPDX-License-Identifier: GPL-2.0-only
 /*
  * ami_log.h - This file contains functions to read AMC shared memory logs.
- * 
+ *
  * Copyright (c) 2023-present Advanced Micro Devices, Inc. All rights reserved.
  */
- 
+
 #ifndef AMI_LOG_H
 #define AMI_LOG_H
 
+#include <linux/types.h>
+#include <linux/spinlock.h>
+#include <linux/wait.h>
+#include <linux/atomic.h>
+#include <linux/kref.h>
+#include <linux/debugfs.h>
+
 #include "ami_amc_control.h"
 
 #define AMC_LOG_ENTRY_SIZE   (96)
 #define AMC_LOG_MAX_RECS     (50)
 
+/* Host side ring - must be a power of two */
+#define AMC_LOG_RING_RECS    (1024)
+
 /**
  * struct amc_msg_payload - AMC log message format.
  * @buff:		message buffer.
@@ -22,8 +32,101 @@ struct amc_msg_payload {
 };
 
 /**
- * dump_amc_log() - Prints incoming AMC logs.
+ * struct amc_log_record - A log message held in the host ring.
+ * @seq: Sequence number, assigned by the driver when the message is collected.
+ * @buff: Message text (always NULL terminated).
+ */
+struct amc_log_record {
+	uint64_t seq;
+	char     buff[AMC_LOG_ENTRY_SIZE];
+};
+
+/**
+ * struct amc_log_ring - Host copy of the AMC log.
+ * @recs: Ring of AMC_LOG_RING_RECS records.
+ * @head: Sequence number of the next record to be written.
+ * @amc_dropped: Messages overwritten in shared memory before the driver
+ *   collected them (a lower bound - each detected lap of the AMC ring counts
+ *   as AMC_LOG_MAX_RECS messages).
+ * @reader_dropped: Messages overwritten in the host ring before a reader
+ *   consumed them.
+ * @readers: Number of open readers.
+ * @lock: Protects the fields above.
+ * @wq: Readers wait here for new records.
+ * @shutdown: Set when the device is going away - readers stop blocking.
+ * @last_slot: Copy of the last shared memory slot the driver consumed.
+ * @last_slot_valid: Whether @last_slot holds anything yet.
+ * @ref: Held by the AMC context and by each open reader.
+ *
+ * @last_slot and @last_slot_valid are only used by the logging thread. An
+ * `amc_log` file may be released after the device is gone, so readers keep
+ * their own reference and never go through the AMC context.
+ */
+struct amc_log_ring {
+	struct amc_log_record *recs;
+	uint64_t               head;
+	uint64_t               amc_dropped;
+	uint64_t               reader_dropped;
+	atomic_t               readers;
+	spinlock_t             lock;
+	wait_queue_head_t      wq;
+	bool                   shutdown;
+	struct amc_msg_payload last_slot;
+	bool                   last_slot_valid;
+	struct kref            ref;
+};
+
+/**
+ * create_amc_log_ring() - Allocate the host log ring.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ *
+ * Return: 0 or negative error code.
+ */
+int create_amc_log_ring(struct amc_control_ctxt *amc_ctrl_ctxt);
+
+/**
+ * destroy_amc_log_ring() - Drop the AMC context's reference to the log ring.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ *
+ * Must only be called once the logging thread and debugfs files are gone.
+ * The ring is freed when the last open reader releases it.
+ */
+void destroy_amc_log_ring(struct amc_control_ctxt *amc_ctrl_ctxt);
+
+/**
+ * create_amc_log_debugfs() - Create the `amc_log` and `amc_log_stats` files.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ * @parent: Per-device debugfs directory.
+ *
+ * `amc_log` streams one "<seq> <message>" line per record and supports
+ * poll(); a gap in sequence numbers means messages were dropped.
+ * The files are removed along with @parent.
+ */
+void create_amc_log_debugfs(struct amc_control_ctxt *amc_ctrl_ctxt, struct dentry *parent);
+
+/**
+ * shutdown_amc_log() - Wake up and stop all `amc_log` readers.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ *
+ * Blocked readers return and further reads report end of file. Must be
+ * called before the debugfs files are removed, as removal waits for any
+ * read in progress.
+ */
+void shutdown_amc_log(struct amc_control_ctxt *amc_ctrl_ctxt);
+
+/**
+ * amc_log_has_readers() - Check if anyone is streaming the log.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ *
+ * Return: true if at least one `amc_log` reader is open.
+ */
+bool amc_log_has_readers(struct amc_control_ctxt *amc_ctrl_ctxt);
+
+/**
+ * dump_amc_log() - Collects incoming AMC logs into the host ring.
  * @param amc_ctrl_ctxt Pointer to top level AMC data struct.
+ *
+ * Messages are only forwarded to dmesg when `amc_log_dmesg` is enabled.
  */
 void dump_amc_log(struct amc_control_ctxt *amc_ctrl_ctxt);
 
@@ -12,6 +12,7 @@
 #include "ami_top.h"
 #include "ami_module.h"
 #include "ami_amc_control.h"
+#include "ami_cdev.h"
 
 /*
  * Read one or more values from a QSFP module.
@@ -74,3 +75,55 @@ int module_write(struct amc_control_ctxt *amc_ctrl_ctxt, uint8_t device_id,
 
 	return ret;
 }
+
+/*
+ * Read from one or more QSFP modules in a single request.
+ */
+int module_read_sg(struct amc_control_ctxt *amc_ctrl_ctxt, uint16_t num_entries,
+	uint8_t *buf, uint32_t buf_len)
+{
+	int ret = SUCCESS;
+	struct ami_ioc_module_sg_entry *entries = (struct ami_ioc_module_sg_entry*)buf;
+	uint32_t required = 0;
+	int i = 0;
+
+	if (!amc_ctrl_ctxt || !buf || (num_entries == 0) ||
+	    (num_entries > MODULE_SG_MAX_ENTRIES))
+		return -EINVAL;
+
+	required = num_entries * sizeof(struct ami_ioc_module_sg_entry);
+	if (buf_len < required)
+		return -EINVAL;
+
+	for (i = 0; i < num_entries; i++) {
+		if ((entries[i].len == 0) ||
+		    ((entries[i].offset + entries[i].len) > MODULE_PAGE_SIZE))
+			return -EINVAL;
+
+		entries[i].result = 0;
+		entries[i].resvd = 0;
+		required += entries[i].len;
+	}
+
+	if (buf_len < required)
+		return -EINVAL;
+
+	AMI_VDBG(
+		amc_ctrl_ctxt,
+		"Attempting scatter-gather module read of %d entries (%d bytes)",
+		num_entries, required
+	);
+
+	ret = submit_gcq_command(
+		amc_ctrl_ctxt,
+		GCQ_SUBMIT_CMD_MODULE_SG_READ,
+		num_entries,
+		buf,
+		required
+	);
+
+	if (ret)
+		AMI_ERR(amc_ctrl_ctxt, "Failed scatter-gather module read");
+
+	return ret;
+}
@@ -30,6 +30,9 @@
 #define MODULE_RW_PAGE(flags)			((uint8_t)((flags & 0x0000ff00) >> 8))
 #define MODULE_RW_OFFSET(flags)			((uint8_t)(flags & 0x000000ff))
 
+#define MODULE_SG_MAX_ENTRIES			(64)
+#define MODULE_PAGE_SIZE			(256)
+
 
 /**
  * module_read() - Read one or more values from a QSFP module.
@@ -59,4 +62,20 @@ int module_read(struct amc_control_ctxt *amc_ctrl_ctxt, uint8_t device_id,
 int module_write(struct amc_control_ctxt *amc_ctrl_ctxt, uint8_t device_id,
 	uint8_t page, uint8_t offset, uint8_t *buf, uint8_t buf_len);
 
+/**
+ * module_read_sg() - Read from one or more QSFP modules in a single request.
+ * @amc_ctrl_ctxt: Pointer to top level AMC data struct.
+ * @num_entries: Number of descriptors at the start of `buf`.
+ * @buf: Descriptor list (struct ami_ioc_module_sg_entry) followed by space
+ *     for the data of each entry, packed in descriptor order.
+ * @buf_len: Total size of `buf`.
+ *
+ * The whole buffer is sent to the AMC as one GCQ command; on return each
+ * descriptor holds its result code and the data area holds the bytes read.
+ * 
+ * Return: 0 or negative error code.
+ */
+int module_read_sg(struct amc_control_ctxt *amc_ctrl_ctxt, uint16_t num_entries,
+	uint8_t *buf, uint32_t buf_len);
+
 #endif  /* AMI_MODULE_H */
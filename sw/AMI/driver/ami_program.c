@@ -205,12 +205,15 @@ int update_fpt(struct pf_dev_struct *pf_dev, uint8_t *buf, uint32_t size,
 	uint8_t boot_device, struct eventfd_ctx *efd_ctx)
 {
 	int ret = 0;
+	struct amc_control_ctxt *amc_ctrl_ctxt = NULL;
 
 	if (!pf_dev || !size || !buf)
 		return -EINVAL;
 
+	amc_ctrl_ctxt = pf_dev_amc_ctxt(pf_dev);
+
 	ret = do_image_download(
-		pf_dev->amc_ctrl_ctxt,
+		amc_ctrl_ctxt,
 		buf,
 		size,
 		boot_device,
@@ -224,12 +227,12 @@ int update_fpt(struct pf_dev_struct *pf_dev, uint8_t *buf, uint32_t size,
 
 		if (ret)
 			AMI_ERR(
-				pf_dev->amc_ctrl_ctxt,
+				amc_ctrl_ctxt,
 				"Could not update FPT SDR"
 			);
 		else
 			AMI_WARN(
-				pf_dev->amc_ctrl_ctxt,
+				amc_ctrl_ctxt,
 				"Updated FPT SDR"
 			);
 	}
@@ -243,18 +246,19 @@ int update_fpt(struct pf_dev_struct *pf_dev, uint8_t *buf, uint32_t size,
 int device_boot(struct pf_dev_struct *pf_dev, uint32_t partition)
 {
 	int ret = SUCCESS;
+	struct amc_control_ctxt *amc_ctrl_ctxt = pf_dev_amc_ctxt(pf_dev);
 
 	AMI_VDBG(
-		pf_dev->amc_ctrl_ctxt,
+		amc_ctrl_ctxt,
 		"Attempting to select device boot partition (%d)",
 		partition
 	);
 
-	ret = submit_gcq_command(pf_dev->amc_ctrl_ctxt, GCQ_SUBMIT_CMD_DEVICE_BOOT,
+	ret = submit_gcq_command(amc_ctrl_ctxt, GCQ_SUBMIT_CMD_DEVICE_BOOT,
 		partition, NULL, 0);
 
 	if (ret)
-		AMI_ERR(pf_dev->amc_ctrl_ctxt, "Failed to select boot partition");
+		AMI_ERR(amc_ctrl_ctxt, "Failed to select boot partition");
 
 	return ret;
 }
@@ -267,9 +271,10 @@ int copy_partition(struct pf_dev_struct *pf_dev, uint32_t src_device, uint32_t s
 	int ret = SUCCESS;
 	struct fpt_partition src_partition = { 0 };
 	struct fpt_partition dest_partition = { 0 };
+	struct amc_control_ctxt *amc_ctrl_ctxt = pf_dev_amc_ctxt(pf_dev);
 
 	AMI_VDBG(
-		pf_dev->amc_ctrl_ctxt,
+		amc_ctrl_ctxt,
 		"Attempting to copy from device %d partition %d to device %d partition %d",
 		src_device, src_part, dest_device, dest_part
 	);
@@ -281,13 +286,13 @@ int copy_partition(struct pf_dev_struct *pf_dev, uint32_t src_device, uint32_t s
 	/* Check that the partitions exist. */
 	if (read_fpt_partition(pf_dev, src_device, src_part, &src_partition) ||
 		read_fpt_partition(pf_dev, dest_device, dest_part, &dest_partition)) {
-			AMI_ERR(pf_dev->amc_ctrl_ctxt, "Partition not found");
+			AMI_ERR(amc_ctrl_ctxt, "Partition not found");
 			return -EINVAL;
 	}
 
 	/* Sanity check partition size */
 	if (dest_partition.partition_size < src_partition.partition_size) {
-		AMI_ERR(pf_dev->amc_ctrl_ctxt, "Destination partition is too small for copy");
+		AMI_ERR(amc_ctrl_ctxt, "Destination partition is too small for copy");
 		return -EINVAL;
 	}
 
@@ -295,11 +300,11 @@ int copy_partition(struct pf_dev_struct *pf_dev, uint32_t src_device, uint32_t s
 	 * Using `flags` to pass in source and destination partitions.
 	 * No data buffer is given and length is set to the size of the source partition.
 	 */
-	ret = submit_gcq_command(pf_dev->amc_ctrl_ctxt, GCQ_SUBMIT_CMD_COPY_PARTITION,
+	ret = submit_gcq_command(amc_ctrl_ctxt, GCQ_SUBMIT_CMD_COPY_PARTITION,
 		MK_PARTITION_FLAGS(src_device, src_part, dest_device, dest_part), NULL, src_partition.partition_size);
 
 	if (ret)
-		AMI_ERR(pf_dev->amc_ctrl_ctxt, "Failed to copy partition");
+		AMI_ERR(amc_ctrl_ctxt, "Failed to copy partition");
 
 	return ret;
 }
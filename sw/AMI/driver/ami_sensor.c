@@ -633,7 +633,7 @@ int discover_sensors(struct pf_dev_struct *pf_dev, int *empty_sdr_count)
 		return -ENOMEM;
 
 	for (i = 0; i < NUM_SENSOR_REPOS; i++) {
-		ret = get_sdr(pf_dev->amc_ctrl_ctxt, discovery_repos[i], &(pf_dev->sensor_repos[i]));
+		ret = get_sdr(pf_dev_amc_ctxt(pf_dev), discovery_repos[i], &(pf_dev->sensor_repos[i]));
 
 		if (ret == -ENODATA) {
 			*empty_sdr_count = *empty_sdr_count + 1;
@@ -736,7 +736,7 @@ int update_sdr(struct pf_dev_struct *pf_dev, enum gcq_sdr_repo_type repo_type)
 	if (!new_repo)
 		return -ENOMEM;
 
-	ret = get_sdr(pf_dev->amc_ctrl_ctxt, repo_type, new_repo);
+	ret = get_sdr(pf_dev_amc_ctxt(pf_dev), repo_type, new_repo);
 
 	if (!ret) {
 		delete_repo_records(pf_dev, repo);
@@ -1026,7 +1026,7 @@ static int read_sensors(struct pf_dev_struct	*pf_dev,
 			*fresh = true;
 
 		return get_all_sensors(
-			pf_dev->amc_ctrl_ctxt,
+			pf_dev_amc_ctxt(pf_dev),
 			gcq_cmd,
 			repo
 		);
@@ -342,6 +342,7 @@ static ssize_t amc_version_show(struct device		*dev,
 {
 	int ret = 0;
 	struct pf_dev_struct *pf_dev = NULL;
+	struct amc_control_ctxt *amc_ctrl_ctxt = NULL;
 
 	if (!dev || !da || !buf)
 		return -EINVAL;
@@ -349,16 +350,18 @@ static ssize_t amc_version_show(struct device		*dev,
 	pf_dev = get_pf_dev_entry(dev, PF_DEV_CACHE_DEV);
 
 	if (pf_dev) {
-		if (pf_dev->amc_ctrl_ctxt) {
+		amc_ctrl_ctxt = pf_dev_amc_ctxt(pf_dev);
+
+		if (amc_ctrl_ctxt) {
 			/* Format is MAJOR.MINOR.PATCH +COMMITS *CHANGES */
 			ret = sprintf(
 				buf,
 				"%hhd.%hhd.%hhd +%hd *%hhd\n",
-				pf_dev->amc_ctrl_ctxt->version.ver_major,
-				pf_dev->amc_ctrl_ctxt->version.ver_minor,
-				pf_dev->amc_ctrl_ctxt->version.ver_patch,
-				pf_dev->amc_ctrl_ctxt->version.dev_commits,
-				pf_dev->amc_ctrl_ctxt->version.local_changes
+				amc_ctrl_ctxt->version.ver_major,
+				amc_ctrl_ctxt->version.ver_minor,
+				amc_ctrl_ctxt->version.ver_patch,
+				amc_ctrl_ctxt->version.dev_commits,
+				amc_ctrl_ctxt->version.local_changes
 			);
 		}
 		put_pf_dev_entry(pf_dev);
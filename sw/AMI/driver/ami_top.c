@@ -24,6 +24,8 @@
 #include <linux/delay.h>
 #include <linux/kthread.h>
 #include <linux/sched/signal.h>
+#include <linux/debugfs.h>
+#include <linux/workqueue.h>
 
 #include "ami.h"
 #include "ami_top.h"
@@ -35,6 +37,8 @@
 #include "ami_pcie.h"
 #include "ami_vsec.h"
 #include "ami_amc_control.h"
+#include "ami_log.h"
+#include "ami_gcq_stats.h"
 #include "ami_driver_version.h"
 
 /* RHEL fix */
@@ -51,6 +55,8 @@ static FW_IF_GCQ_INIT_CFG fw_if_gcq_init_cfg = { 0 };
 
 /* Declared as extern in ami.h */
 bool ami_debug_enabled = true;
+bool amc_log_dmesg_enabled = false;
+struct dentry *ami_debugfs_root = NULL;
 
 /*
  * We need a global device mutex to fetch/delete device handles in situations
@@ -124,7 +130,8 @@ static void amc_event_cb(enum amc_event_id id, void *data)
 		struct pci_dev *dev = NULL;
 		struct pf_dev_struct *pf_dev = NULL;
 
-		PR_ERR("AMC Heartbeat fatal event received, stopping GCQ...");
+		/* The heartbeat thread has already halted the GCQ. */
+		PR_ERR("AMC Heartbeat fatal event received, GCQ stopped");
 
 		if (!data) {
 			PR_ERR("AMC Heartbeat callback received invalid data!");
@@ -135,9 +142,8 @@ static void amc_event_cb(enum amc_event_id id, void *data)
 			if (!pf_dev) {
 				PR_ERR("AMC Heartbeat callback cannot recover!");
 			} else {
-				stop_gcq_services(pf_dev->amc_ctrl_ctxt);
 				/* Overwrite the device state */
-				pf_dev->state = PF_DEV_STATE_NO_AMC;
+				WRITE_ONCE(pf_dev->state, PF_DEV_STATE_NO_AMC);
 			}
 		}
 	}
@@ -175,18 +181,111 @@ static struct pci_driver pcie_driver_core = {
 	.remove		= pcie_device_remove,
 };
 
+/**
+ * init_pf_dev_services() - Start all AMC dependent device services.
+ * @work: Work item embedded in the device data struct.
+ *
+ * This is queued by the probe callback so that waiting for the AMC does not
+ * block the probe of other devices. The device state is only moved out of
+ * PF_DEV_STATE_INIT once all services have been started; any failure here is
+ * reflected in the device state rather than failing the probe.
+ *
+ * Return: None.
+ */
+static void init_pf_dev_services(struct work_struct *work)
+{
+	int ret = SUCCESS;
+	int empty_sdr_count = 0;
+	struct pf_dev_struct *pf_dev = NULL;
+	struct amc_control_ctxt *amc_ctrl_ctxt = NULL;
+	enum pf_dev_state state = PF_DEV_STATE_INIT;
+	struct pci_dev *dev = NULL;
+
+	if (!work)
+		return;
+
+	pf_dev = container_of(work, struct pf_dev_struct, init_work);
+	dev = pf_dev->pci;
+
+	/* AMC Setup */
+	/*
+	 * If this fails, simply leave the context as NULL and continue
+	 * with the remaining services as normal.
+	 */
+	ret = setup_amc(dev,
+			&amc_ctrl_ctxt,
+			pf_dev->endpoints->gcq,
+			pf_dev->endpoints->gcq_payload,
+			amc_event_cb,
+			(void*)dev);
+	if (ret) {
+		amc_ctrl_ctxt = NULL;
+		state = PF_DEV_STATE_NO_AMC;
+	} else {
+		if (amc_ctrl_ctxt->compat_mode)
+			state = PF_DEV_STATE_COMPAT;
+
+		/*
+		 * Only publish the context once it is fully set up. Readers on
+		 * other CPUs use `pf_dev_amc_ctxt`, which pairs with this.
+		 */
+		smp_store_release(&pf_dev->amc_ctrl_ctxt, amc_ctrl_ctxt);
+	}
+
+	/*
+	 * Attempt sensor discovery only if AMC was initialised correctly.
+	 * COMPAT MODE: No sensor data and no hwmon entries.
+	 */
+	if ((pf_dev->pcie_function_num == 0) && amc_ctrl_ctxt &&
+	    !(amc_ctrl_ctxt->compat_mode)) {
+		/* We don't bail out if the sensor discover or hwmon init fail -
+		 * the user should still be able to access the device regardless.
+		 * NOTE: Both, the sensor data and hwmon data use managed
+		 * memory so no cleanup is necessary.
+		 */
+		if (!discover_sensors(pf_dev, &empty_sdr_count)) {
+			ret = register_hwmon(&dev->dev, pf_dev);
+			if (ret) {
+				DEV_ERR(dev, "Failed to register hwmon device");
+				state = PF_DEV_STATE_INIT_ERROR;
+			}
+		} else {
+			state = PF_DEV_STATE_INIT_ERROR;
+		}
+	}
+
+	if (pf_dev->debugfs_dir && amc_ctrl_ctxt) {
+		create_amc_log_debugfs(amc_ctrl_ctxt, pf_dev->debugfs_dir);
+		create_gcq_latency_debugfs(amc_ctrl_ctxt, pf_dev->debugfs_dir);
+		create_amc_task_profile_debugfs(amc_ctrl_ctxt, pf_dev->debugfs_dir);
+	}
+
+	if (state == PF_DEV_STATE_INIT) {
+		if (empty_sdr_count)
+			state = PF_DEV_STATE_MISSING_INFO;
+		else
+			state = PF_DEV_STATE_READY;
+	}
+
+	/* A fatal heartbeat event may already have overwritten the state. */
+	cmpxchg(&pf_dev->state, PF_DEV_STATE_INIT, state);
+
+	DEV_VDBG(dev, "Finished starting device services: 0x%X", dev->device);
+}
+
 /**
  * create_pf_dev_data() - Create a pf_dev struct and initialize all services.
  * @dev: Parent PCI device struct.
  *
- * This function should only be called from the probe callback.
+ * This function should only be called from the probe callback. Only the
+ * PCIe configuration, sysfs and character device are set up here; the AMC
+ * dependent services are started asynchronously by `init_pf_dev_services`.
  *
  * Return: 0 or negative error code.
  */
 static int create_pf_dev_data(struct pci_dev *dev)
 {
 	int ret = SUCCESS;
-	int empty_sdr_count = 0;
 	struct pf_dev_struct *pf_dev = NULL;
 
 	if (!dev)
@@ -215,6 +314,7 @@ static int create_pf_dev_data(struct pci_dev *dev)
 	mutex_init(&pf_dev->app_lock);
 	kref_init(&pf_dev->refcount);
 	INIT_LIST_HEAD(&pf_dev->apps);
+	INIT_WORK(&pf_dev->init_work, init_pf_dev_services);
 
 	sprintf(pf_dev->bdf_str,
 		"%02x:%02x.%1x",
@@ -248,46 +348,6 @@ static int create_pf_dev_data(struct pci_dev *dev)
 		goto delete_data;
 	}
 
-	/* AMC Setup */
-	/*
-	 * If this fails, simply set the context to NULL and try to
-	 * continue with the probe function as normal.
-	 */
-	ret = setup_amc(dev,
-			&pf_dev->amc_ctrl_ctxt,
-			pf_dev->endpoints->gcq,
-			pf_dev->endpoints->gcq_payload,
-			amc_event_cb,
-			(void*)dev);
-	if (ret) {
-		pf_dev->amc_ctrl_ctxt = NULL;
-		pf_dev->state = PF_DEV_STATE_NO_AMC;
-	} else {
-		if (pf_dev->amc_ctrl_ctxt->compat_mode)
-			pf_dev->state = PF_DEV_STATE_COMPAT;
-	}
-
-	/*
-	 * Attempt sensor discovery only if AMC was initialised correctly.
-	 * COMPAT MODE: No sensor data and no hwmon entries.
-	 */
-	if ((pf_dev->pcie_function_num == 0) && pf_dev->amc_ctrl_ctxt &&
-	    !(pf_dev->amc_ctrl_ctxt->compat_mode)) {
-		/* We don't bail out if the sensor discover fails - the user
-		 * should still be able to access the device regardless. We do
-		 * bail out, however, if the hwmon init fails as this should not
-		 * happen. NOTE: Both, the sensor data and hwmon data use managed
-		 * memory so no cleanup is necessary.
-		 */
-		if (!discover_sensors(pf_dev, &empty_sdr_count)) {
-			ret = register_hwmon(&dev->dev, pf_dev);
-			if (ret)
-				goto remove_pf_dev;
-		} else {
-			pf_dev->state = PF_DEV_STATE_INIT_ERROR;
-		}
-	}
-
 	/*
 	 * Create extra sysfs attributes.
 	 * COMPAT MODE: sysfs allowed.
@@ -295,7 +355,7 @@ static int create_pf_dev_data(struct pci_dev *dev)
 
 	ret = register_sysfs(&dev->dev);
 	if (ret)
-		goto remove_pf_dev;
+		goto delete_data;
 
 	/*
 	 * Create character device.
@@ -312,12 +372,16 @@ static int create_pf_dev_data(struct pci_dev *dev)
 
 	pf_dev_index++;
 
-	if (pf_dev->state == PF_DEV_STATE_INIT) {
-		if (empty_sdr_count)
-			pf_dev->state = PF_DEV_STATE_MISSING_INFO;
-		else
-			pf_dev->state = PF_DEV_STATE_READY;
-	}
+	/* Debugfs is best effort - failures are not fatal */
+	if (ami_debugfs_root)
+		pf_dev->debugfs_dir = debugfs_create_dir(pci_name(dev), ami_debugfs_root);
+
+	/*
+	 * The AMC may take a while to come up, so everything that depends on it
+	 * is deferred to a work item - this lets several cards probe in parallel.
+	 * The device stays in the INIT state until the work item has finished.
+	 */
+	queue_work(system_unbound_wq, &pf_dev->init_work);
 
 	DEV_VDBG(dev, "Successfully probed device: 0x%X", dev->device);
 	pf_dev->enabled = true;  /* This is safe if we are called from the probe callback. */
@@ -326,14 +390,6 @@ static int create_pf_dev_data(struct pci_dev *dev)
 delete_sysfs:
 	remove_sysfs(&dev->dev);
 
-remove_pf_dev:
-	pf_dev->cdev.count = 0;
-
-	if (pf_dev->amc_ctrl_ctxt) {
-		unset_amc(dev, &pf_dev->amc_ctrl_ctxt);
-		release_amc_mem(&pf_dev->amc_ctrl_ctxt);
-	}
-
 delete_data:
 	release_vsec_mem(&pf_dev->endpoints);
 	release_pcie_mem(&pf_dev->pcie_config);
@@ -401,6 +457,17 @@ void shutdown_pf_dev_services(struct pf_dev_struct *pf_dev)
 	if (!pf_dev || (pf_dev->state == PF_DEV_STATE_SHUTDOWN))
 		return;
 
+	/* Wait for the init work item if it is still starting services. */
+	cancel_work_sync(&pf_dev->init_work);
+
+	/*
+	 * Debugfs files reference the AMC context so must go first. Removal waits
+	 * for reads in progress, so wake up any blocked log reader beforehand.
+	 */
+	shutdown_amc_log(pf_dev->amc_ctrl_ctxt);
+	debugfs_remove_recursive(pf_dev->debugfs_dir);
+	pf_dev->debugfs_dir = NULL;
+
 	/* Shutdown AMC. */
 	if (pf_dev->amc_ctrl_ctxt) {
 		unset_amc(pf_dev->pci, &pf_dev->amc_ctrl_ctxt);
@@ -877,6 +944,45 @@ static ssize_t ami_debug_enabled_show(struct device_driver *drv, char *buf)
 }
 static DRIVER_ATTR_RW(ami_debug_enabled);
 
+/**
+ * amc_log_dmesg_store() - Sysfs write callback for 'amc_log_dmesg' attribute.
+ * @drv: Driver that this attribute belongs to.
+ * @buf: Input character buffer.
+ * @count: Number of bytes in input buffer.
+ *
+ * Return: Number of bytes used from the buffer.
+ */
+static ssize_t amc_log_dmesg_store(struct device_driver *drv, const char *buf, size_t count)
+{
+	bool set_output_status = false;
+
+	if (!drv || !buf)
+		return 0;
+
+	if (kstrtobool(buf, &set_output_status))
+		return -EINVAL;
+
+	amc_log_dmesg_enabled = set_output_status;
+
+	return count;
+}
+
+/**
+ * amc_log_dmesg_show() - Sysfs read callback for 'amc_log_dmesg' attribute.
+ * @drv: Driver that this attribute belongs to.
+ * @buf: Output character buffer.
+ *
+ * Return: Number of bytes written to output buffer.
+ */
+static ssize_t amc_log_dmesg_show(struct device_driver *drv, char *buf)
+{
+	if (!drv || !buf)
+		return 0;
+
+	return sprintf(buf, "%hhd\n", amc_log_dmesg_enabled);
+}
+static DRIVER_ATTR_RW(amc_log_dmesg);
+
 static int __init vmc_entry(void)
 {
 	int ret = 0;
@@ -888,6 +994,11 @@ static int __init vmc_entry(void)
 
 	PR_DBG("Loading driver to the kernel");
 
+	/* Debugfs is optional - devices will simply not expose any entries */
+	ami_debugfs_root = debugfs_create_dir(KBUILD_MODNAME, NULL);
+	if (IS_ERR(ami_debugfs_root))
+		ami_debugfs_root = NULL;
+
 	/* Register the device driver with the kernel */
 	ret = register_driver_kernel();
 	if (ret)
@@ -913,10 +1024,18 @@ static int __init vmc_entry(void)
 	if (ret)
 		goto remove_version_attr;
 
+	/* Create 'amc_log_dmesg' attribute */
+	ret = driver_create_file(&pcie_driver_core.driver, &driver_attr_amc_log_dmesg);
+	if (ret)
+		goto remove_debug_attr;
+
 	PR_INFO("Successfully loaded driver to the kernel");
 	ami_debug_enabled = false;
 	return SUCCESS;
 
+remove_debug_attr:
+	driver_remove_file(&pcie_driver_core.driver, &driver_attr_ami_debug_enabled);
+
 remove_version_attr:
 	driver_remove_file(&pcie_driver_core.driver, &driver_attr_version);
 
@@ -930,6 +1049,8 @@ static int __init vmc_entry(void)
 	unregister_driver_kernel();
 
 fail:
+	debugfs_remove_recursive(ami_debugfs_root);
+	ami_debugfs_root = NULL;
 	PR_ERR("Failed to load driver to the kernel");
 	return ret;
 }
@@ -948,11 +1069,15 @@ static void __exit vmc_exit(void)
 	driver_remove_file(&pcie_driver_core.driver, &driver_attr_devices);
 	driver_remove_file(&pcie_driver_core.driver, &driver_attr_version);
 	driver_remove_file(&pcie_driver_core.driver, &driver_attr_ami_debug_enabled);
+	driver_remove_file(&pcie_driver_core.driver, &driver_attr_amc_log_dmesg);
 
 	/* Unregister driver */
 	pci_unregister_driver(&pcie_driver_core);
 	unregister_driver_kernel();
 
+	debugfs_remove_recursive(ami_debugfs_root);
+	ami_debugfs_root = NULL;
+
 	PR_INFO("Successfully removed driver");
 }
 
@@ -13,6 +13,8 @@
 #include <linux/list.h>
 #include <linux/kref.h>
 #include <linux/semaphore.h>
+#include <linux/workqueue.h>
+#include <linux/atomic.h>
 
 #include "ami.h"
 #include "ami_vsec.h"
@@ -41,8 +43,9 @@
  * @PF_DEV_STATE_SHUTDOWN: All services have been shutdown.
  * @PF_DEV_STATE_COMPAT: Compatibility mode - most functions unavailable.
  * 
- * Note that, currently, PF_DEV_STATE_INIT is only used temporarily within
- * the device probe function so a user is unlikely to ever see this state.
+ * A device is in PF_DEV_STATE_INIT from the probe callback until the AMC
+ * dependent services have been started in the background. Requests which
+ * need those services will fail with -EAGAIN while in this state.
  */
 enum pf_dev_state {
 	PF_DEV_STATE_INIT = 0,
@@ -91,7 +94,8 @@ enum pf_dev_cache_type {
  * @pci: PCI device struct.
  * @pcie_config: PCI specific data
  * @endpoints: PCI endpoints (UUID, GCQ, etc...)
- * @amc_ctrl_ctxt: AMC data struct.
+ * @amc_ctrl_ctxt: AMC data struct. Published by the init work once it is
+ *   fully set up - read it with `pf_dev_amc_ctxt`.
  * @ioctl_sema: Semaphore used by the IOCTL handler.
  * @sensor_refresh: Sensor update interval in milliseconds.
  * @num_sensor_repos: Number of discovered sensor repos.
@@ -114,6 +118,8 @@ enum pf_dev_cache_type {
  * @remove_sema: Semaphore to allow blocking in the `pcie_device_remove`
  *   callback. This is initialised to 0; when the refcount reaches 0, the semaphore
  *   is incremented and all device data gets deleted. Do not use this directly.
+ * @debugfs_dir: Per-device debugfs directory.
+ * @init_work: Work item which starts the AMC dependent services after probe.
  */
 struct pf_dev_struct {
 	enum pf_dev_state           state;
@@ -137,8 +143,24 @@ struct pf_dev_struct {
 	bool                        enabled;
 	struct kref                 refcount;
 	struct semaphore            remove_sema;
+	struct dentry              *debugfs_dir;
+	struct work_struct          init_work;
 };
 
+/**
+ * pf_dev_amc_ctxt() - Get the AMC context of a device.
+ * @pf_dev: Device data struct.
+ *
+ * Pairs with the release store in the init work, so a non-NULL context is
+ * always seen fully set up.
+ *
+ * Return: The AMC context or NULL if it has not been set up.
+ */
+static inline struct amc_control_ctxt *pf_dev_amc_ctxt(struct pf_dev_struct *pf_dev)
+{
+	return smp_load_acquire(&pf_dev->amc_ctrl_ctxt);
+}
+
 /**
  * shutdown_pf_dev_services() - Shutdown all device services.
  * @pf_dev: Device data struct.
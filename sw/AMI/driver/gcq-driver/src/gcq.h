@@ -96,6 +96,32 @@ typedef uint32_t ( *GCQ_READ_MEM_32 )( uint64_t ullMemAddr );
 *******************************************************************************/
 typedef void ( *GCQ_WRITE_MEM_32 )( uint64_t ullMemAddr, uint32_t ulValue );
 
+/**
+ *
+ * @brief   Bound in function ptr for reading a block of memory
+ *
+ * @param   ullMemAddr is the 32-bit aligned memory address to be read
+ * @param   pucData is the buffer to populate
+ * @param   ulLen is the number of bytes to read, a multiple of 4
+ *
+ * @return  N/A
+ *
+*******************************************************************************/
+typedef void ( *GCQ_READ_MEM_BLOCK )( uint64_t ullMemAddr, uint8_t *pucData, uint32_t ulLen );
+
+/**
+ *
+ * @brief   Bound in function ptr for writing a block of memory
+ *
+ * @param   ullMemAddr is the 32-bit aligned memory address to be written
+ * @param   pucData is the buffer to write
+ * @param   ulLen is the number of bytes to write, a multiple of 4
+ *
+ * @return  N/A
+ *
+*******************************************************************************/
+typedef void ( *GCQ_WRITE_MEM_BLOCK )( uint64_t ullMemAddr, const uint8_t *pucData, uint32_t ulLen );
+
 
 /******************************************************************************/
 /* Structs                                                                    */
@@ -110,6 +136,8 @@ struct GCQ_INSTANCE_TYPE;
 /*
  * @struct GCQ_IO_ACCESS_TYPE
  * @brief  Bound in function pointers for memory & register access
+ * @note   The block functions are optional (NULL to use the 32-bit functions)
+ *         and are only used to copy slot data
  */
 typedef struct GCQ_IO_ACCESS_TYPE
 {
@@ -117,6 +145,8 @@ typedef struct GCQ_IO_ACCESS_TYPE
     GCQ_WRITE_REG_32    xGCQWriteReg32;
     GCQ_READ_MEM_32     xGCQReadMem32;
     GCQ_WRITE_MEM_32    xGCQWriteMem32;
+    GCQ_READ_MEM_BLOCK  xGCQReadMemBlock;
+    GCQ_WRITE_MEM_BLOCK xGCQWriteMemBlock;
 
 } GCQ_IO_ACCESS_TYPE;
 
@@ -304,6 +334,55 @@ GCQ_ERRORS_TYPE xGCQConsumeData( struct GCQ_INSTANCE_TYPE *pxGCQInstance, uint8_
  */
 GCQ_ERRORS_TYPE xGCQProduceData( struct GCQ_INSTANCE_TYPE *pxGCQInstance, uint8_t *pucData, uint32_t ulDataLen );
 
+/**
+ *
+ * @brief    Function to consume/read a batch of slots from the GCQ
+ *           Internally the function will:
+ *           - Check driver has been initilaised
+ *           - Check driver has attached to the consumer
+ *           - Read up to ulMaxSlots slots of data if available
+ *           - Publish the consumed pointer and clear the interrupt once
+ *
+ * @param    pxGCQInstance is the instance of the GCQ
+ * @param    pucData is the pointer to the data to be populated on receive,
+ *           slot N is stored at pucData + ( N * ulDataLen )
+ * @param    ulDataLen is the length of the data received per slot
+ * @param    ulMaxSlots is the maximum number of slots to consume
+ * @param    pulNumSlots is the number of slots actually consumed
+ *
+ * @return   See GCQ_ERRORS_TYPE for possible return values
+ *
+ */
+GCQ_ERRORS_TYPE xGCQConsumeDataBatch( struct GCQ_INSTANCE_TYPE *pxGCQInstance,
+                                      uint8_t *pucData,
+                                      uint32_t ulDataLen,
+                                      uint32_t ulMaxSlots,
+                                      uint32_t *pulNumSlots );
+
+/**
+ *
+ * @brief    Function to produce/send a batch of slots to the GCQ
+ *           Internally the function will:
+ *           - Check driver has been initilaised
+ *           - Write as many of the ulNumSlots slots as there is room for
+ *           - Publish the produced pointer and trigger the interrupt once
+ *
+ * @param    pxGCQInstance is the instance of the GCQ
+ * @param    pucData is the pointer to be data to be sent,
+ *           slot N is read from pucData + ( N * ulDataLen )
+ * @param    ulDataLen the length of the data being sent per slot
+ * @param    ulNumSlots is the number of slots to send
+ * @param    pulNumProduced is the number of slots actually sent
+ *
+ * @return   See GCQ_ERRORS_TYPE for possible return values
+ *
+ */
+GCQ_ERRORS_TYPE xGCQProduceDataBatch( struct GCQ_INSTANCE_TYPE *pxGCQInstance,
+                                      uint8_t *pucData,
+                                      uint32_t ulDataLen,
+                                      uint32_t ulNumSlots,
+                                      uint32_t *pulNumProduced );
+
 /**
  *
  * @brief    Gets version information from gcq_version.h